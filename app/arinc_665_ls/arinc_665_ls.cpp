@@ -23,6 +23,7 @@
 #include <arinc_665/utils/FilePrinter.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <helper/Dump.hpp>
 #include <helper/Exception.hpp>
@@ -122,6 +123,9 @@ int main( const int argc, char * argv[] )
     // directory to list
     std::filesystem::path directory;
 
+    // Trace File
+    std::filesystem::path traceFile;
+
     optionsDescription.add_options()
     (
       "help",
@@ -131,6 +135,11 @@ int main( const int argc, char * argv[] )
       "directory",
       boost::program_options::value( &directory )->required(),
       "start directory"
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -148,6 +157,8 @@ int main( const int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     std::cout << "List files in " << directory << "\n";
 
     list_files( directory );
@@ -12,6 +12,7 @@
 
 #include <arinc_665/utils/MediaSetValidator.hpp>
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <helper/Exception.hpp>
 
@@ -73,6 +74,9 @@ int main( int argc, char * argv[] )
 
     boost::program_options::options_description optionsDescription{ "ARINC 665 Media Set Validator Options" };
 
+    // Trace File
+    std::filesystem::path traceFile;
+
     optionsDescription.add_options()
     (
       "help",
@@ -85,6 +89,11 @@ int main( int argc, char * argv[] )
         ->composing(),
       "ARINC 665 medium source directory.\n"
       "For more media, repeat this parameter."
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -102,6 +111,8 @@ int main( int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     // create validator
     auto validator{ Arinc665::Utils::MediaSetValidator::create() };
 
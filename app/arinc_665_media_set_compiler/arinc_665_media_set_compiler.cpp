@@ -15,12 +15,15 @@
 #include <arinc_665/utils/Arinc665Xml.hpp>
 #include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
 #include <arinc_665/utils/FileCreationPolicyDescription.hpp>
+#include <arinc_665/utils/FilePlacementStrategyDescription.hpp>
 #include <arinc_665/utils/MediaSetDefaults.hpp>
+#include <arinc_665/utils/MediaSetStatistics.hpp>
 
 #include <arinc_665/media/MediaSet.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
 #include <arinc_665/SupportedArinc665VersionDescription.hpp>
+#include <arinc_665/Trace.hpp>
 #include <arinc_665/Version.hpp>
 
 #include <helper/Exception.hpp>
@@ -35,6 +38,7 @@
 #include <filesystem>
 #include <format>
 #include <iostream>
+#include <memory>
 
 /**
  * @brief Application Entry Point.
@@ -86,6 +90,12 @@ int main( const int argc, char * argv[] )
     std::filesystem::path mediaSetDestinationDirectory;
     // Media Set name
     std::string mediaSetName;
+    // File Placement Strategy
+    Arinc665::Utils::FilePlacementStrategy filePlacementStrategy{ Arinc665::Utils::FilePlacementStrategy::Reflink };
+    // Print Statistics
+    bool printStatistics{ false };
+    // Trace File
+    std::filesystem::path traceFile;
 
     boost::program_options::options_description optionsDescription{ "ARINC 665 Media Set Compiler Options" };
 
@@ -132,6 +142,28 @@ int main( const int argc, char * argv[] )
       boost::program_options::value( &mediaSetName ),
       "Media Set Name to use.\n"
       "Is set to part number when not provided"
+    )
+    (
+      "file-placement",
+      boost::program_options::value( &filePlacementStrategy )
+        ->default_value( Arinc665::Utils::FilePlacementStrategy::Reflink ),
+      "File placement strategy:\n"
+        "* 'Copy': Plain copy\n"
+        "* 'KernelCopy': In-kernel copy\n"
+        "* 'Reflink': Copy-on-write clone, if supported by the filesystem\n"
+        "* 'Hardlink': Hardlink, if located on the same volume.\n"
+        "  The source files are made read-only, as they share their content with the media.\n"
+        "Not possible strategies fall back to the next weaker one."
+    )
+    (
+      "stats",
+      boost::program_options::bool_switch( &printStatistics ),
+      "Print per-phase timing and throughput statistics after compilation."
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -149,6 +181,8 @@ int main( const int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     // load ARINC 665 XML file
     auto [ mediaSet, fileMapping ]{ Arinc665::Utils::Arinc665Xml_load( mediaSetXmlFile ) };
 
@@ -162,13 +196,21 @@ int main( const int argc, char * argv[] )
       .createLoadHeaderFiles( createLoadHeaderFiles )
       .sourceBasePath( mediaSetSourceDirectory )
       .filePathMapping( fileMapping )
-      .outputBasePath( mediaSetDestinationDirectory );
+      .outputBasePath( mediaSetDestinationDirectory )
+      .filePlacementStrategy( filePlacementStrategy );
 
     if ( !mediaSetName.empty() )
     {
       compiler->mediaSetName( mediaSetName );
     }
 
+    Arinc665::Utils::MediaSetStatisticsPtr statistics{};
+    if ( printStatistics )
+    {
+      statistics = std::make_shared< Arinc665::Utils::MediaSetStatistics >();
+      compiler->statistics( statistics );
+    }
+
     const auto &[ mediaSetPath, mediaPaths ]{ ( *compiler )() };
 
     std::cout << "Created Media Set " << mediaSetName << " in \n";
@@ -177,6 +219,12 @@ int main( const int argc, char * argv[] )
       std::cout << std::format( " * [{}]: {}\n", mediumNumber, ( mediaSetPath / mediumPath ).string() );
     }
 
+    if ( statistics )
+    {
+      std::cout << "Statistics:\n";
+      Arinc665::Utils::MediaSetStatistics_print( *statistics, std::cout, 10U, " " );
+    }
+
     return EXIT_SUCCESS;
   }
   catch ( const boost::program_options::error &e )
@@ -18,8 +18,10 @@
 #include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
 #include <arinc_665/utils/Arinc665Xml.hpp>
 #include <arinc_665/utils/MediaSetDefaults.hpp>
+#include <arinc_665/utils/MediaSetStatistics.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 #include <arinc_665/Version.hpp>
 
 #include <arinc_645/CheckValue.hpp>
@@ -33,6 +35,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <format>
 
@@ -79,6 +82,12 @@ int main( const int argc, char * argv[] )
     // Check File Integrity
     bool checkFileIntegrity{};
 
+    // Print Statistics
+    bool printStatistics{ false };
+
+    // Trace File
+    std::filesystem::path traceFile;
+
     optionsDescription.add_options()
     (
       "help,h",
@@ -101,6 +110,16 @@ int main( const int argc, char * argv[] )
       boost::program_options::value( &checkFileIntegrity )
         ->default_value( Arinc665::Utils::MediaSetDefaults::DefaultCheckFileIntegrity ),
       "Check File Integrity during decompilation."
+    )
+    (
+      "stats",
+      boost::program_options::bool_switch( &printStatistics ),
+      "Print per-phase timing and throughput statistics after decompilation."
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -119,6 +138,8 @@ int main( const int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     // Fill Media Paths list
     Arinc665::Utils::MediaPaths mediaPaths{};
     for ( const auto &mediumSourceDirectory : mediaSourceDirectories )
@@ -142,6 +163,13 @@ int main( const int argc, char * argv[] )
       .checkFileIntegrity( checkFileIntegrity )
       .mediaPaths( std::move( mediaPaths ) );
 
+    Arinc665::Utils::MediaSetStatisticsPtr statistics{};
+    if ( printStatistics )
+    {
+      statistics = std::make_shared< Arinc665::Utils::MediaSetStatistics >();
+      decompiler->statistics( statistics );
+    }
+
     // perform import
     const auto &[ mediaSet, checkValues ]{ ( *decompiler )() };
 
@@ -160,6 +188,12 @@ int main( const int argc, char * argv[] )
     // export to ARINC 665 XML file
     Arinc665::Utils::Arinc665Xml_save( *mediaSet, fileMapping, mediaSetXmlFile );
 
+    if ( statistics )
+    {
+      std::cout << "Statistics:\n";
+      Arinc665::Utils::MediaSetStatistics_print( *statistics, std::cout, 10U, " " );
+    }
+
     return EXIT_SUCCESS;
   }
   catch ( const boost::program_options::error &e )
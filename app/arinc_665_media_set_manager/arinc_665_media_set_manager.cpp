@@ -12,17 +12,26 @@
 
 #include <arinc_665_commands/Arinc665Commands.hpp>
 
+#include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 #include <arinc_665/Version.hpp>
 
 #include <commands/CommandRegistry.hpp>
 #include <commands/Utils.hpp>
 
+#include <helper/Exception.hpp>
+
 #include <spdlog/spdlog.h>
 
-#include <boost/exception/diagnostic_information.hpp>
+#include <boost/exception/all.hpp>
 
 #include <cstdlib>
+#include <filesystem>
+#include <format>
 #include <iostream>
+#include <iterator>
+#include <string_view>
+#include <vector>
 
 /**
  * @brief Application Entry Point.
@@ -36,6 +45,24 @@
  **/
 int main( int argc, char * argv[] );
 
+/**
+ * @brief Extracts the `--trace-file` option from the command line arguments.
+ *
+ * The command line handler of the commands library does not support global options.
+ * Therefore, the option is removed from @p arguments before they are passed to the command line handler.
+ * The option is only recognised before the command, so the arguments of the command are passed unmodified.
+ * Both forms `--trace-file <File>` and `--trace-file=<File>` are supported.
+ *
+ * @param[in,out] arguments
+ *   Command line arguments (including the program name).
+ *
+ * @return Trace File (empty if not given).
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the trace file is missing.
+ **/
+static std::filesystem::path extractTraceFile( std::vector< char * > &arguments );
+
 int main( const int argc, char * argv[] )
 {
   spdlog::set_level( spdlog::level::warn );
@@ -50,7 +77,13 @@ int main( const int argc, char * argv[] )
 
     Arinc665Commands::registerCommands( registry );
 
-    const auto result{ Commands::Utils_commandLineHandler( registry )( argc, argv ) };
+    std::vector< char * > arguments{ argv, argv + argc };
+
+    const Arinc665::TraceSession traceSession{ extractTraceFile( arguments ) };
+
+    const auto result{ Commands::Utils_commandLineHandler( registry )(
+      static_cast< int >( arguments.size() ),
+      arguments.data() ) };
 
     return result;
   }
@@ -70,3 +103,54 @@ int main( const int argc, char * argv[] )
     return EXIT_FAILURE;
   }
 }
+
+static std::filesystem::path extractTraceFile( std::vector< char * > &arguments )
+{
+  static constexpr std::string_view TraceFileOption{ "--trace-file" };
+
+  std::filesystem::path traceFile{};
+
+  // skip program name - stop at the first argument, which is not the trace file option (start of the command)
+  for ( auto argumentIt{ std::next( arguments.begin() ) }; argumentIt != arguments.end(); )
+  {
+    const std::string_view argument{ *argumentIt };
+    std::string_view value{};
+
+    if ( argument == TraceFileOption )
+    {
+      if ( std::next( argumentIt ) != arguments.end() )
+      {
+        value = *std::next( argumentIt );
+      }
+
+      if ( value.empty() || value.starts_with( '-' ) )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+          << Helper::AdditionalInfo{ "Missing argument for '--trace-file'" } );
+      }
+
+      argumentIt = arguments.erase( argumentIt, std::next( argumentIt, 2 ) );
+    }
+    else if ( argument.starts_with( TraceFileOption ) && ( argument.size() > TraceFileOption.size() )
+      && ( argument[ TraceFileOption.size() ] == '=' ) )
+    {
+      value = argument.substr( TraceFileOption.size() + 1U );
+
+      if ( value.empty() )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+          << Helper::AdditionalInfo{ "Missing argument for '--trace-file'" } );
+      }
+
+      argumentIt = arguments.erase( argumentIt );
+    }
+    else
+    {
+      break;
+    }
+
+    traceFile = value;
+  }
+
+  return traceFile;
+}
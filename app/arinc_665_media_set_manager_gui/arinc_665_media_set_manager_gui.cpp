@@ -65,6 +65,21 @@ int main( int argc, char * argv[] )
       &Arinc665Qt::MediaSetManager::OpenMediaSetManagerAction::rejected,
       &application,
       &QApplication::quit );
+    QObject::connect(
+      &mediaSetManagerAction,
+      &Arinc665Qt::MediaSetManager::OpenMediaSetManagerAction::failed,
+      &application,
+      &QApplication::quit );
+    // present media sets while the media set manager is loading
+    QObject::connect(
+      &mediaSetManagerAction,
+      &Arinc665Qt::MediaSetManager::OpenMediaSetManagerAction::mediaSetLoaded,
+      [ & ]( const Arinc665::Media::ConstMediaSetPtr &mediaSet )
+      {
+        mediaSetManagerWindow.mediaSetLoaded( mediaSet );
+
+        mediaSetManagerWindow.show();
+      } );
     QObject::connect(
       &mediaSetManagerAction,
       &Arinc665Qt::MediaSetManager::OpenMediaSetManagerAction::
@@ -17,6 +17,7 @@
 #include <arinc_665/utils/MediaSetDefaults.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 #include <arinc_665/Version.hpp>
 
 #include <arinc_645/CheckValue.hpp>
@@ -79,6 +80,9 @@ int main( const int argc, char * argv[] )
     // Check File Integrity
     bool checkFileIntegrity{};
 
+    // Trace File
+    std::filesystem::path traceFile;
+
     optionsDescription.add_options()
     (
       "help",
@@ -94,6 +98,11 @@ int main( const int argc, char * argv[] )
       boost::program_options::value( &checkFileIntegrity )
         ->default_value( Arinc665::Utils::MediaSetDefaults::DefaultCheckFileIntegrity ),
       "Check File Integrity during decompilation."
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -111,6 +120,8 @@ int main( const int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     const auto [ mediaSet, checkValues ]{ loadMediaSet( directories, checkFileIntegrity ) };
 
     std::cout << "Media Set: \n";
@@ -16,6 +16,7 @@
 #include <arinc_665/utils/MediaSetPrinter.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <helper/Dump.hpp>
 
@@ -52,6 +53,9 @@ int main( const int argc, char * argv[] )
 
     std::filesystem::path xmlPath;
 
+    // Trace File
+    std::filesystem::path traceFile;
+
     optionsDescription.add_options()
     (
       "help",
@@ -61,6 +65,11 @@ int main( const int argc, char * argv[] )
       "xml-file",
       boost::program_options::value( &xmlPath )->required(),
       "ARINC 665 media set description XML"
+    )
+    (
+      "trace-file",
+      boost::program_options::value( &traceFile ),
+      "Write Chrome Trace Event JSON of the library operations to the given file."
     );
 
     boost::program_options::variables_map variablesMap;
@@ -78,6 +87,8 @@ int main( const int argc, char * argv[] )
 
     boost::program_options::notify( variablesMap );
 
+    const Arinc665::TraceSession traceSession{ traceFile };
+
     std::cout << "List XML" << "\n";
 
     // load ARINC 665 XML file
@@ -49,6 +49,25 @@ class ARINC_665_EXPORT InvalidArinc665File : public Arinc665Exception
     }
 };
 
+/**
+ * @brief Operation Cancelled Exception.
+ *
+ * Thrown, when a long-running operation (e.g. compilation or decompilation of a %Media Set) has been cancelled
+ * cooperatively via its stop token.
+ **/
+class ARINC_665_EXPORT OperationCancelled : public Arinc665Exception
+{
+  public:
+    /**
+     * @brief Returns the exception description.
+     * @return The exception description.
+     **/
+    [[nodiscard]] const char* what() const noexcept override
+    {
+      return "ARINC 665 Operation Cancelled";
+    }
+};
+
 }
 
 #endif
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Symbol.
+ **/
+
+#include "Symbol.hpp"
+
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace Arinc665 {
+
+namespace {
+
+//! Transparent String Hash (allows look up by @p std::string_view without constructing a string)
+struct StringHash
+{
+  //! Enables heterogeneous look up.
+  using is_transparent = void;
+
+  /**
+   * @brief Hashes the String.
+   *
+   * @param[in] string
+   *   String to hash.
+   *
+   * @return Hash value.
+   **/
+  std::size_t operator()( const std::string_view string ) const noexcept
+  {
+    return std::hash< std::string_view >{}( string );
+  }
+};
+
+/**
+ * @brief Interned Strings.
+ *
+ * The node based container keeps the addresses of the strings stable on insertion.
+ **/
+struct SymbolPool
+{
+  //! Protects strings (look ups are shared, insertions exclusive)
+  std::shared_mutex mutex;
+  //! Interned Strings
+  std::unordered_set< std::string, StringHash, std::equal_to<> > strings;
+  //! The empty String (shared by all default constructed symbols)
+  const std::string * const emptyString{ &*strings.emplace().first };
+};
+
+/**
+ * @brief Returns the Symbol Pool.
+ *
+ * The pool is created on first use and never destroyed, so symbols are valid during static initialisation and
+ * destruction.
+ *
+ * @return Symbol pool.
+ **/
+SymbolPool& pool()
+{
+  static auto * const symbolPool{ new SymbolPool{} };
+  return *symbolPool;
+}
+
+}
+
+Symbol::Symbol() noexcept :
+  stringV{ pool().emptyString }
+{
+}
+
+Symbol::Symbol( const std::string_view string ) :
+  stringV{ intern( string ) }
+{
+}
+
+Symbol::Symbol( const std::string &string ) :
+  stringV{ intern( string ) }
+{
+}
+
+Symbol::Symbol( const char * const string ) :
+  stringV{ intern( string ) }
+{
+}
+
+const std::string& Symbol::str() const noexcept
+{
+  return *stringV;
+}
+
+bool Symbol::empty() const noexcept
+{
+  return stringV->empty();
+}
+
+Symbol::operator const std::string&() const noexcept
+{
+  return *stringV;
+}
+
+Symbol::operator std::string_view() const noexcept
+{
+  return *stringV;
+}
+
+std::strong_ordering Symbol::operator<=>( const Symbol &rhs ) const noexcept
+{
+  if ( stringV == rhs.stringV )
+  {
+    return std::strong_ordering::equal;
+  }
+
+  return *stringV <=> *rhs.stringV;
+}
+
+const std::string* Symbol::intern( const std::string_view string )
+{
+  auto &symbolPool{ pool() };
+
+  if ( string.empty() )
+  {
+    return symbolPool.emptyString;
+  }
+
+  {
+    std::shared_lock lock{ symbolPool.mutex };
+
+    if ( const auto interned{ symbolPool.strings.find( string ) }; interned != symbolPool.strings.end() )
+    {
+      return &*interned;
+    }
+  }
+
+  // string may have been interned concurrently - emplace() keeps the existing copy
+  std::unique_lock lock{ symbolPool.mutex };
+  return &*symbolPool.strings.emplace( string ).first;
+}
+
+std::ostream& operator<<( std::ostream &stream, const Symbol &symbol )
+{
+  return stream << symbol.str();
+}
+
+}
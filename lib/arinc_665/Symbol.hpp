@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Symbol.
+ **/
+
+#ifndef ARINC_665_SYMBOL_HPP
+#define ARINC_665_SYMBOL_HPP
+
+#include <arinc_665/Arinc665.hpp>
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace Arinc665 {
+
+/**
+ * @brief Interned String.
+ *
+ * Part numbers, target hardware IDs and positions are repeated many times within and across media sets.
+ * A symbol references the single copy of its string held by a process wide, thread-safe pool.
+ * Copying a symbol copies a pointer, and comparing two symbols for equality compares these pointers.
+ *
+ * Symbols are ordered lexicographically by their strings, so ordered containers of symbols keep the order of the
+ * corresponding string containers.
+ * Symbols can be compared to and looked up by everything convertible to @p std::string_view.
+ *
+ * Interned strings are never released.
+ * Symbols are intended for the identifiers of the media model and not for arbitrary data.
+ **/
+class ARINC_665_EXPORT Symbol
+{
+  public:
+    //! Constructs the empty Symbol.
+    Symbol() noexcept;
+
+    /**
+     * @brief Constructs the Symbol for the given String.
+     *
+     * @param[in] string
+     *   String to intern.
+     **/
+    Symbol( std::string_view string );
+
+    //! @copydoc Symbol(std::string_view)
+    Symbol( const std::string &string );
+
+    //! @copydoc Symbol(std::string_view)
+    Symbol( const char * string );
+
+    /**
+     * @brief Returns the interned String.
+     *
+     * @return Interned string (valid for the lifetime of the process).
+     **/
+    [[nodiscard]] const std::string& str() const noexcept;
+
+    /**
+     * @brief Returns if the Symbol is empty.
+     *
+     * @return If the symbol represents the empty string.
+     **/
+    [[nodiscard]] bool empty() const noexcept;
+
+    //! @copydoc str() const
+    operator const std::string&() const noexcept;
+
+    /**
+     * @brief Returns the interned String as View.
+     *
+     * @return Interned string as view.
+     **/
+    operator std::string_view() const noexcept;
+
+    /**
+     * @brief Equality of Symbols (identity of the interned strings).
+     *
+     * @param[in] rhs
+     *   Compares to.
+     *
+     * @return If both symbols represent the same string.
+     **/
+    bool operator==( const Symbol &rhs ) const noexcept = default;
+
+    /**
+     * @brief Lexicographical 3-way comparison of Symbols.
+     *
+     * @param[in] rhs
+     *   Compares to.
+     *
+     * @return Comparison.
+     **/
+    std::strong_ordering operator<=>( const Symbol &rhs ) const noexcept;
+
+    /**
+     * @brief Equality of Symbol and String.
+     *
+     * @tparam T
+     *   String type.
+     *
+     * @param[in] rhs
+     *   Compares to.
+     *
+     * @return If the symbol represents @p rhs.
+     **/
+    template< typename T >
+    requires ( !std::same_as< T, Symbol > && std::convertible_to< const T&, std::string_view > )
+    bool operator==( const T &rhs ) const noexcept
+    {
+      return std::string_view{ *stringV } == std::string_view{ rhs };
+    }
+
+    /**
+     * @brief Lexicographical 3-way comparison of Symbol and String.
+     *
+     * @tparam T
+     *   String type.
+     *
+     * @param[in] rhs
+     *   Compares to.
+     *
+     * @return Comparison.
+     **/
+    template< typename T >
+    requires ( !std::same_as< T, Symbol > && std::convertible_to< const T&, std::string_view > )
+    std::strong_ordering operator<=>( const T &rhs ) const noexcept
+    {
+      return std::string_view{ *stringV } <=> std::string_view{ rhs };
+    }
+
+  private:
+    /**
+     * @brief Returns the interned Copy of the String.
+     *
+     * @param[in] string
+     *   String to intern.
+     *
+     * @return Interned string.
+     **/
+    static const std::string* intern( std::string_view string );
+
+    //! Interned String
+    const std::string * stringV;
+};
+
+/**
+ * @brief Symbol @p std::ostream output operator.
+ *
+ * @param[in,out] stream
+ *   Output stream.
+ * @param[in] symbol
+ *   Symbol.
+ *
+ * @return Output stream
+ *
+ * @sa @ref Symbol
+ **/
+ARINC_665_EXPORT std::ostream& operator<<( std::ostream &stream, const Symbol &symbol );
+
+}
+
+namespace std {
+
+/**
+ * @brief Specialisation of @p std::hash for @ref Arinc665::Symbol.
+ *
+ * The address of the interned string identifies the symbol.
+ **/
+template<>
+struct hash< Arinc665::Symbol >
+{
+  /**
+   * @brief Arinc665::Symbol hash routine.
+   *
+   * @param[in] symbol
+   *   Symbol
+   *
+   * @return Hash value.
+   **/
+  size_t operator()( const Arinc665::Symbol &symbol ) const noexcept
+  {
+    return std::hash< const void * >{}( &symbol.str() );
+  }
+};
+
+/**
+ * @brief Specialisation of @p std::formatter for @ref Arinc665::Symbol.
+ *
+ * @sa @ref Arinc665::Symbol
+ **/
+template<>
+struct formatter< Arinc665::Symbol > : std::formatter< std::string_view >
+{
+ /**
+  * @brief Arinc665::Symbol format routine.
+  *
+  * @tparam FmtContext
+  *   Formatting Context
+  * @param[in] symbol
+  *   Symbol
+  * @param[in,out] ctx
+  *   Formatting Context
+  *
+  * @return Iterator to the end of output.
+  **/
+ template< class FmtContext >
+ FmtContext::iterator format( const Arinc665::Symbol &symbol, FmtContext &ctx ) const
+ {
+  return std::formatter< string_view >::format( symbol.str(), ctx );
+ }
+};
+
+}
+
+#endif
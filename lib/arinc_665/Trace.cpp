@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Trace.
+ **/
+
+#include "Trace.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/exception/all.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace Arinc665 {
+
+namespace {
+
+//! Recorded Trace Event
+struct TraceEvent
+{
+  //! Event Category
+  std::string_view category;
+  //! Event Name
+  std::string_view name;
+  //! Detail Information
+  std::string detail;
+  //! Start Time
+  std::chrono::steady_clock::time_point start;
+  //! Duration
+  std::chrono::steady_clock::duration duration;
+  //! Thread Identifier
+  std::uint32_t threadId;
+};
+
+//! Tracing enabled flag
+std::atomic_bool traceEnabled{ false };
+//! Mutex protecting the trace events
+std::mutex traceMutex;
+//! Trace Start Time (Time Base of the Events)
+std::chrono::steady_clock::time_point traceStart{};
+//! Recorded Trace Events
+std::vector< TraceEvent > traceEvents;
+
+/**
+ * @brief Returns a small sequential identifier of the calling thread.
+ *
+ * @return Thread identifier.
+ **/
+std::uint32_t threadId()
+{
+  static std::atomic_uint32_t nextThreadId{ 1U };
+  thread_local const std::uint32_t id{ nextThreadId.fetch_add( 1U, std::memory_order_relaxed ) };
+  return id;
+}
+
+/**
+ * @brief Escapes @p value for use as JSON string.
+ *
+ * @param[in] value
+ *   String to escape.
+ *
+ * @return Escaped string (without enclosing quotes).
+ **/
+std::string jsonEscape( std::string_view value )
+{
+  std::string escaped{};
+  escaped.reserve( value.size() );
+
+  for ( const char character : value )
+  {
+    switch ( character )
+    {
+      case '"':  escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n";  break;
+      case '\r': escaped += "\\r";  break;
+      case '\t': escaped += "\\t";  break;
+      default:
+        if ( static_cast< unsigned char >( character ) < 0x20U )
+        {
+          escaped += std::format( "\\u{:04x}", static_cast< unsigned int >( character ) );
+        }
+        else
+        {
+          escaped += character;
+        }
+        break;
+    }
+  }
+
+  return escaped;
+}
+
+}
+
+Trace::Scope::Scope( const std::string_view category, const std::string_view name ) noexcept :
+  categoryV{ category },
+  nameV{ name },
+  startV{ traceEnabled.load( std::memory_order_relaxed ) ?
+    std::chrono::steady_clock::now() :
+    std::chrono::steady_clock::time_point{} }
+{
+}
+
+Trace::Scope::Scope( const std::string_view category, const std::string_view name, const std::string_view detail ) :
+  Scope{ category, name }
+{
+  if ( startV != std::chrono::steady_clock::time_point{} )
+  {
+    detailV = detail;
+  }
+}
+
+Trace::Scope::~Scope()
+{
+  if ( startV == std::chrono::steady_clock::time_point{} )
+  {
+    return;
+  }
+
+  const auto end{ std::chrono::steady_clock::now() };
+
+  try
+  {
+    std::lock_guard lock{ traceMutex };
+
+    // ignore events started before the current trace session
+    if ( !traceEnabled.load( std::memory_order_relaxed ) || ( startV < traceStart ) )
+    {
+      return;
+    }
+
+    traceEvents.emplace_back( categoryV, nameV, std::move( detailV ), startV, end - startV, threadId() );
+  }
+  catch ( const std::exception &e )
+  {
+    SPDLOG_ERROR( "Recording trace event: {}", e.what() );
+  }
+}
+
+void Trace::start()
+{
+  std::lock_guard lock{ traceMutex };
+
+  traceEvents.clear();
+  traceStart = std::chrono::steady_clock::now();
+  traceEnabled.store( true, std::memory_order_relaxed );
+}
+
+void Trace::stop()
+{
+  std::lock_guard lock{ traceMutex };
+  traceEnabled.store( false, std::memory_order_relaxed );
+}
+
+bool Trace::enabled() noexcept
+{
+  return traceEnabled.load( std::memory_order_relaxed );
+}
+
+void Trace::write( const std::filesystem::path &file )
+{
+  std::vector< TraceEvent > events{};
+  std::chrono::steady_clock::time_point start{};
+
+  {
+    std::lock_guard lock{ traceMutex };
+    events.swap( traceEvents );
+    start = traceStart;
+  }
+
+  std::ofstream traceFile{ file, std::ofstream::out | std::ofstream::trunc };
+
+  if ( !traceFile.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening trace file" }
+      << boost::errinfo_file_name{ file.string() } );
+  }
+
+  using Microseconds = std::chrono::duration< double, std::micro >;
+
+  traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  for ( bool first{ true }; const auto &event : events )
+  {
+    traceFile << std::format(
+      "{}\n{{\"ph\":\"X\",\"pid\":1,\"tid\":{},\"cat\":\"{}\",\"name\":\"{}\",\"ts\":{:.3f},\"dur\":{:.3f}",
+      first ? "" : ",",
+      event.threadId,
+      jsonEscape( event.category ),
+      jsonEscape( event.name ),
+      Microseconds{ event.start - start }.count(),
+      Microseconds{ event.duration }.count() );
+
+    if ( !event.detail.empty() )
+    {
+      traceFile << std::format( ",\"args\":{{\"detail\":\"{}\"}}", jsonEscape( event.detail ) );
+    }
+
+    traceFile << "}";
+    first = false;
+  }
+
+  traceFile << "\n]}\n";
+
+  if ( !traceFile )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error writing trace file" }
+      << boost::errinfo_file_name{ file.string() } );
+  }
+}
+
+TraceSession::TraceSession( std::filesystem::path file ) :
+  fileV{ std::move( file ) }
+{
+  if ( !fileV.empty() )
+  {
+    Trace::start();
+  }
+}
+
+TraceSession::~TraceSession()
+{
+  if ( fileV.empty() )
+  {
+    return;
+  }
+
+  try
+  {
+    Trace::stop();
+    Trace::write( fileV );
+  }
+  catch ( const boost::exception &e )
+  {
+    SPDLOG_ERROR( "Write trace file: {}", boost::diagnostic_information( e ) );
+  }
+  catch ( const std::exception &e )
+  {
+    SPDLOG_ERROR( "Write trace file: {}", e.what() );
+  }
+}
+
+}
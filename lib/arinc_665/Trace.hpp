@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Trace.
+ **/
+
+#ifndef ARINC_665_TRACE_HPP
+#define ARINC_665_TRACE_HPP
+
+#include <arinc_665/Arinc665.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Arinc665 {
+
+/**
+ * @brief ARINC 665 Library Event Tracing.
+ *
+ * Records scoped spans (complete events) of library operations like handler calls, file digests, file encoding and
+ * decoding, and media set loads.
+ * The recorded events are written as Chrome Trace Event JSON, which can be visualised with `chrome://tracing` or
+ * Perfetto (https://ui.perfetto.dev).
+ *
+ * Tracing is disabled by default.
+ * When disabled, a trace scope costs a single relaxed atomic load.
+ * When the library is built without `ARINC_665_TRACE`, the trace scope macros expand to nothing.
+ *
+ * Trace scopes are created via the macros @ref ARINC_665_TRACE_SCOPE and @ref ARINC_665_TRACE_SCOPE_DETAIL.
+ * All operations are thread-safe.
+ **/
+class ARINC_665_EXPORT Trace final
+{
+  public:
+    /**
+     * @brief RAII Trace Span.
+     *
+     * Records a complete event from construction until destruction, if tracing is enabled at construction time.
+     **/
+    class ARINC_665_EXPORT Scope final
+    {
+      public:
+        /**
+         * @brief Starts the Trace Span.
+         *
+         * @param[in] category
+         *   Event Category.
+         *   Must be a string literal (not copied).
+         * @param[in] name
+         *   Event Name.
+         *   Must be a string literal (not copied).
+         **/
+        Scope( std::string_view category, std::string_view name ) noexcept;
+
+        /**
+         * @brief Starts the Trace Span with additional detail information.
+         *
+         * @param[in] category
+         *   Event Category.
+         *   Must be a string literal (not copied).
+         * @param[in] name
+         *   Event Name.
+         *   Must be a string literal (not copied).
+         * @param[in] detail
+         *   Detail Information (e.g. filename).
+         *   Copied only, when tracing is enabled.
+         **/
+        Scope( std::string_view category, std::string_view name, std::string_view detail );
+
+        //! Stops the Trace Span and records the event.
+        ~Scope();
+
+        Scope( const Scope & ) = delete;
+        Scope& operator=( const Scope & ) = delete;
+
+      private:
+        //! Event Category
+        std::string_view categoryV;
+        //! Event Name
+        std::string_view nameV;
+        //! Detail Information
+        std::string detailV;
+        //! Start Time (Default constructed, when tracing is disabled)
+        std::chrono::steady_clock::time_point startV;
+    };
+
+    // Deleted Constructor
+    Trace() = delete;
+
+    /**
+     * @brief Enables Tracing.
+     *
+     * Already recorded events are discarded.
+     **/
+    static void start();
+
+    /**
+     * @brief Disables Tracing.
+     *
+     * Recorded events are kept until the next start() or write().
+     **/
+    static void stop();
+
+    /**
+     * @brief Returns if tracing is enabled.
+     *
+     * @return If tracing is enabled.
+     **/
+    [[nodiscard]] static bool enabled() noexcept;
+
+    /**
+     * @brief Writes the recorded events as Chrome Trace Event JSON and discards them.
+     *
+     * @param[in] file
+     *   Trace File
+     *
+     * @throw Arinc665Exception
+     *   If the trace file cannot be written.
+     **/
+    static void write( const std::filesystem::path &file );
+};
+
+/**
+ * @brief ARINC 665 Trace Session.
+ *
+ * Enables tracing on construction and writes the trace file on destruction.
+ * This is used by applications to implement the `--trace-file` option.
+ * If the trace file path is empty, tracing is not enabled.
+ **/
+class ARINC_665_EXPORT TraceSession final
+{
+  public:
+    /**
+     * @brief Starts the Trace Session.
+     *
+     * @param[in] file
+     *   Trace File.
+     *   If empty, tracing is not enabled.
+     **/
+    explicit TraceSession( std::filesystem::path file );
+
+    //! Stops tracing and writes the trace file.
+    ~TraceSession();
+
+    TraceSession( const TraceSession & ) = delete;
+    TraceSession& operator=( const TraceSession & ) = delete;
+
+  private:
+    //! Trace File
+    std::filesystem::path fileV;
+};
+
+}
+
+//! Helper for Unique Trace Scope Variable Names
+#define ARINC_665_TRACE_CONCAT_IMPL( a, b ) a##b
+//! Helper for Unique Trace Scope Variable Names
+#define ARINC_665_TRACE_CONCAT( a, b ) ARINC_665_TRACE_CONCAT_IMPL( a, b )
+
+#if defined( ARINC_665_TRACE )
+/**
+ * @brief Traces the enclosing scope.
+ *
+ * @param[in] category
+ *   Event Category (string literal).
+ * @param[in] name
+ *   Event Name (string literal).
+ **/
+#define ARINC_665_TRACE_SCOPE( category, name ) \
+  const ::Arinc665::Trace::Scope ARINC_665_TRACE_CONCAT( arinc665TraceScope, __LINE__ ){ category, name }
+
+/**
+ * @brief Traces the enclosing scope with additional detail information.
+ *
+ * The @p detail expression is only evaluated, when tracing is enabled.
+ *
+ * @param[in] category
+ *   Event Category (string literal).
+ * @param[in] name
+ *   Event Name (string literal).
+ * @param[in] detail
+ *   Detail Information (convertible to std::string_view).
+ **/
+#define ARINC_665_TRACE_SCOPE_DETAIL( category, name, detail ) \
+  const ::Arinc665::Trace::Scope ARINC_665_TRACE_CONCAT( arinc665TraceScope, __LINE__ ){ \
+    category, \
+    name, \
+    ::Arinc665::Trace::enabled() ? std::string_view{ detail } : std::string_view{} }
+#else
+#define ARINC_665_TRACE_SCOPE( category, name ) static_cast< void >( 0 )
+#define ARINC_665_TRACE_SCOPE_DETAIL( category, name, detail ) static_cast< void >( 0 )
+#endif
+
+#endif
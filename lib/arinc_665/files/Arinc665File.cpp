@@ -312,7 +312,9 @@ Arinc665File& Arinc665File::operator=( Helper::ConstRawDataSpan rawFile )
 
 Arinc665File::operator Helper::RawData() const
 {
-  return encode();
+  Helper::RawData rawFile( encodedSize() );
+  encode( rawFile );
+  return rawFile;
 }
 
 SupportedArinc665Version Arinc665File::arincVersion() const noexcept
@@ -369,12 +371,21 @@ Arinc665File& Arinc665File::operator=( Arinc665File &&other ) noexcept
   return *this;
 }
 
-void Arinc665File::insertHeader( Helper::RawDataSpan rawFile, const std::size_t additionalSize ) const
+void Arinc665File::checkEncodeBuffer( Helper::ConstRawDataSpan rawFile, const std::size_t encodedSize )
 {
-  const auto fileSize{ rawFile.size() + additionalSize };
+  if ( rawFile.size() != encodedSize )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception{}
+      << Helper::AdditionalInfo{ "Buffer size does not match encoded file size" } );
+  }
+}
+
+void Arinc665File::insertHeader( Helper::RawDataSpan rawFile ) const
+{
+  const auto fileSize{ rawFile.size() };
 
   // Check file size
-  if ( rawFile.size() <= ( BaseHeaderSize + sizeof( uint16_t ) ) )
+  if ( fileSize <= ( BaseHeaderSize + ( 2U * sizeof( uint16_t ) ) ) )
   {
     BOOST_THROW_EXCEPTION(
       InvalidArinc665File{} << Helper::AdditionalInfo{ "File too small" } );
@@ -405,7 +416,10 @@ void Arinc665File::calculateFileCrc( Helper::RawDataSpan rawFile ) const
   Helper::RawData_setInt< uint16_t >( rawFile.last( checksumPosition ), calculatedCrc );
 }
 
-void Arinc665File::decodeHeader( Helper::ConstRawDataSpan rawFile, const FileType expectedFileType )
+SupportedArinc665Version Arinc665File::checkHeader(
+  Helper::ConstRawDataSpan rawFile,
+  const FileType expectedFileType,
+  const ptrdiff_t checksumPosition )
 {
   // Check file size
   if ( rawFile.size() <= BaseHeaderSize )
@@ -433,8 +447,6 @@ void Arinc665File::decodeHeader( Helper::ConstRawDataSpan rawFile, const FileTyp
     BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "wrong file format" } );
   }
 
-  arinc665VersionV = *optionalArinc665Version;
-
   // Decode checksum field
   auto [ _2, crc ]{ Helper::RawData_getInt< uint16_t >( rawFile.last( checksumPosition ) ) };
 
@@ -444,6 +456,13 @@ void Arinc665File::decodeHeader( Helper::ConstRawDataSpan rawFile, const FileTyp
   {
     BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "Invalid checksum" } );
   }
+
+  return *optionalArinc665Version;
+}
+
+void Arinc665File::decodeHeader( Helper::ConstRawDataSpan rawFile, const FileType expectedFileType )
+{
+  arinc665VersionV = checkHeader( rawFile, expectedFileType, checksumPosition );
 }
 
 }
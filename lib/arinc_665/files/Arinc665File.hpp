@@ -203,10 +203,37 @@ class ARINC_665_EXPORT Arinc665File
     /**
      * @brief Returns the ARINC 665 file as raw data.
      *
+     * The raw data is allocated once with encodedSize() and filled by encode(Helper::RawDataSpan) const.
+     *
      * @return the protocol file as raw data.
      **/
     [[nodiscard]] explicit operator Helper::RawData() const;
 
+    /**
+     * @brief Returns the exact size of the encoded ARINC 665 file.
+     *
+     * @return Size of the encoded file in bytes.
+     *
+     * @throw Arinc665Exception
+     *   When the file cannot be encoded.
+     **/
+    [[nodiscard]] virtual std::size_t encodedSize() const = 0;
+
+    /**
+     * @brief Encodes the ARINC 665 file into the given buffer.
+     *
+     * The pointer offsets are calculated up front, so each field is written exactly once into @p rawFile, including
+     * spare fields and padding.
+     * This allows encoding into caller-supplied memory (e.g. a memory mapped output file).
+     *
+     * @param[out] rawFile
+     *   Target buffer of exactly encodedSize() bytes.
+     *
+     * @throw Arinc665Exception
+     *   When the size of @p rawFile does not match the encoded size.
+     **/
+    virtual void encode( Helper::RawDataSpan rawFile ) const = 0;
+
     /**
      * @brief Returns the ARINC 665 file type.
      *
@@ -289,27 +316,30 @@ class ARINC_665_EXPORT Arinc665File
     Arinc665File& operator=( Arinc665File &&other ) noexcept;
 
     /**
-     * @brief Encodes the ARINC 665 file as raw data.
+     * @brief Checks the size of the target buffer of encode(Helper::RawDataSpan) const.
      *
-     * @return ARINC 665 file as raw data.
+     * @param[in] rawFile
+     *   Target buffer.
+     * @param[in] encodedSize
+     *   Expected size of the encoded file.
+     *
+     * @throw Arinc665Exception
+     *   When the size of @p rawFile does not match @p encodedSize.
      **/
-    [[nodiscard]] virtual Helper::RawData encode() const = 0;
+    static void checkEncodeBuffer( Helper::ConstRawDataSpan rawFile, std::size_t encodedSize );
 
     /**
-     * @brief Inserts the header data and file CRC into @p rawFile.
+     * @brief Inserts the header data into @p rawFile.
      *
      * @param[in,out] rawFile
-     *   Raw file, where the header is encoded.
-     * @param[in] additionalSize
-     *   Additional value, which should be added to current raw file size.
-     *   Normally it is the missing file CRC field (16 bit).
+     *   Complete raw file (including checksum fields), where the header is encoded.
      *
      * @throw InvalidArinc665File
      *   When file is too small
      * @throw InvalidArinc665File
      *   When file size is invalid
      **/
-    void insertHeader( Helper::RawDataSpan rawFile, std::size_t additionalSize = sizeof( uint16_t ) ) const;
+    void insertHeader( Helper::RawDataSpan rawFile ) const;
 
     /**
      * @brief Calculates and updates the File CRC field.
@@ -319,6 +349,34 @@ class ARINC_665_EXPORT Arinc665File
      **/
     void calculateFileCrc( Helper::RawDataSpan rawFile ) const;
 
+    /**
+     * @brief Checks the header and the File CRC of the given raw file.
+     *
+     * Used by the bulk decoders, which do not instantiate the file class.
+     *
+     * @param[in] rawFile
+     *   Raw File.
+     * @param[in] expectedFileType
+     *   Expected file type.
+     * @param[in] checksumPosition
+     *   Checksum position.
+     *
+     * @return ARINC 665 version of the file.
+     *
+     * @throw InvalidArinc665File
+     *   When file is too small
+     * @throw InvalidArinc665File
+     *   When file size field is invalid
+     * @throw InvalidArinc665File
+     *   When file format is wrong
+     * @throw InvalidArinc665File
+     *   When CRC is invalid
+     **/
+    [[nodiscard]] static SupportedArinc665Version checkHeader(
+      Helper::ConstRawDataSpan rawFile,
+      FileType expectedFileType,
+      ptrdiff_t checksumPosition = DefaultChecksumPosition );
+
   private:
     /**
      * @brief Initialises class with the given raw data.
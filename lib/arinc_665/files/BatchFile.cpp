@@ -48,12 +48,12 @@ FileType BatchFile::fileType() const noexcept
   return FileType::BatchFile;
 }
 
-std::string_view BatchFile::partNumber() const
+Symbol BatchFile::partNumber() const
 {
   return partNumberV;
 }
 
-void BatchFile::partNumber( std::string partNumber )
+void BatchFile::partNumber( Symbol partNumber )
 {
   partNumberV = std::move( partNumber );
 }
@@ -83,53 +83,40 @@ void BatchFile::targetHardware( BatchTargetInfo targetHardwareInfo )
   targetsHardwareV.push_back( std::move( targetHardwareInfo ) );
 }
 
-Helper::RawData BatchFile::encode() const
+std::size_t BatchFile::encodedSize() const
 {
-  Helper::RawData rawFile( BatchFileHeaderSizeV2 );
-
-  // spare field
-  Helper::RawData_setInt< uint16_t>( Helper::RawDataSpan{ rawFile }.subspan( SpareFieldOffsetV2 ), 0U );
-
+  return encodingLayout().size;
+}
 
-  // Next free Offset (used for optional pointer calculation)
-  size_t nextFreeOffset{ BatchFileHeaderSizeV2 };
+void BatchFile::encode( Helper::RawDataSpan rawFile ) const
+{
+  const auto layout{ encodingLayout() };
+  checkEncodeBuffer( rawFile, layout.size );
 
+  // spare field
+  Helper::RawData_setInt< uint16_t>( rawFile.subspan( SpareFieldOffsetV2 ), 0U );
 
   // batch part number + comment
-  auto rawBatchPn{ StringUtils_encodeString( partNumberV ) };
-  assert( rawBatchPn.size() % 2 == 0 );
-  auto rawComment{ StringUtils_encodeString( commentV ) };
-  assert( rawComment.size() % 2 == 0 );
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( BatchPartNumberPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += rawBatchPn.size() + rawComment.size();
-
-  rawFile.insert( rawFile.end(), rawBatchPn.begin(), rawBatchPn.end() );
-  rawFile.insert( rawFile.end(), rawComment.begin(), rawComment.end() );
-
+    rawFile.subspan( BatchPartNumberPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.partNumberOffset / 2U ) );
+  StringUtils_encodeString(
+    StringUtils_encodeString( rawFile.subspan( layout.partNumberOffset ), partNumberV ),
+    commentV );
 
   // THW ID load list
-  auto rawThwIdsList{ encodeBatchTargetsInfo() };
-  assert( rawThwIdsList.size() % 2 == 0 );
-
   Helper::RawData_setInt< uint32_t>(
-    Helper::RawDataSpan{ rawFile }.subspan( ThwIdsPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-
-  rawFile.insert( rawFile.end(), rawThwIdsList.begin(), rawThwIdsList.end() );
+    rawFile.subspan( ThwIdsPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.batchTargetsInfoOffset / 2U ) );
+  encodeBatchTargetsInfo( rawFile.subspan(
+    layout.batchTargetsInfoOffset,
+    layout.size - DefaultChecksumPosition - layout.batchTargetsInfoOffset ) );
 
   // set header
   insertHeader( rawFile );
 
-  // Resize file for file CRC
-  rawFile.resize( rawFile.size() + sizeof( uint16_t ) );
-
   // set CRC
   calculateFileCrc( rawFile );
-
-  return rawFile;
 }
 
 void BatchFile::decodeBody( Helper::ConstRawDataSpan rawFile )
@@ -161,10 +148,22 @@ void BatchFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   decodeBatchTargetsInfo( rawFile.subspan( targetHardwareIdListPtr * 2ULL ) );
 }
 
-Helper::RawData BatchFile::encodeBatchTargetsInfo() const
+BatchFile::EncodingLayout BatchFile::encodingLayout() const
 {
-  Helper::RawData rawBatchTargetsInfo( sizeof( uint16_t ) ); // Number of THW IDs
+  EncodingLayout layout{};
 
+  layout.partNumberOffset = BatchFileHeaderSizeV2;
+  layout.batchTargetsInfoOffset =
+    layout.partNumberOffset
+    + StringUtils_encodedStringSize( partNumberV )
+    + StringUtils_encodedStringSize( commentV );
+  layout.size = layout.batchTargetsInfoOffset + batchTargetsInfoSize() + sizeof( uint16_t );
+
+  return layout;
+}
+
+std::size_t BatchFile::batchTargetsInfoSize() const
+{
   // Number of targets must not exceed field
   if ( targetsHardwareV.size() > std::numeric_limits< uint16_t>::max() )
   {
@@ -172,59 +171,70 @@ Helper::RawData BatchFile::encodeBatchTargetsInfo() const
       << Helper::AdditionalInfo{ "More THW IDs than allowed" } );
   }
 
-  Helper::RawData_setInt< uint16_t>( rawBatchTargetsInfo, Helper::safeCast< uint16_t>( targetsHardwareV.size() ) );
+  std::size_t size{ sizeof( uint16_t ) }; // Number of THW IDs
 
-  // iterate over target HWs
-  uint16_t thwCounter{ 0 };
-  for ( auto const &targetHardwareInfo : targetsHardwareV )
+  for ( const auto &targetHardwareInfo : targetsHardwareV )
   {
-    ++thwCounter;
+    size += batchTargetInfoSize( targetHardwareInfo );
+  }
 
-    Helper::RawData rawLoadsInfo{};
-    /* iterate over loads */
-    for ( auto const &loadInfo : targetHardwareInfo.loads )
-    {
-      auto const rawHeaderFilename{ StringUtils_encodeString( loadInfo.headerFilename ) };
-      assert( rawHeaderFilename.size() % 2 == 0 );
+  return size;
+}
 
-      auto const rawPartNumber{ StringUtils_encodeString( loadInfo.partNumber ) };
-      assert( rawPartNumber.size() % 2 == 0 );
+std::size_t BatchFile::batchTargetInfoSize( const BatchTargetInfo &targetHardwareInfo )
+{
+  std::size_t size{
+    sizeof( uint16_t ) // next THW pointer
+    + StringUtils_encodedStringSize( targetHardwareInfo.targetHardwareIdPosition )
+    + sizeof( uint16_t ) }; // Number of Loads
 
-      rawLoadsInfo.insert( rawLoadsInfo.end(), rawHeaderFilename.begin(), rawHeaderFilename.end() );
-      rawLoadsInfo.insert( rawLoadsInfo.end(), rawPartNumber.begin(), rawPartNumber.end() );
-    }
-    assert( rawLoadsInfo.size() % 2 == 0);
+  for ( const auto &loadInfo : targetHardwareInfo.loads )
+  {
+    size +=
+      StringUtils_encodedStringSize( loadInfo.headerFilename )
+      + StringUtils_encodedStringSize( loadInfo.partNumber );
+  }
+
+  return size;
+}
 
-    Helper::RawData rawBatchTargetInfo( sizeof( uint16_t ) );
+void BatchFile::encodeBatchTargetsInfo( Helper::RawDataSpan rawBatchTargetsInfo ) const
+{
+  // Number of THW IDs
+  auto remaining{ Helper::RawData_setInt< uint16_t>(
+    rawBatchTargetsInfo,
+    Helper::safeCast< uint16_t>( targetsHardwareV.size() ) ) };
 
-    auto const rawThwIdPosition{ StringUtils_encodeString( targetHardwareInfo.targetHardwareIdPosition ) };
-    assert( rawThwIdPosition.size() % 2 == 0);
+  // iterate over target HWs
+  std::size_t thwCounter{ 0U };
+  for ( auto const &targetHardwareInfo : targetsHardwareV )
+  {
+    ++thwCounter;
 
-    // THW ID + Position
-    rawBatchTargetInfo.insert( rawBatchTargetInfo.end(), rawThwIdPosition.begin(), rawThwIdPosition.end() );
+    // next THW pointer (is set to 0 for last THW)
+    remaining = Helper::RawData_setInt< uint16_t>(
+      remaining,
+      ( thwCounter == targetsHardwareV.size() ) ?
+        ( 0U ) :
+        Helper::safeCast< uint16_t>( batchTargetInfoSize( targetHardwareInfo ) / 2 ) );
 
-    rawBatchTargetInfo.resize( rawBatchTargetInfo.size() + sizeof( uint16_t ) );
+    // THW ID + Position
+    remaining = StringUtils_encodeString( remaining, targetHardwareInfo.targetHardwareIdPosition );
 
     // Number of Loads
-    Helper::RawData_setInt< uint16_t>(
-      Helper::RawDataSpan{ rawBatchTargetInfo }.last( sizeof( uint16_t ) ),
+    remaining = Helper::RawData_setInt< uint16_t>(
+      remaining,
       Helper::safeCast< uint16_t>( targetHardwareInfo.loads.size() ) );
 
-    // Loads list
-    rawBatchTargetInfo.insert( rawBatchTargetInfo.end(), rawLoadsInfo.begin(), rawLoadsInfo.end() );
-
-    // next load pointer (is set to 0 for last load)
-    Helper::RawData_setInt< uint16_t>(
-      rawBatchTargetInfo,
-      ( thwCounter == targetsHardwareV.size() ) ?
-        ( 0U ) :
-        Helper::safeCast< uint16_t>( rawBatchTargetInfo.size() / 2 ) );
-
-    // add THW info to files info
-    rawBatchTargetsInfo.insert( rawBatchTargetsInfo.end(), rawBatchTargetInfo.begin(), rawBatchTargetInfo.end() );
+    /* iterate over loads */
+    for ( auto const &loadInfo : targetHardwareInfo.loads )
+    {
+      remaining = StringUtils_encodeString( remaining, loadInfo.headerFilename );
+      remaining = StringUtils_encodeString( remaining, loadInfo.partNumber );
+    }
   }
 
-  return rawBatchTargetsInfo;
+  assert( remaining.empty() );
 }
 
 void BatchFile::decodeBatchTargetsInfo( Helper::ConstRawDataSpan rawData )
@@ -266,7 +276,7 @@ void BatchFile::decodeBatchTargetsInfo( Helper::ConstRawDataSpan rawData )
     }
 
     // THW ID
-    std::string thwId{};
+    Symbol thwId{};
     std::tie( listRemaining, thwId ) = StringUtils_decodeString( listRemaining );
 
     // Loads list
@@ -284,7 +294,7 @@ void BatchFile::decodeBatchTargetsInfo( Helper::ConstRawDataSpan rawData )
       std::tie( listRemaining, filename ) = StringUtils_decodeString( listRemaining );
 
       // Load PN
-      std::string partNumber;
+      Symbol partNumber;
       std::tie( listRemaining, partNumber ) = StringUtils_decodeString( listRemaining );
 
       // Batch Load info
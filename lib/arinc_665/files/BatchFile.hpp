@@ -17,6 +17,8 @@
 #include <arinc_665/files/Arinc665File.hpp>
 #include <arinc_665/files/BatchTargetInfo.hpp>
 
+#include <arinc_665/Symbol.hpp>
+
 namespace Arinc665::Files {
 
 /**
@@ -97,6 +99,12 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
     //! @copydoc Arinc665File::fileType() const noexcept
     [[nodiscard]] FileType fileType() const noexcept override;
 
+    //! @copydoc Arinc665File::encodedSize() const
+    [[nodiscard]] std::size_t encodedSize() const override;
+
+    //! @copydoc Arinc665File::encode(Helper::RawDataSpan) const
+    void encode( Helper::RawDataSpan rawFile ) const override;
+
     /**
      * @name Batch Part Number
      *
@@ -110,7 +118,7 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
      *
      * @return Part Number of the Batch.
      **/
-    [[nodiscard]] std::string_view partNumber() const;
+    [[nodiscard]] Symbol partNumber() const;
 
     /**
      * @brief Updates the Part Number of the Batch.
@@ -118,7 +126,7 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
      * @param[in] partNumber
      *   New Batch Part Number.
      **/
-    void partNumber( std::string partNumber );
+    void partNumber( Symbol partNumber );
 
     /** @} **/
 
@@ -174,8 +182,23 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
     /** @} **/
 
   private:
-    //! @copydoc Arinc665File::encode
-    [[nodiscard]] Helper::RawData encode() const override;
+    //! Offsets and Size of the encoded Batch File
+    struct EncodingLayout
+    {
+      //! Offset of the Batch Part Number (followed by the Comment)
+      std::size_t partNumberOffset;
+      //! Offset of the Target Hardware Information List
+      std::size_t batchTargetsInfoOffset;
+      //! Size of the encoded File
+      std::size_t size;
+    };
+
+    /**
+     * @brief Calculates the pointer offsets and the size of the encoded file.
+     *
+     * @return Encoding Layout.
+     **/
+    [[nodiscard]] EncodingLayout encodingLayout() const;
 
     /**
      * @brief Decodes the body of the batch file.
@@ -185,12 +208,33 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
      **/
     void decodeBody( Helper::ConstRawDataSpan rawFile );
 
+    /**
+     * @brief Returns the size of the encoded target hardware information list.
+     *
+     * @return Size of the encoded _Target Hardware Information_ list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of targets exceeds the number of THW IDs field.
+     **/
+    [[nodiscard]] std::size_t batchTargetsInfoSize() const;
+
+    /**
+     * @brief Returns the size of the encoded target hardware information entry.
+     *
+     * @param[in] targetHardwareInfo
+     *   Target Hardware Information.
+     *
+     * @return Size of the encoded target hardware information entry.
+     **/
+    [[nodiscard]] static std::size_t batchTargetInfoSize( const BatchTargetInfo &targetHardwareInfo );
+
     /**
      * @brief Encodes the target hardware information list.
      *
-     * @return Raw representation of the _Target Hardware Information_ list.
+     * @param[out] rawBatchTargetsInfo
+     *   Target buffer of batchTargetsInfoSize() bytes.
      **/
-    [[nodiscard]] Helper::RawData encodeBatchTargetsInfo() const;
+    void encodeBatchTargetsInfo( Helper::RawDataSpan rawBatchTargetsInfo ) const;
 
     /**
      * @brief Decodes the target hardware information list from the raw data.
@@ -201,7 +245,7 @@ class ARINC_665_EXPORT BatchFile final : public Arinc665File
     void decodeBatchTargetsInfo( Helper::ConstRawDataSpan rawData );
 
     //! Part Number
-    std::string partNumberV;
+    Symbol partNumberV;
     //! Comment
     std::string commentV;
     //! Targets Hardware Information
@@ -16,6 +16,7 @@
 #include <arinc_665/files/Files.hpp>
 
 #include <arinc_665/MediumNumber.hpp>
+#include <arinc_665/Symbol.hpp>
 
 #include <string>
 #include <string_view>
@@ -32,7 +33,7 @@ namespace Arinc665::Files {
 struct ARINC_665_EXPORT BatchInfo
 {
   //! Part Number
-  std::string partNumber;
+  Symbol partNumber;
   //! Filename
   std::string filename;
   //! Member Sequence Number
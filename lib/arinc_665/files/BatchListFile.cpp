@@ -23,6 +23,8 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+
 namespace Arinc665::Files {
 
 BatchListFile::BatchListFile( const SupportedArinc665Version version ) :
@@ -94,67 +96,44 @@ bool BatchListFile::belongsToSameMediaSet( const BatchListFile &other ) const
     && ( batchesV == other.batches() );
 }
 
-Helper::RawData BatchListFile::encode() const
+std::size_t BatchListFile::encodedSize() const
 {
-  Helper::RawData rawFile( FileHeaderSizeV2 );
-
-  // Spare Field
-  Helper::RawData_setInt< uint16_t>( Helper::RawDataSpan{ rawFile }.subspan( SpareFieldOffsetV2 ), 0U );
+  return encodingLayout().size;
+}
 
-  // Next free Offset (used for optional pointer calculation)
-  size_t nextFreeOffset{ rawFile.size() };
+void BatchListFile::encode( Helper::RawDataSpan rawFile ) const
+{
+  const auto layout{ encodingLayout() };
+  checkEncodeBuffer( rawFile, layout.size );
 
+  // Spare Field
+  Helper::RawData_setInt< uint16_t>( rawFile.subspan( SpareFieldOffsetV2 ), 0U );
 
   // media set information
-  const auto rawMediaInformation{ encodeMediaInformation() };
-  assert( rawMediaInformation.size() % 2 == 0 );
-  rawFile.insert( rawFile.end(), rawMediaInformation.begin(), rawMediaInformation.end() );
-
-  // Update Pointer
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan(  MediaSetPartNumberPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += static_cast< ptrdiff_t >( rawMediaInformation.size() );
-
+    rawFile.subspan( MediaSetPartNumberPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.mediaInformationOffset / 2U ) );
+  encodeMediaInformation( rawFile.subspan( layout.mediaInformationOffset ) );
 
-  // Batch Information
-  const auto rawBatchesInfo{ encodeBatchesInfo() };
-  assert( rawBatchesInfo.size() % 2 == 0 );
-
-  // batches list pointer
+  // batches list
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( BatchFilesPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += rawBatchesInfo.size();
-
-  rawFile.insert( rawFile.end(), rawBatchesInfo.begin(), rawBatchesInfo.end() );
-
+    rawFile.subspan( BatchFilesPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.batchesInfoOffset / 2U ) );
+  encodeBatchesInfo(
+    rawFile.subspan( layout.batchesInfoOffset, layout.userDefinedDataOffset - layout.batchesInfoOffset ) );
 
   // user defined data
   assert( userDefinedDataV.size() % 2 == 0 );
-  uint32_t userDefinedDataPtr = 0;
-
-  if ( !userDefinedDataV.empty() )
-  {
-    userDefinedDataPtr = static_cast< uint32_t >( nextFreeOffset / 2U );
-
-    rawFile.insert( rawFile.end(), userDefinedDataV.begin(), userDefinedDataV.end() );
-  }
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( UserDefinedDataPointerFieldOffsetV2 ),
-    userDefinedDataPtr );
+    rawFile.subspan( UserDefinedDataPointerFieldOffsetV2 ),
+    userDefinedDataV.empty() ? 0U : static_cast< uint32_t >( layout.userDefinedDataOffset / 2U ) );
+  std::ranges::copy( userDefinedDataV, rawFile.subspan( layout.userDefinedDataOffset ).begin() );
 
   // set header
   insertHeader( rawFile );
 
-  // Resize file for file CRC
-  rawFile.resize( rawFile.size() + sizeof( uint16_t ) );
-
   // set CRC
   calculateFileCrc( rawFile );
-
-  return rawFile;
 }
 
 void BatchListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
@@ -197,59 +176,77 @@ void BatchListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   // file crc decoded and checked within base class
 }
 
-Helper::RawData BatchListFile::encodeBatchesInfo() const
+BatchListFile::EncodingLayout BatchListFile::encodingLayout() const
 {
-  Helper::RawData rawBatchesInfo( sizeof( uint16_t ) );
+  EncodingLayout layout{};
+
+  layout.mediaInformationOffset = FileHeaderSizeV2;
+  layout.batchesInfoOffset = layout.mediaInformationOffset + mediaInformationSize();
+  layout.userDefinedDataOffset = layout.batchesInfoOffset + batchesInfoSize();
+  layout.size = layout.userDefinedDataOffset + userDefinedDataV.size() + sizeof( uint16_t );
 
+  return layout;
+}
+
+std::size_t BatchListFile::batchesInfoSize() const
+{
   // Number of batches must not exceed field
   if ( batchesV.size() > std::numeric_limits< uint16_t>::max() )
   {
     BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "More batches than allowed" } );
   }
 
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &batchInfo : batchesV )
+  {
+    size += batchInfoSize( batchInfo );
+  }
+
+  return size;
+}
+
+std::size_t BatchListFile::batchInfoSize( const BatchInfo &batchInfo )
+{
+  return
+    sizeof( uint16_t ) // next batch pointer
+    + StringUtils_encodedStringSize( batchInfo.partNumber )
+    + StringUtils_encodedStringSize( batchInfo.filename )
+    + sizeof( uint16_t ); // member sequence number
+}
+
+void BatchListFile::encodeBatchesInfo( Helper::RawDataSpan rawBatchesInfo ) const
+{
   // number of batches
-  Helper::RawData_setInt< uint16_t >( rawBatchesInfo, static_cast< uint16_t >( batchesV.size() ) );
+  auto remaining{
+    Helper::RawData_setInt< uint16_t >( rawBatchesInfo, Helper::safeCast< uint16_t >( batchesV.size() ) ) };
 
   // iterate over batches
-  uint16_t batchCounter{ 0 };
+  std::size_t batchCounter{ 0U };
   for ( auto const &batchInfo : batchesV )
   {
     ++batchCounter;
 
-    Helper::RawData rawBatchInfo( sizeof( uint16_t ) );
-
-    auto const rawPartNumber{ StringUtils_encodeString( batchInfo.partNumber ) };
-    assert( rawPartNumber.size() % 2 == 0 );
-
-    auto const rawFilename{ StringUtils_encodeString( batchInfo.filename ) };
-    assert( rawFilename.size() % 2 == 0 );
-
-    // next pointer
-    Helper::RawData_setInt< uint16_t >(
-      rawBatchInfo,
-      ( batchCounter == numberOfBatches() )
-        ? 0U
-        : static_cast< uint16_t >(
-            ( sizeof( uint16_t ) + rawPartNumber.size() + rawFilename.size() + sizeof( uint16_t ) ) / 2U ) );
+    // next batch pointer (is set to 0 for last batch)
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
+      ( batchCounter == batchesV.size() ) ?
+        0U :
+        static_cast< uint16_t >( batchInfoSize( batchInfo ) / 2U ) );
 
     // Part Number
-    rawBatchInfo.insert( rawBatchInfo.end(), rawPartNumber.begin(), rawPartNumber.end() );
+    remaining = StringUtils_encodeString( remaining, batchInfo.partNumber );
 
     // Batch Filename
-    rawBatchInfo.insert( rawBatchInfo.end(), rawFilename.begin(), rawFilename.end() );
+    remaining = StringUtils_encodeString( remaining, batchInfo.filename );
 
     // member sequence number
-    rawBatchInfo.resize( rawBatchInfo.size() + sizeof( uint16_t ) );
-
-    Helper::RawData_setInt< uint16_t >(
-      Helper::RawDataSpan{ rawBatchInfo }.last( sizeof( uint16_t ) ),
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
       static_cast< uint8_t >( batchInfo.memberSequenceNumber ) );
-
-    // add file info to files info
-    rawBatchesInfo.insert( rawBatchesInfo.end(), rawBatchInfo.begin(), rawBatchInfo.end() );
   }
 
-  return rawBatchesInfo;
+  assert( remaining.empty() );
 }
 
 void BatchListFile::decodeBatchesInfo( Helper::ConstRawDataSpan rawData )
@@ -289,7 +286,7 @@ void BatchListFile::decodeBatchesInfo( Helper::ConstRawDataSpan rawData )
     }
 
     // part number
-    std::string partNumber;
+    Symbol partNumber;
     std::tie( listRemaining, partNumber ) = StringUtils_decodeString( listRemaining );
 
     // batch filename
@@ -106,6 +106,12 @@ class ARINC_665_EXPORT BatchListFile final : public ListFile
     //! @copydoc ListFile::fileType() const noexcept
     [[nodiscard]] FileType fileType() const noexcept override;
 
+    //! @copydoc ListFile::encodedSize() const
+    [[nodiscard]] std::size_t encodedSize() const override;
+
+    //! @copydoc ListFile::encode(Helper::RawDataSpan) const
+    void encode( Helper::RawDataSpan rawFile ) const override;
+
     /**
      * @name Batches
      * @{
@@ -178,8 +184,25 @@ class ARINC_665_EXPORT BatchListFile final : public ListFile
     [[nodiscard]] bool belongsToSameMediaSet( const BatchListFile &other ) const;
 
   private:
-    //! @copydoc ListFile::encode
-    [[nodiscard]] Helper::RawData encode() const override;
+    //! Offsets and Size of the encoded Batch List File
+    struct EncodingLayout
+    {
+      //! Offset of the Media Information
+      std::size_t mediaInformationOffset;
+      //! Offset of the Batches Information List
+      std::size_t batchesInfoOffset;
+      //! Offset of the User Defined Data
+      std::size_t userDefinedDataOffset;
+      //! Size of the encoded File
+      std::size_t size;
+    };
+
+    /**
+     * @brief Calculates the pointer offsets and the size of the encoded file.
+     *
+     * @return Encoding Layout.
+     **/
+    [[nodiscard]] EncodingLayout encodingLayout() const;
 
     /**
      * @brief Decodes the body of the batch list file.
@@ -189,12 +212,33 @@ class ARINC_665_EXPORT BatchListFile final : public ListFile
      **/
     void decodeBody( Helper::ConstRawDataSpan rawFile );
 
+    /**
+     * @brief Returns the size of the encoded batches information list.
+     *
+     * @return Size of the encoded batches information list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of batches exceeds the number of batches field.
+     **/
+    [[nodiscard]] std::size_t batchesInfoSize() const;
+
+    /**
+     * @brief Returns the size of the encoded batch information entry.
+     *
+     * @param[in] batchInfo
+     *   Batch Information.
+     *
+     * @return Size of the encoded batch information entry.
+     **/
+    [[nodiscard]] static std::size_t batchInfoSize( const BatchInfo &batchInfo );
+
     /**
      * @brief Encodes the batches information list.
      *
-     * @return Raw representation of batches information list.
+     * @param[out] rawBatchesInfo
+     *   Target buffer of batchesInfoSize() bytes.
      **/
-    [[nodiscard]] Helper::RawData encodeBatchesInfo() const;
+    void encodeBatchesInfo( Helper::RawDataSpan rawBatchesInfo ) const;
 
     /**
      * @brief Decodes the batches information list from the raw data.
@@ -15,6 +15,8 @@
 
 #include <arinc_665/files/Files.hpp>
 
+#include <arinc_665/Symbol.hpp>
+
 #include <string>
 
 namespace Arinc665::Files {
@@ -32,7 +34,7 @@ struct ARINC_665_EXPORT BatchLoadInfo
   //! Load Header Filename.
   std::string headerFilename;
   //! Load Part Number.
-  std::string partNumber;
+  Symbol partNumber;
 };
 
 }
@@ -16,7 +16,7 @@
 #include <arinc_665/files/Files.hpp>
 #include <arinc_665/files/BatchLoadInfo.hpp>
 
-#include <string>
+#include <arinc_665/Symbol.hpp>
 
 namespace Arinc665::Files {
 
@@ -33,7 +33,7 @@ namespace Arinc665::Files {
 struct ARINC_665_EXPORT BatchTargetInfo
 {
   //! Target Hardware ID and Position
-  std::string targetHardwareIdPosition;
+  Symbol targetHardwareIdPosition;
   //! List of Loads for Target Hardware
   BatchLoadsInfo loads;
 };
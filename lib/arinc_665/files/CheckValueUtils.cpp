@@ -22,6 +22,8 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+
 namespace Arinc665::Files {
 
 size_t CheckValueUtils_size( const Arinc645::CheckValueType type )
@@ -32,31 +34,48 @@ size_t CheckValueUtils_size( const Arinc645::CheckValueType type )
       ( 2U * sizeof( uint16_t ) ) + Arinc645::CheckValue::Sizes.at( type );
 }
 
+size_t CheckValueUtils_encodedSize( const Arinc645::CheckValue &checkValue )
+{
+  return
+    ( Arinc645::CheckValueType::NotUsed == checkValue.type() ) ?
+      sizeof( uint16_t ) :
+      ( 2U * sizeof( uint16_t ) ) + checkValue.value().size();
+}
+
 Helper::RawData CheckValueUtils_encode( const Arinc645::CheckValue &checkValue )
 {
+  Helper::RawData rawCheckValue( CheckValueUtils_encodedSize( checkValue ) );
+  CheckValueUtils_encode( rawCheckValue, checkValue );
+  return rawCheckValue;
+}
+
+Helper::RawDataSpan CheckValueUtils_encode( Helper::RawDataSpan rawData, const Arinc645::CheckValue &checkValue )
+{
+  const auto checkValueSize{ CheckValueUtils_encodedSize( checkValue ) };
+
+  if ( rawData.size() < checkValueSize )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Buffer too small for check value" } );
+  }
+
   // special Handling of "No Check Value"
   if ( Arinc645::CheckValueType::NotUsed == checkValue.type() )
   {
-    return { std::byte{ 0 }, std::byte{ 0 } };
+    return Helper::RawData_setInt< uint16_t >( rawData, 0U );
   }
 
-  // Length + Type
-  Helper::RawData rawCheckValue( 2 * sizeof( uint16_t ) );
+  // Check Value Length
+  auto remaining{ Helper::RawData_setInt< uint16_t >( rawData, Helper::safeCast< uint16_t >( checkValueSize ) ) };
 
   // Check Value Type Field
-  Helper::RawData_setInt< uint16_t >(
-    Helper::RawDataSpan{ rawCheckValue }.subspan( sizeof( uint16_t ) ),
-    static_cast< uint16_t >( checkValue.type() ) );
+  remaining = Helper::RawData_setInt< uint16_t >( remaining, static_cast< uint16_t >( checkValue.type() ) );
 
   // Check Value Data
   const auto &checkValueData{ checkValue.value() };
+  std::ranges::copy( checkValueData, remaining.begin() );
 
-  rawCheckValue.insert( rawCheckValue.end(), checkValueData.begin(), checkValueData.end() );
-
-  // Check Value Length
-  Helper::RawData_setInt< uint16_t >( rawCheckValue, Helper::safeCast< uint16_t >( rawCheckValue.size() ) );
-
-  return rawCheckValue;
+  return remaining.subspan( checkValueData.size() );
 }
 
 Arinc645::CheckValue CheckValueUtils_decode( Helper::ConstRawDataSpan rawFile )
@@ -54,6 +54,16 @@ namespace Arinc665::Files {
  **/
 [[nodiscard]] ARINC_665_EXPORT size_t CheckValueUtils_size( Arinc645::CheckValueType type );
 
+/**
+ * @brief Calculates the Size of the Encoded Check Value.
+ *
+ * @param[in] checkValue
+ *   Check Value to encode.
+ *
+ * @return Size of raw representation of @p checkValue.
+ **/
+[[nodiscard]] ARINC_665_EXPORT size_t CheckValueUtils_encodedSize( const Arinc645::CheckValue &checkValue );
+
 /**
  * @brief Encodes the given Check Value.
  *
@@ -64,6 +74,24 @@ namespace Arinc665::Files {
  **/
 [[nodiscard]] ARINC_665_EXPORT Helper::RawData CheckValueUtils_encode( const Arinc645::CheckValue &checkValue );
 
+/**
+ * @brief Encodes the given Check Value into @p rawData.
+ *
+ * @param[out] rawData
+ *   Target buffer.
+ *   Must provide at least CheckValueUtils_encodedSize() bytes.
+ * @param[in] checkValue
+ *   Check Value to encode.
+ *
+ * @return Remaining buffer after the encoded check value.
+ *
+ * @throw Arinc665Exception
+ *   When @p rawData is too small.
+ **/
+ARINC_665_EXPORT Helper::RawDataSpan CheckValueUtils_encode(
+  Helper::RawDataSpan rawData,
+  const Arinc645::CheckValue &checkValue );
+
 /**
  * @brief Decodes the given data as Check Value.
  *
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Files::FileInfoTable.
+ **/
+
+#include "FileInfoTable.hpp"
+
+#include <arinc_665/files/FileInfo.hpp>
+#include <arinc_665/files/StringUtils.hpp>
+#include <arinc_665/files/CheckValueUtils.hpp>
+
+#include <arinc_665/Arinc665.hpp>
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <tuple>
+
+namespace Arinc665::Files {
+
+namespace {
+
+//! Size of the fixed fields following the strings of a file list entry (Member Sequence Number, CRC)
+constexpr std::size_t FixedFieldsSize{ 2U * sizeof( uint16_t ) };
+
+/**
+ * @brief Returns the file list entry at @p offset and checks its next file pointer.
+ *
+ * @param[in] rawData
+ *   File list raw data.
+ * @param[in] offset
+ *   Offset of the entry within @p rawData.
+ * @param[in] lastEntry
+ *   If the entry is the last one of the list.
+ *
+ * @return Entry data (limited by the next file pointer) and the offset of the next entry.
+ *
+ * @throw InvalidArinc665File
+ *   When the next file pointer is invalid.
+ **/
+std::tuple< Helper::ConstRawDataSpan, std::size_t > listEntry(
+  Helper::ConstRawDataSpan rawData,
+  const std::size_t offset,
+  const bool lastEntry )
+{
+  if ( rawData.size() < offset + sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list entry exceeds file" } );
+  }
+
+  const auto [ _, filePointer ]{ Helper::RawData_getInt< uint16_t >( rawData.subspan( offset ) ) };
+
+  if ( lastEntry )
+  {
+    if ( 0U != filePointer )
+    {
+      BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer is not 0" } );
+    }
+
+    return { rawData.subspan( offset ), rawData.size() };
+  }
+
+  if ( 0U == filePointer )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer is 0" } );
+  }
+
+  const auto entrySize{ 2U * static_cast< std::size_t >( filePointer ) };
+
+  if ( rawData.size() < offset + entrySize )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer exceeds file" } );
+  }
+
+  return { rawData.subspan( offset, entrySize ), offset + entrySize };
+}
+
+/**
+ * @brief Copies the already validated string at the begin of @p rawData into the string arena.
+ *
+ * @param[in,out] strings
+ *   String arena. Must be reserved in advance, so no reallocation takes place.
+ * @param[in] rawData
+ *   Raw data starting at the string length field.
+ *
+ * @return Remaining data (behind the fill character) and the string referencing the arena.
+ **/
+std::tuple< Helper::ConstRawDataSpan, std::string_view > appendString(
+  std::vector< char > &strings,
+  Helper::ConstRawDataSpan rawData )
+{
+  const auto [ stringData, stringLength ]{ Helper::RawData_getInt< uint16_t >( rawData ) };
+
+  const auto begin{ strings.size() };
+  std::ranges::transform(
+    stringData.first( stringLength ),
+    std::back_inserter( strings ),
+    []( const std::byte character ) { return static_cast< char >( character ); } );
+
+  return {
+    stringData.subspan( stringLength + ( stringLength % 2U ) ),
+    std::string_view{ strings.data() + begin, stringLength } };
+}
+
+}
+
+FileInfoTable FileInfoTable::decode( Helper::ConstRawDataSpan rawData, const bool decodeV3Data )
+{
+  if ( rawData.size() < sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list exceeds file" } );
+  }
+
+  const auto [ _, numberOfFiles ]{ Helper::RawData_getInt< uint16_t >( rawData ) };
+
+  // first pass: walk pointer chain, check entries and sum up string sizes
+  std::size_t stringsSize{ 0U };
+
+  for ( std::size_t fileIndex{ 0U }, entryOffset{ sizeof( uint16_t ) }; fileIndex < numberOfFiles; ++fileIndex )
+  {
+    const auto [ entry, nextEntryOffset ]{ listEntry( rawData, entryOffset, fileIndex + 1U == numberOfFiles ) };
+
+    auto remaining{ entry.subspan( sizeof( uint16_t ) ) };
+
+    std::string_view filename{};
+    std::tie( remaining, filename ) = StringUtils_decodeString( remaining );
+
+    std::string_view pathName{};
+    std::tie( remaining, pathName ) = StringUtils_decodeString( remaining );
+
+    if ( remaining.size() < FixedFieldsSize + ( decodeV3Data ? sizeof( uint16_t ) : 0U ) )
+    {
+      BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list entry too small" } );
+    }
+
+    if ( decodeV3Data )
+    {
+      const auto [ _1, checkValueLength ]{
+        Helper::RawData_getInt< uint16_t >( remaining.subspan( FixedFieldsSize ) ) };
+
+      if ( remaining.size() < FixedFieldsSize + checkValueLength )
+      {
+        BOOST_THROW_EXCEPTION( InvalidArinc665File{}
+          << Helper::AdditionalInfo{ "check value exceeds file list entry" } );
+      }
+    }
+
+    const auto [ _2, memberSequenceNumber ]{ Helper::RawData_getInt< uint16_t >( remaining ) };
+    if ( ( memberSequenceNumber < 1U ) || ( memberSequenceNumber > 255U ) )
+    {
+      BOOST_THROW_EXCEPTION( InvalidArinc665File{}
+        << Helper::AdditionalInfo{ "member sequence number out of range" } );
+    }
+
+    stringsSize += filename.size() + pathName.size();
+    entryOffset = nextEntryOffset;
+  }
+
+  FileInfoTable table{};
+  table.stringsV.reserve( stringsSize );
+  table.entriesV.reserve( numberOfFiles );
+
+  // second pass: extract entries
+  for ( std::size_t fileIndex{ 0U }, entryOffset{ sizeof( uint16_t ) }; fileIndex < numberOfFiles; ++fileIndex )
+  {
+    auto [ remaining, filePointer ]{ Helper::RawData_getInt< uint16_t >( rawData.subspan( entryOffset ) ) };
+
+    auto &entry{ table.entriesV.emplace_back() };
+
+    std::tie( remaining, entry.filename ) = appendString( table.stringsV, remaining );
+    std::tie( remaining, entry.pathName ) = appendString( table.stringsV, remaining );
+
+    uint16_t memberSequenceNumber{};
+    std::tie( remaining, memberSequenceNumber ) = Helper::RawData_getInt< uint16_t >( remaining );
+    entry.memberSequenceNumber = MediumNumber{ static_cast< uint8_t >( memberSequenceNumber ) };
+
+    std::tie( remaining, entry.crc ) = Helper::RawData_getInt< uint16_t >( remaining );
+
+    // following fields are available in ARINC 665-3 ff
+    entry.checkValue = decodeV3Data ? CheckValueUtils_decode( remaining ) : Arinc645::CheckValue::NoCheckValue;
+
+    entryOffset += 2U * static_cast< std::size_t >( filePointer );
+  }
+
+  return table;
+}
+
+std::size_t FileInfoTable::size() const noexcept
+{
+  return entriesV.size();
+}
+
+bool FileInfoTable::empty() const noexcept
+{
+  return entriesV.empty();
+}
+
+const FileInfoTable::Entries& FileInfoTable::entries() const noexcept
+{
+  return entriesV;
+}
+
+FilesInfo FileInfoTable::filesInfo() const
+{
+  FilesInfo files{};
+
+  for ( const auto &entry : entriesV )
+  {
+    files.emplace_back( fileInfo( entry ) );
+  }
+
+  return files;
+}
+
+std::filesystem::path FileInfoTable::Entry::path() const
+{
+  std::string newPathName{ pathName };
+
+  std::ranges::replace( newPathName, '\\', '/' );
+
+  return ( std::filesystem::path{ newPathName } / filename ).make_preferred();
+}
+
+FileInfo FileInfoTable::fileInfo( const Entry &entry )
+{
+  return FileInfo{
+    .filename = std::string{ entry.filename },
+    .pathName = std::string{ entry.pathName },
+    .memberSequenceNumber = entry.memberSequenceNumber,
+    .crc = entry.crc,
+    .checkValue = entry.checkValue };
+}
+
+bool FileInfoTable::belongsToSameMediaSet( const FileInfoTable &other ) const
+{
+  return std::ranges::equal( entriesV, other.entriesV, []( const Entry &entry, const Entry &otherEntry )
+  {
+    if ( ( entry.filename != otherEntry.filename ) || ( entry.pathName != otherEntry.pathName ) )
+    {
+      return false;
+    }
+
+    // list files are created per medium
+    if ( ( ListOfLoadsName == entry.filename ) || ( ListOfBatchesName == entry.filename ) )
+    {
+      return true;
+    }
+
+    return ( entry.crc == otherEntry.crc )
+      && ( entry.checkValue == otherEntry.checkValue )
+      && ( entry.memberSequenceNumber == otherEntry.memberSequenceNumber );
+  } );
+}
+
+}
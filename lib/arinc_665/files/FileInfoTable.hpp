@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Files::FileInfoTable.
+ **/
+
+#ifndef ARINC_665_FILES_FILEINFOTABLE_HPP
+#define ARINC_665_FILES_FILEINFOTABLE_HPP
+
+#include <arinc_665/files/Files.hpp>
+
+#include <arinc_665/MediumNumber.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace Arinc665::Files {
+
+/**
+ * @brief ARINC 665 %File Information Table.
+ *
+ * Bulk decoded file list of the ARINC 665 Files List File.
+ * In contrast to FilesInfo, the entries are stored within a contiguous vector and all filenames and path names are
+ * stored within a single string arena, which is allocated once.
+ *
+ * The entries reference the string arena.
+ * Therefore, the table is move-only.
+ *
+ * @sa FileListFile::decodeFilesInfoTable()
+ * @sa FileInfo
+ **/
+class ARINC_665_EXPORT FileInfoTable final
+{
+  public:
+    //! File Information Table Entry
+    struct Entry
+    {
+      //! Filename (references the string arena)
+      std::string_view filename;
+      //! Path Name (references the string arena)
+      std::string_view pathName;
+      //! Member Sequence Number
+      MediumNumber memberSequenceNumber;
+      //! CRC
+      uint16_t crc{};
+      //! Check Value (since ARINC 665-3)
+      Arinc645::CheckValue checkValue;
+
+      /**
+       * @brief Returns the path (path name / filename)
+       *
+       * @return path (incl. filename)
+       *
+       * @sa FileInfo::path()
+       **/
+      [[nodiscard]] std::filesystem::path path() const;
+    };
+
+    //! Table Entries
+    using Entries = std::vector< Entry >;
+
+    //! Initialises an empty table.
+    FileInfoTable() = default;
+
+    //! Move Constructor (The string arena is moved, so the entries stay valid).
+    FileInfoTable( FileInfoTable &&other ) noexcept = default;
+
+    //! Move Assignment (The string arena is moved, so the entries stay valid).
+    FileInfoTable& operator=( FileInfoTable &&other ) noexcept = default;
+
+    // Deleted Copy Constructor
+    FileInfoTable( const FileInfoTable &other ) = delete;
+
+    // Deleted Copy Assignment
+    FileInfoTable& operator=( const FileInfoTable &other ) = delete;
+
+    /**
+     * @brief Decodes the file list of an ARINC 665 Files List File.
+     *
+     * The first pass walks the file pointer chain, bounds-checks each entry and sums up the string sizes.
+     * Afterwards the entry vector and the string arena are reserved, and the second pass extracts the entries without
+     * further allocations (despite the check values).
+     *
+     * @param[in] rawData
+     *   Raw data starting at the Number of Media Set Files field.
+     * @param[in] decodeV3Data
+     *   If set to true, the ARINC 665-3 check values are decoded.
+     *
+     * @return Decoded File Information Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file list is invalid.
+     **/
+    [[nodiscard]] static FileInfoTable decode( Helper::ConstRawDataSpan rawData, bool decodeV3Data );
+
+    /**
+     * @brief Returns the number of entries.
+     *
+     * @return Number of entries.
+     **/
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns if the table is empty.
+     *
+     * @return If the table is empty.
+     **/
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief Returns the entries.
+     *
+     * @return Table entries.
+     **/
+    [[nodiscard]] const Entries& entries() const noexcept;
+
+    /**
+     * @brief Converts the table into the files information list representation.
+     *
+     * @return Files Information.
+     **/
+    [[nodiscard]] FilesInfo filesInfo() const;
+
+    /**
+     * @brief Converts a table entry into the file information representation.
+     *
+     * @param[in] entry
+     *   Table Entry.
+     *
+     * @return File Information.
+     **/
+    [[nodiscard]] static FileInfo fileInfo( const Entry &entry );
+
+    /**
+     * @brief Compares the file lists of two media of a media set.
+     *
+     * The files are compared as done by FileListFile::belongsToSameMediaSet().
+     * So the CRC, check value and member sequence number of the list of loads and the list of batches, which differ
+     * between the media, are not compared.
+     *
+     * @param[in] other
+     *   Other File Information Table.
+     *
+     * @return If both tables list the same files.
+     **/
+    [[nodiscard]] bool belongsToSameMediaSet( const FileInfoTable &other ) const;
+
+  private:
+    //! String Arena
+    std::vector< char > stringsV;
+    //! Entries
+    Entries entriesV;
+};
+
+}
+
+#endif
@@ -26,6 +26,8 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+
 namespace Arinc665::Files {
 
 FileListFile::FileListFile( const SupportedArinc665Version version ) :
@@ -39,6 +41,36 @@ FileListFile::FileListFile( Helper::ConstRawDataSpan rawFile ) :
   decodeBody( rawFile );
 }
 
+FileListFile::FileListFile( Helper::ConstRawDataSpan rawFile, FileInfoTable &filesInfoTable ) :
+  ListFile{ rawFile, FileType::FileList }
+{
+  decodeBody( rawFile, &filesInfoTable );
+}
+
+FileInfoTable FileListFile::decodeFilesInfoTable( Helper::ConstRawDataSpan rawFile )
+{
+  bool decodeV3Data{ false };
+
+  switch ( checkHeader( rawFile, FileType::FileList ) )
+  {
+    case SupportedArinc665Version::Supplement2:
+      break;
+
+    case SupportedArinc665Version::Supplement345:
+      decodeV3Data = true;
+      break;
+
+    default:
+      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
+  }
+
+  // file list pointer
+  const auto [ _, fileListPtr ]{
+    Helper::RawData_getInt< uint32_t >( rawFile.subspan( MediaSetFilesPointerFieldOffsetV2 ) ) };
+
+  return FileInfoTable::decode( fileListData( rawFile, fileListPtr ), decodeV3Data );
+}
+
 FileListFile& FileListFile::operator=( Helper::ConstRawDataSpan rawFile )
 {
   Arinc665File::operator =( rawFile );
@@ -164,117 +196,75 @@ bool FileListFile::belongsToSameMediaSet( const FileListFile &other ) const
   return true;
 }
 
-Helper::RawData FileListFile::encode() const
+std::size_t FileListFile::encodedSize() const
 {
-  bool encodeV3Data{ false };
-  std::size_t baseSize;
-
-  switch ( arincVersion() )
-  {
-    case SupportedArinc665Version::Supplement2:
-      baseSize = FileHeaderSizeV2;
-      break;
-
-    case SupportedArinc665Version::Supplement345:
-      encodeV3Data = true;
-      baseSize = FileHeaderSizeV3;
-      break;
-
-    default:
-      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
-  }
+  return encodingLayout().size;
+}
 
-  Helper::RawData rawFile( baseSize );
+void FileListFile::encode( Helper::RawDataSpan rawFile ) const
+{
+  const auto layout{ encodingLayout() };
+  checkEncodeBuffer( rawFile, layout.size );
 
   // spare field
-  Helper::RawData_setInt< uint16_t>( Helper::RawDataSpan{ rawFile }.subspan( SpareFieldOffsetV2 ), 0U );
-
-  // Next free Offset (used for optional pointer calculation)
-  ptrdiff_t nextFreeOffset{ static_cast< ptrdiff_t>( rawFile.size() ) };
-
+  Helper::RawData_setInt< uint16_t>( rawFile.subspan( SpareFieldOffsetV2 ), 0U );
 
   // media set information
-  const auto rawMediaInformation{ encodeMediaInformation() };
-  assert( rawMediaInformation.size() % 2 == 0 );
-  rawFile.insert( rawFile.end(), rawMediaInformation.begin(), rawMediaInformation.end() );
-
-  // Update Pointer
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( MediaSetPartNumberPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += static_cast< ptrdiff_t >( rawMediaInformation.size() );
-
+    rawFile.subspan( MediaSetPartNumberPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.mediaInformationOffset / 2U ) );
+  encodeMediaInformation( rawFile.subspan( layout.mediaInformationOffset ) );
 
   // media set files list
-  const auto rawFilesInfo{ encodeFilesInfo( encodeV3Data ) };
-  assert( rawFilesInfo.size() % 2 == 0 );
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( MediaSetFilesPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += static_cast< ptrdiff_t>( rawFilesInfo.size() );
-
-  rawFile.insert( rawFile.end(), rawFilesInfo.begin(), rawFilesInfo.end() );
+    rawFile.subspan( MediaSetFilesPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.filesInfoOffset / 2U ) );
+  encodeFilesInfo(
+    rawFile.subspan( layout.filesInfoOffset, layout.userDefinedDataOffset - layout.filesInfoOffset ),
+    layout.encodeV3Data );
 
   // user defined data
   assert( userDefinedDataV.size() % 2 == 0);
-  uint32_t userDefinedDataPtr = 0;
-
-  if ( !userDefinedDataV.empty() )
-  {
-    userDefinedDataPtr = static_cast< uint32_t >( nextFreeOffset / 2U );
-    nextFreeOffset += static_cast< ptrdiff_t>( userDefinedDataV.size() );
-
-    rawFile.insert( rawFile.end(), userDefinedDataV.begin(), userDefinedDataV.end() );
-  }
-
-  // update User Defined Data Pointer
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( UserDefinedDataPointerFieldOffsetV2 ),
-    userDefinedDataPtr );
+    rawFile.subspan( UserDefinedDataPointerFieldOffsetV2 ),
+    userDefinedDataV.empty() ? 0U : static_cast< uint32_t >( layout.userDefinedDataOffset / 2U ) );
+  std::ranges::copy( userDefinedDataV, rawFile.subspan( layout.userDefinedDataOffset ).begin() );
 
-
-  // Update Check Value Pointer (only in V3 mode)
+  // Check Value Pointer (only in V3 mode)
   // must be done before check value and CRC generation
-  size_t checkValueSize{ 0U };
-  if ( encodeV3Data )
+  if ( layout.encodeV3Data )
   {
-    // Check Value Pointer
     Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFile }.subspan( FileCheckValuePointerFieldOffsetV3 ),
-      static_cast< uint32_t >( nextFreeOffset / 2 ) );
-
-    // Update size
-    checkValueSize = CheckValueUtils_size( checkValueTypeV );
+      rawFile.subspan( FileCheckValuePointerFieldOffsetV3 ),
+      static_cast< uint32_t >( layout.checkValueOffset / 2U ) );
   }
 
-  // set header ( Check Value and File CRC must be added to size field
+  // set header
   // must be done before check value and CRC generation
-  insertHeader( rawFile, checkValueSize + sizeof( uint16_t ) );
+  insertHeader( rawFile );
 
   // Check Value (only in V3 mode)
-  if ( encodeV3Data )
+  if ( layout.encodeV3Data )
   {
-    // calculate and encode File Load Check Value
-    const auto rawCheckValue{ CheckValueUtils_encode(
-      Arinc645::CheckValueGenerator::checkValue(
-        checkValueTypeV,
-        std::as_bytes( Helper::ConstRawDataSpan{ rawFile } ) ).value_or( Arinc645::CheckValue::NoCheckValue ) ) };
-    assert( rawCheckValue.size() % 2 == 0 );
-
-    rawFile.insert( rawFile.end(), rawCheckValue.begin(), rawCheckValue.end() );
+    // calculate and encode File Check Value
+    const auto checkValue{ Arinc645::CheckValueGenerator::checkValue(
+      checkValueTypeV,
+      Helper::ConstRawDataSpan{ rawFile.first( layout.checkValueOffset ) } ).value_or(
+        Arinc645::CheckValue::NoCheckValue ) };
+
+    const auto remaining{ CheckValueUtils_encode(
+      rawFile.subspan(
+        layout.checkValueOffset,
+        layout.size - DefaultChecksumPosition - layout.checkValueOffset ),
+      checkValue ) };
+    std::ranges::fill( remaining, std::byte{ 0U } );
   }
 
-  // Resize to final size ( File CRC)
-  rawFile.resize( rawFile.size() + sizeof( uint16_t ) );
-
   // set CRC
   calculateFileCrc( rawFile );
-
-  return rawFile;
 }
 
-void FileListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
+void FileListFile::decodeBody( Helper::ConstRawDataSpan rawFile, FileInfoTable * const filesInfoTable )
 {
   bool decodeV3Data{ false };
 
@@ -330,7 +320,15 @@ void FileListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   decodeMediaInformation( rawFile.subspan( 2ULL * mediaInformationPtr ) );
 
   // file list
-  decodeFilesInfo( rawFile.subspan( fileListPtr * 2ULL ), decodeV3Data );
+  if ( nullptr != filesInfoTable )
+  {
+    filesV.clear();
+    *filesInfoTable = FileInfoTable::decode( fileListData( rawFile, fileListPtr ), decodeV3Data );
+  }
+  else
+  {
+    decodeFilesInfo( rawFile.subspan( fileListPtr * 2ULL ), decodeV3Data );
+  }
 
   // user defined data
   if ( 0 != userDefinedDataPtr )
@@ -379,10 +377,54 @@ void FileListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   // file crc decoded and checked within base class
 }
 
-Helper::RawData FileListFile::encodeFilesInfo( const bool encodeV3Data ) const
+Helper::ConstRawDataSpan FileListFile::fileListData(
+  Helper::ConstRawDataSpan rawFile,
+  const uint32_t fileListPtr )
+{
+  // the file list must be located between header and file CRC
+  const auto rawBody{ rawFile.first( rawFile.size() - DefaultChecksumPosition ) };
+
+  if ( ( fileListPtr * 2ULL < FileHeaderSizeV2 ) || ( fileListPtr * 2ULL >= rawBody.size() ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "Invalid Pointers" } );
+  }
+
+  return rawBody.subspan( fileListPtr * 2ULL );
+}
+
+FileListFile::EncodingLayout FileListFile::encodingLayout() const
 {
-  Helper::RawData rawFilesInfo( sizeof( uint16_t ) );
+  EncodingLayout layout{};
+
+  switch ( arincVersion() )
+  {
+    case SupportedArinc665Version::Supplement2:
+      layout.encodeV3Data = false;
+      layout.mediaInformationOffset = FileHeaderSizeV2;
+      break;
+
+    case SupportedArinc665Version::Supplement345:
+      layout.encodeV3Data = true;
+      layout.mediaInformationOffset = FileHeaderSizeV3;
+      break;
+
+    default:
+      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
+  }
+
+  layout.filesInfoOffset = layout.mediaInformationOffset + mediaInformationSize();
+  layout.userDefinedDataOffset = layout.filesInfoOffset + filesInfoSize( layout.encodeV3Data );
+  layout.checkValueOffset = layout.userDefinedDataOffset + userDefinedDataV.size();
+  layout.size =
+    layout.checkValueOffset
+    + ( layout.encodeV3Data ? CheckValueUtils_size( checkValueTypeV ) : 0U )
+    + sizeof( uint16_t );
 
+  return layout;
+}
+
+std::size_t FileListFile::filesInfoSize( const bool encodeV3Data ) const
+{
   // Number of files must not exceed field
   if ( filesV.size() > std::numeric_limits< uint16_t>::max() )
   {
@@ -390,56 +432,68 @@ Helper::RawData FileListFile::encodeFilesInfo( const bool encodeV3Data ) const
       << Helper::AdditionalInfo{ "More files than allowed" } );
   }
 
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &fileInfo : filesV )
+  {
+    size += fileInfoSize( fileInfo, encodeV3Data );
+  }
+
+  return size;
+}
+
+std::size_t FileListFile::fileInfoSize( const FileInfo &fileInfo, const bool encodeV3Data )
+{
+  return
+    sizeof( uint16_t ) // next file pointer
+    + StringUtils_encodedStringSize( fileInfo.filename )
+    + StringUtils_encodedStringSize( fileInfo.pathName )
+    + ( 2U * sizeof( uint16_t ) ) // member sequence number + CRC
+    + ( encodeV3Data ? CheckValueUtils_encodedSize( fileInfo.checkValue ) : 0U );
+}
+
+void FileListFile::encodeFilesInfo( Helper::RawDataSpan rawFilesInfo, const bool encodeV3Data ) const
+{
   // number of files
-  Helper::RawData_setInt< uint16_t >( rawFilesInfo, static_cast< uint16_t >( filesV.size() ) );
+  auto remaining{
+    Helper::RawData_setInt< uint16_t >( rawFilesInfo, static_cast< uint16_t >( filesV.size() ) ) };
 
   // iterate over files
-  uint16_t fileCounter{ 0 };
+  std::size_t fileCounter{ 0U };
   for ( auto const &fileInfo : filesV )
   {
     ++fileCounter;
 
-    Helper::RawData rawFileInfo( sizeof( uint16_t) );
+    // next file pointer (is set to 0 for last file)
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
+      ( fileCounter == filesV.size() ) ?
+        0U :
+        static_cast< uint16_t >( fileInfoSize( fileInfo, encodeV3Data ) / 2U ) );
 
     // filename
-    auto const rawFilename{ StringUtils_encodeString( fileInfo.filename ) };
-    assert( rawFilename.size() % 2 == 0 );
-    rawFileInfo.insert( rawFileInfo.end(), rawFilename.begin(), rawFilename.end() );
+    remaining = StringUtils_encodeString( remaining, fileInfo.filename );
 
     // path name
-    auto const rawPathname{ StringUtils_encodeString( fileInfo.pathName ) };
-    assert( rawPathname.size() % 2 == 0);
-    rawFileInfo.insert( rawFileInfo.end(), rawPathname.begin(), rawPathname.end() );
-
-    rawFileInfo.resize( rawFileInfo.size() + ( 2 * sizeof( uint16_t ) ) );
+    remaining = StringUtils_encodeString( remaining, fileInfo.pathName );
 
     // member sequence number
-    auto next{ Helper::RawData_setInt< uint16_t>(
-      Helper::RawDataSpan{ rawFileInfo }.last( 2 * sizeof( uint16_t ) ),
-      static_cast< uint8_t >( fileInfo.memberSequenceNumber ) ) };
+    remaining = Helper::RawData_setInt< uint16_t>(
+      remaining,
+      static_cast< uint8_t >( fileInfo.memberSequenceNumber ) );
 
     // crc
-    Helper::RawData_setInt< uint16_t>( next, fileInfo.crc );
+    remaining = Helper::RawData_setInt< uint16_t>( remaining, fileInfo.crc );
 
     // following fields are available in ARINC 665-3 ff
     if ( encodeV3Data )
     {
       // check Value
-      const auto rawCheckValue{ CheckValueUtils_encode( fileInfo.checkValue ) };
-      assert( rawCheckValue.size() % 2 == 0 );
-      rawFileInfo.insert( rawFileInfo.end(), rawCheckValue.begin(), rawCheckValue.end() );
+      remaining = CheckValueUtils_encode( remaining, fileInfo.checkValue );
     }
-
-    // next file pointer (is set to 0 for last file)
-    Helper::RawData_setInt< uint16_t >(
-      rawFileInfo,
-      ( fileCounter == numberOfFiles() ) ? 0U : static_cast< uint16_t >( rawFileInfo.size() / 2U ) );
-
-    // add file info to files info
-    rawFilesInfo.insert( rawFilesInfo.end(), rawFileInfo.begin(), rawFileInfo.end() );
   }
 
-  return rawFilesInfo;
+  assert( remaining.empty() );
 }
 
 void FileListFile::decodeFilesInfo( Helper::ConstRawDataSpan rawData, const bool decodeV3Data )
@@ -16,6 +16,7 @@
 #include <arinc_665/files/Files.hpp>
 #include <arinc_665/files/ListFile.hpp>
 #include <arinc_665/files/FileInfo.hpp>
+#include <arinc_665/files/FileInfoTable.hpp>
 
 #include <arinc_645/Arinc645.hpp>
 
@@ -113,6 +114,42 @@ class ARINC_665_EXPORT FileListFile final : public ListFile
      **/
     explicit FileListFile( Helper::ConstRawDataSpan rawFile );
 
+    /**
+     * @brief Creates a file list file from the given raw data and bulk decodes its file list.
+     *
+     * The file list is decoded into @p filesInfoTable instead of files(), which stays empty.
+     * This avoids the per-entry allocations of files(), when the file list is only iterated.
+     *
+     * @param[in] rawFile
+     *   Raw data file representation.
+     * @param[out] filesInfoTable
+     *   Decoded File Information Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file or the file list is invalid.
+     *
+     * @sa FileInfoTable::decode()
+     **/
+    FileListFile( Helper::ConstRawDataSpan rawFile, FileInfoTable &filesInfoTable );
+
+    /**
+     * @brief Bulk decodes the file list of the given raw file list file.
+     *
+     * Only the file header, the CRC and the file list are decoded.
+     * This is used, when only the files information is of interest, and avoids the per-entry allocations of files().
+     *
+     * @param[in] rawFile
+     *   Raw data file representation.
+     *
+     * @return File Information Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file or the file list is invalid.
+     *
+     * @sa FileInfoTable::decode()
+     **/
+    [[nodiscard]] static FileInfoTable decodeFilesInfoTable( Helper::ConstRawDataSpan rawFile );
+
     //! Destructor.
     ~FileListFile() override = default;
 
@@ -122,6 +159,12 @@ class ARINC_665_EXPORT FileListFile final : public ListFile
     //! @copydoc ListFile::fileType() const noexcept
     [[nodiscard]] FileType fileType() const noexcept override;
 
+    //! @copydoc ListFile::encodedSize() const
+    [[nodiscard]] std::size_t encodedSize() const override;
+
+    //! @copydoc ListFile::encode(Helper::RawDataSpan) const
+    void encode( Helper::RawDataSpan rawFile ) const override;
+
     /**
      * @name Files
      * @sa FileInfo, FilesInfo
@@ -224,26 +267,91 @@ class ARINC_665_EXPORT FileListFile final : public ListFile
     [[nodiscard]] bool belongsToSameMediaSet( const FileListFile &other ) const;
 
   private:
-    //! @copydoc ListFile::encode
-    [[nodiscard]] Helper::RawData encode() const override;
+    //! Offsets and Size of the encoded File List File
+    struct EncodingLayout
+    {
+      //! If set to true, additional data as stated in ARINC 665-3 is encoded.
+      bool encodeV3Data;
+      //! Offset of the Media Information
+      std::size_t mediaInformationOffset;
+      //! Offset of the Files Information List
+      std::size_t filesInfoOffset;
+      //! Offset of the User Defined Data
+      std::size_t userDefinedDataOffset;
+      //! Offset of the File Check Value (Only ARINC 665-3/4)
+      std::size_t checkValueOffset;
+      //! Size of the encoded File
+      std::size_t size;
+    };
+
+    /**
+     * @brief Calculates the pointer offsets and the size of the encoded file.
+     *
+     * @return Encoding Layout.
+     **/
+    [[nodiscard]] EncodingLayout encodingLayout() const;
 
     /**
      * @brief Decodes the body of the file list file.
      *
      * @param[in] rawFile
      *   Raw file list file representation.
+     * @param[out] filesInfoTable
+     *   If set, the file list is bulk decoded into this table instead of files().
      **/
-    void decodeBody( Helper::ConstRawDataSpan rawFile );
+    void decodeBody( Helper::ConstRawDataSpan rawFile, FileInfoTable * filesInfoTable = nullptr );
 
     /**
-     * @brief Encodes the files information list.
+     * @brief Returns the file list referenced by the file list pointer.
+     *
+     * @param[in] rawFile
+     *   Raw file list file representation.
+     * @param[in] fileListPtr
+     *   File List Pointer (16-bit words).
+     *
+     * @return File list raw data, which ends before the file CRC.
+     *
+     * @throw InvalidArinc665File
+     *   When the pointer is invalid.
+     **/
+    [[nodiscard]] static Helper::ConstRawDataSpan fileListData(
+      Helper::ConstRawDataSpan rawFile,
+      uint32_t fileListPtr );
+
+    /**
+     * @brief Returns the size of the encoded files information list.
+     *
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
      *
+     * @return Size of the encoded files information list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of files exceeds the number of files field.
+     **/
+    [[nodiscard]] std::size_t filesInfoSize( bool encodeV3Data ) const;
+
+    /**
+     * @brief Returns the size of the encoded file information entry.
+     *
+     * @param[in] fileInfo
+     *   File Information.
      * @param[in] encodeV3Data
      *   If set to true, additional data as stated in ARINC 665-3 is encoded.
      *
-     * @return Raw representation of files information list.
+     * @return Size of the encoded file information entry.
+     **/
+    [[nodiscard]] static std::size_t fileInfoSize( const FileInfo &fileInfo, bool encodeV3Data );
+
+    /**
+     * @brief Encodes the files information list.
+     *
+     * @param[out] rawFilesInfo
+     *   Target buffer of filesInfoSize() bytes.
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
      **/
-    [[nodiscard]] Helper::RawData encodeFilesInfo( bool encodeV3Data ) const;
+    void encodeFilesInfo( Helper::RawDataSpan rawFilesInfo, bool encodeV3Data ) const;
 
     /**
      * @brief Decodes the files information list from the raw data.
@@ -55,6 +55,7 @@ class Arinc665File;
 struct LoadFileInfo;
 //! Load Files Information.
 using LoadFilesInfo = std::list< LoadFileInfo >;
+class LoadFileInfoTable;
 class LoadHeaderFile;
 
 /** @} **/
@@ -110,6 +111,7 @@ class LoadListFile;
 struct FileInfo;
 //! Files Information.
 using FilesInfo = std::list< FileInfo >;
+class FileInfoTable;
 class FileListFile;
 
 /** @} **/
@@ -75,24 +75,21 @@ ListFile::ListFile(
 {
 }
 
-Helper::RawData ListFile::encodeMediaInformation() const
+std::size_t ListFile::mediaInformationSize() const noexcept
 {
-  // media set part number
-  auto rawMediaInformation{ StringUtils_encodeString( mediaSetPn() ) };
-  assert( rawMediaInformation.size() % 2 == 0U );
-
-  const auto partNumberSize{ static_cast< ptrdiff_t >( rawMediaInformation.size() ) };
+  return StringUtils_encodedStringSize( mediaSetPnV ) + ( 2U * sizeof( uint8_t ) );
+}
 
-  rawMediaInformation.resize( partNumberSize + ( 2U * sizeof( uint8_t ) ) );
-  auto remaining{ Helper::RawDataSpan{ rawMediaInformation}.subspan( partNumberSize ) };
+Helper::RawDataSpan ListFile::encodeMediaInformation( Helper::RawDataSpan rawData ) const
+{
+  // media set part number
+  auto remaining{ StringUtils_encodeString( rawData, mediaSetPnV ) };
 
   // media sequence number
   remaining = Helper::RawData_setInt( remaining, static_cast< uint8_t >( mediaSequenceNumberV ) );
 
   // number of media set members
-  Helper::RawData_setInt< uint8_t>( remaining, static_cast< uint8_t >( numberOfMediaSetMembersV ) );
-
-  return rawMediaInformation;
+  return Helper::RawData_setInt< uint8_t>( remaining, static_cast< uint8_t >( numberOfMediaSetMembersV ) );
 }
 
 void ListFile::decodeMediaInformation( Helper::ConstRawDataSpan rawData )
@@ -154,12 +154,23 @@ class ARINC_665_EXPORT ListFile : public Arinc665File
     //! @copydoc operator=(const Arinc665File&)
     ListFile& operator=( ListFile &&other ) = default;
 
+    /**
+     * @brief Returns the size of the encoded Media Information.
+     *
+     * @return Size of the encoded Media Information.
+     **/
+    [[nodiscard]] std::size_t mediaInformationSize() const noexcept;
+
     /**
      * @brief Encodes the Media Information.
      *
-     * @return Raw representation of Media Information.
+     * @param[out] rawData
+     *   Target buffer.
+     *   Must provide at least mediaInformationSize() bytes.
+     *
+     * @return Remaining buffer after the Media Information.
      **/
-    [[nodiscard]] Helper::RawData encodeMediaInformation() const;
+    Helper::RawDataSpan encodeMediaInformation( Helper::RawDataSpan rawData ) const;
 
     /**
      * @brief Decodes the Media Information.
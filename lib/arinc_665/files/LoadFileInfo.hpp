@@ -15,6 +15,8 @@
 
 #include <arinc_665/files/Files.hpp>
 
+#include <arinc_665/Symbol.hpp>
+
 #include <arinc_645/CheckValue.hpp>
 
 #include <cstdint>
@@ -36,7 +38,7 @@ struct ARINC_665_EXPORT LoadFileInfo
   //! Filename
   std::string filename;
   //! File Part Number
-  std::string partNumber;
+  Symbol partNumber;
   //! File Length (Always in bytes)
   uint64_t length{};
   //! File CRC
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Files::LoadFileInfoTable.
+ **/
+
+#include "LoadFileInfoTable.hpp"
+
+#include <arinc_665/files/LoadFileInfo.hpp>
+#include <arinc_665/files/StringUtils.hpp>
+#include <arinc_665/files/CheckValueUtils.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <tuple>
+
+namespace Arinc665::Files {
+
+namespace {
+
+//! Size of the fixed fields following the strings of a load file list entry (File Length, CRC)
+constexpr std::size_t FixedFieldsSize{ sizeof( uint32_t ) + sizeof( uint16_t ) };
+
+/**
+ * @brief Returns the file list entry at @p offset and checks its next file pointer.
+ *
+ * @param[in] rawData
+ *   File list raw data.
+ * @param[in] offset
+ *   Offset of the entry within @p rawData.
+ * @param[in] lastEntry
+ *   If the entry is the last one of the list.
+ *
+ * @return Entry data (limited by the next file pointer) and the offset of the next entry.
+ *
+ * @throw InvalidArinc665File
+ *   When the next file pointer is invalid.
+ **/
+std::tuple< Helper::ConstRawDataSpan, std::size_t > listEntry(
+  Helper::ConstRawDataSpan rawData,
+  const std::size_t offset,
+  const bool lastEntry )
+{
+  if ( rawData.size() < offset + sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list entry exceeds file" } );
+  }
+
+  const auto [ _, filePointer ]{ Helper::RawData_getInt< uint16_t >( rawData.subspan( offset ) ) };
+
+  if ( lastEntry )
+  {
+    if ( 0U != filePointer )
+    {
+      BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer is not 0" } );
+    }
+
+    return { rawData.subspan( offset ), rawData.size() };
+  }
+
+  if ( 0U == filePointer )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer is 0" } );
+  }
+
+  const auto entrySize{ 2U * static_cast< std::size_t >( filePointer ) };
+
+  if ( rawData.size() < offset + entrySize )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "next file pointer exceeds file" } );
+  }
+
+  return { rawData.subspan( offset, entrySize ), offset + entrySize };
+}
+
+/**
+ * @brief Copies the already validated string at the begin of @p rawData into the string arena.
+ *
+ * @param[in,out] strings
+ *   String arena. Must be reserved in advance, so no reallocation takes place.
+ * @param[in] rawData
+ *   Raw data starting at the string length field.
+ *
+ * @return Remaining data (behind the fill character) and the string referencing the arena.
+ **/
+std::tuple< Helper::ConstRawDataSpan, std::string_view > appendString(
+  std::vector< char > &strings,
+  Helper::ConstRawDataSpan rawData )
+{
+  const auto [ stringData, stringLength ]{ Helper::RawData_getInt< uint16_t >( rawData ) };
+
+  const auto begin{ strings.size() };
+  std::ranges::transform(
+    stringData.first( stringLength ),
+    std::back_inserter( strings ),
+    []( const std::byte character ) { return static_cast< char >( character ); } );
+
+  return {
+    stringData.subspan( stringLength + ( stringLength % 2U ) ),
+    std::string_view{ strings.data() + begin, stringLength } };
+}
+
+}
+
+LoadFileInfoTable LoadFileInfoTable::decodeDataFiles( Helper::ConstRawDataSpan rawData, const bool decodeV3Data )
+{
+  return decode( rawData, true, decodeV3Data );
+}
+
+LoadFileInfoTable LoadFileInfoTable::decodeSupportFiles( Helper::ConstRawDataSpan rawData, const bool decodeV3Data )
+{
+  return decode( rawData, false, decodeV3Data );
+}
+
+std::size_t LoadFileInfoTable::size() const noexcept
+{
+  return entriesV.size();
+}
+
+bool LoadFileInfoTable::empty() const noexcept
+{
+  return entriesV.empty();
+}
+
+const LoadFileInfoTable::Entries& LoadFileInfoTable::entries() const noexcept
+{
+  return entriesV;
+}
+
+LoadFilesInfo LoadFileInfoTable::filesInfo() const
+{
+  LoadFilesInfo files{};
+
+  for ( const auto &entry : entriesV )
+  {
+    files.emplace_back( LoadFileInfo{
+      .filename = std::string{ entry.filename },
+      .partNumber = Symbol{ entry.partNumber },
+      .length = entry.length,
+      .crc = entry.crc,
+      .checkValue = entry.checkValue } );
+  }
+
+  return files;
+}
+
+LoadFileInfoTable LoadFileInfoTable::decode(
+  Helper::ConstRawDataSpan rawData,
+  const bool dataFiles,
+  const bool decodeV3Data )
+{
+  if ( rawData.size() < sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list exceeds file" } );
+  }
+
+  const auto [ _, numberOfFiles ]{ Helper::RawData_getInt< uint16_t >( rawData ) };
+
+  // fixed fields incl. ARINC 665-3 length in bytes and check value length field
+  const auto fixedFieldsSize{ FixedFieldsSize
+    + ( ( decodeV3Data && dataFiles ) ? sizeof( uint64_t ) : 0U )
+    + ( decodeV3Data ? sizeof( uint16_t ) : 0U ) };
+
+  // first pass: walk pointer chain, check entries and sum up string sizes
+  std::size_t stringsSize{ 0U };
+
+  for ( std::size_t fileIndex{ 0U }, entryOffset{ sizeof( uint16_t ) }; fileIndex < numberOfFiles; ++fileIndex )
+  {
+    const auto [ entry, nextEntryOffset ]{ listEntry( rawData, entryOffset, fileIndex + 1U == numberOfFiles ) };
+
+    auto remaining{ entry.subspan( sizeof( uint16_t ) ) };
+
+    std::string_view filename{};
+    std::tie( remaining, filename ) = StringUtils_decodeString( remaining );
+
+    std::string_view partNumber{};
+    std::tie( remaining, partNumber ) = StringUtils_decodeString( remaining );
+
+    if ( remaining.size() < fixedFieldsSize )
+    {
+      BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "file list entry too small" } );
+    }
+
+    if ( decodeV3Data )
+    {
+      const auto checkValueOffset{ fixedFieldsSize - sizeof( uint16_t ) };
+      const auto [ _1, checkValueLength ]{
+        Helper::RawData_getInt< uint16_t >( remaining.subspan( checkValueOffset ) ) };
+
+      if ( remaining.size() < checkValueOffset + checkValueLength )
+      {
+        BOOST_THROW_EXCEPTION( InvalidArinc665File{}
+          << Helper::AdditionalInfo{ "check value exceeds file list entry" } );
+      }
+    }
+
+    stringsSize += filename.size() + partNumber.size();
+    entryOffset = nextEntryOffset;
+  }
+
+  LoadFileInfoTable table{};
+  table.stringsV.reserve( stringsSize );
+  table.entriesV.reserve( numberOfFiles );
+
+  // second pass: extract entries
+  for ( std::size_t fileIndex{ 0U }, entryOffset{ sizeof( uint16_t ) }; fileIndex < numberOfFiles; ++fileIndex )
+  {
+    auto [ remaining, filePointer ]{ Helper::RawData_getInt< uint16_t >( rawData.subspan( entryOffset ) ) };
+
+    auto &entry{ table.entriesV.emplace_back() };
+
+    std::tie( remaining, entry.filename ) = appendString( table.stringsV, remaining );
+    std::tie( remaining, entry.partNumber ) = appendString( table.stringsV, remaining );
+
+    // data files: number of 16-bit words, support files: number of bytes
+    uint32_t length{};
+    std::tie( remaining, length ) = Helper::RawData_getInt< uint32_t >( remaining );
+    entry.length = dataFiles ? ( length * 2ULL ) : length;
+
+    std::tie( remaining, entry.crc ) = Helper::RawData_getInt< uint16_t >( remaining );
+
+    // following fields are available in ARINC 665-3 ff
+    if ( decodeV3Data )
+    {
+      if ( dataFiles )
+      {
+        uint64_t fileLengthInBytes{};
+        std::tie( remaining, fileLengthInBytes ) = Helper::RawData_getInt< uint64_t >( remaining );
+
+        // check length fields for consistency
+        if ( ( ( fileLengthInBytes + 1 ) / 2 ) <= std::numeric_limits< uint32_t >::max()
+          && ( length != ( static_cast< uint32_t >( ( fileLengthInBytes + 1 ) / 2 ) ) ) )
+        {
+          BOOST_THROW_EXCEPTION( Arinc665Exception() << Helper::AdditionalInfo{ "Inconsistent length fields" } );
+        }
+
+        entry.length = fileLengthInBytes;
+      }
+
+      entry.checkValue = CheckValueUtils_decode( remaining );
+    }
+    else
+    {
+      entry.checkValue = Arinc645::CheckValue::NoCheckValue;
+    }
+
+    entryOffset += 2U * static_cast< std::size_t >( filePointer );
+  }
+
+  return table;
+}
+
+}
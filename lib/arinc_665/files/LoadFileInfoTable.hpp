@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Files::LoadFileInfoTable.
+ **/
+
+#ifndef ARINC_665_FILES_LOADFILEINFOTABLE_HPP
+#define ARINC_665_FILES_LOADFILEINFOTABLE_HPP
+
+#include <arinc_665/files/Files.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Arinc665::Files {
+
+/**
+ * @brief ARINC 665 Load %File Information Table.
+ *
+ * Bulk decoded data file list or support file list of the ARINC 665 Load Header File.
+ * In contrast to LoadFilesInfo, the entries are stored within a contiguous vector and all filenames and part numbers
+ * are stored within a single string arena, which is allocated once.
+ *
+ * The entries reference the string arena.
+ * Therefore, the table is move-only.
+ *
+ * @sa LoadHeaderFile::decodeDataFilesTable()
+ * @sa LoadHeaderFile::decodeSupportFilesTable()
+ * @sa LoadFileInfo
+ **/
+class ARINC_665_EXPORT LoadFileInfoTable final
+{
+  public:
+    //! Load File Information Table Entry
+    struct Entry
+    {
+      //! Filename (references the string arena)
+      std::string_view filename;
+      //! File Part Number (references the string arena)
+      std::string_view partNumber;
+      //! File Length (Always in bytes)
+      uint64_t length{};
+      //! File CRC
+      uint16_t crc{};
+      //! Check Value (since ARINC 665-3)
+      Arinc645::CheckValue checkValue;
+    };
+
+    //! Table Entries
+    using Entries = std::vector< Entry >;
+
+    //! Initialises an empty table.
+    LoadFileInfoTable() = default;
+
+    //! Move Constructor (The string arena is moved, so the entries stay valid).
+    LoadFileInfoTable( LoadFileInfoTable &&other ) noexcept = default;
+
+    //! Move Assignment (The string arena is moved, so the entries stay valid).
+    LoadFileInfoTable& operator=( LoadFileInfoTable &&other ) noexcept = default;
+
+    // Deleted Copy Constructor
+    LoadFileInfoTable( const LoadFileInfoTable &other ) = delete;
+
+    // Deleted Copy Assignment
+    LoadFileInfoTable& operator=( const LoadFileInfoTable &other ) = delete;
+
+    /**
+     * @brief Decodes the data file list of an ARINC 665 Load Header File.
+     *
+     * The first pass walks the file pointer chain, bounds-checks each entry and sums up the string sizes.
+     * Afterwards the entry vector and the string arena are reserved, and the second pass extracts the entries without
+     * further allocations (despite the check values).
+     *
+     * @param[in] rawData
+     *   Raw data starting at the Number of Data Files field.
+     * @param[in] decodeV3Data
+     *   If set to true, the ARINC 665-3 length in bytes and check values are decoded.
+     *
+     * @return Decoded Load File Information Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file list is invalid.
+     * @throw Arinc665Exception
+     *   When the length fields are inconsistent.
+     **/
+    [[nodiscard]] static LoadFileInfoTable decodeDataFiles( Helper::ConstRawDataSpan rawData, bool decodeV3Data );
+
+    /**
+     * @brief Decodes the support file list of an ARINC 665 Load Header File.
+     *
+     * @param[in] rawData
+     *   Raw data starting at the Number of Support Files field.
+     * @param[in] decodeV3Data
+     *   If set to true, the ARINC 665-3 check values are decoded.
+     *
+     * @return Decoded Load File Information Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file list is invalid.
+     *
+     * @sa decodeDataFiles()
+     **/
+    [[nodiscard]] static LoadFileInfoTable decodeSupportFiles( Helper::ConstRawDataSpan rawData, bool decodeV3Data );
+
+    /**
+     * @brief Returns the number of entries.
+     *
+     * @return Number of entries.
+     **/
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Returns if the table is empty.
+     *
+     * @return If the table is empty.
+     **/
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief Returns the entries.
+     *
+     * @return Table entries.
+     **/
+    [[nodiscard]] const Entries& entries() const noexcept;
+
+    /**
+     * @brief Converts the table into the load files information list representation.
+     *
+     * @return Load Files Information.
+     **/
+    [[nodiscard]] LoadFilesInfo filesInfo() const;
+
+  private:
+    /**
+     * @brief Decodes a data or support file list.
+     *
+     * @param[in] rawData
+     *   Raw data starting at the Number of Files field.
+     * @param[in] dataFiles
+     *   If set to true, the data file list format is decoded, otherwise the support file list format.
+     * @param[in] decodeV3Data
+     *   If set to true, the ARINC 665-3 fields are decoded.
+     *
+     * @return Decoded Load File Information Table.
+     **/
+    [[nodiscard]] static LoadFileInfoTable decode(
+      Helper::ConstRawDataSpan rawData,
+      bool dataFiles,
+      bool decodeV3Data );
+
+    //! String Arena
+    std::vector< char > stringsV;
+    //! Entries
+    Entries entriesV;
+};
+
+}
+
+#endif
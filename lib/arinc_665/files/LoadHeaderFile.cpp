@@ -16,6 +16,7 @@
 #include <arinc_665/files/StringUtils.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <arinc_645/CheckValueGenerator.hpp>
 
@@ -26,6 +27,9 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+#include <cassert>
+
 namespace Arinc665::Files {
 
 void LoadHeaderFile::processLoadCrc( Helper::ConstRawDataSpan rawFile, Arinc645::Arinc645Crc32 &loadCrc )
@@ -113,6 +117,32 @@ Arinc645::CheckValue LoadHeaderFile::decodeLoadCheckValue( Helper::ConstRawDataS
   return CheckValueUtils_decode( rawFile.subspan( static_cast< size_t >( loadCheckValuePtr ) * 2U ) );
 }
 
+LoadFileInfoTable LoadHeaderFile::decodeDataFilesTable( Helper::ConstRawDataSpan rawFile )
+{
+  const auto [ rawFileList, decodeV3Data ]{ fileListData( rawFile, DataFilesPointerFieldOffsetV2 ) };
+
+  // data file list is mandatory
+  if ( rawFileList.empty() )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "Invalid Pointers" } );
+  }
+
+  return LoadFileInfoTable::decodeDataFiles( rawFileList, decodeV3Data );
+}
+
+LoadFileInfoTable LoadHeaderFile::decodeSupportFilesTable( Helper::ConstRawDataSpan rawFile )
+{
+  const auto [ rawFileList, decodeV3Data ]{ fileListData( rawFile, SupportFilesPointerFieldOffsetV2 ) };
+
+  // support file list is optional
+  if ( rawFileList.empty() )
+  {
+    return {};
+  }
+
+  return LoadFileInfoTable::decodeSupportFiles( rawFileList, decodeV3Data );
+}
+
 LoadHeaderFile::LoadHeaderFile( const SupportedArinc665Version version ) :
   Arinc665File{ version, FileCrcOffset }
 {
@@ -124,6 +154,15 @@ LoadHeaderFile::LoadHeaderFile( Helper::ConstRawDataSpan rawFile ) :
   decodeBody( rawFile );
 }
 
+LoadHeaderFile::LoadHeaderFile(
+  Helper::ConstRawDataSpan rawFile,
+  LoadFileInfoTable &dataFilesTable,
+  LoadFileInfoTable &supportFilesTable ) :
+  Arinc665File{ rawFile, FileType::LoadUploadHeader, FileCrcOffset }
+{
+  decodeBody( rawFile, &dataFilesTable, &supportFilesTable );
+}
+
 LoadHeaderFile& LoadHeaderFile::operator=( Helper::ConstRawDataSpan rawFile )
 {
   // call inherited operator
@@ -147,12 +186,12 @@ void LoadHeaderFile::partFlags( uint16_t partFlags ) noexcept
   partFlagsV = partFlags;
 }
 
-std::string_view LoadHeaderFile::partNumber() const
+Symbol LoadHeaderFile::partNumber() const
 {
   return partNumberV;
 }
 
-void LoadHeaderFile::partNumber( std::string partNumber )
+void LoadHeaderFile::partNumber( Symbol partNumber )
 {
   partNumberV = std::move( partNumber );
 }
@@ -172,7 +211,7 @@ void LoadHeaderFile::targetHardwareIds( TargetHardwareIds targetHardwareIds )
   targetHardwareIdsV = std::move( targetHardwareIds );
 }
 
-void LoadHeaderFile::targetHardwareId( std::string targetHardwareId )
+void LoadHeaderFile::targetHardwareId( Symbol targetHardwareId )
 {
   targetHardwareIdsV.emplace_back( std::move( targetHardwareId ) );
 }
@@ -192,7 +231,7 @@ void LoadHeaderFile::targetHardwareIdsPositions( TargetHardwareIdsPositions targ
   targetHardwareIdsPositionsV = std::move( targetHardwareIdsPositions );
 }
 
-void LoadHeaderFile::targetHardwareIdPositions( std::string targetHardwareId, Positions positions )
+void LoadHeaderFile::targetHardwareIdPositions( Symbol targetHardwareId, Positions positions )
 {
   targetHardwareIdsPositionsV.emplace_back( std::move( targetHardwareId ), std::move( positions ) );
 }
@@ -269,219 +308,129 @@ void LoadHeaderFile::loadCheckValueType( const Arinc645::CheckValueType type )
   loadCheckValueTypeV = type;
 }
 
-Helper::RawData LoadHeaderFile::encode() const
+std::size_t LoadHeaderFile::encodedSize() const
 {
-  bool encodeV3Data{ false };
-  std::size_t baseSize;
-
-  switch ( arincVersion() )
-  {
-    case SupportedArinc665Version::Supplement2:
-      // Spare
-      baseSize = LoadHeaderSizeV2;
-      break;
-
-    case SupportedArinc665Version::Supplement345:
-      // Part Flags
-      encodeV3Data = true;
-      baseSize = LoadHeaderSizeV3;
-      break;
+  return encodingLayout().size;
+}
 
-    default:
-      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
-  }
+void LoadHeaderFile::encode( Helper::RawDataSpan rawFile ) const
+{
+  ARINC_665_TRACE_SCOPE( "files", "Encode Load Header" );
 
-  Helper::RawData rawFile( baseSize );
+  const auto layout{ encodingLayout() };
+  checkEncodeBuffer( rawFile, layout.size );
 
   // Part Flags or Spare
   Helper::RawData_setInt< uint16_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( PartFlagsFieldOffsetV3 ),
-    encodeV3Data ? partFlagsV : 0U );
-
-  // Next free Offset (used for optional pointer calculation)
-  ptrdiff_t nextFreeOffset{ static_cast< ptrdiff_t>( rawFile.size() ) };
+    rawFile.subspan( PartFlagsFieldOffsetV3 ),
+    layout.encodeV3Data ? partFlagsV : 0U );
 
   // Load Part Number
-  auto rawLoadPn{ StringUtils_encodeString( partNumber() ) };
-  assert( rawLoadPn.size() % 2 == 0 );
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( LoadPartNumberPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2 ) );
-  nextFreeOffset += static_cast< ptrdiff_t>( rawLoadPn.size() );
-
-  rawFile.insert( rawFile.end(), rawLoadPn.begin(), rawLoadPn.end() );
-
+    rawFile.subspan( LoadPartNumberPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.partNumberOffset / 2U ) );
+  StringUtils_encodeString( rawFile.subspan( layout.partNumberOffset ), partNumber() );
 
   // Load Type (only in V3 mode)
-  if ( encodeV3Data )
+  if ( layout.encodeV3Data )
   {
-    uint32_t loadTypePtr{ 0 };
+    Helper::RawData_setInt< uint32_t >(
+      rawFile.subspan( LoadTypeDescriptionPointerFieldOffsetV3 ),
+      static_cast< uint32_t >( layout.loadTypeOffset / 2U ) );
 
     // Encode lode type only if set.
     if ( typeV )
     {
-      loadTypePtr = static_cast< uint32_t >( nextFreeOffset / 2 );
-
-      const auto rawTypeDescription{ StringUtils_encodeString( typeV->first ) };
-      assert( rawTypeDescription.size() % 2 == 0 );
-
       // description
-      rawFile.insert( rawFile.end(), rawTypeDescription.begin(), rawTypeDescription.end() );
+      auto remaining{ StringUtils_encodeString( rawFile.subspan( layout.loadTypeOffset ), typeV->first ) };
 
-      rawFile.resize( rawFile.size() + sizeof( uint16_t ) );
-      Helper::RawData_setInt< uint16_t >(
-        Helper::RawDataSpan{ rawFile }.subspan( nextFreeOffset + static_cast< ptrdiff_t >( rawTypeDescription.size() ) ),
-        typeV->second );
-
-      nextFreeOffset += static_cast< ptrdiff_t>( rawTypeDescription.size() + sizeof( uint16_t ) );
+      // type
+      Helper::RawData_setInt< uint16_t >( remaining, typeV->second );
     }
-
-    Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFile }.subspan( LoadTypeDescriptionPointerFieldOffsetV3 ),
-      loadTypePtr );
   }
 
   // THW ID list
-  auto rawThwIdsList{ StringUtils_encodeStrings( targetHardwareIdsV ) };
-  assert( rawThwIdsList.size() % 2 == 0 );
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( ThwIdsPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2 ) );
-  nextFreeOffset += static_cast< ptrdiff_t >( rawThwIdsList.size() );
-
-  rawFile.insert( rawFile.end(), rawThwIdsList.begin(), rawThwIdsList.end() );
-
+    rawFile.subspan( ThwIdsPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.thwIdsOffset / 2U ) );
+  StringUtils_encodeStrings( rawFile.subspan( layout.thwIdsOffset ), targetHardwareIdsV );
 
   // THW ID + Positions (only in V3 mode)
-  if ( encodeV3Data )
+  if ( layout.encodeV3Data )
   {
-    uint16_t thwIdPosCount{ 0 };
-    Helper::RawData rawThwPos( sizeof( uint16_t ) );
-
-    for ( const auto &[ thwId, positions ] : targetHardwareIdsPositionsV )
-    {
-      // skip if no positions are stored
-      if ( positions.empty() )
-      {
-        continue;
-      }
-
-      // THW ID
-      const auto rawThwId{ StringUtils_encodeString( thwId ) };
-      assert( rawThwId.size() % 2 == 0 );
-
-      rawThwPos.insert( rawThwPos.end(), rawThwId.begin(), rawThwId.end() );
-
-      // Positions
-      const auto rawPositions{ StringUtils_encodeStrings( positions ) };
-      assert( rawThwId.size() % 2 == 0 );
-
-      rawThwPos.insert( rawThwPos.end(), rawPositions.begin(), rawPositions.end() );
-
-      ++thwIdPosCount;
-    }
-
-    Helper::RawData_setInt< uint16_t>( rawThwPos, thwIdPosCount );
-
-    uint32_t thwIdPosPtr{ 0 };
+    Helper::RawData_setInt< uint32_t >(
+      rawFile.subspan( ThwIdPositionsPointerFieldOffsetV3 ),
+      static_cast< uint32_t >( layout.thwIdsPositionsOffset / 2U ) );
 
-    if ( 0 != thwIdPosCount )
+    if ( 0U != layout.thwIdsPositionsOffset )
     {
-      thwIdPosPtr = static_cast< uint32_t >( nextFreeOffset / 2 );
-      rawFile.insert( rawFile.end(), rawThwPos.begin(), rawThwPos.end() );
-      nextFreeOffset += static_cast< ptrdiff_t>( rawThwPos.size() );
+      encodeTargetHardwareIdsPositions(
+        rawFile.subspan( layout.thwIdsPositionsOffset, layout.dataFilesOffset - layout.thwIdsPositionsOffset ) );
     }
-
-    Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFile }.subspan( ThwIdPositionsPointerFieldOffsetV3 ),
-      thwIdPosPtr );
   }
 
-
-  // data files list pointer
-  auto rawDataFiles{ encodeDataFiles( encodeV3Data ) };
-  assert( rawDataFiles.size() % 2 == 0 );
-
+  // data files list
   Helper::RawData_setInt< uint32_t>(
-    Helper::RawDataSpan{ rawFile }.subspan( DataFilesPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2 ) );
-  nextFreeOffset += static_cast< ptrdiff_t>( rawDataFiles.size() );
-
-  rawFile.insert( rawFile.end(), rawDataFiles.begin(), rawDataFiles.end() );
-
+    rawFile.subspan( DataFilesPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.dataFilesOffset / 2U ) );
+  encodeDataFiles(
+    rawFile.subspan(
+      layout.dataFilesOffset,
+      ( ( 0U != layout.supportFilesOffset ) ? layout.supportFilesOffset : layout.userDefinedDataOffset )
+        - layout.dataFilesOffset ),
+    layout.encodeV3Data );
 
   // support files (only if support files are present)
-  auto rawSupportFiles{ encodeSupportFiles( encodeV3Data ) };
-  assert( rawSupportFiles.size() % 2 == 0 );
-
-  uint32_t supportFileListPtr{ 0 };
-
-  if ( !supportFiles().empty() )
-  {
-    supportFileListPtr = static_cast< uint32_t >( nextFreeOffset / 2 );
-    nextFreeOffset += static_cast< ptrdiff_t>( rawSupportFiles.size() );
-
-    rawFile.insert( rawFile.end(), rawSupportFiles.begin(), rawSupportFiles.end() );
-  }
-
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( SupportFilesPointerFieldOffsetV2 ),
-    supportFileListPtr );
+    rawFile.subspan( SupportFilesPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.supportFilesOffset / 2U ) );
 
-  // user defined data pointer
-  assert( userDefinedDataV.size() % 2 == 0 );
-  uint32_t userDefinedDataPtr{ 0 };
-
-  if ( !userDefinedDataV.empty() )
+  if ( 0U != layout.supportFilesOffset )
   {
-    userDefinedDataPtr = static_cast< uint32_t >( nextFreeOffset / 2 );
-    nextFreeOffset += static_cast< ptrdiff_t>( userDefinedDataV.size() );
-
-    rawFile.insert( rawFile.end(), userDefinedDataV.begin(), userDefinedDataV.end() );
+    encodeSupportFiles(
+      rawFile.subspan( layout.supportFilesOffset, layout.userDefinedDataOffset - layout.supportFilesOffset ),
+      layout.encodeV3Data );
   }
 
+  // user defined data
+  assert( userDefinedDataV.size() % 2 == 0 );
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( UserDefinedDataPointerFieldOffsetV2 ),
-    userDefinedDataPtr );
-
-  // amount of data of Check Values and CRCs
-  // by default File CRC (16bit) + load CRC (32 bit)
-  uint32_t checkValueCrcSizes{ sizeof( uint16_t ) + sizeof( uint32_t ) };
+    rawFile.subspan( UserDefinedDataPointerFieldOffsetV2 ),
+    userDefinedDataV.empty() ? 0U : static_cast< uint32_t >( layout.userDefinedDataOffset / 2U ) );
+  std::ranges::copy( userDefinedDataV, rawFile.subspan( layout.userDefinedDataOffset ).begin() );
 
   // Load Check Value (only in V3 mode)
-  if ( encodeV3Data )
+  if ( layout.encodeV3Data )
   {
     // Alternative implementation set Load Check Pointer to zero, when Load
     // Check Value is not given
 
-    checkValueCrcSizes += static_cast< uint32_t >( CheckValueUtils_size( loadCheckValueTypeV ) );
-
     // Set Pointer to Load Check Value Field
     Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFile }.subspan( LoadCheckValuePointerFieldOffsetV3 ),
-      static_cast< uint32_t >( nextFreeOffset / 2 ) );
-
-    // actual check value must be encoded by external means
+      rawFile.subspan( LoadCheckValuePointerFieldOffsetV3 ),
+      static_cast< uint32_t >( layout.checkValueOffset / 2U ) );
   }
 
-  // set header
-  insertHeader( rawFile, checkValueCrcSizes );
+  // Check Value + File CRC + Load CRC
+  // actual check value and load CRC must be encoded by external means
+  std::ranges::fill( rawFile.subspan( layout.checkValueOffset ), std::byte{ 0U } );
 
-  // Resize to final size ( Check Value + File CRC + Load CRC)
-  rawFile.resize( rawFile.size() + checkValueCrcSizes );
+  // set header
+  insertHeader( rawFile );
 
   // set CRC
   calculateFileCrc( rawFile );
-
-  // load CRC must be encoded by external means
-
-  return rawFile;
 }
 
-void LoadHeaderFile::decodeBody( Helper::ConstRawDataSpan rawFile )
+void LoadHeaderFile::decodeBody(
+  Helper::ConstRawDataSpan rawFile,
+  LoadFileInfoTable * const dataFilesTable,
+  LoadFileInfoTable * const supportFilesTable )
 {
+  assert( ( nullptr == dataFilesTable ) == ( nullptr == supportFilesTable ) );
+
+  ARINC_665_TRACE_SCOPE( "files", "Decode Load Header" );
+
   bool decodeV3Data{ false };
 
   uint16_t partFlags;
@@ -576,7 +525,7 @@ void LoadHeaderFile::decodeBody( Helper::ConstRawDataSpan rawFile )
 
     for ( uint16_t thwIdIndex{ 0 }; thwIdIndex < numberOfThwIdsWithPos; ++thwIdIndex )
     {
-      std::string thwId;
+      Symbol thwId;
       std::tie( remaining, thwId ) = StringUtils_decodeString( remaining );
 
       Positions positions;
@@ -586,13 +535,27 @@ void LoadHeaderFile::decodeBody( Helper::ConstRawDataSpan rawFile )
     }
   }
 
-  // data file list
-  decodeDataFiles( rawFile.subspan( dataFileListPtr * 2ULL ), decodeV3Data );
-
-  // support file list
-  if ( 0U != supportFileListPtr )
+  if ( nullptr != dataFilesTable )
   {
-    decodeSupportFiles( rawFile.subspan( supportFileListPtr * 2ULL ), decodeV3Data );
+    dataFilesV.clear();
+    supportFilesV.clear();
+
+    // data file list is mandatory - support file list is optional
+    *dataFilesTable = LoadFileInfoTable::decodeDataFiles( checkedFileList( rawFile, dataFileListPtr ), decodeV3Data );
+    *supportFilesTable = ( 0U == supportFileListPtr ) ?
+      LoadFileInfoTable{} :
+      LoadFileInfoTable::decodeSupportFiles( checkedFileList( rawFile, supportFileListPtr ), decodeV3Data );
+  }
+  else
+  {
+    // data file list
+    decodeDataFiles( rawFile.subspan( dataFileListPtr * 2ULL ), decodeV3Data );
+
+    // support file list
+    if ( 0U != supportFileListPtr )
+    {
+      decodeSupportFiles( rawFile.subspan( supportFileListPtr * 2ULL ), decodeV3Data );
+    }
   }
 
   // user defined data
@@ -627,140 +590,305 @@ void LoadHeaderFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   // load crc is not decoded - this must be done by other means
 }
 
-Helper::RawData LoadHeaderFile::encodeDataFiles( const bool encodeV3Data ) const
+std::tuple< Helper::ConstRawDataSpan, bool > LoadHeaderFile::fileListData(
+  Helper::ConstRawDataSpan rawFile,
+  const std::size_t pointerFieldOffset )
 {
-  Helper::RawData rawFileList( sizeof( uint16_t ) );
+  bool decodeV3Data{ false };
 
+  switch ( checkHeader( rawFile, FileType::LoadUploadHeader, FileCrcOffset ) )
+  {
+    case SupportedArinc665Version::Supplement2:
+      break;
+
+    case SupportedArinc665Version::Supplement345:
+      decodeV3Data = true;
+      break;
+
+    default:
+      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
+  }
+
+  // file list pointer
+  const auto [ _, fileListPtr ]{ Helper::RawData_getInt< uint32_t >( rawFile.subspan( pointerFieldOffset ) ) };
+
+  if ( 0U == fileListPtr )
+  {
+    return { Helper::ConstRawDataSpan{}, decodeV3Data };
+  }
+
+  return { checkedFileList( rawFile, fileListPtr ), decodeV3Data };
+}
+
+Helper::ConstRawDataSpan LoadHeaderFile::checkedFileList(
+  Helper::ConstRawDataSpan rawFile,
+  const uint32_t fileListPtr )
+{
+  // the file list must be located between header and load CRC
+  const auto rawBody{ rawFile.first( rawFile.size() - FileCrcOffset ) };
+
+  if ( ( fileListPtr * 2ULL < LoadHeaderSizeV2 ) || ( fileListPtr * 2ULL >= rawBody.size() ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "Invalid Pointers" } );
+  }
+
+  return rawBody.subspan( fileListPtr * 2ULL );
+}
+
+LoadHeaderFile::EncodingLayout LoadHeaderFile::encodingLayout() const
+{
+  EncodingLayout layout{};
+
+  switch ( arincVersion() )
+  {
+    case SupportedArinc665Version::Supplement2:
+      layout.encodeV3Data = false;
+      layout.partNumberOffset = LoadHeaderSizeV2;
+      break;
+
+    case SupportedArinc665Version::Supplement345:
+      layout.encodeV3Data = true;
+      layout.partNumberOffset = LoadHeaderSizeV3;
+      break;
+
+    default:
+      BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Unsupported ARINC 665 Version" } );
+  }
+
+  // Next free Offset
+  std::size_t nextFreeOffset{ layout.partNumberOffset + StringUtils_encodedStringSize( partNumberV ) };
+
+  // Load Type (only in V3 mode and if set)
+  if ( layout.encodeV3Data && typeV )
+  {
+    layout.loadTypeOffset = nextFreeOffset;
+    nextFreeOffset += StringUtils_encodedStringSize( typeV->first ) + sizeof( uint16_t );
+  }
+
+  layout.thwIdsOffset = nextFreeOffset;
+  nextFreeOffset += StringUtils_encodedStringsSize( targetHardwareIdsV );
+
+  // THW ID + Positions (only in V3 mode and if positions are present)
+  if ( const auto thwIdsPositionsSize{ layout.encodeV3Data ? targetHardwareIdsPositionsSize() : 0U };
+    0U != thwIdsPositionsSize )
+  {
+    layout.thwIdsPositionsOffset = nextFreeOffset;
+    nextFreeOffset += thwIdsPositionsSize;
+  }
+
+  layout.dataFilesOffset = nextFreeOffset;
+  nextFreeOffset += dataFilesSize( layout.encodeV3Data );
+
+  // support files (only if support files are present)
+  if ( !supportFilesV.empty() )
+  {
+    layout.supportFilesOffset = nextFreeOffset;
+    nextFreeOffset += supportFilesSize( layout.encodeV3Data );
+  }
+
+  layout.userDefinedDataOffset = nextFreeOffset;
+  nextFreeOffset += userDefinedDataV.size();
+
+  // Load Check Value (only in V3 mode) + File CRC (16bit) + Load CRC (32 bit)
+  layout.checkValueOffset = nextFreeOffset;
+  layout.size =
+    nextFreeOffset
+    + ( layout.encodeV3Data ? CheckValueUtils_size( loadCheckValueTypeV ) : 0U )
+    + sizeof( uint16_t )
+    + sizeof( uint32_t );
+
+  return layout;
+}
+
+std::size_t LoadHeaderFile::targetHardwareIdsPositionsSize() const
+{
+  std::size_t size{ 0U };
+
+  for ( const auto &[ thwId, positions ] : targetHardwareIdsPositionsV )
+  {
+    // skip if no positions are stored
+    if ( positions.empty() )
+    {
+      continue;
+    }
+
+    size += StringUtils_encodedStringSize( thwId ) + StringUtils_encodedStringsSize( positions );
+  }
+
+  return ( 0U == size ) ? 0U : ( sizeof( uint16_t ) + size );
+}
+
+void LoadHeaderFile::encodeTargetHardwareIdsPositions( Helper::RawDataSpan rawData ) const
+{
+  const auto thwIdPosCount{ std::ranges::count_if(
+    targetHardwareIdsPositionsV,
+    []( const auto &thwIdPositions ) { return !thwIdPositions.second.empty(); } ) };
+
+  auto remaining{ Helper::RawData_setInt< uint16_t >( rawData, Helper::safeCast< uint16_t >( thwIdPosCount ) ) };
+
+  for ( const auto &[ thwId, positions ] : targetHardwareIdsPositionsV )
+  {
+    // skip if no positions are stored
+    if ( positions.empty() )
+    {
+      continue;
+    }
+
+    // THW ID
+    remaining = StringUtils_encodeString( remaining, thwId );
+
+    // Positions
+    remaining = StringUtils_encodeStrings( remaining, positions );
+  }
+
+  assert( remaining.empty() );
+}
+
+std::size_t LoadHeaderFile::dataFilesSize( const bool encodeV3Data ) const
+{
   // Number of files must not exceed field
   if ( dataFilesV.size() > std::numeric_limits< uint16_t >::max() )
   {
     BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "More files than allowed" } );
   }
 
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &fileInfo : dataFilesV )
+  {
+    size += dataFileSize( fileInfo, encodeV3Data );
+  }
+
+  return size;
+}
+
+std::size_t LoadHeaderFile::dataFileSize( const LoadFileInfo &fileInfo, const bool encodeV3Data )
+{
+  return
+    sizeof( uint16_t ) // next file pointer
+    + StringUtils_encodedStringSize( fileInfo.filename )
+    + StringUtils_encodedStringSize( fileInfo.partNumber )
+    + sizeof( uint32_t ) + sizeof( uint16_t ) // file length + CRC
+    + ( encodeV3Data ?
+        ( sizeof( uint64_t ) + CheckValueUtils_encodedSize( fileInfo.checkValue ) ) :
+        0U );
+}
+
+void LoadHeaderFile::encodeDataFiles( Helper::RawDataSpan rawFileList, const bool encodeV3Data ) const
+{
   // number of files
-  Helper::RawData_setInt< uint16_t >( rawFileList, Helper::safeCast< uint16_t >( dataFilesV.size() ) );
+  auto remaining{
+    Helper::RawData_setInt< uint16_t >( rawFileList, Helper::safeCast< uint16_t >( dataFilesV.size() ) ) };
 
   // iterate over files
-  uint16_t fileCounter{ 0 };
+  std::size_t fileCounter{ 0U };
   for ( auto const &fileInfo : dataFilesV )
   {
     ++fileCounter;
 
-    Helper::RawData rawFileInfo( sizeof( uint16_t ) );
+    // next file pointer (is set to 0 for last file)
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
+      ( fileCounter == dataFilesV.size() ) ?
+        0U :
+        Helper::safeCast< uint16_t >( dataFileSize( fileInfo, encodeV3Data ) / 2U ) );
 
     // filename
-    auto const rawFilename{ StringUtils_encodeString( fileInfo.filename ) };
-    assert( rawFilename.size() % 2 == 0);
-    rawFileInfo.insert( rawFileInfo.end(), rawFilename.begin(), rawFilename.end() );
+    remaining = StringUtils_encodeString( remaining, fileInfo.filename );
 
     // part number
-    auto const rawPartNumber{ StringUtils_encodeString( fileInfo.partNumber ) };
-    assert( rawPartNumber.size() % 2 == 0 );
-    rawFileInfo.insert( rawFileInfo.end(), rawPartNumber.begin(), rawPartNumber.end() );
-
-    // resize for file length, CRC
-    rawFileInfo.resize( rawFileInfo.size() + sizeof( uint32_t ) + sizeof( uint16_t ) );
+    remaining = StringUtils_encodeString( remaining, fileInfo.partNumber );
 
     // file length - rounded number of 16-bit words
-    const uint32_t fileLength{ Helper::safeCast< uint32_t >( ( fileInfo.length + 1U ) / 2U ) };
-
-    Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFileInfo }.last( sizeof( uint32_t ) + sizeof( uint16_t ) ),
-      fileLength );
+    remaining = Helper::RawData_setInt< uint32_t >(
+      remaining,
+      Helper::safeCast< uint32_t >( ( fileInfo.length + 1U ) / 2U ) );
 
     // CRC
-    Helper::RawData_setInt< uint16_t >( Helper::RawDataSpan{ rawFileInfo }.last( sizeof( uint16_t ) ), fileInfo.crc );
+    remaining = Helper::RawData_setInt< uint16_t >( remaining, fileInfo.crc );
 
     // following fields are available in ARINC 665-3 ff
     if ( encodeV3Data )
     {
       // length in bytes (Data File List)
-      rawFileInfo.resize( rawFileInfo.size() + sizeof( uint64_t ) );
-      Helper::RawData_setInt< uint64_t >(
-        Helper::RawDataSpan{ rawFileInfo }.last( sizeof( uint64_t ) ),
-        fileInfo.length );
+      remaining = Helper::RawData_setInt< uint64_t >( remaining, fileInfo.length );
 
       // check Value
-      const auto rawCheckValue{ CheckValueUtils_encode( fileInfo.checkValue ) };
-      assert( rawCheckValue.size() % 2 == 0 );
-      rawFileInfo.insert( rawFileInfo.end(), rawCheckValue.begin(), rawCheckValue.end() );
+      remaining = CheckValueUtils_encode( remaining, fileInfo.checkValue );
     }
-
-    // next load pointer (is set to 0 for last load)
-    Helper::RawData_setInt< uint16_t >(
-      rawFileInfo,
-      ( fileCounter == dataFilesV.size() ) ? 0U : Helper::safeCast< uint16_t >( rawFileInfo.size() / 2U ) );
-
-    // add file info to files info
-    rawFileList.insert( rawFileList.end(), rawFileInfo.begin(), rawFileInfo.end() );
   }
 
-  return rawFileList;
+  assert( remaining.empty() );
 }
 
-Helper::RawData LoadHeaderFile::encodeSupportFiles( const bool encodeV3Data ) const
+std::size_t LoadHeaderFile::supportFilesSize( const bool encodeV3Data ) const
 {
-  Helper::RawData rawFileList( sizeof( uint16_t ) );
-
   // Number of files must not exceed field
   if ( supportFilesV.size() > std::numeric_limits< uint16_t>::max() )
   {
     BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "More files than allowed" } );
   }
 
-  // number of loads
-  Helper::RawData_setInt< uint16_t >( rawFileList, Helper::safeCast< uint16_t >( supportFilesV.size() ) );
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &fileInfo : supportFilesV )
+  {
+    size += supportFileSize( fileInfo, encodeV3Data );
+  }
+
+  return size;
+}
+
+std::size_t LoadHeaderFile::supportFileSize( const LoadFileInfo &fileInfo, const bool encodeV3Data )
+{
+  return
+    sizeof( uint16_t ) // next file pointer
+    + StringUtils_encodedStringSize( fileInfo.filename )
+    + StringUtils_encodedStringSize( fileInfo.partNumber )
+    + sizeof( uint32_t ) + sizeof( uint16_t ) // file length + CRC
+    + ( encodeV3Data ? CheckValueUtils_encodedSize( fileInfo.checkValue ) : 0U );
+}
+
+void LoadHeaderFile::encodeSupportFiles( Helper::RawDataSpan rawFileList, const bool encodeV3Data ) const
+{
+  // number of files
+  auto remaining{
+    Helper::RawData_setInt< uint16_t >( rawFileList, Helper::safeCast< uint16_t >( supportFilesV.size() ) ) };
 
   // iterate over files
-  uint16_t fileCounter{ 0 };
+  std::size_t fileCounter{ 0U };
   for ( auto const &fileInfo : supportFilesV )
   {
     ++fileCounter;
 
-    Helper::RawData rawFileInfo( sizeof( uint16_t ) );
+    // next file pointer (is set to 0 for last file)
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
+      ( fileCounter == supportFilesV.size() ) ?
+        0U :
+        Helper::safeCast< uint16_t >( supportFileSize( fileInfo, encodeV3Data ) / 2U ) );
 
     // filename
-    auto const rawFilename{ StringUtils_encodeString( fileInfo.filename ) };
-    assert( rawFilename.size() % 2 == 0 );
-    rawFileInfo.insert( rawFileInfo.end(), rawFilename.begin(), rawFilename.end() );
+    remaining = StringUtils_encodeString( remaining, fileInfo.filename );
 
     // part number
-    auto const rawPartNumber{ StringUtils_encodeString( fileInfo.partNumber ) };
-    assert( rawPartNumber.size() % 2 == 0);
-    rawFileInfo.insert( rawFileInfo.end(), rawPartNumber.begin(), rawPartNumber.end() );
-
-    // resize for file length and CRC
-    rawFileInfo.resize( rawFileInfo.size() + sizeof( uint32_t ) + sizeof( uint16_t ) );
+    remaining = StringUtils_encodeString( remaining, fileInfo.partNumber );
 
     // file length in number of bytes
-    uint32_t fileLength{ Helper::safeCast< uint32_t>( fileInfo.length ) };
-
-    Helper::RawData_setInt< uint32_t >(
-      Helper::RawDataSpan{ rawFileInfo }.last( sizeof( uint32_t ) + sizeof( uint16_t ) ),
-      fileLength );
+    remaining = Helper::RawData_setInt< uint32_t >( remaining, Helper::safeCast< uint32_t>( fileInfo.length ) );
 
     // CRC
-    Helper::RawData_setInt< uint16_t >( Helper::RawDataSpan{ rawFileInfo }.last( sizeof( uint16_t ) ), fileInfo.crc );
+    remaining = Helper::RawData_setInt< uint16_t >( remaining, fileInfo.crc );
 
     // following fields are available in ARINC 665-3 ff
     if ( encodeV3Data )
     {
       // check Value
-      const auto rawCheckValue{ CheckValueUtils_encode( fileInfo.checkValue ) };
-      assert( rawCheckValue.size() % 2 == 0 );
-      rawFileInfo.insert( rawFileInfo.end(), rawCheckValue.begin(), rawCheckValue.end() );
+      remaining = CheckValueUtils_encode( remaining, fileInfo.checkValue );
     }
-
-    // next load pointer (is set to 0 for last load)
-    Helper::RawData_setInt< uint16_t >(
-      rawFileInfo,
-      ( fileCounter == supportFilesV.size() ) ? 0U : Helper::safeCast< uint16_t >( rawFileInfo.size() / 2U ) );
-
-    // add file info to files info
-    rawFileList.insert( rawFileList.end(), rawFileInfo.begin(), rawFileInfo.end() );
   }
 
-  return rawFileList;
+  assert( remaining.empty() );
 }
 
 void LoadHeaderFile::decodeDataFiles( Helper::ConstRawDataSpan rawData, const bool decodeV3Data )
@@ -804,7 +932,7 @@ void LoadHeaderFile::decodeDataFiles( Helper::ConstRawDataSpan rawData, const bo
     std::tie( listRemaining, name ) = StringUtils_decodeString( listRemaining );
 
     // part number
-    std::string partNumber;
+    Symbol partNumber;
     std::tie( listRemaining, partNumber ) = StringUtils_decodeString( listRemaining );
 
     // file length
@@ -897,7 +1025,7 @@ void LoadHeaderFile::decodeSupportFiles( Helper::ConstRawDataSpan rawData, bool
     std::tie( listRemaining, name ) = StringUtils_decodeString( listRemaining );
 
     // part number
-    std::string partNumber{};
+    Symbol partNumber{};
     std::tie( listRemaining, partNumber ) = StringUtils_decodeString( listRemaining );
 
     // file length
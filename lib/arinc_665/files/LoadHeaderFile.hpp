@@ -16,6 +16,9 @@
 #include <arinc_665/files/Files.hpp>
 #include <arinc_665/files/Arinc665File.hpp>
 #include <arinc_665/files/LoadFileInfo.hpp>
+#include <arinc_665/files/LoadFileInfoTable.hpp>
+
+#include <arinc_665/Symbol.hpp>
 
 #include <arinc_645/Arinc645.hpp>
 #include <arinc_645/Arinc645Crc.hpp>
@@ -24,6 +27,7 @@
 #include <list>
 #include <optional>
 #include <string_view>
+#include <tuple>
 #include <utility>
 
 namespace Arinc665::Files {
@@ -110,11 +114,11 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
 {
   public:
     //! Positions
-    using Positions = std::list< std::string >;
+    using Positions = std::list< Symbol >;
     //! Target Hardware IDs / Positions
-    using TargetHardwareIdsPositions = std::list< std::pair< std::string, Positions > >;
+    using TargetHardwareIdsPositions = std::list< std::pair< Symbol, Positions > >;
     //! Target Hardware IDs
-    using TargetHardwareIds = std::list< std::string >;
+    using TargetHardwareIds = std::list< Symbol >;
     //! Load Type (Description + ID)
     using LoadType = std::optional< std::pair< std::string, uint16_t > >;
 
@@ -283,6 +287,46 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
 
     /** @} **/
 
+    /**
+     * @name Bulk Decoding of File Lists
+     *
+     * Only the file header, the file CRC and the requested file list are decoded.
+     * This is used, when only the files information is of interest, and avoids the per-entry allocations of
+     * dataFiles() and supportFiles().
+     *
+     * @sa LoadFileInfoTable
+     * @{
+     **/
+
+    /**
+     * @brief Bulk decodes the data file list of the given raw load header file.
+     *
+     * @param[in] rawFile
+     *   Raw representation of Load Header File
+     *
+     * @return Data Files Table.
+     *
+     * @throw InvalidArinc665File
+     *   When the file or the data file list is invalid.
+     **/
+    [[nodiscard]] static LoadFileInfoTable decodeDataFilesTable( Helper::ConstRawDataSpan rawFile );
+
+    /**
+     * @brief Bulk decodes the support file list of the given raw load header file.
+     *
+     * @param[in] rawFile
+     *   Raw representation of Load Header File
+     *
+     * @return Support Files Table.
+     *   Empty, if no support file list is present.
+     *
+     * @throw InvalidArinc665File
+     *   When the file or the support file list is invalid.
+     **/
+    [[nodiscard]] static LoadFileInfoTable decodeSupportFilesTable( Helper::ConstRawDataSpan rawFile );
+
+    /** @} **/
+
     /**
      * @brief Creates an empty load header file.
      *
@@ -299,6 +343,28 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
      **/
     explicit LoadHeaderFile( Helper::ConstRawDataSpan rawFile );
 
+    /**
+     * @brief Creates a load header file from the given raw data and bulk decodes its file lists.
+     *
+     * The file lists are decoded into @p dataFilesTable and @p supportFilesTable instead of dataFiles() and
+     * supportFiles(), which stay empty.
+     * This avoids the per-entry allocations of dataFiles() and supportFiles(), when the file lists are only iterated.
+     *
+     * @param[in] rawFile
+     *   Raw data file representation.
+     * @param[out] dataFilesTable
+     *   Decoded Data Files Table.
+     * @param[out] supportFilesTable
+     *   Decoded Support Files Table (empty, if no support file list is present).
+     *
+     * @throw InvalidArinc665File
+     *   When the file or a file list is invalid.
+     **/
+    LoadHeaderFile(
+      Helper::ConstRawDataSpan rawFile,
+      LoadFileInfoTable &dataFilesTable,
+      LoadFileInfoTable &supportFilesTable );
+
     //! Destructor.
     ~LoadHeaderFile() override = default;
 
@@ -308,6 +374,12 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
     //! @copydoc Arinc665File::fileType() const noexcept
     [[nodiscard]] FileType fileType() const noexcept override;
 
+    //! @copydoc Arinc665File::encodedSize() const
+    [[nodiscard]] std::size_t encodedSize() const override;
+
+    //! @copydoc Arinc665File::encode(Helper::RawDataSpan) const
+    void encode( Helper::RawDataSpan rawFile ) const override;
+
     /**
      * @name Load Part Flags
      *
@@ -361,7 +433,7 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
      *
      * @return Part Number of the Load Header File.
      **/
-    [[nodiscard]] std::string_view partNumber() const;
+    [[nodiscard]] Symbol partNumber() const;
 
     /**
      * @brief Updates the Part Number of the Load Header File.
@@ -369,7 +441,7 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
      * @param[in] partNumber
      *   New Part Number.
      **/
-    void partNumber( std::string partNumber );
+    void partNumber( Symbol partNumber );
 
     /** @} **/
 
@@ -402,7 +474,7 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
      * @param[in] targetHardwareId
      *   Target Hardware ID.
      **/
-    void targetHardwareId( std::string targetHardwareId );
+    void targetHardwareId( Symbol targetHardwareId );
 
     /** @} **/
 
@@ -441,7 +513,7 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
      * @param[in] positions
      *   Positions
      **/
-    void targetHardwareIdPositions( std::string targetHardwareId, Positions positions );
+    void targetHardwareIdPositions( Symbol targetHardwareId, Positions positions );
 
     /** @} **/
 
@@ -603,36 +675,176 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
     /** @} **/
 
   private:
-    //! @copydoc Arinc665File::encode
-    [[nodiscard]] Helper::RawData encode() const override;
+    //! Offsets and Size of the encoded Load Header File
+    struct EncodingLayout
+    {
+      //! If set to true, additional data as stated in ARINC 665-3 is encoded.
+      bool encodeV3Data;
+      //! Offset of the Load Part Number
+      std::size_t partNumberOffset;
+      //! Offset of the Load Type (Only ARINC 665-3/4, 0 if not present)
+      std::size_t loadTypeOffset;
+      //! Offset of the THW IDs List
+      std::size_t thwIdsOffset;
+      //! Offset of the THW IDs with Positions List (Only ARINC 665-3/4, 0 if not present)
+      std::size_t thwIdsPositionsOffset;
+      //! Offset of the Data Files List
+      std::size_t dataFilesOffset;
+      //! Offset of the Support Files List (0 if not present)
+      std::size_t supportFilesOffset;
+      //! Offset of the User Defined Data
+      std::size_t userDefinedDataOffset;
+      //! Offset of the Load Check Value (Only ARINC 665-3/4)
+      std::size_t checkValueOffset;
+      //! Size of the encoded File
+      std::size_t size;
+    };
+
+    /**
+     * @brief Calculates the pointer offsets and the size of the encoded file.
+     *
+     * @return Encoding Layout.
+     **/
+    [[nodiscard]] EncodingLayout encodingLayout() const;
 
     /**
      * @brief Decodes the body of the load header file.
      *
      * @param[in] rawFile
      *   Raw Load Header File representation.
+     * @param[out] dataFilesTable
+     *   If set, the data file list is bulk decoded into this table instead of dataFiles().
+     * @param[out] supportFilesTable
+     *   If set, the support file list is bulk decoded into this table instead of supportFiles().
+     *   Must be set together with @p dataFilesTable.
+     **/
+    void decodeBody(
+      Helper::ConstRawDataSpan rawFile,
+      LoadFileInfoTable * dataFilesTable = nullptr,
+      LoadFileInfoTable * supportFilesTable = nullptr );
+
+    /**
+     * @brief Checks the raw load header file and returns the file list referenced by the given pointer field.
+     *
+     * @param[in] rawFile
+     *   Raw Load Header File representation.
+     * @param[in] pointerFieldOffset
+     *   Offset of the file list pointer field.
+     *
+     * @return File list raw data (empty, if the pointer is 0) and if ARINC 665-3 data shall be decoded.
+     *
+     * @throw InvalidArinc665File
+     *   When the file or the pointer is invalid.
+     **/
+    [[nodiscard]] static std::tuple< Helper::ConstRawDataSpan, bool > fileListData(
+      Helper::ConstRawDataSpan rawFile,
+      std::size_t pointerFieldOffset );
+
+    /**
+     * @brief Returns the file list referenced by the given file list pointer.
+     *
+     * @param[in] rawFile
+     *   Raw Load Header File representation.
+     * @param[in] fileListPtr
+     *   File List Pointer (16-bit words, not 0).
+     *
+     * @return File list raw data, which ends before the load CRC.
+     *
+     * @throw InvalidArinc665File
+     *   When the pointer is invalid.
+     **/
+    [[nodiscard]] static Helper::ConstRawDataSpan checkedFileList(
+      Helper::ConstRawDataSpan rawFile,
+      uint32_t fileListPtr );
+
+    /**
+     * @brief Returns the size of the encoded THW IDs with Positions List.
+     *
+     * @return Size of the encoded THW IDs with Positions List.
+     * @retval 0
+     *   If no THW ID with positions is stored.
      **/
-    void decodeBody( Helper::ConstRawDataSpan rawFile );
+    [[nodiscard]] std::size_t targetHardwareIdsPositionsSize() const;
+
+    /**
+     * @brief Encodes the THW IDs with Positions List.
+     *
+     * THW IDs without positions are skipped.
+     *
+     * @param[out] rawData
+     *   Target buffer of targetHardwareIdsPositionsSize() bytes.
+     **/
+    void encodeTargetHardwareIdsPositions( Helper::RawDataSpan rawData ) const;
+
+    /**
+     * @brief Returns the size of the encoded Data Files Information List.
+     *
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
+     *
+     * @return Size of the encoded files information list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of files exceeds the number of files field.
+     **/
+    [[nodiscard]] std::size_t dataFilesSize( bool encodeV3Data ) const;
+
+    /**
+     * @brief Returns the size of the encoded Data File Information entry.
+     *
+     * @param[in] fileInfo
+     *   Data File Information.
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
+     *
+     * @return Size of the encoded file information entry.
+     **/
+    [[nodiscard]] static std::size_t dataFileSize( const LoadFileInfo &fileInfo, bool encodeV3Data );
 
     /**
      * @brief Encodes the Data Files Information List.
      *
+     * @param[out] rawFileList
+     *   Target buffer of dataFilesSize() bytes.
      * @param[in] encodeV3Data
      *   If set to true, additional data as stated in ARINC 665-3 is encoded.
+     **/
+    void encodeDataFiles( Helper::RawDataSpan rawFileList, bool encodeV3Data ) const;
+
+    /**
+     * @brief Returns the size of the encoded Support Files Information List.
      *
-     * @return Raw representation of files information list.
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
+     *
+     * @return Size of the encoded files information list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of files exceeds the number of files field.
      **/
-    [[nodiscard]] Helper::RawData encodeDataFiles( bool encodeV3Data ) const;
+    [[nodiscard]] std::size_t supportFilesSize( bool encodeV3Data ) const;
 
     /**
-     * @brief Encodes the Support Files Information List.
+     * @brief Returns the size of the encoded Support File Information entry.
      *
+     * @param[in] fileInfo
+     *   Support File Information.
      * @param[in] encodeV3Data
      *   If set to true, additional data as stated in ARINC 665-3 is encoded.
      *
-     * @return Raw representation of files information list.
+     * @return Size of the encoded file information entry.
+     **/
+    [[nodiscard]] static std::size_t supportFileSize( const LoadFileInfo &fileInfo, bool encodeV3Data );
+
+    /**
+     * @brief Encodes the Support Files Information List.
+     *
+     * @param[out] rawFileList
+     *   Target buffer of supportFilesSize() bytes.
+     * @param[in] encodeV3Data
+     *   If set to true, additional data as stated in ARINC 665-3 is encoded.
      **/
-    [[nodiscard]] Helper::RawData encodeSupportFiles( bool encodeV3Data ) const;
+    void encodeSupportFiles( Helper::RawDataSpan rawFileList, bool encodeV3Data ) const;
 
     /**
      * @brief Decodes the Data Files List from the raw data.
@@ -662,7 +874,7 @@ class ARINC_665_EXPORT LoadHeaderFile final : public Arinc665File
     //! Part Flags
     uint16_t partFlagsV{ 0U };
     //! Part Number of the Load
-    std::string partNumberV;
+    Symbol partNumberV;
     //! List of compatible Target Hardware IDs
     TargetHardwareIds targetHardwareIdsV;
     //! List of compatible Target Hardware IDs with Positions
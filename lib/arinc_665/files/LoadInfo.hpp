@@ -16,6 +16,7 @@
 #include <arinc_665/files/Files.hpp>
 
 #include <arinc_665/MediumNumber.hpp>
+#include <arinc_665/Symbol.hpp>
 
 #include <string>
 #include <list>
@@ -32,10 +33,10 @@ namespace Arinc665::Files {
 struct ARINC_665_EXPORT LoadInfo
 {
   //! Target Hardware IDs.
-  using ThwIds = std::list< std::string >;
+  using ThwIds = std::list< Symbol >;
 
   //! Load Part Number
-  std::string partNumber;
+  Symbol partNumber;
   //! Header Filename
   std::string headerFilename;
   //! Member Sequence Number
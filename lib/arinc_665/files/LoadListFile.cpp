@@ -24,6 +24,8 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+
 namespace Arinc665::Files {
 
 LoadListFile::LoadListFile( const SupportedArinc665Version version ) :
@@ -96,65 +98,44 @@ bool LoadListFile::belongsToSameMediaSet( const LoadListFile &other ) const
     && ( loadsV == other.loads() );
 }
 
-Helper::RawData LoadListFile::encode() const
+std::size_t LoadListFile::encodedSize() const
 {
-  Helper::RawData rawFile( FileHeaderSizeV2 );
+  return encodingLayout().size;
+}
 
-  // Spare Field
-  Helper::RawData_setInt< uint16_t>( Helper::RawDataSpan{ rawFile }.subspan( SpareFieldOffsetV2 ), 0U );
+void LoadListFile::encode( Helper::RawDataSpan rawFile ) const
+{
+  const auto layout{ encodingLayout() };
+  checkEncodeBuffer( rawFile, layout.size );
 
-  // Next free Offset (used for optional pointer calculation)
-  ptrdiff_t nextFreeOffset{ static_cast< ptrdiff_t >( rawFile.size() ) };
+  // Spare Field
+  Helper::RawData_setInt< uint16_t>( rawFile.subspan( SpareFieldOffsetV2 ), 0U );
 
   // media set information
-  const auto rawMediaInformation{ encodeMediaInformation() };
-  assert( rawMediaInformation.size() % 2 == 0);
-  rawFile.insert( rawFile.end(), rawMediaInformation.begin(), rawMediaInformation.end() );
-
-  // media set information pointer
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( MediaSetPartNumberPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += static_cast< ptrdiff_t >( rawMediaInformation.size() );
-
-  // loads info
-  const auto rawLoadsInfo{ encodeLoadsInfo() };
-  assert( rawLoadsInfo.size() % 2 == 0);
+    rawFile.subspan( MediaSetPartNumberPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.mediaInformationOffset / 2U ) );
+  encodeMediaInformation( rawFile.subspan( layout.mediaInformationOffset ) );
 
-  // loads list pointer
+  // loads list
   Helper::RawData_setInt< uint32_t >(
-    Helper::RawDataSpan{ rawFile }.subspan( LoadFilesPointerFieldOffsetV2 ),
-    static_cast< uint32_t >( nextFreeOffset / 2U ) );
-  nextFreeOffset += static_cast< ptrdiff_t >( rawLoadsInfo.size() );
-
-  rawFile.insert( rawFile.end(), rawLoadsInfo.begin(), rawLoadsInfo.end() );
+    rawFile.subspan( LoadFilesPointerFieldOffsetV2 ),
+    static_cast< uint32_t >( layout.loadsInfoOffset / 2U ) );
+  encodeLoadsInfo(
+    rawFile.subspan( layout.loadsInfoOffset, layout.userDefinedDataOffset - layout.loadsInfoOffset ) );
 
   // user defined data
   assert( userDefinedDataV.size() % 2 == 0 );
-  uint32_t userDefinedDataPtr{};
-
-  if ( !userDefinedDataV.empty() )
-  {
-    userDefinedDataPtr = static_cast< uint32_t >( nextFreeOffset / 2U );
-
-    rawFile.insert( rawFile.end(), userDefinedDataV.begin(), userDefinedDataV.end() );
-  }
-
-  Helper::RawData_setInt< uint32_t>(
-    Helper::RawDataSpan{ rawFile }.subspan( UserDefinedDataPointerFieldOffsetV2 ),
-    userDefinedDataPtr );
-
+  Helper::RawData_setInt< uint32_t >(
+    rawFile.subspan( UserDefinedDataPointerFieldOffsetV2 ),
+    userDefinedDataV.empty() ? 0U : static_cast< uint32_t >( layout.userDefinedDataOffset / 2U ) );
+  std::ranges::copy( userDefinedDataV, rawFile.subspan( layout.userDefinedDataOffset ).begin() );
 
   // set header
   insertHeader( rawFile );
 
-  // Resize file for file CRC
-  rawFile.resize( rawFile.size() + sizeof( uint16_t ) );
-
   // set CRC
   calculateFileCrc( rawFile );
-
-  return rawFile;
 }
 
 void LoadListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
@@ -195,59 +176,81 @@ void LoadListFile::decodeBody( Helper::ConstRawDataSpan rawFile )
   // file crc decoded and checked within base class
 }
 
-Helper::RawData LoadListFile::encodeLoadsInfo() const
+LoadListFile::EncodingLayout LoadListFile::encodingLayout() const
 {
-  Helper::RawData rawLoadsInfo( sizeof( uint16_t ) );
+  EncodingLayout layout{};
+
+  layout.mediaInformationOffset = FileHeaderSizeV2;
+  layout.loadsInfoOffset = layout.mediaInformationOffset + mediaInformationSize();
+  layout.userDefinedDataOffset = layout.loadsInfoOffset + loadsInfoSize();
+  layout.size = layout.userDefinedDataOffset + userDefinedDataV.size() + sizeof( uint16_t );
 
+  return layout;
+}
+
+std::size_t LoadListFile::loadsInfoSize() const
+{
   // Number of loads must not exceed field
   if ( loadsV.size() > std::numeric_limits< uint16_t>::max() )
   {
-    BOOST_THROW_EXCEPTION( InvalidArinc665File()
-      << Helper::AdditionalInfo{ "More loads than allowed" } );
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "More loads than allowed" } );
   }
 
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &loadInfo : loadsV )
+  {
+    size += loadInfoSize( loadInfo );
+  }
+
+  return size;
+}
+
+std::size_t LoadListFile::loadInfoSize( const LoadInfo &loadInfo )
+{
+  return
+    sizeof( uint16_t ) // next load pointer
+    + StringUtils_encodedStringSize( loadInfo.partNumber )
+    + StringUtils_encodedStringSize( loadInfo.headerFilename )
+    + sizeof( uint16_t ) // member sequence number
+    + StringUtils_encodedStringsSize( loadInfo.targetHardwareIds );
+}
+
+void LoadListFile::encodeLoadsInfo( Helper::RawDataSpan rawLoadsInfo ) const
+{
   // number of loads
-  Helper::RawData_setInt< uint16_t >( rawLoadsInfo, Helper::safeCast< uint16_t >( loadsV.size() ) );
+  auto remaining{
+    Helper::RawData_setInt< uint16_t >( rawLoadsInfo, Helper::safeCast< uint16_t >( loadsV.size() ) ) };
 
-  // iterate over files
-  uint16_t loadCounter{ 0 };
+  // iterate over loads
+  std::size_t loadCounter{ 0U };
   for ( auto const &loadInfo : loadsV )
   {
     ++loadCounter;
 
-    Helper::RawData rawLoadInfo( sizeof( uint16_t ) );
+    // next load pointer (is set to 0 for last load)
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
+      ( loadCounter == loadsV.size() ) ?
+        0U :
+        static_cast< uint16_t >( loadInfoSize( loadInfo ) / 2U ) );
 
     // part number
-    auto const rawPartNumber( StringUtils_encodeString( loadInfo.partNumber ) );
-    assert( rawPartNumber.size() % 2 == 0);
-    rawLoadInfo.insert( rawLoadInfo.end(), rawPartNumber.begin(), rawPartNumber.end() );
+    remaining = StringUtils_encodeString( remaining, loadInfo.partNumber );
 
     // header filename
-    auto const rawHeaderFilename( StringUtils_encodeString( loadInfo.headerFilename ) );
-    assert( rawHeaderFilename.size() % 2 == 0);
-    rawLoadInfo.insert( rawLoadInfo.end(), rawHeaderFilename.begin(), rawHeaderFilename.end() );
+    remaining = StringUtils_encodeString( remaining, loadInfo.headerFilename );
 
     // member sequence number
-    rawLoadInfo.resize( rawLoadInfo.size() + sizeof( uint16_t ) );
-    Helper::RawData_setInt< uint16_t >(
-      Helper::RawDataSpan{ rawLoadInfo }.last( sizeof( uint16_t ) ),
+    remaining = Helper::RawData_setInt< uint16_t >(
+      remaining,
       static_cast< uint8_t >( loadInfo.memberSequenceNumber ) );
 
     // THW IDs list
-    auto const rawThwIds( StringUtils_encodeStrings( loadInfo.targetHardwareIds ) );
-    assert( rawThwIds.size() % 2 == 0);
-    rawLoadInfo.insert( rawLoadInfo.end(), rawThwIds.begin(), rawThwIds.end() );
-
-    // next load pointer (is set to 0 for last load)
-    Helper::RawData_setInt< uint16_t >(
-      rawLoadInfo,
-      ( loadCounter == numberOfLoads() ) ? 0U : static_cast< uint16_t >( rawLoadInfo.size() / 2U ) );
-
-    // add file info to files info
-    rawLoadsInfo.insert( rawLoadsInfo.end(), rawLoadInfo.begin(), rawLoadInfo.end() );
+    remaining = StringUtils_encodeStrings( remaining, loadInfo.targetHardwareIds );
   }
 
-  return rawLoadsInfo;
+  assert( remaining.empty() );
 }
 
 void LoadListFile::decodeLoadsInfo( Helper::ConstRawDataSpan rawData )
@@ -284,7 +287,7 @@ void LoadListFile::decodeLoadsInfo( Helper::ConstRawDataSpan rawData )
     }
 
     // part number
-    std::string partNumber;
+    Symbol partNumber;
     std::tie( listRemaining, partNumber ) = StringUtils_decodeString( listRemaining );
 
     // header filename
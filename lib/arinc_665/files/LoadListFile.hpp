@@ -108,6 +108,12 @@ class ARINC_665_EXPORT LoadListFile final : public ListFile
     //! @copydoc ListFile::fileType() const noexcept
     [[nodiscard]] FileType fileType() const noexcept override;
 
+    //! @copydoc ListFile::encodedSize() const
+    [[nodiscard]] std::size_t encodedSize() const override;
+
+    //! @copydoc ListFile::encode(Helper::RawDataSpan) const
+    void encode( Helper::RawDataSpan rawFile ) const override;
+
     /**
      * @name Loads
      * @{
@@ -194,8 +200,25 @@ class ARINC_665_EXPORT LoadListFile final : public ListFile
     [[nodiscard]] bool belongsToSameMediaSet( const LoadListFile &other ) const;
 
   private:
-    //! @copydoc ListFile::encode
-    [[nodiscard]] Helper::RawData encode() const override;
+    //! Offsets and Size of the encoded Load List File
+    struct EncodingLayout
+    {
+      //! Offset of the Media Information
+      std::size_t mediaInformationOffset;
+      //! Offset of the Loads Information List
+      std::size_t loadsInfoOffset;
+      //! Offset of the User Defined Data
+      std::size_t userDefinedDataOffset;
+      //! Size of the encoded File
+      std::size_t size;
+    };
+
+    /**
+     * @brief Calculates the pointer offsets and the size of the encoded file.
+     *
+     * @return Encoding Layout.
+     **/
+    [[nodiscard]] EncodingLayout encodingLayout() const;
 
     /**
      * @brief Decodes the body of the batch file.
@@ -206,11 +229,32 @@ class ARINC_665_EXPORT LoadListFile final : public ListFile
     void decodeBody( Helper::ConstRawDataSpan rawFile );
 
     /**
-     * @brief Encodes the batches information list.
+     * @brief Returns the size of the encoded loads information list.
+     *
+     * @return Size of the encoded loads information list.
+     *
+     * @throw InvalidArinc665File
+     *   When the number of loads exceeds the number of loads field.
+     **/
+    [[nodiscard]] std::size_t loadsInfoSize() const;
+
+    /**
+     * @brief Returns the size of the encoded load information entry.
+     *
+     * @param[in] loadInfo
+     *   Load Information.
+     *
+     * @return Size of the encoded load information entry.
+     **/
+    [[nodiscard]] static std::size_t loadInfoSize( const LoadInfo &loadInfo );
+
+    /**
+     * @brief Encodes the loads information list.
      *
-     * @return Raw representation of loads information list.
+     * @param[out] rawLoadsInfo
+     *   Target buffer of loadsInfoSize() bytes.
      **/
-    [[nodiscard]] Helper::RawData encodeLoadsInfo() const;
+    void encodeLoadsInfo( Helper::RawDataSpan rawLoadsInfo ) const;
 
     /**
      * @brief Decodes the loads information list from the raw data.
@@ -15,10 +15,11 @@
 #include <arinc_665/Arinc665Exception.hpp>
 
 #include <helper/Exception.hpp>
+#include <helper/SafeCast.hpp>
 
 #include <boost/exception/all.hpp>
 
-#include <cassert>
+#include <algorithm>
 
 namespace Arinc665::Files {
 
@@ -26,10 +27,20 @@ std::tuple< Helper::ConstRawDataSpan, std::string_view > StringUtils_decodeStrin
 {
   auto remaining{ rawData };
 
+  if ( remaining.size() < sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "String length field exceeds data" } );
+  }
+
   // string length
   uint16_t stringLength{};
   std::tie( remaining, stringLength ) = Helper::RawData_getInt< uint16_t >( remaining );
 
+  if ( remaining.size() < stringLength )
+  {
+    BOOST_THROW_EXCEPTION( InvalidArinc665File{} << Helper::AdditionalInfo{ "String exceeds data" } );
+  }
+
   // copy string
   std::string_view string;
   std::tie( remaining, string ) =  Helper::RawData_getString( remaining, stringLength );
@@ -38,7 +49,7 @@ std::tuple< Helper::ConstRawDataSpan, std::string_view > StringUtils_decodeStrin
   if ( stringLength % 2 == 1 )
   {
     // check fill-character
-    if ( std::byte{ 0 } != remaining.front() )
+    if ( remaining.empty() || ( std::byte{ 0 } != remaining.front() ) )
     {
       BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Fill character not '0'" } );
     }
@@ -48,33 +59,48 @@ std::tuple< Helper::ConstRawDataSpan, std::string_view > StringUtils_decodeStrin
   return { remaining, string };
 }
 
+std::size_t StringUtils_encodedStringSize( const std::string_view string ) noexcept
+{
+  return sizeof( uint16_t ) + string.size() + ( string.size() % sizeof( uint16_t ) );
+}
+
 Helper::RawData StringUtils_encodeString( std::string_view string )
 {
-  Helper::RawData rawString;
-  rawString.reserve( sizeof( uint16_t ) + string.size()  + ( string.size() % sizeof( uint16_t ) ) );
+  Helper::RawData rawString( StringUtils_encodedStringSize( string ) );
+  StringUtils_encodeString( rawString, string );
+  return rawString;
+}
+
+Helper::RawDataSpan StringUtils_encodeString( Helper::RawDataSpan rawData, std::string_view string )
+{
+  if ( rawData.size() < StringUtils_encodedStringSize( string ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Buffer too small for string" } );
+  }
 
   // set string length
-  rawString.resize( sizeof( uint16_t ) );
-  Helper::RawData_setInt< uint16_t >( rawString, Helper::safeCast< uint16_t >( string.size() ) );
+  auto remaining{ Helper::RawData_setInt< uint16_t >( rawData, Helper::safeCast< uint16_t >( string.size() ) ) };
 
   // copy string
-  auto stringSpan{ Helper::RawData_asRawData( string ) };
-  rawString.insert( rawString.end(), stringSpan.begin(), stringSpan.end() );
+  const auto stringSpan{ Helper::RawData_asRawData( string ) };
+  std::ranges::copy( stringSpan, remaining.begin() );
+  remaining = remaining.subspan( stringSpan.size() );
 
   // fill string if it is odd
   if ( string.size() % 2 == 1 )
   {
-    rawString.push_back( std::byte{ 0U } );
+    remaining.front() = std::byte{ 0U };
+    remaining = remaining.subspan( 1 );
   }
 
-  return rawString;
+  return remaining;
 }
 
-std::tuple< Helper::ConstRawDataSpan, std::list< std::string > > StringUtils_decodeStrings(
+std::tuple< Helper::ConstRawDataSpan, std::list< Symbol > > StringUtils_decodeStrings(
   Helper::ConstRawDataSpan rawData )
 {
   // empty strings
-  std::list< std::string > strings;
+  std::list< Symbol > strings;
 
   auto remaining{ rawData };
 
@@ -93,23 +119,41 @@ std::tuple< Helper::ConstRawDataSpan, std::list< std::string > > StringUtils_dec
   return { remaining, strings };
 }
 
-Helper::RawData StringUtils_encodeStrings( const std::list< std::string > &strings )
+std::size_t StringUtils_encodedStringsSize( const std::list< Symbol > &strings ) noexcept
 {
-  Helper::RawData rawStrings( sizeof( uint16_t ) );
+  std::size_t size{ sizeof( uint16_t ) };
+
+  for ( const auto &string : strings )
+  {
+    size += StringUtils_encodedStringSize( string );
+  }
+
+  return size;
+}
+
+Helper::RawData StringUtils_encodeStrings( const std::list< Symbol > &strings )
+{
+  Helper::RawData rawStrings( StringUtils_encodedStringsSize( strings ) );
+  StringUtils_encodeStrings( rawStrings, strings );
+  return rawStrings;
+}
+
+Helper::RawDataSpan StringUtils_encodeStrings( Helper::RawDataSpan rawData, const std::list< Symbol > &strings )
+{
+  if ( rawData.size() < sizeof( uint16_t ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception{} << Helper::AdditionalInfo{ "Buffer too small for strings" } );
+  }
 
   // set number of strings
-  Helper::RawData_setInt< uint16_t >( rawStrings, Helper::safeCast< uint16_t >( strings.size() ) );
+  auto remaining{ Helper::RawData_setInt< uint16_t >( rawData, Helper::safeCast< uint16_t >( strings.size() ) ) };
 
   for ( const auto &string : strings )
   {
-    auto rawString{ StringUtils_encodeString( string ) };
-    assert( rawString.size() % 2 == 0 );
-
-    // append string
-    rawStrings.insert( rawStrings.end(), rawString.begin(), rawString.end() );
+    remaining = StringUtils_encodeString( remaining, string );
   }
 
-  return rawStrings;
+  return remaining;
 }
 
 }
@@ -15,6 +15,8 @@
 
 #include <arinc_665/files/Files.hpp>
 
+#include <arinc_665/Symbol.hpp>
+
 #include <helper/RawData.hpp>
 
 #include <list>
@@ -53,6 +55,16 @@ namespace Arinc665::Files {
 ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::string_view > StringUtils_decodeString(
   Helper::ConstRawDataSpan rawData );
 
+/**
+ * @brief Returns the size of the encoded ARINC 665 string.
+ *
+ * @param[in] string
+ *  String to encode.
+ *
+ * @return Size of the encoded string including length field and padding.
+ **/
+[[nodiscard]] ARINC_665_EXPORT std::size_t StringUtils_encodedStringSize( std::string_view string ) noexcept;
+
 /**
  * @brief Encodes the ARINC 665 string to the stream.
  *
@@ -63,6 +75,21 @@ ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::string_view > String
  **/
 [[nodiscard]] ARINC_665_EXPORT Helper::RawData StringUtils_encodeString( std::string_view string );
 
+/**
+ * @brief Encodes the ARINC 665 string into @p rawData.
+ *
+ * Writes length field, string and padding.
+ *
+ * @param[out] rawData
+ *   Target buffer.
+ *   Must provide at least StringUtils_encodedStringSize() bytes.
+ * @param[in] string
+ *  String to encode.
+ *
+ * @return Remaining buffer after the encoded string.
+ **/
+ARINC_665_EXPORT Helper::RawDataSpan StringUtils_encodeString( Helper::RawDataSpan rawData, std::string_view string );
+
 /** @} **/
 
 /**
@@ -85,9 +112,20 @@ ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::string_view > String
  *
  * @return std::tuple of remaining raw data and decoded strings.
  **/
-ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::list< std::string > > StringUtils_decodeStrings(
+ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::list< Symbol > > StringUtils_decodeStrings(
   Helper::ConstRawDataSpan rawData );
 
+/**
+ * @brief Returns the size of the encoded ARINC 665 String List.
+ *
+ * @param[in] strings
+ *   String List
+ *
+ * @return Size of the encoded string list.
+ **/
+[[nodiscard]] ARINC_665_EXPORT std::size_t StringUtils_encodedStringsSize(
+  const std::list< Symbol > &strings ) noexcept;
+
 /**
  * @brief Encodes the ARINC 665 String List to the Stream.
  *
@@ -96,7 +134,22 @@ ARINC_665_EXPORT std::tuple< Helper::ConstRawDataSpan, std::list< std::string >
  *
  * @return Encoded raw string list.
  **/
-[[nodiscard]] ARINC_665_EXPORT Helper::RawData StringUtils_encodeStrings( const std::list< std::string > &strings );
+[[nodiscard]] ARINC_665_EXPORT Helper::RawData StringUtils_encodeStrings( const std::list< Symbol > &strings );
+
+/**
+ * @brief Encodes the ARINC 665 String List into @p rawData.
+ *
+ * @param[out] rawData
+ *   Target buffer.
+ *   Must provide at least StringUtils_encodedStringsSize() bytes.
+ * @param[in] strings
+ *   String List
+ *
+ * @return Remaining buffer after the encoded string list.
+ **/
+ARINC_665_EXPORT Helper::RawDataSpan StringUtils_encodeStrings(
+  Helper::RawDataSpan rawData,
+  const std::list< Symbol > &strings );
 
 /** @} **/
 
@@ -0,0 +1,359 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Classes Arinc665::Files::FileInfoTable and
+ *   Arinc665::Files::LoadFileInfoTable.
+ *
+ * The bulk decoders are validated against the list decoders of FileListFile and LoadHeaderFile.
+ **/
+
+#include <arinc_665/files/FileInfoTable.hpp>
+#include <arinc_665/files/LoadFileInfoTable.hpp>
+#include <arinc_665/files/FileListFile.hpp>
+#include <arinc_665/files/LoadHeaderFile.hpp>
+
+#include <arinc_665/Arinc665.hpp>
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <format>
+#include <string>
+
+namespace Arinc665::Files {
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( FilesTest )
+BOOST_AUTO_TEST_SUITE( FileInfoTableTest )
+
+namespace {
+
+/**
+ * @brief Creates a check value for the given index.
+ *
+ * @param[in] index
+ *   Index of the file.
+ *
+ * @return Check value (Every third file without check value).
+ **/
+Arinc645::CheckValue checkValue( const unsigned int index )
+{
+  if ( 0U == ( index % 3U ) )
+  {
+    return Arinc645::CheckValue::NoCheckValue;
+  }
+
+  return Arinc645::CheckValue{
+    Arinc645::CheckValueType::Crc32,
+    Helper::RawData{
+      std::byte( index ), std::byte( index >> 8U ), std::byte{ 0xA5U }, std::byte{ 0x5AU } } };
+}
+
+/**
+ * @brief Creates a raw file list file with @p numberOfFiles files.
+ *
+ * Filenames and path names have alternating odd and even lengths to cover the fill character handling.
+ *
+ * @param[in] version
+ *   ARINC 665 version.
+ * @param[in] numberOfFiles
+ *   Number of files.
+ *
+ * @return Raw file list file.
+ **/
+Helper::RawData rawFileListFile( const SupportedArinc665Version version, const unsigned int numberOfFiles )
+{
+  FileListFile file{ version };
+  file.mediaSetPn( "PN12345" );
+  file.mediaSequenceNumber( MediumNumber{ 1U } );
+  file.numberOfMediaSetMembers( MediumNumber{ 3U } );
+
+  for ( unsigned int index{ 0U }; index < numberOfFiles; ++index )
+  {
+    file.file( FileInfo{
+      .filename = std::format( "FILE_{}.BIN", index ),
+      .pathName = std::string( index % 5U, 'P' ).append( "\\" ),
+      .memberSequenceNumber = MediumNumber{ static_cast< uint8_t >( 1U + index % 3U ) },
+      .crc = static_cast< uint16_t >( index * 7U ),
+      .checkValue = ( SupportedArinc665Version::Supplement345 == version ) ?
+        checkValue( index ) : Arinc645::CheckValue::NoCheckValue } );
+  }
+
+  file.userDefinedData( Helper::RawData{ std::byte{ 0x01U }, std::byte{ 0x02U } } );
+
+  return static_cast< Helper::RawData >( file );
+}
+
+/**
+ * @brief Creates a raw load header file with @p numberOfFiles data and support files.
+ *
+ * @param[in] version
+ *   ARINC 665 version.
+ * @param[in] numberOfFiles
+ *   Number of data files and support files.
+ *
+ * @return Raw load header file.
+ **/
+Helper::RawData rawLoadHeaderFile( const SupportedArinc665Version version, const unsigned int numberOfFiles )
+{
+  const bool v3{ SupportedArinc665Version::Supplement345 == version };
+
+  LoadHeaderFile file{ version };
+  file.partNumber( "LOADPN123" );
+  file.targetHardwareIds( { "THW0", "THW1" } );
+
+  for ( unsigned int index{ 0U }; index < numberOfFiles; ++index )
+  {
+    file.dataFile( LoadFileInfo{
+      .filename = std::format( "DATA_{}", index ),
+      .partNumber = std::format( "DPN{}", index * 11U ),
+      // odd lengths are only representable within ARINC 665-3 files
+      .length = v3 ? ( 1000U + index ) : ( 1000U + 2U * index ),
+      .crc = static_cast< uint16_t >( index * 3U ),
+      .checkValue = v3 ? checkValue( index ) : Arinc645::CheckValue::NoCheckValue } );
+
+    file.supportFile( LoadFileInfo{
+      .filename = std::format( "SUPPORT_{}.TXT", index ),
+      .partNumber = std::string( index % 4U, 'S' ),
+      .length = 17U + index,
+      .crc = static_cast< uint16_t >( index * 5U ),
+      .checkValue = v3 ? checkValue( index + 1U ) : Arinc645::CheckValue::NoCheckValue } );
+  }
+
+  return static_cast< Helper::RawData >( file );
+}
+
+/**
+ * @brief Compares the File Information Table against the files information list.
+ *
+ * @param[in] table
+ *   Bulk decoded table.
+ * @param[in] files
+ *   Files information decoded by FileListFile.
+ **/
+void checkEqual( const FileInfoTable &table, const FilesInfo &files )
+{
+  BOOST_REQUIRE( table.size() == files.size() );
+
+  auto fileIt{ files.begin() };
+  for ( const auto &entry : table.entries() )
+  {
+    BOOST_CHECK( entry.filename == fileIt->filename );
+    BOOST_CHECK( entry.pathName == fileIt->pathName );
+    BOOST_CHECK( entry.memberSequenceNumber == fileIt->memberSequenceNumber );
+    BOOST_CHECK( entry.crc == fileIt->crc );
+    BOOST_CHECK( entry.checkValue == fileIt->checkValue );
+    ++fileIt;
+  }
+
+  BOOST_CHECK( table.filesInfo() == files );
+}
+
+/**
+ * @brief Compares the Load File Information Table against the load files information list.
+ *
+ * @param[in] table
+ *   Bulk decoded table.
+ * @param[in] files
+ *   Load files information decoded by LoadHeaderFile.
+ **/
+void checkEqual( const LoadFileInfoTable &table, const LoadFilesInfo &files )
+{
+  BOOST_REQUIRE( table.size() == files.size() );
+
+  auto fileIt{ files.begin() };
+  for ( const auto &entry : table.entries() )
+  {
+    BOOST_CHECK( entry.filename == fileIt->filename );
+    BOOST_CHECK( entry.partNumber == fileIt->partNumber );
+    BOOST_CHECK( entry.length == fileIt->length );
+    BOOST_CHECK( entry.crc == fileIt->crc );
+    BOOST_CHECK( entry.checkValue == fileIt->checkValue );
+    ++fileIt;
+  }
+
+  BOOST_CHECK( std::ranges::equal(
+    table.filesInfo(),
+    files,
+    []( const LoadFileInfo &converted, const LoadFileInfo &decoded ) {
+      return ( converted.filename == decoded.filename )
+        && ( converted.partNumber == decoded.partNumber )
+        && ( converted.length == decoded.length )
+        && ( converted.crc == decoded.crc )
+        && ( converted.checkValue == decoded.checkValue );
+    } ) );
+}
+
+}
+
+//! Differential test of the FILES.LUM bulk decoder
+BOOST_AUTO_TEST_CASE( fileListFile )
+{
+  for ( const auto version : { SupportedArinc665Version::Supplement2, SupportedArinc665Version::Supplement345 } )
+  {
+    for ( const auto numberOfFiles : { 0U, 1U, 2U, 17U, 500U } )
+    {
+      BOOST_TEST_CONTEXT( "version " << static_cast< int >( version ) << ", files " << numberOfFiles )
+      {
+        const auto rawFile{ rawFileListFile( version, numberOfFiles ) };
+
+        auto table{ FileListFile::decodeFilesInfoTable( rawFile ) };
+        checkEqual( table, FileListFile{ rawFile }.files() );
+
+        // entries must stay valid, when the table is moved
+        const auto movedTable{ std::move( table ) };
+        checkEqual( movedTable, FileListFile{ rawFile }.files() );
+
+        // file list decoded into the table instead of the file list file
+        FileInfoTable decodedTable{};
+        const FileListFile file{ rawFile, decodedTable };
+        checkEqual( decodedTable, FileListFile{ rawFile }.files() );
+        BOOST_CHECK( file.files().empty() );
+        BOOST_CHECK( file.mediaSetPn() == "PN12345" );
+        BOOST_CHECK( file.numberOfMediaSetMembers() == MediumNumber{ 3U } );
+      }
+    }
+  }
+}
+
+//! Differential test of the LUH data and support files bulk decoders
+BOOST_AUTO_TEST_CASE( loadHeaderFile )
+{
+  for ( const auto version : { SupportedArinc665Version::Supplement2, SupportedArinc665Version::Supplement345 } )
+  {
+    for ( const auto numberOfFiles : { 0U, 1U, 2U, 17U, 500U } )
+    {
+      BOOST_TEST_CONTEXT( "version " << static_cast< int >( version ) << ", files " << numberOfFiles )
+      {
+        const auto rawFile{ rawLoadHeaderFile( version, numberOfFiles ) };
+        const LoadHeaderFile file{ rawFile };
+
+        checkEqual( LoadHeaderFile::decodeDataFilesTable( rawFile ), file.dataFiles() );
+        checkEqual( LoadHeaderFile::decodeSupportFilesTable( rawFile ), file.supportFiles() );
+
+        // file lists decoded into the tables instead of the load header file
+        LoadFileInfoTable dataFilesTable{};
+        LoadFileInfoTable supportFilesTable{};
+        const LoadHeaderFile tableFile{ rawFile, dataFilesTable, supportFilesTable };
+        checkEqual( dataFilesTable, file.dataFiles() );
+        checkEqual( supportFilesTable, file.supportFiles() );
+        BOOST_CHECK( tableFile.dataFiles().empty() );
+        BOOST_CHECK( tableFile.supportFiles().empty() );
+        BOOST_CHECK( tableFile.partNumber() == file.partNumber() );
+      }
+    }
+  }
+}
+
+//! Tables of the media of a media set are compared like FileListFile::belongsToSameMediaSet()
+BOOST_AUTO_TEST_CASE( belongsToSameMediaSet )
+{
+  const auto decode{ []( const FilesInfo &files )
+  {
+    FileListFile file{ SupportedArinc665Version::Supplement345 };
+    for ( const auto &fileInfo : files )
+    {
+      file.file( fileInfo );
+    }
+    return FileListFile::decodeFilesInfoTable( static_cast< Helper::RawData >( file ) );
+  } };
+
+  const FilesInfo files{
+    FileInfo{
+      .filename = std::string{ ListOfLoadsName },
+      .pathName = "\\",
+      .memberSequenceNumber = MediumNumber{ 1U },
+      .crc = 1U },
+    FileInfo{
+      .filename = "FILE.BIN",
+      .pathName = "\\DIR\\",
+      .memberSequenceNumber = MediumNumber{ 2U },
+      .crc = 2U,
+      .checkValue = checkValue( 1U ) } };
+
+  const auto table{ decode( files ) };
+  BOOST_CHECK( table.belongsToSameMediaSet( decode( files ) ) );
+  BOOST_CHECK( table.entries().back().path() == files.back().path() );
+
+  // list of loads is created per medium
+  auto otherFiles{ files };
+  otherFiles.front().crc = 3U;
+  otherFiles.front().memberSequenceNumber = MediumNumber{ 2U };
+  BOOST_CHECK( table.belongsToSameMediaSet( decode( otherFiles ) ) );
+
+  otherFiles = files;
+  otherFiles.back().crc = 3U;
+  BOOST_CHECK( !table.belongsToSameMediaSet( decode( otherFiles ) ) );
+
+  otherFiles = files;
+  otherFiles.back().memberSequenceNumber = MediumNumber{ 1U };
+  BOOST_CHECK( !table.belongsToSameMediaSet( decode( otherFiles ) ) );
+
+  otherFiles = files;
+  otherFiles.back().checkValue = Arinc645::CheckValue::NoCheckValue;
+  BOOST_CHECK( !table.belongsToSameMediaSet( decode( otherFiles ) ) );
+
+  otherFiles = files;
+  otherFiles.back().pathName = "\\OTHER\\";
+  BOOST_CHECK( !table.belongsToSameMediaSet( decode( otherFiles ) ) );
+
+  otherFiles = files;
+  otherFiles.pop_back();
+  BOOST_CHECK( !table.belongsToSameMediaSet( decode( otherFiles ) ) );
+}
+
+//! Invalid file lists must be rejected by the bulk decoder
+BOOST_AUTO_TEST_CASE( invalidFileList )
+{
+  // Number of files: 2, last file pointer is not 0
+  const Helper::RawData invalidLastPointer{
+    std::byte{ 0x00U }, std::byte{ 0x02U },
+    std::byte{ 0x00U }, std::byte{ 0x05U },
+    std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x01U }, std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x01U },
+    std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x01U }, std::byte{ 0x00U }, std::byte{ 0x00U } };
+  BOOST_CHECK_THROW( (void)FileInfoTable::decode( invalidLastPointer, false ), InvalidArinc665File );
+
+  // Number of files: 2, next file pointer exceeds file list
+  const Helper::RawData pointerExceedsList{
+    std::byte{ 0x00U }, std::byte{ 0x02U },
+    std::byte{ 0x00U }, std::byte{ 0x40U },
+    std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x01U }, std::byte{ 0x00U }, std::byte{ 0x00U } };
+  BOOST_CHECK_THROW( (void)FileInfoTable::decode( pointerExceedsList, false ), InvalidArinc665File );
+
+  // Number of files: 1, string length exceeds file list
+  const Helper::RawData stringExceedsList{
+    std::byte{ 0x00U }, std::byte{ 0x01U },
+    std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x20U }, std::byte{ 'A' }, std::byte{ 'B' } };
+  BOOST_CHECK_THROW( (void)LoadFileInfoTable::decodeSupportFiles( stringExceedsList, false ), Arinc665Exception );
+
+  // member sequence number out of range
+  const Helper::RawData invalidMemberSequenceNumber{
+    std::byte{ 0x00U }, std::byte{ 0x01U },
+    std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U },
+    std::byte{ 0x01U }, std::byte{ 0x00U }, std::byte{ 0x00U }, std::byte{ 0x00U } };
+  BOOST_CHECK_THROW( (void)FileInfoTable::decode( invalidMemberSequenceNumber, false ), InvalidArinc665File );
+
+  // corrupted file CRC
+  auto rawFile{ rawFileListFile( SupportedArinc665Version::Supplement345, 3U ) };
+  rawFile.back() ^= std::byte{ 0xFFU };
+  BOOST_CHECK_THROW( (void)FileListFile::decodeFilesInfoTable( rawFile ), InvalidArinc665File );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
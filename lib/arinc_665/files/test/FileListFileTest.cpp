@@ -136,6 +136,22 @@ BOOST_AUTO_TEST_CASE( constructor1 )
   BOOST_CHECK( std::ranges::equal( std::as_bytes( std::span{ rawFileListFile } ), raw2 ) );
 }
 
+//! Encoding into caller supplied buffer
+BOOST_AUTO_TEST_CASE( encodeBuffer )
+{
+  const FileListFile file{ std::as_bytes( std::span{ rawFileListFile } ) };
+
+  BOOST_CHECK( file.encodedSize() == sizeof( rawFileListFile ) );
+
+  // all fields (including spares and padding) must be written
+  Helper::RawData buffer( file.encodedSize(), std::byte{ 0xFFU } );
+  file.encode( buffer );
+  BOOST_CHECK( std::ranges::equal( std::as_bytes( std::span{ rawFileListFile } ), buffer ) );
+
+  Helper::RawData wrongSize( file.encodedSize() + 2U );
+  BOOST_CHECK_THROW( file.encode( wrongSize ), Arinc665Exception );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -60,11 +60,30 @@ BOOST_AUTO_TEST_CASE( encodeString )
   BOOST_CHECK( std::ranges::equal( StringUtils_encodeString( "" ), std::as_bytes( std::span{ expected3 } ) ) );
 }
 
+//! Encode String into Buffer Test
+BOOST_AUTO_TEST_CASE( encodeStringBuffer )
+{
+  BOOST_CHECK( StringUtils_encodedStringSize( "Test" ) == 6U );
+  BOOST_CHECK( StringUtils_encodedStringSize( "Test1" ) == 8U );
+  BOOST_CHECK( StringUtils_encodedStringSize( "" ) == 2U );
+
+  // padding must be written, even if the buffer is not zero initialised
+  Helper::RawData buffer( 10U, std::byte{ 0xFFU } );
+  const auto remaining{ StringUtils_encodeString( buffer, "Test1" ) };
+  BOOST_CHECK( remaining.size() == 2U );
+
+  const uint8_t expected[]{ 0x00, 0x05, 'T', 'e', 's', 't', '1', 0x00, 0xFF, 0xFF };
+  BOOST_CHECK( std::ranges::equal( buffer, std::as_bytes( std::span{ expected } ) ) );
+
+  Helper::RawData tooSmall( 7U );
+  BOOST_CHECK_THROW( StringUtils_encodeString( tooSmall, "Test1" ), Arinc665Exception );
+}
+
 //! Decode Strings Test
 BOOST_AUTO_TEST_CASE( decodeStrings )
 {
   Helper::ConstRawDataSpan remaining;
-  std::list< std::string > out;
+  std::list< Symbol > out;
 
   const uint8_t rawStringList1[]{
     0x00, 0x03,
@@ -33,23 +33,26 @@ std::string_view Batch::partNumber() const
   return partNumberV;
 }
 
-void Batch::partNumber( std::string partNumber )
+void Batch::partNumber( Symbol partNumber )
 {
   partNumberV = std::move( partNumber );
 }
 
 std::string_view Batch::comment() const
 {
+  loadContent();
   return commentV;
 }
 
 void Batch::comment( std::string comment )
 {
+  loadContent();
   commentV = std::move( comment );
 }
 
 ConstBatchInformation Batch::targets() const
 {
+  loadContent();
   ConstBatchInformation batchInfo{};
 
   for ( const auto &[ targetHardwareId, loads ] : batchesV )
@@ -62,6 +65,7 @@ ConstBatchInformation Batch::targets() const
 
 ConstLoads Batch::target( std::string_view targetHardwareIdPosition ) const
 {
+  loadContent();
   const auto targetLoads{ batchesV.find( targetHardwareIdPosition ) };
 
   if ( targetLoads == batchesV.end() )
@@ -72,14 +76,16 @@ ConstLoads Batch::target( std::string_view targetHardwareIdPosition ) const
   return { targetLoads->second.begin(), targetLoads->second.end() };
 }
 
-void Batch::target( std::string targetHardwareIdPosition, const ConstLoads &loads )
+void Batch::target( Symbol targetHardwareIdPosition, const ConstLoads &loads )
 {
+  loadContent();
   batchesV.try_emplace( std::move( targetHardwareIdPosition ), loads.begin(), loads.end() );
 }
 
 void Batch::target( std::string_view targetHardwareIdPosition, const ConstLoadPtr &load )
 {
-  batchesV[ std::string{ targetHardwareIdPosition } ].emplace_back( load );
+  loadContent();
+  batchesV[ Symbol{ targetHardwareIdPosition } ].emplace_back( load );
 }
 
 }
@@ -27,6 +27,9 @@ namespace Arinc665::Media {
  *
  * A %Batch is used to declare loads for multiple Target Hardware Items at a time.
  * For each Target Hardware (identified by its Target Hardware ID - THW ID) a list of loads is defined.
+ *
+ * The content of the batch file can be deferred (see File::contentLoader()).
+ * The part number is provided by the list of batches and is available without loading the deferred content.
  **/
 class ARINC_665_EXPORT Batch final : public File
 {
@@ -80,7 +83,7 @@ class ARINC_665_EXPORT Batch final : public File
      * @param[in] partNumber
      *   New %Batch Part Number
      **/
-    void partNumber( std::string partNumber );
+    void partNumber( Symbol partNumber );
 
     /** @} **/
 
@@ -147,7 +150,7 @@ class ARINC_665_EXPORT Batch final : public File
      * @param[in] loads
      *   Loads for @p targetHardwareIdPosition.
      **/
-    void target( std::string targetHardwareIdPosition, const ConstLoads &loads );
+    void target( Symbol targetHardwareIdPosition, const ConstLoads &loads );
 
     /**
      * @brief Add the given Load to the Target Hardware ID Position.
@@ -169,10 +172,10 @@ class ARINC_665_EXPORT Batch final : public File
     using WeakLoads = std::list< ConstLoadPtr::weak_type >;
 
     //! Batch Information (Target Hardware ID -> Weak Loads)
-    using WeakBatchInfo = std::map< std::string, WeakLoads, std::less<> >;
+    using WeakBatchInfo = std::map< Symbol, WeakLoads, std::less<> >;
 
     //! Part Number
-    std::string partNumberV;
+    Symbol partNumberV;
     //! Batch Comment
     std::string commentV;
     //! Batch Information
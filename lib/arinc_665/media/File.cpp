@@ -106,6 +106,18 @@ void File::checkValueType( std::optional< Arinc645::CheckValueType > type )
   checkValueTypeV = type;
 }
 
+void File::contentLoader( ContentLoader contentLoader )
+{
+  const std::lock_guard lock{ contentMutexV };
+  contentLoaderV = std::move( contentLoader );
+  contentPendingV.store( static_cast< bool >( contentLoaderV ), std::memory_order_release );
+}
+
+bool File::contentLoaded() const noexcept
+{
+  return !contentPendingV.load( std::memory_order_acquire );
+}
+
 File::File(
   const ContainerEntityPtr &parent,
   std::string name,
@@ -135,4 +147,43 @@ void File::parent( const ContainerEntityPtr &parent )
   parentV = parent;
 }
 
+void File::loadContent() const
+{
+  // content not deferred or already loaded
+  if ( !contentPendingV.load( std::memory_order_acquire ) )
+  {
+    return;
+  }
+
+  const std::lock_guard lock{ contentMutexV };
+
+  // loaded meanwhile by another thread, or called by the content loader itself through the modifying methods
+  if ( !contentLoaderV )
+  {
+    return;
+  }
+
+  ContentLoader contentLoader{};
+  contentLoader.swap( contentLoaderV );
+
+  try
+  {
+    // files are always created as non-const instances (see ContainerEntity)
+    contentLoader( const_cast< File & >( *this ) );
+  }
+  catch ( ... )
+  {
+    // try again on next access
+    contentLoaderV = std::move( contentLoader );
+    throw;
+  }
+
+  contentPendingV.store( false, std::memory_order_release );
+}
+
+std::unique_lock< std::recursive_mutex > File::lockContent() const
+{
+  return std::unique_lock{ contentMutexV };
+}
+
 }
@@ -20,7 +20,10 @@
 
 #include <arinc_645/Arinc645.hpp>
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <optional>
 
 namespace Arinc665::Media {
@@ -40,6 +43,12 @@ namespace Arinc665::Media {
  * have no direct representation.
  *
  * The parent stored within this class is held as weak reference.
+ *
+ * @par Deferred Content
+ * The content of load header files and batch files can be provided on first access (see contentLoader()).
+ * This is used by the lazy decompilation of media sets (see Utils::MediaSetDecompiler::lazy()), which creates the
+ * files only from the list files.
+ * The derived classes call loadContent() before each access to their content.
  **/
 class ARINC_665_EXPORT File : public Base
 {
@@ -170,6 +179,43 @@ class ARINC_665_EXPORT File : public Base
 
     /** @} **/
 
+    /**
+     * @name Deferred Content
+     * @{
+     **/
+
+    /**
+     * @brief Content Loader.
+     *
+     * Provides the content of the file by using the modifying methods of @p file.
+     * It must not access the content of @p file itself.
+     *
+     * @param[in,out] file
+     *   This file.
+     *
+     * @throw Arinc665Exception
+     *   When the content cannot be provided.
+     **/
+    using ContentLoader = std::function< void( File &file ) >;
+
+    /**
+     * @brief Sets the Content Loader, which is called on the first access to the content.
+     *
+     * @param[in] contentLoader
+     *   Content Loader.
+     *   If empty, the content is considered as loaded.
+     **/
+    void contentLoader( ContentLoader contentLoader );
+
+    /**
+     * @brief Returns if the Content has been loaded.
+     *
+     * @return If no content loader is pending.
+     **/
+    [[nodiscard]] bool contentLoaded() const noexcept;
+
+    /** @} **/
+
   protected:
     /**
      * @brief Initialises the instance with the given data.
@@ -202,6 +248,28 @@ class ARINC_665_EXPORT File : public Base
      **/
     void parent( const ContainerEntityPtr &parent );
 
+    /**
+     * @brief Loads the deferred Content, if not already done.
+     *
+     * Can be called concurrently.
+     * Concurrent callers wait until the content has been loaded.
+     * When the content loader fails, it is called again on the next access.
+     *
+     * @throw Arinc665Exception
+     *   When the content cannot be loaded.
+     **/
+    void loadContent() const;
+
+    /**
+     * @brief Locks the Content against a concurrently running Content Loader.
+     *
+     * Used to read content, which is available without loading the deferred content, but is modified by the content
+     * loader.
+     *
+     * @return Lock of the content.
+     **/
+    [[nodiscard]] std::unique_lock< std::recursive_mutex > lockContent() const;
+
   private:
     //! Parent Container
     ContainerEntityPtr::weak_type parentV;
@@ -211,6 +279,12 @@ class ARINC_665_EXPORT File : public Base
     OptionalMediumNumber mediumNumberV;
     //! Check Value Type
     std::optional< Arinc645::CheckValueType > checkValueTypeV;
+    //! Content Loader Pending (checked without locking)
+    mutable std::atomic_bool contentPendingV{ false };
+    //! Guards the Content Loader (recursive, as the loader modifies the file)
+    mutable std::recursive_mutex contentMutexV;
+    //! Content Loader
+    mutable ContentLoader contentLoaderV;
 };
 
 }
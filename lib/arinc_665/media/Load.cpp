@@ -45,11 +45,13 @@ FileType Load::fileType() const
 
 uint16_t Load::partFlags() const
 {
+  loadContent();
   return partFlagsV;
 }
 
 void Load::partFlags( const uint16_t partFlags )
 {
+  loadContent();
   partFlagsV = partFlags;
 }
 
@@ -58,28 +60,33 @@ std::string_view Load::partNumber() const
   return partNumberV;
 }
 
-void Load::partNumber( std::string partNumber )
+void Load::partNumber( Symbol partNumber )
 {
   partNumberV = std::move( partNumber );
 }
 
 const Load::TargetHardwareIdPositions& Load::targetHardwareIdPositions() const
 {
+  loadContent();
   return targetHardwareIdPositionsV;
 }
 
 Load::TargetHardwareIdPositions& Load::targetHardwareIdPositions()
 {
+  loadContent();
   return targetHardwareIdPositionsV;
 }
 
 void Load::targetHardwareIdPositions( TargetHardwareIdPositions targetHardwareIdPositions )
 {
+  loadContent();
   targetHardwareIdPositionsV = std::move( targetHardwareIdPositions );
 }
 
 Load::TargetHardwareIds Load::targetHardwareIds() const
 {
+  // THW IDs are provided without the deferred content, but their positions are assigned by the content loader
+  const auto lock{ lockContent() };
   TargetHardwareIds thwIds{};
 
   for ( const auto &[ thwId, positions ] : targetHardwareIdPositionsV )
@@ -92,14 +99,16 @@ Load::TargetHardwareIds Load::targetHardwareIds() const
 
 void Load::targetHardwareIds( const TargetHardwareIds &thwIds )
 {
+  loadContent();
   for ( const auto &targetHardwareId : thwIds )
   {
     targetHardwareIdPositionsV.insert_or_assign( targetHardwareId, Positions{} );
   }
 }
 
-void Load::targetHardwareId( std::string targetHardwareId, Positions positions )
+void Load::targetHardwareId( Symbol targetHardwareId, Positions positions )
 {
+  loadContent();
   targetHardwareIdPositionsV.insert_or_assign( std::move( targetHardwareId ), std::move( positions ) );
 }
 
@@ -165,6 +174,7 @@ ConstFilePtr Load::file(
 
 ConstFiles Load::files() const
 {
+  loadContent();
   // add the load file itself
   ConstFiles files{ {
     std::dynamic_pointer_cast< const File >( shared_from_this() ) } };
@@ -186,6 +196,7 @@ ConstFiles Load::files() const
 
 ConstLoadFiles Load::dataFiles( const bool effective ) const
 {
+  loadContent();
   ConstLoadFiles files{};
 
   for ( const auto &[ filePtr, partNumber, checkValueType ] : dataFilesV )
@@ -208,14 +219,16 @@ ConstLoadFiles Load::dataFiles( const bool effective ) const
 
 void Load::dataFiles( const ConstLoadFiles &files )
 {
+  loadContent();
   dataFilesV.assign( files.begin(), files.end() );
 }
 
 void Load::dataFile(
   const ConstRegularFilePtr &file,
-  std::string partNumber,
+  Symbol partNumber,
   std::optional< Arinc645::CheckValueType > checkValueType )
 {
+  loadContent();
   if ( !file || ( file->mediaSet() != mediaSet() ) )
   {
     BOOST_THROW_EXCEPTION( Arinc665Exception{}
@@ -230,6 +243,7 @@ void Load::dataFile(
 
 ConstLoadFiles Load::supportFiles( const bool effective ) const
 {
+  loadContent();
   ConstLoadFiles files{};
 
   for ( const auto &[filePtr, partNumber, checkValueType ] : supportFilesV )
@@ -252,14 +266,16 @@ ConstLoadFiles Load::supportFiles( const bool effective ) const
 
 void Load::supportFiles( const ConstLoadFiles &files )
 {
+  loadContent();
   supportFilesV.assign( files.begin(), files.end() );
 }
 
 void Load::supportFile(
   const ConstRegularFilePtr &file,
-  std::string partNumber,
+  Symbol partNumber,
   std::optional< Arinc645::CheckValueType > checkValueType )
 {
+  loadContent();
   if ( !file || ( file->mediaSet() != mediaSet() ) )
   {
     BOOST_THROW_EXCEPTION( Arinc665Exception{}
@@ -271,31 +287,37 @@ void Load::supportFile(
 
 Helper::ConstRawDataSpan Load::userDefinedData() const
 {
+  loadContent();
   return userDefinedDataV;
 }
 
 Helper::RawData& Load::userDefinedData()
 {
+  loadContent();
   return userDefinedDataV;
 }
 
 void Load::userDefinedData( Helper::RawData userDefinedData )
 {
+  loadContent();
   userDefinedDataV = std::move( userDefinedData ) ;
 }
 
 const Load::Type& Load::loadType() const
 {
+  loadContent();
   return typeV;
 }
 
 void Load::loadType( Type type )
 {
+  loadContent();
   typeV = std::move( type );
 }
 
 Arinc645::CheckValueType Load::effectiveLoadCheckValueType() const
 {
+  loadContent();
   return loadCheckValueTypeV.value_or(
     mediaSet()->mediaSetCheckValueType().value_or(
       Arinc645::CheckValueType::NotUsed ) );
@@ -303,12 +325,14 @@ Arinc645::CheckValueType Load::effectiveLoadCheckValueType() const
 
 std::optional< Arinc645::CheckValueType > Load::loadCheckValueType() const
 {
+  loadContent();
   return loadCheckValueTypeV;
 }
 
 void Load::loadCheckValueType(
   std::optional< Arinc645::CheckValueType > checkValueType )
 {
+  loadContent();
   loadCheckValueTypeV = checkValueType;
 }
 
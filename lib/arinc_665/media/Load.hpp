@@ -33,16 +33,20 @@ namespace Arinc665::Media {
 
 /**
  * @brief %Load within %Media Set.
+ *
+ * The content of the load header file can be deferred (see File::contentLoader()).
+ * The part number and the target hardware IDs without positions are provided by the list of loads and are available
+ * without loading the deferred content.
  **/
 class ARINC_665_EXPORT Load final : public File
 {
   public:
     //! Positions List
-    using Positions = std::set< std::string, std::less<> >;
+    using Positions = std::set< Symbol, std::less<> >;
     //! Target Hardware ID / Positions
-    using TargetHardwareIdPositions = std::map< std::string, Positions, std::less<> >;
+    using TargetHardwareIdPositions = std::map< Symbol, Positions, std::less<> >;
     //! Target Hardware ID List
-    using TargetHardwareIds = std::set< std::string, std::less<> >;
+    using TargetHardwareIds = std::set< Symbol, std::less<> >;
     //! %Load Type (Description + ID)
     using Type = std::optional< std::pair< std::string, uint16_t > >;
 
@@ -142,7 +146,7 @@ class ARINC_665_EXPORT Load final : public File
      * @param[in] partNumber
      *   New %Load Part Number
      **/
-    void partNumber( std::string partNumber );
+    void partNumber( Symbol partNumber );
 
     /** @} **/
 
@@ -200,7 +204,7 @@ class ARINC_665_EXPORT Load final : public File
      * @param[in] positions
      *   Optional additional Position specification.
      **/
-    void targetHardwareId( std::string targetHardwareId, Positions positions = {} );
+    void targetHardwareId( Symbol targetHardwareId, Positions positions = {} );
 
     /** @} **/
 
@@ -307,7 +311,7 @@ class ARINC_665_EXPORT Load final : public File
      **/
     void dataFile(
       const ConstRegularFilePtr &file,
-      std::string partNumber,
+      Symbol partNumber,
       std::optional< Arinc645::CheckValueType > checkValueType = {} );
 
     /** @} **/
@@ -357,7 +361,7 @@ class ARINC_665_EXPORT Load final : public File
      **/
     void supportFile(
       const ConstRegularFilePtr &file,
-      std::string partNumber,
+      Symbol partNumber,
       std::optional< Arinc645::CheckValueType > checkValueType = {} );
 
     /** @} **/
@@ -529,7 +533,7 @@ class ARINC_665_EXPORT Load final : public File
     //! Weak %Load %File ( file, Part Number, Check Value Type ).
     using WeakLoadFile = std::tuple<
       ConstRegularFilePtr::weak_type,
-      std::string,
+      Symbol,
       std::optional< Arinc645::CheckValueType > >;
     //! Weak %Load %File List.
     using WeakLoadFiles = std::list< WeakLoadFile >;
@@ -537,7 +541,7 @@ class ARINC_665_EXPORT Load final : public File
     //! Part Flags
     uint16_t partFlagsV{};
     //! Part Number
-    std::string partNumberV;
+    Symbol partNumberV;
     //! Target Hardware ID/ Positions
     TargetHardwareIdPositions targetHardwareIdPositionsV;
     //! Data Files
@@ -19,6 +19,7 @@
 #define ARINC_665_MEDIA_MEDIA_HPP
 
 #include <arinc_665/Arinc665.hpp>
+#include <arinc_665/Symbol.hpp>
 
 #include <arinc_645/Arinc645.hpp>
 
@@ -180,7 +181,7 @@ using LoadsVariant = std::variant< Loads, ConstLoads >;
 
 //! Const %Load %File List (File, Part Number, Check Value Type for this File).
 //! Used for Data and Support Files of Load
-using ConstLoadFile = std::tuple< ConstRegularFilePtr, std::string, std::optional< Arinc645::CheckValueType > >;
+using ConstLoadFile = std::tuple< ConstRegularFilePtr, Symbol, std::optional< Arinc645::CheckValueType > >;
 
 //! Const %Load %File List. Used for Data and Support Files of Load
 using ConstLoadFiles = std::list< ConstLoadFile >;
@@ -207,9 +208,9 @@ using BatchVariant = std::variant< BatchPtr, ConstBatchPtr >;
 using BatchesVariant = std::variant< Batches, ConstBatches >;
 
 //! Batch Information (Maps: Target Hardware ID Position -> Loads)
-using BatchInformation = std::map< std::string, Loads, std::less<> >;
+using BatchInformation = std::map< Symbol, Loads, std::less<> >;
 //! Const Batch Information (Maps: Target Hardware ID Position -> Loads)
-using ConstBatchInformation = std::map< std::string, ConstLoads, std::less<> >;
+using ConstBatchInformation = std::map< Symbol, ConstLoads, std::less<> >;
 //! Batch Information Variant
 using BatchInformationVariant = std::variant< BatchInformation, ConstBatchInformation >;
 //! Batch Target Information
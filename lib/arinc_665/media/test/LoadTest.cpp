@@ -17,6 +17,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
 using namespace std::string_view_literals;
 
 namespace Arinc665::Media {
@@ -112,6 +118,105 @@ BOOST_AUTO_TEST_CASE( Loads_filePartNumberTest )
   BOOST_CHECK( Loads_file( loads, "LOAD2.LUH", "PN2" ) == load2 );
 }
 
+//! Deferred Content Test
+BOOST_AUTO_TEST_CASE( contentLoader )
+{
+  auto mediaSet{ MediaSet::create() };
+
+  auto load{ mediaSet->addLoad( "LOAD.LUH" ) };
+  BOOST_CHECK( load );
+  BOOST_CHECK( load->contentLoaded() );
+
+  auto regularFile{ mediaSet->addRegularFile( "FILE1" ) };
+
+  load->partNumber( "PN" );
+  load->targetHardwareIds( { "THW1" } );
+
+  std::size_t calls{ 0U };
+  bool fail{ true };
+
+  load->contentLoader( [ & ]( File &file )
+  {
+    ++calls;
+
+    if ( fail )
+    {
+      throw std::runtime_error{ "content not available" };
+    }
+
+    auto &deferredLoad{ dynamic_cast< Load & >( file ) };
+    deferredLoad.partFlags( 0x1234U );
+    deferredLoad.targetHardwareId( "THW1", { "POS1" } );
+    deferredLoad.dataFile( regularFile, "PN1" );
+  } );
+  BOOST_CHECK( !load->contentLoaded() );
+
+  // provided without loading the content
+  BOOST_CHECK( load->partNumber() == "PN" );
+  BOOST_CHECK( load->targetHardwareIds() == Load::TargetHardwareIds{ "THW1" } );
+  BOOST_CHECK( calls == 0U );
+
+  // failed loader is called again on next access
+  BOOST_CHECK_THROW( static_cast< void >( load->partFlags() ), std::runtime_error );
+  BOOST_CHECK( !load->contentLoaded() );
+
+  fail = false;
+  BOOST_CHECK( load->partFlags() == 0x1234U );
+  BOOST_CHECK( load->contentLoaded() );
+  BOOST_CHECK( calls == 2U );
+
+  BOOST_CHECK( load->targetHardwareIdPositions().at( "THW1" ) == Load::Positions{ "POS1" } );
+  BOOST_CHECK( load->dataFiles().size() == 1U );
+  BOOST_CHECK( calls == 2U );
+}
+
+//! THW IDs are read consistently while the content loader modifies them
+BOOST_AUTO_TEST_CASE( concurrentContentLoader )
+{
+  constexpr std::size_t thwIds{ 100U };
+
+  auto mediaSet{ MediaSet::create() };
+  auto load{ mediaSet->addLoad( "LOAD.LUH" ) };
+  load->targetHardwareIds( { "THW" } );
+
+  load->contentLoader( []( File &file )
+  {
+    auto &deferredLoad{ dynamic_cast< Load & >( file ) };
+
+    for ( std::size_t thwId{ 0U }; thwId < thwIds; ++thwId )
+    {
+      deferredLoad.targetHardwareId( "THW" + std::to_string( thwId ) );
+
+      if ( thwIds / 2U == thwId )
+      {
+        std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+      }
+    }
+  } );
+
+  std::atomic_bool inconsistent{ false };
+  std::atomic_bool loaded{ false };
+
+  std::jthread reader{ [ & ]
+  {
+    do
+    {
+      const auto size{ load->targetHardwareIds().size() };
+      if ( ( 1U != size ) && ( thwIds + 1U != size ) )
+      {
+        inconsistent = true;
+      }
+    } while ( !loaded );
+  } };
+
+  BOOST_CHECK( load->partFlags() == 0U );
+  loaded = true;
+  reader.join();
+
+  BOOST_CHECK( !inconsistent );
+  BOOST_CHECK( load->targetHardwareIds().size() == thwIds + 1U );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of unit tests for the class Arinc665::Symbol.
+ **/
+
+#include <arinc_665/Symbol.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <format>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace Arinc665 {
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( SymbolTest )
+
+//! Interning Test
+BOOST_AUTO_TEST_CASE( intern )
+{
+  const Symbol symbol1{ "THW1"sv };
+  const Symbol symbol2{ std::string{ "THW1" } };
+  const Symbol symbol3{ "THW2" };
+
+  BOOST_CHECK( symbol1 == symbol2 );
+  BOOST_CHECK( &symbol1.str() == &symbol2.str() );
+  BOOST_CHECK( symbol1 != symbol3 );
+  BOOST_CHECK( symbol1.str() == "THW1" );
+
+  BOOST_CHECK( Symbol{}.empty() );
+  BOOST_CHECK( Symbol{ "" } == Symbol{} );
+  BOOST_CHECK( !symbol1.empty() );
+}
+
+//! Comparison Test
+BOOST_AUTO_TEST_CASE( compare )
+{
+  const Symbol symbol{ "POS1" };
+
+  BOOST_CHECK( symbol == "POS1" );
+  BOOST_CHECK( "POS1" == symbol );
+  BOOST_CHECK( symbol == "POS1"sv );
+  BOOST_CHECK( symbol == std::string{ "POS1" } );
+  BOOST_CHECK( symbol != "POS2" );
+
+  BOOST_CHECK( Symbol{ "A" } < Symbol{ "B" } );
+  BOOST_CHECK( Symbol{ "B" } > "A"sv );
+
+  // ordered lexicographically and not by interning order
+  const std::set< Symbol, std::less<> > symbols{ "Z", "A", "M" };
+  BOOST_CHECK( *symbols.begin() == "A" );
+  BOOST_CHECK( *symbols.rbegin() == "Z" );
+  BOOST_CHECK( symbols.contains( "M"sv ) );
+  BOOST_CHECK( !symbols.contains( "B"sv ) );
+}
+
+//! Concurrent Interning Test
+BOOST_AUTO_TEST_CASE( concurrentIntern )
+{
+  constexpr std::size_t threads{ 4U };
+  std::vector< const std::string * > strings( threads );
+
+  {
+    std::vector< std::jthread > workers{};
+
+    for ( std::size_t thread{ 0U }; thread < threads; ++thread )
+    {
+      workers.emplace_back( [ &strings, thread ]
+      {
+        for ( std::size_t index{ 0U }; index < 1000U; ++index )
+        {
+          const Symbol symbol{ std::format( "SYMBOL{}", index ) };
+
+          if ( 500U == index )
+          {
+            strings[ thread ] = &symbol.str();
+          }
+        }
+      } );
+    }
+  }
+
+  for ( const auto *string : strings )
+  {
+    BOOST_CHECK( string == strings.front() );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
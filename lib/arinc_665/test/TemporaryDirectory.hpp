@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration and Definition of Class Arinc665::Test::TemporaryDirectory.
+ **/
+
+#ifndef ARINC_665_TEST_TEMPORARYDIRECTORY_HPP
+#define ARINC_665_TEST_TEMPORARYDIRECTORY_HPP
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <system_error>
+
+namespace Arinc665::Test {
+
+/**
+ * @brief Temporary Directory for Unit Tests, which operate on the file system.
+ *
+ * The directory is created within the temporary directory of the system and removed with all its content on
+ * destruction.
+ **/
+class TemporaryDirectory
+{
+  public:
+    //! Creates a new, unique Temporary Directory.
+    TemporaryDirectory()
+    {
+      std::random_device random{};
+
+      do
+      {
+        pathV = std::filesystem::temp_directory_path() / ( "arinc_665_test_" + std::to_string( random() ) );
+      } while ( !std::filesystem::create_directory( pathV ) );
+    }
+
+    TemporaryDirectory( const TemporaryDirectory & ) = delete;
+    TemporaryDirectory& operator=( const TemporaryDirectory & ) = delete;
+
+    //! Removes the Temporary Directory.
+    ~TemporaryDirectory()
+    {
+      std::error_code error{};
+      std::filesystem::remove_all( pathV, error );
+    }
+
+    /**
+     * @brief Returns the Path of the Temporary Directory.
+     *
+     * @return Path of the temporary directory.
+     **/
+    [[nodiscard]] const std::filesystem::path& path() const noexcept
+    {
+      return pathV;
+    }
+
+  private:
+    //! Path of the Temporary Directory
+    std::filesystem::path pathV;
+};
+
+}
+
+#endif
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Trace.
+ **/
+
+#include <arinc_665/Trace.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Arinc665 {
+
+namespace {
+
+/**
+ * @brief Reads the Events of the given Trace File.
+ *
+ * @param[in] file
+ *   Trace File.
+ *
+ * @return Trace Events in order of the file.
+ **/
+std::vector< boost::property_tree::ptree > readTraceEvents( const std::filesystem::path &file )
+{
+  boost::property_tree::ptree trace{};
+  boost::property_tree::read_json( file.string(), trace );
+
+  BOOST_CHECK_EQUAL( trace.get< std::string >( "displayTimeUnit" ), "ms" );
+
+  std::vector< boost::property_tree::ptree > events{};
+  for ( const auto &[ key, event ] : trace.get_child( "traceEvents" ) )
+  {
+    events.emplace_back( event );
+  }
+
+  return events;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( TraceTest )
+
+//! A trace session without trace file does not enable tracing
+BOOST_AUTO_TEST_CASE( disabledSession )
+{
+  BOOST_CHECK( !Trace::enabled() );
+
+  {
+    const TraceSession traceSession{ {} };
+    BOOST_CHECK( !Trace::enabled() );
+  }
+
+  BOOST_CHECK( !Trace::enabled() );
+}
+
+//! Nested scopes are written as complete events with escaped detail information
+BOOST_AUTO_TEST_CASE( session )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto traceFile{ directory.path() / "trace.json" };
+  const std::string detail{ "File \"A\\B\"\n\tEnd\x01" };
+
+  {
+    const TraceSession traceSession{ traceFile };
+    BOOST_CHECK( Trace::enabled() );
+
+    const Trace::Scope outer{ "Test", "Outer" };
+    {
+      const Trace::Scope inner{ "Test", "Inner", detail };
+    }
+  }
+
+  BOOST_CHECK( !Trace::enabled() );
+  BOOST_REQUIRE( std::filesystem::is_regular_file( traceFile ) );
+
+  // events are recorded when the scope ends
+  const auto events{ readTraceEvents( traceFile ) };
+  BOOST_REQUIRE_EQUAL( events.size(), 2U );
+  const auto &inner{ events[ 0 ] };
+  const auto &outer{ events[ 1 ] };
+
+  for ( const auto &event : events )
+  {
+    BOOST_CHECK_EQUAL( event.get< std::string >( "ph" ), "X" );
+    BOOST_CHECK_EQUAL( event.get< unsigned int >( "pid" ), 1U );
+    BOOST_CHECK_EQUAL( event.get< std::string >( "cat" ), "Test" );
+    BOOST_CHECK_GE( event.get< double >( "ts" ), 0.0 );
+    BOOST_CHECK_GE( event.get< double >( "dur" ), 0.0 );
+  }
+
+  BOOST_CHECK_EQUAL( inner.get< std::string >( "name" ), "Inner" );
+  BOOST_CHECK_EQUAL( inner.get< std::string >( "args.detail" ), detail );
+  BOOST_CHECK_EQUAL( outer.get< std::string >( "name" ), "Outer" );
+  BOOST_CHECK( !outer.get_child_optional( "args" ) );
+  BOOST_CHECK_EQUAL( inner.get< unsigned int >( "tid" ), outer.get< unsigned int >( "tid" ) );
+
+  // outer span contains the inner span (tolerance of the rounding to nanoseconds)
+  constexpr double Tolerance{ 0.002 };
+  BOOST_CHECK_LE( outer.get< double >( "ts" ), inner.get< double >( "ts" ) + Tolerance );
+  BOOST_CHECK_LE(
+    inner.get< double >( "ts" ) + inner.get< double >( "dur" ),
+    outer.get< double >( "ts" ) + outer.get< double >( "dur" ) + Tolerance );
+}
+
+//! Scopes outside the trace session are not recorded
+BOOST_AUTO_TEST_CASE( droppedEvents )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto traceFile{ directory.path() / "trace.json" };
+
+  // started while disabled
+  {
+    const Trace::Scope scope{ "Test", "Disabled" };
+    Trace::start();
+  }
+
+  // ended while disabled
+  {
+    const Trace::Scope scope{ "Test", "Stopped" };
+    Trace::stop();
+  }
+
+  Trace::start();
+  {
+    // started before the current trace session
+    const Trace::Scope previous{ "Test", "Previous" };
+    Trace::start();
+
+    const Trace::Scope recorded{ "Test", "Recorded" };
+  }
+  Trace::stop();
+
+  // not enabled again
+  {
+    const Trace::Scope scope{ "Test", "Disabled" };
+  }
+
+  Trace::write( traceFile );
+
+  const auto events{ readTraceEvents( traceFile ) };
+  BOOST_REQUIRE_EQUAL( events.size(), 1U );
+  BOOST_CHECK_EQUAL( events.front().get< std::string >( "name" ), "Recorded" );
+
+  // recorded events are discarded by write
+  Trace::write( traceFile );
+  BOOST_CHECK( readTraceEvents( traceFile ).empty() );
+}
+
+//! Events of different threads have different thread identifiers
+BOOST_AUTO_TEST_CASE( threads )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto traceFile{ directory.path() / "trace.json" };
+
+  {
+    const TraceSession traceSession{ traceFile };
+
+    {
+      const Trace::Scope scope{ "Test", "Main" };
+    }
+
+    std::thread thread{ []{ const Trace::Scope scope{ "Test", "Worker" }; } };
+    thread.join();
+  }
+
+  const auto events{ readTraceEvents( traceFile ) };
+  BOOST_REQUIRE_EQUAL( events.size(), 2U );
+  BOOST_CHECK_EQUAL( events[ 0 ].get< std::string >( "name" ), "Main" );
+  BOOST_CHECK_EQUAL( events[ 1 ].get< std::string >( "name" ), "Worker" );
+  BOOST_CHECK_NE( events[ 0 ].get< unsigned int >( "tid" ), events[ 1 ].get< unsigned int >( "tid" ) );
+}
+
+//! Trace files, which cannot be written, are reported
+BOOST_AUTO_TEST_CASE( writeError )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto traceFile{ directory.path() / "missing" / "trace.json" };
+
+  BOOST_CHECK_THROW( Trace::write( traceFile ), Arinc665Exception );
+
+  // the trace session only logs the error
+  BOOST_CHECK_NO_THROW( { const TraceSession traceSession{ traceFile }; } );
+  BOOST_CHECK( !Trace::enabled() );
+  BOOST_CHECK( !std::filesystem::exists( traceFile ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
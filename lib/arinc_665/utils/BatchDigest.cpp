@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665::Utils BatchDigest.
+ **/
+
+#include "BatchDigest.hpp"
+
+#include <arinc_665/utils/Parallel.hpp>
+
+#include <arinc_645/Arinc645Crc.hpp>
+#include <arinc_645/CheckValueGenerator.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <numeric>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Digests a single Buffer.
+ *
+ * @param[in] request
+ *   Digest Request.
+ *
+ * @return Digest of the buffer.
+ **/
+Digest digestBuffer( const DigestRequest &request )
+{
+  Arinc645::Arinc645Crc16 crc{};
+  crc.process_bytes( request.data.data(), request.data.size() );
+
+  if ( Arinc645::CheckValueType::NotUsed == request.checkValueType )
+  {
+    return { .crc = crc.checksum(), .checkValue = Arinc645::CheckValue::NoCheckValue };
+  }
+
+  auto checkValueGenerator{ Arinc645::CheckValueGenerator::create( request.checkValueType ) };
+  assert( checkValueGenerator );
+  checkValueGenerator->process( std::as_bytes( request.data ) );
+
+  return { .crc = crc.checksum(), .checkValue = checkValueGenerator->checkValue() };
+}
+
+}
+
+std::vector< Digest > BatchDigest_calculate(
+  const std::span< const DigestRequest > requests,
+  const std::size_t lanes,
+  const std::stop_token stopToken )
+{
+  std::vector< Digest > digests( requests.size() );
+
+  // largest buffers first - keeps the lanes balanced at the end of the batch
+  std::vector< std::size_t > order( requests.size() );
+  std::iota( order.begin(), order.end(), std::size_t{ 0U } );
+  std::ranges::stable_sort( order, std::ranges::greater{}, [ & ]( const std::size_t index )
+  {
+    return requests[ index ].data.size();
+  } );
+
+  Parallel_forEach( order.size(), lanes, stopToken, [ & ]( const std::size_t index )
+  {
+    digests[ order[ index ] ] = digestBuffer( requests[ order[ index ] ] );
+  } );
+
+  return digests;
+}
+
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665::Utils BatchDigest.
+ **/
+
+#ifndef ARINC_665_UTILS_BATCHDIGEST_HPP
+#define ARINC_665_UTILS_BATCHDIGEST_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+/**
+ * @name ARINC 665 Batch Digest
+ *
+ * Calculates the ARINC 665 file CRC and the ARINC 645 check value of many independent buffers at once.
+ *
+ * The buffers are distributed to parallel lanes, starting with the largest buffer.
+ * Each buffer is digested by a single lane using Arinc645::CheckValueGenerator, so the results are identical to
+ * digesting the buffers one after another.
+ * This hides the per-file latency when a media set consists of many small files.
+ * @{
+ **/
+
+//! Digest Request of a single Buffer
+struct DigestRequest
+{
+  //! Data to digest. Must stay valid until the batch is digested.
+  Helper::ConstRawDataSpan data;
+  //! Check Value Type (Arinc645::CheckValueType::NotUsed for CRC only)
+  Arinc645::CheckValueType checkValueType{ Arinc645::CheckValueType::NotUsed };
+};
+
+//! Digest of a single Buffer
+struct Digest
+{
+  //! ARINC 665 File CRC
+  uint16_t crc{ 0U };
+  //! Check Value (Arinc645::CheckValue::NoCheckValue if not requested)
+  Arinc645::CheckValue checkValue;
+};
+
+/**
+ * @brief Digests the given Buffers in parallel Lanes.
+ *
+ * The calling thread is used as one of the lanes.
+ *
+ * @param[in] requests
+ *   Digest Requests.
+ * @param[in] lanes
+ *   Maximum number of parallel lanes. 0 selects the number of hardware threads.
+ * @param[in] stopToken
+ *   Stop Token used for Cancellation. Checked between two buffers.
+ *
+ * @return Digests in the order of @p requests.
+ *
+ * @throw OperationCancelled
+ *   When cancellation has been requested.
+ **/
+[[nodiscard]] ARINC_665_EXPORT std::vector< Digest > BatchDigest_calculate(
+  std::span< const DigestRequest > requests,
+  std::size_t lanes = 0U,
+  std::stop_token stopToken = {} );
+
+/** @} **/
+
+}
+
+#endif
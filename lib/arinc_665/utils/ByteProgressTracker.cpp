@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::ByteProgressTracker.
+ **/
+
+#include "ByteProgressTracker.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <utility>
+
+namespace Arinc665::Utils {
+
+ByteProgressTracker::ByteProgressTracker( ByteProgressHandler progressHandler, std::stop_token stopToken ) :
+  progressHandlerV{ std::move( progressHandler ) },
+  stopTokenV{ std::move( stopToken ) },
+  startV{ std::chrono::steady_clock::now() },
+  lastReportV{ startV }
+{
+}
+
+bool ByteProgressTracker::reporting() const noexcept
+{
+  return static_cast< bool >( progressHandlerV );
+}
+
+void ByteProgressTracker::totalBytes( const std::uint64_t totalBytes ) noexcept
+{
+  totalBytesV = totalBytes;
+}
+
+void ByteProgressTracker::addTotalBytes( const std::uint64_t bytes ) noexcept
+{
+  totalBytesV += bytes;
+}
+
+void ByteProgressTracker::currentFile( std::filesystem::path currentFile )
+{
+  if ( progressHandlerV )
+  {
+    currentFileV = std::move( currentFile );
+  }
+}
+
+void ByteProgressTracker::advance( const std::uint64_t bytes )
+{
+  checkCancelled();
+
+  processedBytesV += bytes;
+
+  if ( !progressHandlerV )
+  {
+    return;
+  }
+
+  if ( const auto now{ std::chrono::steady_clock::now() }; now - lastReportV >= ReportInterval )
+  {
+    lastReportV = now;
+    report();
+  }
+}
+
+void ByteProgressTracker::checkCancelled() const
+{
+  if ( stopTokenV.stop_requested() )
+  {
+    BOOST_THROW_EXCEPTION( OperationCancelled{}
+      << Helper::AdditionalInfo{ "Operation cancelled by request" } );
+  }
+}
+
+void ByteProgressTracker::finish()
+{
+  if ( progressHandlerV )
+  {
+    report();
+  }
+}
+
+void ByteProgressTracker::report()
+{
+  const std::chrono::duration< double > elapsed{ std::chrono::steady_clock::now() - startV };
+
+  const double throughput{
+    ( elapsed.count() > 0.0 ) ? ( static_cast< double >( processedBytesV ) / elapsed.count() ) : 0.0 };
+
+  std::optional< std::chrono::seconds > remainingTime{};
+  if ( ( 0U != totalBytesV ) && ( totalBytesV >= processedBytesV ) && ( throughput > 0.0 ) )
+  {
+    remainingTime = std::chrono::seconds{ static_cast< std::chrono::seconds::rep >(
+      static_cast< double >( totalBytesV - processedBytesV ) / throughput ) };
+  }
+
+  progressHandlerV( ByteProgress{
+    .processedBytes = processedBytesV,
+    .totalBytes = totalBytesV,
+    .currentFile = currentFileV,
+    .throughput = throughput,
+    .remainingTime = remainingTime } );
+}
+
+}
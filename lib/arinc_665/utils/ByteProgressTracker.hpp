@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::ByteProgressTracker.
+ **/
+
+#ifndef ARINC_665_UTILS_BYTEPROGRESSTRACKER_HPP
+#define ARINC_665_UTILS_BYTEPROGRESSTRACKER_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <stop_token>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Byte Progress Tracker.
+ *
+ * Accumulates processed bytes of a long-running operation, calculates throughput and estimated remaining time, and
+ * reports them rate limited to a @ref ByteProgressHandler.
+ * Additionally, the stop token is checked on each update to support cooperative cancellation.
+ *
+ * Digest and copy loops process the data in chunks of @ref ChunkSize bytes and update the tracker after each chunk,
+ * so cancellation is detected within milliseconds even for large files.
+ **/
+class ARINC_665_EXPORT ByteProgressTracker
+{
+  public:
+    //! Chunk Size used by Digest and Copy Loops
+    static constexpr std::size_t ChunkSize{ 1024U * 1024U };
+
+    //! Minimum Interval between two Progress Reports
+    static constexpr std::chrono::milliseconds ReportInterval{ 100 };
+
+    /**
+     * @brief Initialises the Byte Progress Tracker.
+     *
+     * @param[in] progressHandler
+     *   Progress Handler. Can be empty.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     **/
+    explicit ByteProgressTracker( ByteProgressHandler progressHandler = {}, std::stop_token stopToken = {} );
+
+    /**
+     * @brief Returns if a Progress Handler is set.
+     *
+     * Used to skip the calculation of the total number of bytes if nobody is interested.
+     *
+     * @return If a Progress Handler is set.
+     **/
+    [[nodiscard]] bool reporting() const noexcept;
+
+    /**
+     * @brief Sets the Total Number of Bytes.
+     *
+     * @param[in] totalBytes
+     *   Total Number of Bytes to process.
+     **/
+    void totalBytes( std::uint64_t totalBytes ) noexcept;
+
+    /**
+     * @brief Increases the Total Number of Bytes.
+     *
+     * Used, when additional work is discovered during operation.
+     *
+     * @param[in] bytes
+     *   Additional Bytes to process.
+     **/
+    void addTotalBytes( std::uint64_t bytes ) noexcept;
+
+    /**
+     * @brief Sets the currently processed File.
+     *
+     * @param[in] currentFile
+     *   Currently processed File.
+     **/
+    void currentFile( std::filesystem::path currentFile );
+
+    /**
+     * @brief Adds processed bytes.
+     *
+     * Checks for cancellation and reports the progress if the report interval has elapsed.
+     *
+     * @param[in] bytes
+     *   Processed Bytes.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
+     **/
+    void advance( std::uint64_t bytes );
+
+    /**
+     * @brief Checks for Cancellation.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
+     **/
+    void checkCancelled() const;
+
+    /**
+     * @brief Reports the final progress unconditionally.
+     **/
+    void finish();
+
+    /**
+     * @brief Processes the given data in chunks.
+     *
+     * Calls @p processor for each chunk of @ref ChunkSize bytes and advances the progress afterward.
+     *
+     * @tparam ChunkProcessor
+     *   Callable with signature `void( Helper::ConstRawDataSpan chunk )`.
+     *
+     * @param[in] data
+     *   Data to process.
+     * @param[in] processor
+     *   Chunk Processor.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
+     **/
+    template< typename ChunkProcessor >
+    void process( Helper::ConstRawDataSpan data, ChunkProcessor &&processor );
+
+  private:
+    //! Calls the Progress Handler.
+    void report();
+
+    //! Progress Handler
+    ByteProgressHandler progressHandlerV;
+    //! Stop Token
+    std::stop_token stopTokenV;
+    //! Processed Bytes
+    std::uint64_t processedBytesV{ 0U };
+    //! Total Bytes
+    std::uint64_t totalBytesV{ 0U };
+    //! Current File
+    std::filesystem::path currentFileV;
+    //! Start Time
+    std::chrono::steady_clock::time_point startV;
+    //! Time of last Progress Report
+    std::chrono::steady_clock::time_point lastReportV;
+};
+
+template< typename ChunkProcessor >
+void ByteProgressTracker::process( Helper::ConstRawDataSpan data, ChunkProcessor &&processor )
+{
+  checkCancelled();
+
+  while ( !data.empty() )
+  {
+    const auto chunk{ data.first( std::min( data.size(), ChunkSize ) ) };
+    processor( chunk );
+    advance( chunk.size() );
+    data = data.subspan( chunk.size() );
+  }
+}
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::FilePlacementStrategyDescription.
+ **/
+
+#include <arinc_665/utils/FilePlacementStrategyDescription.hpp>
+
+#include <boost/exception/exception.hpp>
+#include <boost/program_options.hpp>
+
+namespace Arinc665::Utils {
+
+FilePlacementStrategyDescription::FilePlacementStrategyDescription():
+  Description{
+    { "Copy",       FilePlacementStrategy::Copy },
+    { "KernelCopy", FilePlacementStrategy::KernelCopy },
+    { "Reflink",    FilePlacementStrategy::Reflink },
+    { "Hardlink",   FilePlacementStrategy::Hardlink }
+  }
+{
+}
+
+std::ostream& operator<<( std::ostream &stream, const FilePlacementStrategy filePlacementStrategy )
+{
+  return ( stream << FilePlacementStrategyDescription::instance().name( filePlacementStrategy ) );
+}
+
+std::istream& operator>>( std::istream &stream, FilePlacementStrategy &filePlacementStrategy )
+{
+  std::string str;
+
+  // extract string from stream
+  stream >> str;
+
+  // Decode
+  const auto optionalFilePlacementStrategy{ FilePlacementStrategyDescription::instance().enumeration( str ) };
+
+  if ( !optionalFilePlacementStrategy )
+  {
+    BOOST_THROW_EXCEPTION( boost::program_options::invalid_option_value( str ) );
+  }
+
+  filePlacementStrategy = *optionalFilePlacementStrategy;
+  return stream;
+}
+
+}
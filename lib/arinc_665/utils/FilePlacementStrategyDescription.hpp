@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::FilePlacementStrategyDescription.
+ **/
+
+#ifndef ARINC_665_UTILS_FILEPLACEMENTSTRATEGYDESCRIPTION_HPP
+#define ARINC_665_UTILS_FILEPLACEMENTSTRATEGYDESCRIPTION_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <helper/Description.hpp>
+
+#include <iosfwd>
+
+namespace Arinc665::Utils {
+
+/**
+ * @name File Placement Strategy Description
+ *
+ * @sa @ref Arinc665::Utils::FilePlacementStrategy
+ * @sa @ref Arinc665::Utils::FilePlacementStrategyDescription
+ *
+ * @{
+ **/
+
+//! %File Placement Strategy Description
+class ARINC_665_EXPORT FilePlacementStrategyDescription final :
+  public Helper::Description< FilePlacementStrategyDescription, FilePlacementStrategy >
+{
+  public:
+    //! Constructs and adds the entries
+    FilePlacementStrategyDescription();
+};
+
+/**
+ * @brief File Placement Strategy @p std::ostream output operator.
+ *
+ * @param[in,out] stream
+ *   Output Stream
+ * @param[in] filePlacementStrategy
+ *   File Placement Strategy.
+ *
+ * @return Output Stream for chaining.
+ **/
+ARINC_665_EXPORT std::ostream& operator<<( std::ostream &stream, FilePlacementStrategy filePlacementStrategy );
+
+/**
+ * @brief File Placement Strategy @p std::istream input operator.
+ *
+ * @param[in,out] stream
+ *   Input stream
+ * @param[out] filePlacementStrategy
+ *   Decoded file placement strategy
+ *
+ * @return Input Stream for chaining.
+ *
+ * @throw boost::program_options
+ *   When @p stream cannot be decoded to FilePlacementStrategy.
+ **/
+ARINC_665_EXPORT std::istream& operator>>( std::istream &stream, FilePlacementStrategy &filePlacementStrategy );
+
+/** @} **/
+
+}
+
+#endif
@@ -15,6 +15,8 @@
 
 #include <arinc_665/utils/Utils.hpp>
 
+#include <stop_token>
+
 namespace Arinc665::Utils {
 
 /**
@@ -134,6 +136,60 @@ class ARINC_665_EXPORT FilesystemMediaSetCompiler
      **/
     virtual FilesystemMediaSetCompiler& mediaSetName( std::string mediaSetName ) = 0;
 
+    /**
+     * @brief Sets the Statistics Instance.
+     *
+     * @param[in] statistics
+     *   Statistics Instance. Can be empty to disable recording.
+     *
+     * @return *this for chaining.
+     *
+     * @sa MediaSetCompiler::statistics()
+     **/
+    virtual FilesystemMediaSetCompiler& statistics( MediaSetStatisticsPtr statistics ) = 0;
+
+    /**
+     * @brief Sets the Byte Progress Handler.
+     *
+     * The total number of bytes is determined from the sizes of the source files.
+     *
+     * @param[in] progressHandler
+     *   Byte Progress Handler.
+     *
+     * @return *this for chaining.
+     *
+     * @sa MediaSetCompiler::progressHandler()
+     **/
+    virtual FilesystemMediaSetCompiler& progressHandler( ByteProgressHandler progressHandler ) = 0;
+
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * On cancellation, the partially created media set directory is removed.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     *
+     * @return *this for chaining.
+     *
+     * @sa MediaSetCompiler::stopToken()
+     **/
+    virtual FilesystemMediaSetCompiler& stopToken( std::stop_token stopToken ) = 0;
+
+    /**
+     * @brief Sets the File Placement Strategy used to populate the media with the source files.
+     *
+     * Defaults to FilePlacementStrategy::Reflink, which falls back to an in-kernel copy, when the filesystem does not
+     * support reflinks.
+     * FilePlacementStrategy::Hardlink makes the source files read-only.
+     *
+     * @param[in] filePlacementStrategy
+     *   File Placement Strategy.
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCompiler& filePlacementStrategy( FilePlacementStrategy filePlacementStrategy ) = 0;
+
     /** @} **/
 
     /**
@@ -141,12 +197,26 @@ class ARINC_665_EXPORT FilesystemMediaSetCompiler
      *
      * All parameters must have been set previously.
      *
+     * On failure (including cancellation), the files and directories created by this call are removed.
+     * Already existing files and directories are kept.
+     *
      * @return Media Set Paths relative to Output Directory Base Path.
      *
+     * @throw OperationCancelled
+     *   When compilation has been cancelled.
      * @throw Arinc665Exception
      *   When compilation fails
      **/
     [[nodiscard]] virtual MediaSetPaths operator()() = 0;
+
+    /**
+     * @brief Returns the Check Values calculated during the last Compilation.
+     *
+     * @return Check Values calculated during the last compilation.
+     *
+     * @sa MediaSetCompiler::checkValues()
+     **/
+    [[nodiscard]] virtual const Media::CheckValues& checkValues() const = 0;
 };
 
 }
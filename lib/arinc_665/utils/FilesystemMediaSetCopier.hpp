@@ -15,13 +15,23 @@
 
 #include <arinc_665/utils/Utils.hpp>
 
+#include <cstddef>
+#include <stop_token>
+
 namespace Arinc665::Utils {
 
 /**
  * @brief ARINC 665 %Media Set Copier.
  *
  * Copies a media set from a filesystem source to a filesystem destination.
- * No integrity checks of the media set are performed.
+ * Optionally, the integrity of the copied files is checked while copying (see checkFileIntegrity()).
+ *
+ * All media are copied concurrently, so media located on different devices are read at once.
+ * The files of each medium are copied by a configurable number of threads (see threadsPerMedium()), starting with
+ * the largest file to balance the work.
+ * A medium copied by a single thread is read in the order of the physical placement of its files instead, which avoids
+ * seeks on rotational and other slow media.
+ * Each thread moves at most one buffer at a time, which bounds the memory in flight.
  **/
 class ARINC_665_EXPORT FilesystemMediaSetCopier
 {
@@ -74,6 +84,91 @@ class ARINC_665_EXPORT FilesystemMediaSetCopier
      **/
     virtual FilesystemMediaSetCopier& mediaSetName( std::string mediaSetName ) = 0;
 
+    /**
+     * @brief Sets the File Placement Strategy used to populate the destination media.
+     *
+     * Defaults to FilePlacementStrategy::Reflink.
+     * FilePlacementStrategy::Hardlink makes the files of the source media read-only.
+     *
+     * @param[in] filePlacementStrategy
+     *   File Placement Strategy.
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCopier& filePlacementStrategy( FilePlacementStrategy filePlacementStrategy ) = 0;
+
+    /**
+     * @brief Sets if the integrity of the copied files is checked.
+     *
+     * The CRC and Check Value of each file listed within the list of files (FILES.LUM) of a medium are calculated on
+     * the buffers, which are copied, and compared to the list of files.
+     * So the copied media set is verified without reading it again.
+     * Listed files, which are missing on the medium, are reported as error.
+     *
+     * Defaults to false.
+     *
+     * @param[in] checkFileIntegrity
+     *   If set to true, the integrity of the copied files is checked.
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCopier& checkFileIntegrity( bool checkFileIntegrity ) = 0;
+
+    /**
+     * @brief Sets the Payload Store used to deduplicate the copied Files.
+     *
+     * The files listed within the list of files are placed as hardlinks to the objects of a content-addressed store
+     * (keyed by SHA-256 digest and file CRC).
+     * Files with a SHA-256 check value within the list of files, which are already stored, are linked without
+     * copying or reading them.
+     * All other files are copied and added to the store, using the digests calculated while copying.
+     *
+     * The store must be located on the same volume as the output base path.
+     *
+     * @param[in] payloadStore
+     *   Payload Store Directory. If empty, no payload store is used (default).
+     *
+     * @return *this for chaining.
+     *
+     * @sa FilesystemMediaSetRemover::payloadStore()
+     **/
+    virtual FilesystemMediaSetCopier& payloadStore( std::filesystem::path payloadStore ) = 0;
+
+    /**
+     * @brief Sets the Number of Threads copying the Files of each Medium.
+     *
+     * Defaults to 1 (one thread per medium).
+     *
+     * @param[in] threadsPerMedium
+     *   Number of files copied concurrently from each medium (values smaller than 1 are treated as 1).
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCopier& threadsPerMedium( std::size_t threadsPerMedium ) = 0;
+
+    /**
+     * @brief Sets the Byte Progress Handler.
+     *
+     * The total number of bytes is determined from the sizes of the source files.
+     * The handler is called from the copy threads, but never concurrently.
+     *
+     * @param[in] progressHandler
+     *   Byte Progress Handler.
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCopier& progressHandler( ByteProgressHandler progressHandler ) = 0;
+
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     *
+     * @return *this for chaining.
+     **/
+    virtual FilesystemMediaSetCopier& stopToken( std::stop_token stopToken ) = 0;
+
     /** @} **/
 
     /**
@@ -83,8 +178,12 @@ class ARINC_665_EXPORT FilesystemMediaSetCopier
      *
      * @return Media Set Paths relative to Output Directory Base Path.
      *
+     * On failure or cancellation, the partially copied media set directory is removed.
+     *
      * @throw Arinc665Exception
-     *   When the copy operation fails
+     *   When the copy operation or the file integrity check fails
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
      **/
     [[nodiscard]] virtual MediaSetPaths operator()() = 0;
 };
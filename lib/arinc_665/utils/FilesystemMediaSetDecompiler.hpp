@@ -17,6 +17,8 @@
 
 #include <arinc_665/utils/MediaSetDecompiler.hpp>
 
+#include <stop_token>
+
 namespace Arinc665::Utils {
 
 /**
@@ -65,6 +67,34 @@ class ARINC_665_EXPORT FilesystemMediaSetDecompiler
      **/
     virtual FilesystemMediaSetDecompiler& checkFileIntegrity( bool checkFileIntegrity ) noexcept = 0;
 
+    /**
+     * @brief Sets the Check Listed Files Flag.
+     *
+     * @param[in] checkListedFiles
+     *   If set to true, the checksum and check value of the listed files are verified.
+     *
+     * @return @p *this for chaining.
+     *
+     * @sa MediaSetDecompiler::checkListedFiles()
+     **/
+    virtual FilesystemMediaSetDecompiler& checkListedFiles( bool checkListedFiles ) noexcept = 0;
+
+    /**
+     * @brief Sets the Lazy Flag.
+     *
+     * The media set reads the load header files and batch files from the media paths on first access to the content
+     * of the load or batch, so the media paths must stay accessible as long as the media set is used.
+     * The decompiler itself can be destroyed.
+     *
+     * @param[in] lazy
+     *   If set to true, load header files and batch files are decoded on first access.
+     *
+     * @return @p *this for chaining.
+     *
+     * @sa MediaSetDecompiler::lazy()
+     **/
+    virtual FilesystemMediaSetDecompiler& lazy( bool lazy ) noexcept = 0;
+
     /**
      * @brief Sets the Media Paths
      *
@@ -75,6 +105,42 @@ class ARINC_665_EXPORT FilesystemMediaSetDecompiler
      **/
     virtual FilesystemMediaSetDecompiler& mediaPaths( MediaPaths mediaPaths ) = 0;
 
+    /**
+     * @brief Sets the Statistics Instance.
+     *
+     * @param[in] statistics
+     *   Statistics Instance. Can be empty to disable recording.
+     *
+     * @return @p *this for chaining.
+     *
+     * @sa MediaSetDecompiler::statistics()
+     **/
+    virtual FilesystemMediaSetDecompiler& statistics( MediaSetStatisticsPtr statistics ) = 0;
+
+    /**
+     * @brief Sets the Byte Progress Handler.
+     *
+     * @param[in] byteProgressHandler
+     *   Byte Progress Handler.
+     *
+     * @return @p *this for chaining.
+     *
+     * @sa MediaSetDecompiler::byteProgressHandler()
+     **/
+    virtual FilesystemMediaSetDecompiler& byteProgressHandler( ByteProgressHandler byteProgressHandler ) = 0;
+
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     *
+     * @return @p *this for chaining.
+     *
+     * @sa MediaSetDecompiler::stopToken()
+     **/
+    virtual FilesystemMediaSetDecompiler& stopToken( std::stop_token stopToken ) = 0;
+
     /** @} **/
 
     /**
@@ -84,6 +150,8 @@ class ARINC_665_EXPORT FilesystemMediaSetDecompiler
      *
      * @return Decompiled %Media Set
      *
+     * @throw OperationCancelled
+     *   When decompilation has been cancelled.
      * @throw Arinc665Exception
      *   When the media set cannot be decompiled.
      **/
@@ -50,6 +50,21 @@ class ARINC_665_EXPORT FilesystemMediaSetRemover
      **/
     virtual FilesystemMediaSetRemover& mediaSetPaths( MediaSetPaths mediaSetPaths ) = 0;
 
+    /**
+     * @brief Sets the Payload Store.
+     *
+     * After removing the media set, the objects of the payload store, which are no longer referenced by any media
+     * set, are removed.
+     *
+     * @param[in] payloadStore
+     *   Payload Store Directory. If empty or not existing, no payload store is cleaned up (default).
+     *
+     * @return *this for chaining.
+     *
+     * @sa FilesystemMediaSetCopier::payloadStore()
+     **/
+    virtual FilesystemMediaSetRemover& payloadStore( std::filesystem::path payloadStore ) = 0;
+
     /** @} **/
 
     /**
@@ -21,8 +21,10 @@
 
 #include <helper/RawData.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <stop_token>
 
 namespace Arinc665::Utils {
 
@@ -66,15 +68,29 @@ class ARINC_665_EXPORT MediaSetCompiler
      **/
     using CheckFileExistenceHandler = std::function< bool( const Media::ConstFilePtr &file ) >;
 
+    /**
+     * @brief Handler, which is called with the content of a created file in chunks.
+     *
+     * @param[in] chunk
+     *   Next chunk of the file content.
+     **/
+    using FileContentHandler = std::function< void( Helper::ConstRawDataSpan chunk ) >;
+
     /**
      * @brief Handler, which is called to generate the given File from Source.
      *
      * How the file is generated is not known to the exporter itself.
+     * The handler must pass the complete content of the generated file in order to @p contentHandler.
+     * The compiler uses it to calculate the CRC and check values of the file while it is generated, so the file is not
+     * read again for the list of files and load headers.
      *
      * @param[in] file
      *   File to be created.
+     * @param[in] contentHandler
+     *   Handler to be called with the file content.
      **/
-    using CreateFileHandler = std::function< void( const Media::ConstFilePtr &file ) >;
+    using CreateFileHandler =
+      std::function< void( const Media::ConstFilePtr &file, const FileContentHandler &contentHandler ) >;
 
     /**
      * @brief Handler, which is called to write the given File on the Target.
@@ -101,6 +117,9 @@ class ARINC_665_EXPORT MediaSetCompiler
      * Therefore, a basic representation is used.
      * This operation is used for checksum and check value calculation.
      *
+     * The handler is called from a read-ahead thread, while the previous file is processed.
+     * It is never called concurrently to itself, but concurrently to the other handlers.
+     *
      * @param[in] mediumNumber
      *   Medium Number
      * @param[in] path
@@ -111,6 +130,19 @@ class ARINC_665_EXPORT MediaSetCompiler
     using ReadFileHandler =
       std::function< Helper::RawData( const MediumNumber &mediumNumber, const std::filesystem::path &path ) >;
 
+    /**
+     * @brief Handler, which returns the Size of the given File within the Source.
+     *
+     * This handler is optional and only used to calculate the total number of bytes for progress reporting.
+     * For files, which are generated by the compiler (Load Headers, Batch Files), 0 can be returned.
+     *
+     * @param[in] file
+     *   File
+     *
+     * @return Size of the source file in bytes.
+     **/
+    using FileSizeHandler = std::function< std::uint64_t( const Media::ConstFilePtr &file ) >;
+
     /**
      * @brief Creates the ARINC 665 %Media Set Compiler Instance.
      *
@@ -227,6 +259,54 @@ class ARINC_665_EXPORT MediaSetCompiler
      **/
     virtual MediaSetCompiler& createLoadHeaderFiles( FileCreationPolicy createLoadHeaderFiles ) = 0;
 
+    /**
+     * @brief Sets the Statistics Instance.
+     *
+     * If set, the compiler records per-phase timing and file I/O metrics within the given instance.
+     *
+     * @param[in] statistics
+     *   Statistics Instance. Can be empty to disable recording.
+     *
+     * @return *this for chaining.
+     **/
+    virtual MediaSetCompiler& statistics( MediaSetStatisticsPtr statistics ) = 0;
+
+    /**
+     * @brief Sets the File Size Handler.
+     *
+     * @param[in] fileSizeHandler
+     *   Returns the size of source files. Used for progress reporting only.
+     *
+     * @return *this for chaining.
+     **/
+    virtual MediaSetCompiler& fileSizeHandler( FileSizeHandler fileSizeHandler ) = 0;
+
+    /**
+     * @brief Sets the Byte Progress Handler.
+     *
+     * The handler is called rate-limited with the number of processed (created and hashed) bytes, the total number of
+     * bytes (if a @ref fileSizeHandler() is set), the current file, the throughput, and the estimated remaining time.
+     *
+     * @param[in] progressHandler
+     *   Byte Progress Handler.
+     *
+     * @return *this for chaining.
+     **/
+    virtual MediaSetCompiler& progressHandler( ByteProgressHandler progressHandler ) = 0;
+
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * The token is checked between chunks of all digest loops and before each file creation.
+     * On cancellation, @ref operator()() throws @ref OperationCancelled.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     *
+     * @return *this for chaining.
+     **/
+    virtual MediaSetCompiler& stopToken( std::stop_token stopToken ) = 0;
+
     /** @} **/
 
     /**
@@ -234,10 +314,23 @@ class ARINC_665_EXPORT MediaSetCompiler
      *
      * All parameters must have been set previously.
      *
+     * @throw OperationCancelled
+     *   When compilation has been cancelled.
      * @throw Arinc665Exception
      *   When compilation fails
      **/
     virtual void operator()() = 0;
+
+    /**
+     * @brief Returns the Check Values calculated during the last Compilation.
+     *
+     * Contains the CRC 16 and the ARINC 645 check value of each file listed within the list of files, as well as the
+     * check values of the load files, which are stored within the load header files.
+     * These check values can be used to register the compiled media set without re-reading all files.
+     *
+     * @return Check Values calculated during the last compilation.
+     **/
+    [[nodiscard]] virtual const Media::CheckValues& checkValues() const = 0;
 };
 
 }
@@ -23,8 +23,12 @@
 
 #include <helper/RawData.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <span>
+#include <stop_token>
+#include <vector>
 
 namespace Arinc665::Utils {
 
@@ -38,6 +42,16 @@ namespace Arinc665::Utils {
  * the load checksum and load check values of all loads are verified.
  * The file checksum of ARINC 665 files (list of files, list of loads, list of batches, load headers, and batch files)
  * are always verified.
+ * When the member files are verified by other means (e.g. FilesystemMediaSetCopier::checkFileIntegrity()), the
+ * checks of the files listed within the list of files can be skipped (see checkListedFiles()), while the load
+ * checksum and load check values are still verified.
+ *
+ * @par Lazy Decompilation
+ * When the *lazy* flag is set to `true` only the list files (list of files, list of loads and list of batches) are
+ * read to create the media set.
+ * The load header files and batch files are read and decoded on the first access to the content of the load or batch
+ * (see Media::File::contentLoader()).
+ * This is intended for users, which only need the media set structure (e.g. for a summary listing).
  **/
 class ARINC_665_EXPORT MediaSetDecompiler
 {
@@ -65,6 +79,9 @@ class ARINC_665_EXPORT MediaSetDecompiler
      *
      * This handler is also used to read files, which are not represented by Arinc665::Media classes.
      *
+     * The handler is called from a read-ahead thread, while the previous file is processed.
+     * It is never called concurrently to itself, but concurrently to the other handlers.
+     *
      * This Handler shall throw when the file does not exist.
      *
      * @param[in] mediumNumber
@@ -77,6 +94,46 @@ class ARINC_665_EXPORT MediaSetDecompiler
     using ReadFileHandler =
       std::function< Helper::RawData( const MediumNumber &mediumNumber, const std::filesystem::path &path ) >;
 
+    /**
+     * @brief Handler, which is called to read several files from a medium at once.
+     *
+     * Used to read the files for the file integrity check, so the handler can issue the reads concurrently.
+     * This handler is optional - if not set, the @ref ReadFileHandler is called for each file.
+     * The handler is called from a read-ahead thread, while the previous batch is digested.
+     *
+     * This Handler shall throw when a file does not exist.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] paths
+     *   Relative Paths on Medium.
+     *
+     * @return File Data (Read as binary) in the order of @p paths.
+     **/
+    using ReadFilesHandler = std::function< std::vector< Helper::RawData >(
+      const MediumNumber &mediumNumber,
+      std::span< const std::filesystem::path > paths ) >;
+
+    /**
+     * @brief Handler, which is called to obtain the physical location of a file on a medium.
+     *
+     * Used to read the files for the file integrity check in the order of their placement on the medium, which avoids
+     * seeks on rotational and other slow media.
+     * This handler is optional - if not set, the files are read in the order of the list of files.
+     * The locations are only compared for files of the same medium.
+     *
+     * This Handler shall not throw - errors are reported, when the file is read.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Relative Path on Medium.
+     *
+     * @return Physical location of the file (sort key), or 0 if unknown.
+     **/
+    using FileLocationHandler =
+      std::function< std::uint64_t( const MediumNumber &mediumNumber, const std::filesystem::path &path ) >;
+
     /**
      * @brief Callback for progress indication.
      *
@@ -123,6 +180,26 @@ class ARINC_665_EXPORT MediaSetDecompiler
      **/
     virtual MediaSetDecompiler& readFileHandler( ReadFileHandler readFileHandler ) = 0;
 
+    /**
+     * @brief Sets the optional Read Files Handler.
+     *
+     * @param[in] readFilesHandler
+     *   Handler which is called to get several files from the medium at once.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& readFilesHandler( ReadFilesHandler readFilesHandler ) = 0;
+
+    /**
+     * @brief Sets the optional File Location Handler.
+     *
+     * @param[in] fileLocationHandler
+     *   Handler which is called to get the physical location of files on the medium.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& fileLocationHandler( FileLocationHandler fileLocationHandler ) = 0;
+
     /**
      * @brief Sets the Progress Handler.
      *
@@ -133,6 +210,32 @@ class ARINC_665_EXPORT MediaSetDecompiler
      **/
     virtual MediaSetDecompiler& progressHandler( ProgressHandler progressHandler ) = 0;
 
+    /**
+     * @brief Sets the Byte Progress Handler.
+     *
+     * The handler is called rate-limited with the number of hashed bytes during file integrity checks.
+     * The total number of bytes is extended medium by medium and load by load, as the media set is discovered.
+     *
+     * @param[in] byteProgressHandler
+     *   Byte Progress Handler.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& byteProgressHandler( ByteProgressHandler byteProgressHandler ) = 0;
+
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * The token is checked between chunks of all digest loops.
+     * On cancellation, @ref operator()() throws @ref OperationCancelled.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& stopToken( std::stop_token stopToken ) = 0;
+
     /**
      * @brief Sets the Check File Integrity Flag.
      *
@@ -143,6 +246,53 @@ class ARINC_665_EXPORT MediaSetDecompiler
      **/
     virtual MediaSetDecompiler& checkFileIntegrity( bool checkFileIntegrity ) noexcept = 0;
 
+    /**
+     * @brief Sets the Check Listed Files Flag.
+     *
+     * Only evaluated, when the *check file integrity* flag is set.
+     * If cleared, the checksum and check value of the files listed within the list of files are not verified.
+     * The load checksum and load check value of the loads are still verified.
+     *
+     * Defaults to true.
+     *
+     * @param[in] checkListedFiles
+     *   If set to true, the checksum and check value of the listed files are verified.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& checkListedFiles( bool checkListedFiles ) noexcept = 0;
+
+    /**
+     * @brief Sets the Lazy Flag.
+     *
+     * In lazy mode:
+     * - The *check file integrity* flag is ignored - no file integrity checks are performed.
+     * - The read file handler is kept by the loads and batches of the media set and called on first access to their
+     *   content, so it must stay valid as long as the media set is used.
+     *   It might be called from any thread accessing the media set, but never concurrently to itself.
+     * - The returned check values contain only the values of the list of files.
+     * - Errors within load header files and batch files are thrown on first access to the content of the load or
+     *   batch.
+     *
+     * @param[in] lazy
+     *   If set to true, load header files and batch files are decoded on first access.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& lazy( bool lazy ) noexcept = 0;
+
+    /**
+     * @brief Sets the Statistics Instance.
+     *
+     * If set, the decompiler records per-phase timing and file I/O metrics within the given instance.
+     *
+     * @param[in] statistics
+     *   Statistics Instance. Can be empty to disable recording.
+     *
+     * @return @p *this for chaining.
+     **/
+    virtual MediaSetDecompiler& statistics( MediaSetStatisticsPtr statistics ) = 0;
+
     /** @} **/
 
     /**
@@ -152,6 +302,8 @@ class ARINC_665_EXPORT MediaSetDecompiler
      *
      * @return Decompiled %Media Set
      *
+     * @throw OperationCancelled
+     *   When decompilation has been cancelled.
      * @throw Arinc665Exception
      *   When the media set cannot be decompiled.
      **/
@@ -26,6 +26,8 @@ constexpr SupportedArinc665Version MediaSetDefaults::DefaultVersion;
 
 constexpr FileCreationPolicy MediaSetDefaults::DefaultFileCreationPolicy;
 
+constexpr bool MediaSetDefaults::DefaultPayloadStore;
+
 MediaSetDefaults::MediaSetDefaults( const boost::property_tree::ptree &properties )
 {
   fromProperties( properties );
@@ -39,6 +41,8 @@ void MediaSetDefaults::fromProperties( const boost::property_tree::ptree &proper
 
   loadHeaderFileCreationPolicy = properties.get( "load_header_file_creation_policy", DefaultFileCreationPolicy );
   batchFileCreationPolicy = properties.get( "batch_file_creation_policy", DefaultFileCreationPolicy );
+
+  payloadStore = properties.get( "payload_store", DefaultPayloadStore );
 }
 
 boost::property_tree::ptree MediaSetDefaults::toProperties( const bool full ) const
@@ -65,6 +69,11 @@ boost::property_tree::ptree MediaSetDefaults::toProperties( const bool full ) co
     properties.add( "batch_file_creation_policy", batchFileCreationPolicy );
   }
 
+  if ( full || ( payloadStore != DefaultPayloadStore ) )
+  {
+    properties.add( "payload_store", payloadStore );
+  }
+
   return properties;
 }
 
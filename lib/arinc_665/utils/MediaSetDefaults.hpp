@@ -34,6 +34,8 @@ class ARINC_665_EXPORT MediaSetDefaults
     static constexpr SupportedArinc665Version DefaultVersion{ SupportedArinc665Version::Supplement345 };
     //! Default Value for File Creation Policy
     static constexpr FileCreationPolicy DefaultFileCreationPolicy{ FileCreationPolicy::NoneExisting };
+    //! Default Value for Payload Store
+    static constexpr bool DefaultPayloadStore{ false };
 
     //! Initialises the configuration with default values.
     MediaSetDefaults() = default;
@@ -72,6 +74,8 @@ class ARINC_665_EXPORT MediaSetDefaults
     FileCreationPolicy loadHeaderFileCreationPolicy{ DefaultFileCreationPolicy };
     //! Default Load Header File Create File Policy
     FileCreationPolicy batchFileCreationPolicy{ DefaultFileCreationPolicy };
+    //! Deduplicate imported Files within the Payload Store of the Media Set Manager
+    bool payloadStore{ DefaultPayloadStore };
 };
 
 }
@@ -44,13 +44,22 @@ MediaSetManagerPtr MediaSetManager::create( std::filesystem::path directory )
 
   boost::property_tree::write_json( ( directory / ConfigurationFilename ).string(), configurationPTree );
 
-  return std::make_shared< MediaSetManagerImpl >( std::move( directory ), false, LoadProgressHandler{} );
+  return std::make_shared< MediaSetManagerImpl >(
+    std::move( directory ),
+    false,
+    LoadProgressHandler{},
+    MediaSetLoadedHandler{},
+    std::stop_token{},
+    false );
 }
 
 MediaSetManagerPtr MediaSetManager::load(
   std::filesystem::path directory,
   const bool checkFileIntegrity,
-  LoadProgressHandler loadProgressHandler )
+  LoadProgressHandler loadProgressHandler,
+  MediaSetLoadedHandler mediaSetLoadedHandler,
+  std::stop_token stopToken,
+  const bool lazy )
 {
   if ( !std::filesystem::exists( directory ) )
   {
@@ -62,13 +71,19 @@ MediaSetManagerPtr MediaSetManager::load(
   return std::make_shared< MediaSetManagerImpl >(
     std::move( directory ),
     checkFileIntegrity,
-    std::move( loadProgressHandler ) );
+    std::move( loadProgressHandler ),
+    std::move( mediaSetLoadedHandler ),
+    std::move( stopToken ),
+    lazy );
 }
 
 MediaSetManagerPtr MediaSetManager::loadOrCreate(
   std::filesystem::path directory,
   const bool checkFileIntegrity,
-  LoadProgressHandler loadProgressHandler )
+  LoadProgressHandler loadProgressHandler,
+  MediaSetLoadedHandler mediaSetLoadedHandler,
+  std::stop_token stopToken,
+  const bool lazy )
 {
   if (
     !std::filesystem::exists( directory )
@@ -80,7 +95,10 @@ MediaSetManagerPtr MediaSetManager::loadOrCreate(
   return std::make_shared< MediaSetManagerImpl >(
     std::move( directory ),
     checkFileIntegrity,
-    std::move( loadProgressHandler ) );
+    std::move( loadProgressHandler ),
+    std::move( mediaSetLoadedHandler ),
+    std::move( stopToken ),
+    lazy );
 }
 
 }
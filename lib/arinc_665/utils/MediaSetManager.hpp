@@ -20,13 +20,17 @@
 
 #include <arinc_645/CheckValue.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <optional>
+#include <stop_token>
 #include <string>
 #include <string_view>
+#include <tuple>
 
 namespace Arinc665::Utils {
 
@@ -40,6 +44,15 @@ namespace Arinc665::Utils {
  * - Media sets are stored beneath the media set directory.
  * - Within this directory the media sets each are stored within a directory named @p mediaSetName.
  * - Within the media set directory the media are stored with the corresponding medium-path mapping.
+ *
+ * @par Concurrency
+ * The registered media sets are held as an immutable snapshot, which is replaced as a whole by each modification
+ * (copy-on-write).
+ * So the queries of the registered media sets (e.g. hasMediaSet(), mediaSet(), loads(), filePath(),
+ * mediaSetsSnapshot()) can be executed by any number of threads concurrently to a registration or de-registration.
+ * Each query sees either the state before or after a modification.
+ * Modifications are serialised among each other.
+ * The media set defaults and the configuration persistence are not covered.
  **/
 class ARINC_665_EXPORT MediaSetManager
 {
@@ -48,6 +61,41 @@ class ARINC_665_EXPORT MediaSetManager
     using MediaSetInformation = std::pair< Media::ConstMediaSetPtr, Media::CheckValues >;
     //! Media Sets Information (Part Number -> Media Set Information)
     using MediaSetsInformation = std::map< std::string, MediaSetInformation, std::less<> >;
+    //! Immutable Snapshot of the Media Sets Information (see mediaSetsSnapshot())
+    using ConstMediaSetsInformationPtr = std::shared_ptr< const MediaSetsInformation >;
+    //! Compiled Media Set Information (Media Set Paths, Media Set, Check Values)
+    using CompiledMediaSetInformation = std::tuple< MediaSetPaths, Media::ConstMediaSetPtr, Media::CheckValues >;
+    //! Compiled Media Sets Information
+    using CompiledMediaSetsInformation = std::list< CompiledMediaSetInformation >;
+
+    /**
+     * @brief Loads Query.
+     *
+     * All given criteria must be met by a load.
+     * Criteria not set are not checked.
+     *
+     * @sa loads(const LoadsQuery&) const
+     **/
+    struct LoadsQuery
+    {
+      //! Load Part Number
+      std::optional< std::string > partNumber{};
+      //! Load Header Filename
+      std::optional< std::string > headerFilename{};
+      //! Target Hardware ID the load is compatible with
+      std::optional< std::string > targetHardwareId{};
+      /**
+       * @brief Target Hardware Position the load is compatible with.
+       *
+       * Only checked together with targetHardwareId.
+       * Loads without position restriction for the Target Hardware ID are compatible with all positions.
+       **/
+      std::optional< std::string > targetHardwareIdPosition{};
+      //! Load Type ID
+      std::optional< uint16_t > loadTypeId{};
+      //! Part Number of the Media Set containing the load
+      std::optional< std::string > mediaSetPartNumber{};
+    };
 
     /**
      * @brief Load Media Set Manager Progress Handler.
@@ -65,9 +113,29 @@ class ARINC_665_EXPORT MediaSetManager
         std::string_view partNumber,
         std::pair< MediumNumber, MediumNumber > medium ) >;
 
+    /**
+     * @brief Media Set Loaded Handler.
+     *
+     * Called after each media set has been loaded, so users can present media sets before the whole Media Set Manager
+     * is loaded.
+     * The handler is called within the thread executing the load operation.
+     *
+     * @param[in] mediaSet
+     *   Loaded Media Set.
+     **/
+    using MediaSetLoadedHandler = std::function< void( const Media::ConstMediaSetPtr &mediaSet ) >;
+
     //! Media Set Manager Configuration Filename
     static constexpr std::string_view ConfigurationFilename{ "MediaSetManager.json" };
 
+    /**
+     * @brief Payload Store Directory (relative to the Media Set Manager Directory).
+     *
+     * Content-addressed store of the payload files of imported media sets (see MediaSetDefaults::payloadStore).
+     * The files of the media sets are hardlinks to the objects of the store.
+     **/
+    static constexpr std::string_view PayloadStoreDirectory{ ".objects" };
+
     /**
      * @brief Creates an empty Media Set Manager (but don't load it)
      *
@@ -88,13 +156,27 @@ class ARINC_665_EXPORT MediaSetManager
      *   If set to true additional file integrity checks are performed
      * @param[in] loadProgressHandler
      *   Handler for load progress.
+     * @param[in] mediaSetLoadedHandler
+     *   Handler called for each loaded media set.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     * @param[in] lazy
+     *   If set to true, the media sets are decompiled lazily (see MediaSetDecompiler::lazy()).
+     *   The load header files and batch files are read on first access to the loads and batches.
+     *   @p checkFileIntegrity is ignored in this case.
      *
      * @return Media Set Manager Instance.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
      **/
     [[nodiscard]] static MediaSetManagerPtr load(
       std::filesystem::path directory,
       bool checkFileIntegrity = true,
-      LoadProgressHandler loadProgressHandler = {} );
+      LoadProgressHandler loadProgressHandler = {},
+      MediaSetLoadedHandler mediaSetLoadedHandler = {},
+      std::stop_token stopToken = {},
+      bool lazy = false );
 
     /**
      * @brief Checks if a Media Set Manager Configuration is available or creates it.
@@ -105,13 +187,25 @@ class ARINC_665_EXPORT MediaSetManager
      *   If set to true additional file integrity checks are performed
      * @param[in] loadProgressHandler
      *   Handler for load progress.
+     * @param[in] mediaSetLoadedHandler
+     *   Handler called for each loaded media set.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     * @param[in] lazy
+     *   If set to true, the media sets are decompiled lazily (see load()).
      *
      * @return Media Set Manager
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
      **/
     [[nodiscard]] static MediaSetManagerPtr loadOrCreate(
       std::filesystem::path directory,
       bool checkFileIntegrity = true,
-      LoadProgressHandler loadProgressHandler = {} );
+      LoadProgressHandler loadProgressHandler = {},
+      MediaSetLoadedHandler mediaSetLoadedHandler = {},
+      std::stop_token stopToken = {},
+      bool lazy = false );
 
     //! Destructor
     virtual ~MediaSetManager() = default;
@@ -158,6 +252,17 @@ class ARINC_665_EXPORT MediaSetManager
      **/
     virtual void saveConfiguration() = 0;
 
+    /**
+     * @brief Discards the Configuration on Destruction.
+     *
+     * By default, the configuration is persisted, when the Media Set Manager is destroyed.
+     * After this call, the configuration file is left untouched on destruction.
+     * This is used, when the configuration file might have been replaced by another instance (e.g. another tool),
+     * and this instance is released to load the configuration file again.
+     * Own modifications must have been persisted by saveConfiguration() before.
+     **/
+    virtual void discardConfiguration() noexcept = 0;
+
     /**
      * @brief Returns the Media Set Manager Directory
      *
@@ -195,11 +300,27 @@ class ARINC_665_EXPORT MediaSetManager
     [[nodiscard]] virtual std::optional< MediaSetInformation > mediaSet( std::string_view partNumber ) const = 0;
 
     /**
-     * @brief Returns all registered media sets.
+     * @brief Returns an immutable Snapshot of all registered Media Sets.
      *
-     * @return All media sets.
+     * The snapshot is not affected by later modifications and stays valid as long as it is referenced.
+     * Obtaining the snapshot does not wait for running registrations (e.g. the decompilation of an imported media
+     * set).
+     *
+     * @return Snapshot of all media sets.
      **/
-    [[nodiscard]] virtual const MediaSetsInformation& mediaSets() const = 0;
+    [[nodiscard]] virtual ConstMediaSetsInformationPtr mediaSetsSnapshot() const = 0;
+
+    /**
+     * @brief Returns the Media Set Paths of the Media Set with the given Part Number.
+     *
+     * @param[in] partNumber
+     *   Media Set Part Number.
+     *
+     * @return Media Set Paths (relative to the Media Set Manager Directory).
+     * @retval {}
+     *   If no Media Set with partNumber exist.
+     **/
+    [[nodiscard]] virtual std::optional< MediaSetPaths > mediaSetPaths( std::string_view partNumber ) const = 0;
 
     /**
      * @brief Registers the Media Set by the Media Set Manager.
@@ -213,6 +334,55 @@ class ARINC_665_EXPORT MediaSetManager
      **/
     virtual void registerMediaSet( const MediaSetPaths &mediaSetPaths, bool checkFileIntegrity = true ) = 0;
 
+    /**
+     * @brief Registers an already available Media Set by the Media Set Manager.
+     *
+     * Used to register a freshly compiled Media Set without decompiling it again.
+     * The Media Set and the Check Values are taken as provided by the Media Set Compiler
+     * (see FilesystemMediaSetCompiler::checkValues()).
+     *
+     * If @p verify is set, a cheap post-write verification is performed:
+     *  - The list of files of each medium is decoded, which checks its file CRC.
+     *  - Each listed file must exist and its CRC must match the provided check values.
+     *  - The size of each load file must match the length stated within the load header file.
+     *
+     * @param[in] mediaSetPaths
+     *   Media Set Path Configuration
+     * @param[in] mediaSet
+     *   Media Set located at @p mediaSetPaths.
+     * @param[in] checkValues
+     *   Check Values of the Media Set.
+     * @param[in] verify
+     *   If set to true, the written media set is verified against the given information.
+     *
+     * @throw Arinc665Exception
+     *   When the media set already exists or the verification fails.
+     **/
+    virtual void registerMediaSet(
+      const MediaSetPaths &mediaSetPaths,
+      Media::ConstMediaSetPtr mediaSet,
+      Media::CheckValues checkValues,
+      bool verify = true ) = 0;
+
+    /**
+     * @brief Registers several already available Media Sets by the Media Set Manager within one Transaction.
+     *
+     * All media sets are checked (and verified, if requested) before the first one is registered.
+     * So either all or none of the media sets are registered.
+     * The configuration must be saved afterwards only once (see saveConfiguration()).
+     *
+     * @param[in] mediaSets
+     *   Compiled Media Sets.
+     * @param[in] verify
+     *   If set to true, the written media sets are verified against the given information.
+     *
+     * @throw Arinc665Exception
+     *   When a media set already exists, is provided multiple times, or the verification fails.
+     *
+     * @sa registerMediaSet(const MediaSetPaths&,Media::ConstMediaSetPtr,Media::CheckValues,bool)
+     **/
+    virtual void registerMediaSets( CompiledMediaSetsInformation mediaSets, bool verify = true ) = 0;
+
     /**
      * @brief De-registers the Media Set from the Media Set Manager.
      *
@@ -225,6 +395,28 @@ class ARINC_665_EXPORT MediaSetManager
      **/
     virtual MediaSetPaths deregisterMediaSet( std::string_view partNumber ) = 0;
 
+    /**
+     * @brief Replaces the Information of a registered Media Set.
+     *
+     * Used to take over a media set, which has been modified on the disk and decompiled again (see
+     * MediaSetManagerWatcher), without reloading the whole Media Set Manager.
+     * The Media Set Paths are kept.
+     *
+     * @param[in] partNumber
+     *   Part Number of the registered Media Set.
+     * @param[in] mediaSet
+     *   Decompiled Media Set.
+     * @param[in] checkValues
+     *   Check Values of the Media Set.
+     *
+     * @throw Arinc665Exception
+     *   When the media set is not registered or the part number of @p mediaSet differs.
+     **/
+    virtual void updateMediaSet(
+      std::string_view partNumber,
+      Media::ConstMediaSetPtr mediaSet,
+      Media::CheckValues checkValues ) = 0;
+
     /** @} **/
 
     /**
@@ -239,6 +431,68 @@ class ARINC_665_EXPORT MediaSetManager
      **/
     [[nodiscard]] virtual Media::ConstLoads loads() const = 0;
 
+    /**
+     * @brief Returns the Loads matching the Query.
+     *
+     * The loads are looked up within an index of all loads, which is maintained on registration and de-registration
+     * of media sets.
+     * So no media set is traversed.
+     *
+     * @param[in] query
+     *   Loads Query.
+     *
+     * @return Matching loads (in the order of loads()).
+     **/
+    [[nodiscard]] virtual Media::ConstLoads loads( const LoadsQuery &query ) const = 0;
+
+    /**
+     * @brief Returns the Loads with the given Part Number.
+     *
+     * The same load might be contained within several media sets.
+     * The containing media set is provided by the load.
+     *
+     * @param[in] partNumber
+     *   Load Part Number.
+     *
+     * @return Loads with the given Part Number.
+     **/
+    [[nodiscard]] virtual Media::ConstLoads loadsByPartNumber( std::string_view partNumber ) const = 0;
+
+    /**
+     * @brief Returns the Loads with the given Load Header Filename.
+     *
+     * @param[in] headerFilename
+     *   Load Header Filename.
+     *
+     * @return Loads with the given Load Header Filename.
+     **/
+    [[nodiscard]] virtual Media::ConstLoads loadsByHeaderFilename( std::string_view headerFilename ) const = 0;
+
+    /**
+     * @brief Returns the Loads compatible with the given Target Hardware.
+     *
+     * @param[in] targetHardwareId
+     *   Target Hardware ID.
+     * @param[in] position
+     *   Target Hardware Position.
+     *   If not provided, loads for all positions are returned.
+     *
+     * @return Loads compatible with the given Target Hardware.
+     **/
+    [[nodiscard]] virtual Media::ConstLoads compatibleLoads(
+      std::string_view targetHardwareId,
+      std::optional< std::string_view > position = {} ) const = 0;
+
+    /**
+     * @brief Returns the Loads of the given Load Type.
+     *
+     * @param[in] loadTypeId
+     *   Load Type ID.
+     *
+     * @return Loads of the given Load Type.
+     **/
+    [[nodiscard]] virtual Media::ConstLoads loadsByType( uint16_t loadTypeId ) const = 0;
+
     /** @} **/
 
     /**
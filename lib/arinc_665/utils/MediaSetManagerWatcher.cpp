@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::MediaSetManagerWatcher.
+ **/
+
+#include "MediaSetManagerWatcher.hpp"
+
+#if defined( __linux__ )
+#include <arinc_665/utils/implementation/MediaSetManagerWatcherImpl.hpp>
+#endif
+
+#include <arinc_665/media/MediaSet.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/exception/all.hpp>
+
+namespace Arinc665::Utils {
+
+MediaSetManagerWatcherPtr MediaSetManagerWatcher::create(
+  [[maybe_unused]] const MediaSetManager &mediaSetManager,
+  [[maybe_unused]] ChangeHandler changeHandler,
+  [[maybe_unused]] const bool checkFileIntegrity )
+{
+#if defined( __linux__ )
+  return std::make_unique< MediaSetManagerWatcherImpl >(
+    mediaSetManager,
+    std::move( changeHandler ),
+    checkFileIntegrity );
+#else
+  BOOST_THROW_EXCEPTION( Arinc665Exception()
+    << Helper::AdditionalInfo{ "File system watching is not supported on this platform" } );
+#endif
+}
+
+bool MediaSetManagerWatcher::apply( MediaSetManager &mediaSetManager, const Change &change )
+{
+  switch ( change.type )
+  {
+    case ChangeType::MediaSetAdded:
+      // already registered by the media set manager itself
+      if ( !change.mediaSetInformation
+        || mediaSetManager.hasMediaSet( change.mediaSetInformation->first->partNumber() ) )
+      {
+        return false;
+      }
+
+      mediaSetManager.registerMediaSet(
+        change.mediaSetPaths,
+        change.mediaSetInformation->first,
+        change.mediaSetInformation->second,
+        false );
+      return true;
+
+    case ChangeType::MediaSetUpdated:
+      if ( !change.mediaSetInformation
+        || ( mediaSetManager.mediaSetPaths( change.partNumber ) != change.mediaSetPaths ) )
+      {
+        return false;
+      }
+
+      mediaSetManager.updateMediaSet(
+        change.partNumber,
+        change.mediaSetInformation->first,
+        change.mediaSetInformation->second );
+      return true;
+
+    case ChangeType::MediaSetRemoved:
+      // already de-registered by the media set manager itself
+      if ( mediaSetManager.mediaSetPaths( change.partNumber ) != change.mediaSetPaths )
+      {
+        return false;
+      }
+
+      // a configuration file alone does not remove media sets, which are still available
+      if ( std::filesystem::exists( mediaSetManager.directory() / change.mediaSetPaths.first ) )
+      {
+        spdlog::warn(
+          "Media Set '{}' still exists - keeping it registered",
+          change.mediaSetPaths.first.string() );
+        return false;
+      }
+
+      static_cast< void >( mediaSetManager.deregisterMediaSet( change.partNumber ) );
+      return true;
+
+    case ChangeType::MediaSetInvalid:
+      spdlog::warn(
+        "Media Set '{}' cannot be loaded - keeping last state: {}",
+        change.mediaSetPaths.first.string(),
+        change.error );
+      return false;
+
+    default:
+      return false;
+  }
+}
+
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::MediaSetManagerWatcher.
+ **/
+
+#ifndef ARINC_665_UTILS_MEDIASETMANAGERWATCHER_HPP
+#define ARINC_665_UTILS_MEDIASETMANAGERWATCHER_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+#include <arinc_665/utils/MediaSetManager.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief ARINC 665 %Media Set Manager Watcher.
+ *
+ * Watches the Media Set Manager directory and the media of all registered media sets for modifications by other
+ * tools (Linux: inotify).
+ *
+ * When files of a medium are written, created, moved or deleted, only the affected media set is decompiled again
+ * within the background thread of the watcher.
+ * When the Media Set Manager configuration file is replaced, the media sets added to or removed from it are
+ * determined.
+ * Configuration files written by the Media Set Manager itself (as known by the last watch() call) are ignored.
+ * A media set removed from the configuration file is only reported as removed, when its directory is gone.
+ * Events are collected until the file system has been quiet for a short time, so a media set is decompiled only once
+ * while it is written by another tool.
+ *
+ * The changes are published to the change handler.
+ * The watcher does not modify the Media Set Manager itself.
+ * The handler is called within the watcher thread, so observers usually forward the change to the thread owning the
+ * Media Set Manager, and apply it there (see apply()).
+ *
+ * After the owner has modified the Media Set Manager itself (register, de-register), it updates the watched media
+ * sets by calling watch().
+ **/
+class ARINC_665_EXPORT MediaSetManagerWatcher
+{
+  public:
+    //! Type of Change
+    enum class ChangeType
+    {
+      //! Media Set added to the configuration file - decompiled media set provided.
+      MediaSetAdded,
+      //! Media Set modified on disk - decompiled media set provided.
+      MediaSetUpdated,
+      //! Media Set removed from the configuration file and its directory is gone.
+      MediaSetRemoved,
+      //! Media Set cannot be decompiled (anymore) - error provided.
+      MediaSetInvalid
+    };
+
+    //! Change of the Media Set Manager State on Disk.
+    struct Change
+    {
+      //! Type of Change
+      ChangeType type;
+      //! Media Set Paths (relative to the Media Set Manager Directory)
+      MediaSetPaths mediaSetPaths;
+      //! Part Number of the registered Media Set (empty for added media sets)
+      std::string partNumber;
+      //! Decompiled Media Set Information (for added and updated media sets)
+      std::optional< MediaSetManager::MediaSetInformation > mediaSetInformation;
+      //! Error Description (for invalid media sets)
+      std::string error;
+    };
+
+    /**
+     * @brief Change Handler.
+     *
+     * Called within the watcher thread.
+     *
+     * @param[in] change
+     *   Detected Change.
+     **/
+    using ChangeHandler = std::function< void( Change change ) >;
+
+    /**
+     * @brief Creates the Media Set Manager Watcher and starts watching.
+     *
+     * @param[in] mediaSetManager
+     *   Media Set Manager, which registered media sets are watched.
+     *   Only accessed during this call.
+     * @param[in] changeHandler
+     *   Handler called for each detected change.
+     * @param[in] checkFileIntegrity
+     *   If set to true, additional file integrity checks are performed, when media sets are decompiled.
+     *
+     * @return Media Set Manager Watcher Instance.
+     *
+     * @throw Arinc665Exception
+     *   When file system watching is not supported on this platform or cannot be initialised.
+     **/
+    [[nodiscard]] static MediaSetManagerWatcherPtr create(
+      const MediaSetManager &mediaSetManager,
+      ChangeHandler changeHandler,
+      bool checkFileIntegrity = true );
+
+    /**
+     * @brief Applies the Change to the Media Set Manager.
+     *
+     * Changes, which are already reflected by the Media Set Manager (e.g. a media set added to the configuration by
+     * the Media Set Manager itself), are ignored.
+     * Invalid media sets are kept with their last valid state.
+     * Removed media sets are only de-registered, when their directory does not exist anymore.
+     *
+     * @param[in,out] mediaSetManager
+     *   Media Set Manager.
+     * @param[in] change
+     *   Change reported by the watcher.
+     *
+     * @return If the Media Set Manager has been modified.
+     *
+     * @throw Arinc665Exception
+     *   When the change cannot be applied.
+     **/
+    static bool apply( MediaSetManager &mediaSetManager, const Change &change );
+
+    //! Destructor - stops watching.
+    virtual ~MediaSetManagerWatcher() = default;
+
+    /**
+     * @brief Updates the watched Media Sets to the registered Media Sets of the Media Set Manager.
+     *
+     * Pending changes of media sets, which are no longer registered, are discarded.
+     *
+     * @param[in] mediaSetManager
+     *   Media Set Manager.
+     *   Only accessed during this call.
+     **/
+    virtual void watch( const MediaSetManager &mediaSetManager ) = 0;
+};
+
+}
+
+#endif
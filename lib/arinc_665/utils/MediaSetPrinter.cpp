@@ -168,6 +168,61 @@ void MediaSetPrinter_print(
   }
 }
 
+void MediaSetPrinter_printSummary(
+  const Media::MediaSet &mediaSet,
+  std::ostream &outS,
+  std::string_view initialIndent,
+  std::string_view indent )
+{
+  std::string nextIndent{ initialIndent };
+  nextIndent += indent;
+
+  outS
+    << initialIndent
+    << "Media Set Part Number: '" << mediaSet.partNumber() << "'\n"
+
+    << initialIndent
+    << "Number of Media: " << mediaSet.lastMediumNumber() << "\n"
+
+    << initialIndent
+    << "Number of Files: " << mediaSet.recursiveNumberOfFiles() << "\n";
+
+  // only part number and target hardware IDs are provided by the list of loads
+  outS
+    << initialIndent
+    << "Loads:" << "\n";
+
+  for ( auto const &load : mediaSet.recursiveLoads() )
+  {
+    outS
+      << nextIndent
+      << "[" << load->effectiveMediumNumber() << "]:"
+      << load->path().generic_string()
+      << " '" << load->partNumber() << "'";
+
+    for ( const auto &targetHardwareId : load->targetHardwareIds() )
+    {
+      outS << " " << targetHardwareId;
+    }
+
+    outS << "\n";
+  }
+
+  if ( mediaSet.recursiveNumberOfBatches() != 0U )
+  {
+    outS << initialIndent << "Batches:" << "\n";
+
+    for ( auto const &batch : mediaSet.recursiveBatches() )
+    {
+      outS
+        << nextIndent
+        << "[" << batch->effectiveMediumNumber() << "]:"
+        << batch->path().generic_string()
+        << " '" << batch->partNumber() << "'\n";
+    }
+  }
+}
+
 void MediaSetPrinter_print( const Media::File &file, std::ostream &outS, std::string_view initialIndent )
 {
   outS
@@ -55,6 +55,33 @@ ARINC_665_EXPORT void MediaSetPrinter_print(
   std::string_view initialIndent = {},
   std::string_view indent = " " );
 
+/**
+ * @brief Prints a Summary of the %Media Set.
+ *
+ * - Media Set Part Number and Number of Media
+ * - Number of Files
+ * - Loads (Name, Part Number and Target Hardware IDs)
+ * - Batches (Name and Part Number)
+ *
+ * Only information provided by the list files is printed.
+ * So the load header files and batch files of a lazily decompiled media set are not read
+ * (see MediaSetDecompiler::lazy()).
+ *
+ * @param[in] mediaSet
+ *   Media Set to print.
+ * @param[in,out] outS
+ *   Output Stream
+ * @param[in] initialIndent
+ *   Initial Indention prepended before each output.
+ * @param[in] indent
+ *   Indent for sub-information
+ **/
+ARINC_665_EXPORT void MediaSetPrinter_printSummary(
+  const Media::MediaSet &mediaSet,
+  std::ostream &outS = std::cout,
+  std::string_view initialIndent = {},
+  std::string_view indent = " " );
+
 /**
  * @brief Decodes and prints the content of the %Media Set File.
  *
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::MediaSetStatistics.
+ **/
+
+#include "MediaSetStatistics.hpp"
+
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <format>
+
+#if defined( BOOST_HAS_UNISTD_H )
+#include <time.h>
+#endif
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Returns the CPU Time consumed by the calling Thread.
+ *
+ * Falls back to the CPU time of the process, where the thread CPU time clock is not available.
+ *
+ * @return CPU Time.
+ **/
+std::chrono::nanoseconds cpuTime() noexcept
+{
+#if defined( CLOCK_THREAD_CPUTIME_ID )
+  timespec time{};
+
+  if ( 0 != ::clock_gettime( CLOCK_THREAD_CPUTIME_ID, &time ) )
+  {
+    return {};
+  }
+
+  return std::chrono::seconds{ time.tv_sec } + std::chrono::nanoseconds{ time.tv_nsec };
+#else
+  return std::chrono::duration_cast< std::chrono::nanoseconds >(
+    std::chrono::duration< double >{ static_cast< double >( std::clock() ) / CLOCKS_PER_SEC } );
+#endif
+}
+
+}
+
+MediaSetStatistics::ScopedPhase::ScopedPhase( MediaSetStatistics * const statistics, const Phase phase ) noexcept :
+  statisticsV{ statistics },
+  phaseV{ phase },
+  wallStartV{ statistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{} },
+  cpuStartV{ statistics ? cpuTime() : std::chrono::nanoseconds{} }
+{
+}
+
+MediaSetStatistics::ScopedPhase::~ScopedPhase()
+{
+  if ( nullptr == statisticsV )
+  {
+    return;
+  }
+
+  const auto wallTime{ std::chrono::steady_clock::now() - wallStartV };
+
+  statisticsV->phase(
+    phaseV,
+    std::chrono::duration_cast< std::chrono::nanoseconds >( wallTime ),
+    cpuTime() - cpuStartV );
+}
+
+std::string_view MediaSetStatistics::phaseName( const Phase phase ) noexcept
+{
+  switch ( phase )
+  {
+    using enum Phase;
+
+    case ListFileDecode:   return "List File Decode";
+    case LoadHeaderDecode: return "Load Header Decode";
+    case BatchFileDecode:  return "Batch File Decode";
+    case Crc:              return "CRC";
+    case CheckValue:       return "Check Value";
+    case Read:             return "I/O Wait (Read)";
+    case Encode:           return "Encode";
+    case Write:            return "Write";
+    case Create:           return "Create";
+    default:               return "Invalid";
+  }
+}
+
+void MediaSetStatistics::phase(
+  const Phase phase,
+  const std::chrono::nanoseconds wallTime,
+  const std::chrono::nanoseconds cpuTime )
+{
+  if ( phase >= Phase::Count )
+  {
+    return;
+  }
+
+  std::lock_guard lock{ mutexV };
+
+  auto &phaseStatistics{ phasesV[ static_cast< std::size_t >( phase ) ] };
+  phaseStatistics.wallTime += wallTime;
+  phaseStatistics.cpuTime += cpuTime;
+  ++phaseStatistics.count;
+}
+
+void MediaSetStatistics::fileRead(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path,
+  const std::uint64_t bytes,
+  const std::chrono::nanoseconds duration )
+{
+  std::lock_guard lock{ mutexV };
+
+  auto &fileStatistics{ filesV[ { mediumNumber, path } ] };
+  ++fileStatistics.reads;
+  fileStatistics.bytesRead += bytes;
+  fileStatistics.ioTime += duration;
+}
+
+void MediaSetStatistics::fileWritten(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path,
+  const std::uint64_t bytes,
+  const std::chrono::nanoseconds duration )
+{
+  std::lock_guard lock{ mutexV };
+
+  auto &fileStatistics{ filesV[ { mediumNumber, path } ] };
+  ++fileStatistics.writes;
+  fileStatistics.bytesWritten += bytes;
+  fileStatistics.ioTime += duration;
+}
+
+void MediaSetStatistics::clear()
+{
+  std::lock_guard lock{ mutexV };
+
+  phasesV = {};
+  filesV.clear();
+}
+
+MediaSetStatistics::PhaseStatistics MediaSetStatistics::phaseStatistics( const Phase phase ) const
+{
+  if ( phase >= Phase::Count )
+  {
+    return {};
+  }
+
+  std::lock_guard lock{ mutexV };
+  return phasesV[ static_cast< std::size_t >( phase ) ];
+}
+
+std::uint64_t MediaSetStatistics::bytesRead() const
+{
+  std::lock_guard lock{ mutexV };
+
+  std::uint64_t bytes{ 0U };
+  for ( const auto &[ file, fileStatistics ] : filesV )
+  {
+    bytes += fileStatistics.bytesRead;
+  }
+
+  return bytes;
+}
+
+std::uint64_t MediaSetStatistics::bytesWritten() const
+{
+  std::lock_guard lock{ mutexV };
+
+  std::uint64_t bytes{ 0U };
+  for ( const auto &[ file, fileStatistics ] : filesV )
+  {
+    bytes += fileStatistics.bytesWritten;
+  }
+
+  return bytes;
+}
+
+MediaSetStatistics::FilesStatistics MediaSetStatistics::filesStatistics() const
+{
+  std::lock_guard lock{ mutexV };
+  return filesV;
+}
+
+MediaSetStatistics::SlowestFiles MediaSetStatistics::slowestFiles( const std::size_t count ) const
+{
+  SlowestFiles files{};
+
+  {
+    std::lock_guard lock{ mutexV };
+    files.assign( filesV.begin(), filesV.end() );
+  }
+
+  const auto middle{ std::next( files.begin(), static_cast< std::ptrdiff_t >( std::min( count, files.size() ) ) ) };
+
+  std::ranges::partial_sort(
+    files.begin(),
+    middle,
+    files.end(),
+    std::ranges::greater{},
+    []( const auto &file ) { return file.second.ioTime; } );
+
+  files.erase( middle, files.end() );
+
+  return files;
+}
+
+void MediaSetStatistics_print(
+  const MediaSetStatistics &statistics,
+  std::ostream &outS,
+  const std::size_t slowestFiles,
+  std::string_view initialIndent,
+  std::string_view indent )
+{
+  using Milliseconds = std::chrono::duration< double, std::milli >;
+
+  outS << std::format( "{}Phases:\n", initialIndent );
+
+  for ( std::size_t phase{ 0U }; phase < static_cast< std::size_t >( MediaSetStatistics::Phase::Count ); ++phase )
+  {
+    const auto phaseStatistics{
+      statistics.phaseStatistics( static_cast< MediaSetStatistics::Phase >( phase ) ) };
+
+    if ( 0U == phaseStatistics.count )
+    {
+      continue;
+    }
+
+    outS << std::format(
+      "{}{}{:<20} wall {:>12.3f} ms, cpu {:>12.3f} ms, count {}\n",
+      initialIndent,
+      indent,
+      MediaSetStatistics::phaseName( static_cast< MediaSetStatistics::Phase >( phase ) ),
+      Milliseconds{ phaseStatistics.wallTime }.count(),
+      Milliseconds{ phaseStatistics.cpuTime }.count(),
+      phaseStatistics.count );
+  }
+
+  outS << std::format(
+    "{}Bytes read: {}\n{}Bytes written: {}\n",
+    initialIndent,
+    statistics.bytesRead(),
+    initialIndent,
+    statistics.bytesWritten() );
+
+  if ( 0U == slowestFiles )
+  {
+    return;
+  }
+
+  outS << std::format( "{}Slowest Files:\n", initialIndent );
+
+  for ( const auto &[ file, fileStatistics ] : statistics.slowestFiles( slowestFiles ) )
+  {
+    outS << std::format(
+      "{}{}[{}]:'{}' I/O {:.3f} ms, {} reads ({} bytes), {} writes ({} bytes)\n",
+      initialIndent,
+      indent,
+      file.first,
+      file.second.generic_string(),
+      Milliseconds{ fileStatistics.ioTime }.count(),
+      fileStatistics.reads,
+      fileStatistics.bytesRead,
+      fileStatistics.writes,
+      fileStatistics.bytesWritten );
+  }
+}
+
+}
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::MediaSetStatistics.
+ **/
+
+#ifndef ARINC_665_UTILS_MEDIASETSTATISTICS_HPP
+#define ARINC_665_UTILS_MEDIASETSTATISTICS_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <arinc_665/MediumNumber.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief ARINC 665 %Media Set Operation Statistics.
+ *
+ * Collects timing and throughput metrics of a %Media Set Compiler or %Media Set Decompiler run.
+ * An instance is handed to the compiler or decompiler via its configuration methods and filled during operation.
+ *
+ * For each phase the wall time, the CPU time of the measuring thread and the number of phase executions are
+ * accumulated.
+ * So phases executed concurrently by several threads are not charged with the CPU time of each other.
+ * For each accessed file the number of reads and writes, the transferred bytes and the I/O time are recorded.
+ *
+ * All operations are thread-safe.
+ **/
+class ARINC_665_EXPORT MediaSetStatistics
+{
+  public:
+    //! Operation Phase
+    enum class Phase
+    {
+      //! Decoding of List Files (List of Files, List of Loads, List of Batches)
+      ListFileDecode,
+      //! Decoding of Load Header Files
+      LoadHeaderDecode,
+      //! Decoding of Batch Files
+      BatchFileDecode,
+      //! CRC calculation (File CRC and Load CRC)
+      Crc,
+      //! Check Value calculation (File Check Value and Load Check Value)
+      CheckValue,
+      //! Waiting for File Read Operations
+      Read,
+      //! Encoding of ARINC 665 Files
+      Encode,
+      //! Writing of ARINC 665 Files
+      Write,
+      //! Creation of Files from Source (i.e. Copy)
+      Create,
+
+      //! Number of Phases (Not a valid Phase)
+      Count
+    };
+
+    //! Statistics of a single Phase
+    struct PhaseStatistics
+    {
+      //! Accumulated Wall Time
+      std::chrono::nanoseconds wallTime{};
+      //! Accumulated CPU Time of the measuring Threads
+      std::chrono::nanoseconds cpuTime{};
+      //! Number of Phase Executions
+      std::size_t count{ 0U };
+    };
+
+    //! Statistics of a single File
+    struct FileStatistics
+    {
+      //! Number of Read Operations
+      std::size_t reads{ 0U };
+      //! Number of Write Operations
+      std::size_t writes{ 0U };
+      //! Bytes Read
+      std::uint64_t bytesRead{ 0U };
+      //! Bytes Written
+      std::uint64_t bytesWritten{ 0U };
+      //! Accumulated I/O Time (Read and Write)
+      std::chrono::nanoseconds ioTime{};
+    };
+
+    //! File Key (Medium Number + Path on Medium)
+    using FileKey = std::pair< MediumNumber, std::filesystem::path >;
+    //! Files Statistics (File Key -> File Statistics)
+    using FilesStatistics = std::map< FileKey, FileStatistics >;
+    //! Slowest Files (sorted by descending I/O time)
+    using SlowestFiles = std::vector< std::pair< FileKey, FileStatistics > >;
+
+    /**
+     * @brief RAII Phase Measurement.
+     *
+     * Measures wall and CPU time of the calling thread between construction and destruction and adds it to the
+     * statistics.
+     * Construction and destruction must be performed by the same thread.
+     * Where the CPU time of a thread is not available, the CPU time of the process is measured.
+     * If no statistics instance is given, nothing is measured.
+     **/
+    class ARINC_665_EXPORT ScopedPhase
+    {
+      public:
+        /**
+         * @brief Starts the Phase Measurement.
+         *
+         * @param[in] statistics
+         *   Statistics to update. Can be @p nullptr.
+         * @param[in] phase
+         *   Measured Phase.
+         **/
+        ScopedPhase( MediaSetStatistics * statistics, Phase phase ) noexcept;
+
+        //! Stops the Phase Measurement and updates the statistics.
+        ~ScopedPhase();
+
+        ScopedPhase( const ScopedPhase & ) = delete;
+        ScopedPhase& operator=( const ScopedPhase & ) = delete;
+
+      private:
+        //! Statistics
+        MediaSetStatistics * statisticsV;
+        //! Phase
+        Phase phaseV;
+        //! Start Wall Time
+        std::chrono::steady_clock::time_point wallStartV;
+        //! Start CPU Time of the Thread
+        std::chrono::nanoseconds cpuStartV;
+    };
+
+    //! Initialises empty statistics.
+    MediaSetStatistics() = default;
+
+    /**
+     * @brief Returns the name of the given phase.
+     *
+     * @param[in] phase
+     *   Phase
+     *
+     * @return Name of @p phase.
+     **/
+    [[nodiscard]] static std::string_view phaseName( Phase phase ) noexcept;
+
+    /**
+     * @name Recording
+     * @{
+     **/
+
+    /**
+     * @brief Adds the measurement of a phase.
+     *
+     * @param[in] phase
+     *   Phase
+     * @param[in] wallTime
+     *   Wall Time
+     * @param[in] cpuTime
+     *   CPU Time
+     **/
+    void phase( Phase phase, std::chrono::nanoseconds wallTime, std::chrono::nanoseconds cpuTime );
+
+    /**
+     * @brief Records a File Read Operation.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Path on Medium
+     * @param[in] bytes
+     *   Number of read bytes.
+     * @param[in] duration
+     *   Duration of the Read Operation.
+     **/
+    void fileRead(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path,
+      std::uint64_t bytes,
+      std::chrono::nanoseconds duration );
+
+    /**
+     * @brief Records a File Write Operation.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Path on Medium
+     * @param[in] bytes
+     *   Number of written bytes.
+     * @param[in] duration
+     *   Duration of the Write Operation.
+     **/
+    void fileWritten(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path,
+      std::uint64_t bytes,
+      std::chrono::nanoseconds duration );
+
+    //! Resets all statistics.
+    void clear();
+
+    /** @} **/
+
+    /**
+     * @name Evaluation
+     * @{
+     **/
+
+    /**
+     * @brief Returns the Statistics of the given Phase.
+     *
+     * @param[in] phase
+     *   Phase
+     *
+     * @return Statistics of @p phase.
+     **/
+    [[nodiscard]] PhaseStatistics phaseStatistics( Phase phase ) const;
+
+    /**
+     * @brief Returns the total number of read bytes.
+     *
+     * @return Total number of read bytes.
+     **/
+    [[nodiscard]] std::uint64_t bytesRead() const;
+
+    /**
+     * @brief Returns the total number of written bytes.
+     *
+     * @return Total number of written bytes.
+     **/
+    [[nodiscard]] std::uint64_t bytesWritten() const;
+
+    /**
+     * @brief Returns the Statistics of all accessed Files.
+     *
+     * @return Files Statistics.
+     **/
+    [[nodiscard]] FilesStatistics filesStatistics() const;
+
+    /**
+     * @brief Returns the Files with the highest I/O Time.
+     *
+     * @param[in] count
+     *   Maximum Number of Files to return.
+     *
+     * @return Slowest Files sorted by descending I/O time.
+     **/
+    [[nodiscard]] SlowestFiles slowestFiles( std::size_t count ) const;
+
+    /** @} **/
+
+  private:
+    //! Mutex protecting the statistics
+    mutable std::mutex mutexV;
+    //! Phases Statistics
+    std::array< PhaseStatistics, static_cast< std::size_t >( Phase::Count ) > phasesV{};
+    //! Files Statistics
+    FilesStatistics filesV;
+};
+
+/**
+ * @brief Prints the %Media Set Statistics.
+ *
+ * - Phase Statistics
+ * - Total Bytes Read and Written
+ * - Slowest Files
+ *
+ * @param[in] statistics
+ *   Statistics to print.
+ * @param[in,out] outS
+ *   Output Stream
+ * @param[in] slowestFiles
+ *   Number of slowest files to print.
+ * @param[in] initialIndent
+ *   Initial Indention prepended before each output.
+ * @param[in] indent
+ *   Indent for sub-information
+ **/
+ARINC_665_EXPORT void MediaSetStatistics_print(
+  const MediaSetStatistics &statistics,
+  std::ostream &outS = std::cout,
+  std::size_t slowestFiles = 10U,
+  std::string_view initialIndent = {},
+  std::string_view indent = " " );
+
+}
+
+#endif
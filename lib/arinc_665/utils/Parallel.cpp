@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665::Utils Parallel.
+ **/
+
+#include "Parallel.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+void Parallel_forEach(
+  const std::size_t count,
+  const std::size_t lanes,
+  const std::stop_token &stopToken,
+  const std::function< void( std::size_t index ) > &function )
+{
+  // stops the other lanes on failure or on external cancellation
+  std::stop_source stopSource{};
+  std::stop_callback stopCallback{ stopToken, [ &stopSource ] { stopSource.request_stop(); } };
+
+  std::atomic_size_t nextIndex{ 0U };
+  std::exception_ptr exception{};
+  bool exceptionCancelled{ false };
+  std::mutex exceptionMutex{};
+
+  // keeps the first exception - other failures take precedence over cancellations caused by the first failure
+  const auto failed{ [ & ]( const bool cancelled )
+  {
+    const std::lock_guard lock{ exceptionMutex };
+    if ( !exception || ( exceptionCancelled && !cancelled ) )
+    {
+      exception = std::current_exception();
+      exceptionCancelled = cancelled;
+    }
+    stopSource.request_stop();
+  } };
+
+  const auto lane{ [ & ]
+  {
+    try
+    {
+      for (
+        auto index{ nextIndex.fetch_add( 1U, std::memory_order_relaxed ) };
+        ( index < count ) && !stopSource.stop_requested();
+        index = nextIndex.fetch_add( 1U, std::memory_order_relaxed ) )
+      {
+        function( index );
+      }
+    }
+    catch ( const OperationCancelled & )
+    {
+      failed( true );
+    }
+    catch ( ... )
+    {
+      failed( false );
+    }
+  } };
+
+  const auto hardwareLanes{ std::max( std::size_t{ std::thread::hardware_concurrency() }, std::size_t{ 1U } ) };
+  const auto laneCount{ std::min( 0U == lanes ? hardwareLanes : lanes, count ) };
+
+  {
+    std::vector< std::jthread > workers{};
+    for ( std::size_t worker{ 1U }; worker < laneCount; ++worker )
+    {
+      workers.emplace_back( lane );
+    }
+
+    lane();
+  }
+
+  if ( exception )
+  {
+    std::rethrow_exception( exception );
+  }
+
+  if ( stopToken.stop_requested() )
+  {
+    BOOST_THROW_EXCEPTION( OperationCancelled{}
+      << Helper::AdditionalInfo{ "Operation cancelled by request" } );
+  }
+}
+
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665::Utils Parallel.
+ **/
+
+#ifndef ARINC_665_UTILS_PARALLEL_HPP
+#define ARINC_665_UTILS_PARALLEL_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <stop_token>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Calls the Function for each Index in parallel Lanes.
+ *
+ * The indices are handed out in ascending order to the next free lane.
+ * The calling thread is used as one of the lanes.
+ *
+ * When the function throws, the other lanes stop after their current index and the first exception is rethrown.
+ * An OperationCancelled exception of the function is only rethrown, when no other exception has been thrown.
+ * So a failure, which causes the cancellation of operations within the other lanes, is not hidden.
+ *
+ * @param[in] count
+ *   Number of Indices.
+ * @param[in] lanes
+ *   Maximum number of parallel lanes. 0 selects the number of hardware threads.
+ * @param[in] stopToken
+ *   Stop Token used for Cancellation. Checked between two indices.
+ * @param[in] function
+ *   Function called with each index.
+ *
+ * @throw OperationCancelled
+ *   When cancellation has been requested.
+ **/
+ARINC_665_EXPORT void Parallel_forEach(
+  std::size_t count,
+  std::size_t lanes,
+  const std::stop_token &stopToken,
+  const std::function< void( std::size_t index ) > &function );
+
+}
+
+#endif
@@ -26,7 +26,10 @@
 
 #include <arinc_665/MediumNumber.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -96,6 +99,43 @@ using FilesystemMediaSetDecompilerPtr = std::unique_ptr< FilesystemMediaSetDecom
 
 /** @} **/
 
+/**
+ * @name Byte Progress
+ *
+ * @{
+ **/
+
+//! Byte-Level Progress Information of long-running Operations.
+struct ByteProgress
+{
+  //! Processed (hashed or copied) Bytes
+  std::uint64_t processedBytes;
+  //! Total Bytes to process (0 if unknown)
+  std::uint64_t totalBytes;
+  //! Currently processed File (Path on Medium)
+  std::filesystem::path currentFile;
+  //! Throughput in Bytes per Second
+  double throughput;
+  //! Estimated remaining Time (Empty if unknown)
+  std::optional< std::chrono::seconds > remainingTime;
+};
+
+/**
+ * @brief Byte Progress Handler.
+ *
+ * @param[in] progress
+ *   Current Progress.
+ **/
+using ByteProgressHandler = std::function< void( const ByteProgress &progress ) >;
+
+class ByteProgressTracker;
+
+/** @} **/
+
+class MediaSetStatistics;
+//! ARINC 665 %Media Set Statistics Instance.
+using MediaSetStatisticsPtr = std::shared_ptr< MediaSetStatistics >;
+
 class FilesystemMediaSetCopier;
 //! Filesystem ARINC 665 %Media Set Copier Instance.
 using FilesystemMediaSetCopierPtr = std::unique_ptr< FilesystemMediaSetCopier >;
@@ -104,6 +144,32 @@ class FilesystemMediaSetRemover;
 //! Filesystem ARINC 665 %Media Set Remover Instance.
 using FilesystemMediaSetRemoverPtr = std::unique_ptr< FilesystemMediaSetRemover >;
 
+/**
+ * @name File Placement
+ *
+ * @{
+ **/
+
+/**
+ * @brief Strategy used to place Source Files into Media.
+ *
+ * If the strategy is not possible (e.g. not supported by the platform or filesystem), the next weaker one is used:
+ * Hardlink -> Reflink -> KernelCopy -> Copy.
+ **/
+enum class FilePlacementStrategy
+{
+  //! Plain copy through user space buffers.
+  Copy,
+  //! In-kernel copy (`copy_file_range` or `sendfile`).
+  KernelCopy,
+  //! Copy-on-write clone (reflink), which shares the data blocks with the source file.
+  Reflink,
+  //! Hardlink to the source file - the source file is made read-only, as it shares its inode with the medium file.
+  Hardlink
+};
+
+/** @} **/
+
 /**
  * @name Media Set Validator
  *
@@ -128,6 +194,10 @@ class MediaSetManager;
 //! ARINC 665 %Media Set Manager Instance Pointer.
 using MediaSetManagerPtr = std::shared_ptr< MediaSetManager >;
 
+class MediaSetManagerWatcher;
+//! ARINC 665 %Media Set Manager Watcher Instance.
+using MediaSetManagerWatcherPtr = std::unique_ptr< MediaSetManagerWatcher >;
+
 /** @} **/
 
 /**
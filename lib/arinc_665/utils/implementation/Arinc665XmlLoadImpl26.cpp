@@ -313,7 +313,7 @@ void Arinc665XmlLoadImpl26::load( const xmlpp::Element &loadElement, Media::Cont
       << Helper::AdditionalInfo{ "PartNumber attribute missing or empty" }
       << boost::errinfo_at_line{ loadElement.get_line() } );
   }
-  load->partNumber( std::move( partNumber ) );
+  load->partNumber( partNumber.raw() );
 
   // Part Flags
   if ( const auto partFlags{ loadElement.get_attribute_value( "PartFlags" ) }; !partFlags.empty() )
@@ -381,10 +381,10 @@ void Arinc665XmlLoadImpl26::load( const xmlpp::Element &loadElement, Media::Cont
 
       auto position{ positionElement->get_attribute_value( "Pos" ) };
 
-      positions.emplace( position );
+      positions.emplace( position.raw() );
     }
 
-    thwIds.try_emplace( thwId, std::move( positions ) );
+    thwIds.try_emplace( thwId.raw(), std::move( positions ) );
   }
 
   load->targetHardwareIdPositions( std::move( thwIds ) );
@@ -489,7 +489,7 @@ Media::ConstLoadFiles Arinc665XmlLoadImpl26::loadFiles(
         << boost::errinfo_at_line{ fileNode->get_line() } );
     }
 
-    loadFiles.emplace_back( file, filePartNumber, checkValueType );
+    loadFiles.emplace_back( file, filePartNumber.raw(), checkValueType );
   }
 
   return loadFiles;
@@ -508,7 +508,7 @@ void Arinc665XmlLoadImpl26::batch( const xmlpp::Element &batchElement, Media::Co
       << Helper::AdditionalInfo{ "PartNumber attribute missing or empty" }
       << boost::errinfo_at_line{ batchElement.get_line() } );
   }
-  batch->partNumber( std::move( partNumber ) );
+  batch->partNumber( partNumber.raw() );
 
   auto comment{ batchElement.get_attribute_value( "Comment" ) };
   batch->comment( std::move( comment ) );
@@ -584,7 +584,7 @@ void Arinc665XmlLoadImpl26::loadBatchDeferred( const xmlpp::Element &batchElemen
     }
 
     // add THW ID POS with Loads
-    batch.target( thwIdPos, targetLoads );
+    batch.target( thwIdPos.raw(), targetLoads );
   }
 }
 
@@ -210,12 +210,12 @@ void Arinc665XmlSaveImpl26::load( const Media::ConstFilePtr &file, xmlpp::Elemen
   for ( const auto &[targetHardwareId, positions] : load->targetHardwareIdPositions() )
   {
     auto * const targetHardwareElement{ loadElement->add_child( "TargetHardware" ) };
-    targetHardwareElement->set_attribute( "ThwId", targetHardwareId );
+    targetHardwareElement->set_attribute( "ThwId", toGlibString( targetHardwareId ) );
 
     for( const auto &position : positions )
     {
       auto * const positionElement{ targetHardwareElement->add_child( "Position" ) };
-      positionElement->set_attribute( "Pos", position );
+      positionElement->set_attribute( "Pos", toGlibString( position ) );
     }
   }
 
@@ -243,7 +243,7 @@ void Arinc665XmlSaveImpl26::loadFiles(
   {
     auto * const fileElement{ loadElement.add_child( fileElementNameStr ) };
     fileElement->set_attribute( "FilePath", file->path().string() );
-    fileElement->set_attribute( "PartNumber", partNumber );
+    fileElement->set_attribute( "PartNumber", toGlibString( partNumber ) );
 
     if ( checkValueType )
     {
@@ -276,7 +276,7 @@ void Arinc665XmlSaveImpl26::batch( const Media::ConstFilePtr &file, xmlpp::Eleme
   {
     auto * const targetElement{ batchElement->add_child( "Target" ) };
 
-    targetElement->set_attribute( "ThwIdPos", thwIdPos );
+    targetElement->set_attribute( "ThwIdPos", toGlibString( thwIdPos ) );
 
     // iterate over loads
     for ( const auto &load : loads )
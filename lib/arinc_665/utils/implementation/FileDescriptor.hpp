@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::FileDescriptor.
+ **/
+
+#ifndef ARINC_665_UTILS_IMPLEMENTATION_FILEDESCRIPTOR_HPP
+#define ARINC_665_UTILS_IMPLEMENTATION_FILEDESCRIPTOR_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <unistd.h>
+
+namespace Arinc665::Utils {
+
+//! Closes the POSIX File Descriptor on Destruction.
+class FileDescriptor
+{
+  public:
+    /**
+     * @brief Takes ownership of the File Descriptor.
+     *
+     * @param[in] fd
+     *   File Descriptor (-1 if invalid).
+     **/
+    explicit FileDescriptor( const int fd ) noexcept :
+      fdV{ fd }
+    {
+    }
+
+    FileDescriptor( const FileDescriptor & ) = delete;
+    FileDescriptor &operator=( const FileDescriptor & ) = delete;
+
+    //! Closes the File Descriptor.
+    ~FileDescriptor()
+    {
+      if ( fdV >= 0 )
+      {
+        ::close( fdV );
+      }
+    }
+
+    //! @return File Descriptor.
+    [[nodiscard]] int get() const noexcept
+    {
+      return fdV;
+    }
+
+  private:
+    //! File Descriptor
+    int fdV;
+};
+
+}
+
+#endif
@@ -0,0 +1,433 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Function Arinc665::Utils::FilePlacement_placeFile.
+ **/
+
+#include "FilePlacement.hpp"
+
+#if defined( __linux__ )
+#include "FileDescriptor.hpp"
+#endif
+
+#include <arinc_665/utils/ByteProgressTracker.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/exception/all.hpp>
+
+#include <fstream>
+#include <span>
+#include <vector>
+
+#if defined( __linux__ )
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <system_error>
+#endif
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Copies the file through user space buffers.
+ *
+ * @param[in] sourceFilePath
+ *   Source File Path.
+ * @param[in] destinationFilePath
+ *   Destination File Path.
+ * @param[in] cancellation
+ *   Tracker used for cancellation checks.
+ * @param[in] chunkProcessor
+ *   Optional Chunk Processor called with each copied buffer.
+ **/
+void copyFile(
+  const std::filesystem::path &sourceFilePath,
+  const std::filesystem::path &destinationFilePath,
+  const ByteProgressTracker &cancellation,
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor )
+{
+  std::ifstream source{ sourceFilePath, std::ifstream::binary | std::ifstream::in };
+  std::ofstream destination{
+    destinationFilePath,
+    std::ofstream::binary | std::ofstream::out | std::ofstream::trunc };
+
+  if ( !source.is_open() || !destination.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening files" }
+      << boost::errinfo_file_name{ sourceFilePath.string() } );
+  }
+
+  std::vector< char > chunk( ByteProgressTracker::ChunkSize );
+
+  while ( source )
+  {
+    cancellation.checkCancelled();
+
+    source.read( chunk.data(), static_cast< std::streamsize >( chunk.size() ) );
+    const auto chunkSize{ static_cast< std::size_t >( source.gcount() ) };
+    destination.write( chunk.data(), source.gcount() );
+
+    if ( chunkProcessor && ( 0U != chunkSize ) )
+    {
+      chunkProcessor( std::as_bytes( std::span{ chunk.data(), chunkSize } ) );
+    }
+  }
+
+  if ( !source.eof() || !destination )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error copying file" }
+      << boost::errinfo_file_name{ sourceFilePath.string() } );
+  }
+}
+
+/**
+ * @brief Reads the file in chunks and passes them to the chunk processor.
+ *
+ * Used for placement strategies, which do not move the data through user space.
+ *
+ * @param[in] filePath
+ *   File Path.
+ * @param[in] cancellation
+ *   Tracker used for cancellation checks.
+ * @param[in] chunkProcessor
+ *   Chunk Processor.
+ **/
+void processFile(
+  const std::filesystem::path &filePath,
+  const ByteProgressTracker &cancellation,
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor )
+{
+  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
+
+  if ( !file.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  std::vector< char > chunk( ByteProgressTracker::ChunkSize );
+
+  while ( file )
+  {
+    cancellation.checkCancelled();
+
+    file.read( chunk.data(), static_cast< std::streamsize >( chunk.size() ) );
+
+    if ( const auto chunkSize{ static_cast< std::size_t >( file.gcount() ) }; 0U != chunkSize )
+    {
+      chunkProcessor( std::as_bytes( std::span{ chunk.data(), chunkSize } ) );
+    }
+  }
+
+  if ( !file.eof() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error reading file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+}
+
+#if defined( __linux__ )
+
+/**
+ * @brief Returns if the error indicates, that the in-kernel copy is not supported for the given files.
+ *
+ * @param[in] error
+ *   Error Number.
+ *
+ * @return If the in-kernel copy is not supported.
+ **/
+bool notSupported( const int error ) noexcept
+{
+  return ( ENOSYS == error ) || ( EXDEV == error ) || ( EINVAL == error ) || ( EOPNOTSUPP == error )
+    || ( ENOTTY == error ) || ( EPERM == error );
+}
+
+/**
+ * @brief Copies the file within the kernel.
+ *
+ * Uses `copy_file_range` and falls back to `sendfile`.
+ *
+ * @param[in] source
+ *   Source File Descriptor.
+ * @param[in] destination
+ *   Destination File Descriptor.
+ * @param[in] size
+ *   File Size.
+ * @param[in] cancellation
+ *   Tracker used for cancellation checks.
+ * @param[in] destinationFilePath
+ *   Destination File Path (for error reporting).
+ *
+ * @return If the file has been copied.
+ * @retval false
+ *   If in-kernel copy is not supported and no data has been copied.
+ **/
+bool kernelCopy(
+  const FileDescriptor &source,
+  const FileDescriptor &destination,
+  const std::uintmax_t size,
+  const ByteProgressTracker &cancellation,
+  const std::filesystem::path &destinationFilePath )
+{
+  std::uintmax_t copied{ 0U };
+  bool useSendfile{ false };
+
+  while ( copied < size )
+  {
+    cancellation.checkCancelled();
+
+    const auto chunkSize{ static_cast< std::size_t >(
+      std::min< std::uintmax_t >( size - copied, ByteProgressTracker::ChunkSize ) ) };
+
+    const auto result{ useSendfile ?
+      ::sendfile( destination.get(), source.get(), nullptr, chunkSize ) :
+      ::copy_file_range( source.get(), nullptr, destination.get(), nullptr, chunkSize, 0U ) };
+
+    if ( result < 0 )
+    {
+      const auto error{ errno };
+
+      if ( EINTR == error )
+      {
+        continue;
+      }
+
+      if ( ( 0U == copied ) && notSupported( error ) )
+      {
+        if ( !useSendfile )
+        {
+          useSendfile = true;
+          continue;
+        }
+
+        return false;
+      }
+
+      const std::error_code errorCode{ error, std::generic_category() };
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ errorCode.message() }
+        << boost::errinfo_file_name{ destinationFilePath.string() } );
+    }
+
+    // source file shrunk during copy
+    if ( 0 == result )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Error copying file" }
+        << boost::errinfo_file_name{ destinationFilePath.string() } );
+    }
+
+    copied += static_cast< std::uintmax_t >( result );
+  }
+
+  return true;
+}
+
+/**
+ * @brief Places the file by reflink or in-kernel copy.
+ *
+ * @param[in] sourceFilePath
+ *   Source File Path.
+ * @param[in] destinationFilePath
+ *   Destination File Path.
+ * @param[in] strategy
+ *   Preferred File Placement Strategy (Reflink or KernelCopy).
+ * @param[in] allowKernelCopy
+ *   If the in-kernel copy may be used.
+ * @param[in] cancellation
+ *   Tracker used for cancellation checks.
+ *
+ * @return Strategy, which has been used.
+ * @retval FilePlacementStrategy::Copy
+ *   If neither reflink nor in-kernel copy are supported or allowed. The destination file is not created.
+ **/
+FilePlacementStrategy placeFileKernel(
+  const std::filesystem::path &sourceFilePath,
+  const std::filesystem::path &destinationFilePath,
+  const FilePlacementStrategy strategy,
+  const bool allowKernelCopy,
+  const ByteProgressTracker &cancellation )
+{
+  const FileDescriptor source{ ::open( sourceFilePath.c_str(), O_RDONLY | O_CLOEXEC ) };
+
+  struct ::stat sourceStat{};
+  if ( ( source.get() < 0 ) || ( ::fstat( source.get(), &sourceStat ) != 0 ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening files" }
+      << boost::errinfo_file_name{ sourceFilePath.string() } );
+  }
+
+  const FileDescriptor destination{ ::open(
+    destinationFilePath.c_str(),
+    O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+    sourceStat.st_mode & 0777U ) };
+
+  if ( destination.get() < 0 )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening files" }
+      << boost::errinfo_file_name{ destinationFilePath.string() } );
+  }
+
+  if ( ( FilePlacementStrategy::Reflink == strategy ) && ( ::ioctl( destination.get(), FICLONE, source.get() ) == 0 ) )
+  {
+    return FilePlacementStrategy::Reflink;
+  }
+
+  if ( allowKernelCopy && kernelCopy(
+    source,
+    destination,
+    static_cast< std::uintmax_t >( sourceStat.st_size ),
+    cancellation,
+    destinationFilePath ) )
+  {
+    return FilePlacementStrategy::KernelCopy;
+  }
+
+  // remove the empty destination, it is re-created by the plain copy
+  std::error_code err{};
+  std::filesystem::remove( destinationFilePath, err );
+
+  return FilePlacementStrategy::Copy;
+}
+
+#endif
+
+/**
+ * @brief Places the Source File at the Destination Path using the given Strategy or its Fallbacks.
+ *
+ * @param[in] sourceFilePath
+ *   Source File Path.
+ * @param[in] destinationFilePath
+ *   Destination File Path.
+ * @param[in] strategy
+ *   Preferred File Placement Strategy.
+ * @param[in] cancellation
+ *   Tracker used for cancellation checks.
+ * @param[in] chunkProcessor
+ *   Optional Chunk Processor called with the file content.
+ *
+ * @return Strategy, which has been used to place the file.
+ **/
+FilePlacementStrategy placeFile(
+  const std::filesystem::path &sourceFilePath,
+  const std::filesystem::path &destinationFilePath,
+  FilePlacementStrategy strategy,
+  const ByteProgressTracker &cancellation,
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor )
+{
+  if ( FilePlacementStrategy::Hardlink == strategy )
+  {
+    // fails, when source and destination are located on different volumes
+    if ( std::error_code err{}; std::filesystem::create_hard_link( sourceFilePath, destinationFilePath, err ), !err )
+    {
+      if ( chunkProcessor )
+      {
+        processFile( sourceFilePath, cancellation, chunkProcessor );
+      }
+
+      // source and destination share the inode - a modification of the source file would modify the media
+      std::filesystem::permissions(
+        destinationFilePath,
+        std::filesystem::perms::owner_write
+          | std::filesystem::perms::group_write
+          | std::filesystem::perms::others_write,
+        std::filesystem::perm_options::remove,
+        err );
+
+      if ( !err )
+      {
+        return FilePlacementStrategy::Hardlink;
+      }
+
+      SPDLOG_WARN( "Write protect '{}': {}", sourceFilePath.string(), err.message() );
+      std::filesystem::remove( destinationFilePath, err );
+    }
+
+    strategy = FilePlacementStrategy::Reflink;
+  }
+
+#if defined( __linux__ )
+  // an in-kernel copy would require a second read for the chunk processor - the plain copy processes its buffers
+  if ( ( FilePlacementStrategy::Reflink == strategy )
+    || ( ( FilePlacementStrategy::KernelCopy == strategy ) && !chunkProcessor ) )
+  {
+    if ( const auto usedStrategy{
+        placeFileKernel( sourceFilePath, destinationFilePath, strategy, !chunkProcessor, cancellation ) };
+      FilePlacementStrategy::Copy != usedStrategy )
+    {
+      if ( chunkProcessor )
+      {
+        processFile( sourceFilePath, cancellation, chunkProcessor );
+      }
+
+      return usedStrategy;
+    }
+  }
+#endif
+
+  SPDLOG_TRACE( "Plain copy of '{}'", sourceFilePath.string() );
+
+  copyFile( sourceFilePath, destinationFilePath, cancellation, chunkProcessor );
+
+  return FilePlacementStrategy::Copy;
+}
+
+}
+
+FilePlacementStrategy FilePlacement_placeFile(
+  const std::filesystem::path &sourceFilePath,
+  const std::filesystem::path &destinationFilePath,
+  const FilePlacementStrategy strategy,
+  const std::stop_token &stopToken,
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor )
+{
+  const ByteProgressTracker cancellation{ {}, stopToken };
+  cancellation.checkCancelled();
+
+  // check the existence of the file
+  if ( std::filesystem::exists( destinationFilePath ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "File already exists" }
+      << boost::errinfo_file_name{ destinationFilePath.string() } );
+  }
+
+  try
+  {
+    return placeFile( sourceFilePath, destinationFilePath, strategy, cancellation, chunkProcessor );
+  }
+  catch ( ... )
+  {
+    // the destination did not exist before - a partially placed file must not be left behind
+    std::error_code err{};
+    std::filesystem::remove( destinationFilePath, err );
+
+    throw;
+  }
+}
+
+}
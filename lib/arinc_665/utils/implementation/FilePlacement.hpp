@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Function Arinc665::Utils::FilePlacement_placeFile.
+ **/
+
+#ifndef ARINC_665_UTILS_FILEPLACEMENT_HPP
+#define ARINC_665_UTILS_FILEPLACEMENT_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <stop_token>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Places the Source File at the Destination Path.
+ *
+ * The given @p strategy is tried first.
+ * If it is not possible, the next weaker strategy is used (see FilePlacementStrategy).
+ * A hardlink is only possible, when source and destination are located on the same volume.
+ * The linked inode is write protected, so the source file becomes read-only.
+ * If the inode cannot be write protected (e.g. the source file is owned by another user), no hardlink is placed.
+ * A reflink requires a filesystem with copy-on-write support (e.g. btrfs, XFS).
+ *
+ * The stop token is checked between the chunks of the copy strategies.
+ *
+ * If a @p chunkProcessor is given, it is called with the complete file content in order (e.g. to calculate CRCs and
+ * check values while placing the file).
+ * In this case the in-kernel copy is replaced by the plain copy, which passes its buffers to the chunk processor.
+ * Hardlinks and reflinks do not move the data, so the source file is read once after placing it.
+ *
+ * On any failure (including cancellation and exceptions of the chunk processor), the partially placed destination
+ * file is removed.
+ *
+ * @param[in] sourceFilePath
+ *   Source File Path.
+ * @param[in] destinationFilePath
+ *   Destination File Path. The file must not exist.
+ * @param[in] strategy
+ *   Preferred File Placement Strategy.
+ * @param[in] stopToken
+ *   Stop Token used for Cancellation.
+ * @param[in] chunkProcessor
+ *   Optional Chunk Processor called with the file content.
+ *
+ * @return Strategy, which has been used to place the file.
+ *
+ * @throw OperationCancelled
+ *   When cancellation has been requested.
+ * @throw Arinc665Exception
+ *   When the destination file exists or the file cannot be placed.
+ **/
+ARINC_665_EXPORT FilePlacementStrategy FilePlacement_placeFile(
+  const std::filesystem::path &sourceFilePath,
+  const std::filesystem::path &destinationFilePath,
+  FilePlacementStrategy strategy,
+  const std::stop_token &stopToken = {},
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor = {} );
+
+}
+
+#endif
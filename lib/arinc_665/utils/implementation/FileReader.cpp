@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665::Utils FileReader.
+ **/
+
+#include "FileReader.hpp"
+
+#include <arinc_665/utils/Parallel.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#if defined( __linux__ )
+#include "FileDescriptor.hpp"
+
+#include <fcntl.h>
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#else
+#include <fstream>
+#endif
+
+namespace Arinc665::Utils {
+
+#if defined( __linux__ )
+
+Helper::RawData FileReader_readFile( const std::filesystem::path &filePath )
+{
+  const FileDescriptor file{ ::open( filePath.c_str(), O_RDONLY | O_CLOEXEC ) };
+
+  if ( file.get() < 0 )
+  {
+    const auto error{ errno };
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ ENOENT == error ? "File not found" : "Error opening file" }
+      << boost::errinfo_errno{ error }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  struct ::stat status{};
+  if ( ( 0 != ::fstat( file.get(), &status ) ) || !S_ISREG( status.st_mode ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "File not found" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  Helper::RawData data( static_cast< std::size_t >( status.st_size ) );
+
+  for ( std::size_t offset{ 0U }; offset < data.size(); )
+  {
+    const auto result{
+      ::pread( file.get(), data.data() + offset, data.size() - offset, static_cast< ::off_t >( offset ) ) };
+
+    if ( ( result < 0 ) && ( EINTR == errno ) )
+    {
+      continue;
+    }
+
+    // error or file truncated while reading
+    if ( result <= 0 )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Error reading file" }
+        << boost::errinfo_file_name{ filePath.string() } );
+    }
+
+    offset += static_cast< std::size_t >( result );
+  }
+
+  return data;
+}
+
+std::uint64_t FileReader_location( const std::filesystem::path &filePath ) noexcept
+{
+  const FileDescriptor file{ ::open( filePath.c_str(), O_RDONLY | O_CLOEXEC ) };
+
+  if ( file.get() < 0 )
+  {
+    return 0U;
+  }
+
+  // FIEMAP request with space for the first extent only
+  std::array< std::uint64_t, ( sizeof( ::fiemap ) + sizeof( ::fiemap_extent ) ) / sizeof( std::uint64_t ) > request{};
+  auto * const fileMap{ reinterpret_cast< ::fiemap * >( request.data() ) };
+  fileMap->fm_start = 0U;
+  fileMap->fm_length = FIEMAP_MAX_OFFSET;
+  fileMap->fm_extent_count = 1U;
+
+  if ( 0 == ::ioctl( file.get(), FS_IOC_FIEMAP, fileMap ) )
+  {
+    // files without extents (empty or inline data) are sorted first
+    return ( 0U == fileMap->fm_mapped_extents ) ? 0U : fileMap->fm_extents[ 0 ].fe_physical;
+  }
+
+  // FIEMAP not supported by the filesystem (e.g. ISO 9660, network filesystems)
+  struct ::stat status{};
+  if ( 0 != ::fstat( file.get(), &status ) )
+  {
+    return 0U;
+  }
+
+  return static_cast< std::uint64_t >( status.st_ino );
+}
+
+#else
+
+Helper::RawData FileReader_readFile( const std::filesystem::path &filePath )
+{
+  // check existence of the file
+  if ( !std::filesystem::is_regular_file( filePath ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "File not found" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  Helper::RawData data( std::filesystem::file_size( filePath ) );
+
+  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
+
+  if ( !file.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  file.read( reinterpret_cast< char * >( data.data() ), static_cast< std::streamsize >( data.size() ) );
+
+  if ( file.bad() || ( file.gcount() != static_cast< std::streamsize >( data.size() ) ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error reading file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  return data;
+}
+
+std::uint64_t FileReader_location( [[maybe_unused]] const std::filesystem::path &filePath ) noexcept
+{
+  // physical location not available - the requested order is kept
+  return 0U;
+}
+
+#endif
+
+std::vector< Helper::RawData > FileReader_readFiles(
+  const std::span< const std::filesystem::path > filePaths,
+  const std::size_t lanes,
+  const std::stop_token &stopToken )
+{
+  std::vector< Helper::RawData > files( filePaths.size() );
+
+  Parallel_forEach( filePaths.size(), lanes, stopToken, [ & ]( const std::size_t index )
+  {
+    files[ index ] = FileReader_readFile( filePaths[ index ] );
+  } );
+
+  return files;
+}
+
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665::Utils FileReader.
+ **/
+
+#ifndef ARINC_665_UTILS_IMPLEMENTATION_FILEREADER_HPP
+#define ARINC_665_UTILS_IMPLEMENTATION_FILEREADER_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <helper/RawData.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+//! Default Number of parallel Read Lanes
+//! Reads mostly wait for the device (or the network), so more lanes than hardware threads are used.
+constexpr std::size_t FileReader_DefaultLanes{ 16U };
+
+/**
+ * @brief Reads the complete File.
+ *
+ * On Linux, the file is opened once and its size is taken from the open file descriptor, so only the
+ * `open`, `fstat`, and `pread` system calls are issued.
+ *
+ * @param[in] filePath
+ *   File Path.
+ *
+ * @return File Data.
+ *
+ * @throw Arinc665Exception
+ *   When the file does not exist or cannot be read.
+ **/
+[[nodiscard]] ARINC_665_EXPORT Helper::RawData FileReader_readFile( const std::filesystem::path &filePath );
+
+/**
+ * @brief Returns the physical Location of the File.
+ *
+ * The location is used as sort key to read files in the order of their placement on the device, which avoids seeks on
+ * rotational and other slow media.
+ * On Linux, the physical offset of the first extent is returned, if the filesystem supports `FS_IOC_FIEMAP`.
+ * Otherwise, the inode number is returned, which mostly follows the order of creation on the medium.
+ * Locations are only comparable for files of the same filesystem.
+ *
+ * @param[in] filePath
+ *   File Path.
+ *
+ * @return Physical location of the file, or 0 if unknown (e.g. the file does not exist).
+ **/
+[[nodiscard]] ARINC_665_EXPORT std::uint64_t FileReader_location( const std::filesystem::path &filePath ) noexcept;
+
+/**
+ * @brief Reads the given Files in parallel Lanes.
+ *
+ * Hides the per-file open and read latency when many small files are read, e.g. on NFS or NVMe devices.
+ *
+ * @param[in] filePaths
+ *   File Paths.
+ * @param[in] lanes
+ *   Maximum number of parallel lanes.
+ * @param[in] stopToken
+ *   Stop Token used for Cancellation. Checked between two files.
+ *
+ * @return File Data in the order of @p filePaths.
+ *
+ * @throw Arinc665Exception
+ *   When a file does not exist or cannot be read.
+ * @throw OperationCancelled
+ *   When cancellation has been requested.
+ **/
+[[nodiscard]] ARINC_665_EXPORT std::vector< Helper::RawData > FileReader_readFiles(
+  std::span< const std::filesystem::path > filePaths,
+  std::size_t lanes = FileReader_DefaultLanes,
+  const std::stop_token &stopToken = {} );
+
+}
+
+#endif
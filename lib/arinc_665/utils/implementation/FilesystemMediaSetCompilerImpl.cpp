@@ -11,8 +11,11 @@
  **/
 
 #include "FilesystemMediaSetCompilerImpl.hpp"
+#include "FilePlacement.hpp"
+#include "FileReader.hpp"
 
 #include <arinc_665/utils/MediaSetCompiler.hpp>
+#include <arinc_665/utils/MediaSetStatistics.hpp>
 
 #include <arinc_665/media/Directory.hpp>
 #include <arinc_665/media/File.hpp>
@@ -28,8 +31,10 @@
 #include <boost/exception/all.hpp>
 
 #include <cassert>
+#include <chrono>
 #include <fstream>
 #include <format>
+#include <ranges>
 
 namespace Arinc665::Utils {
 
@@ -41,6 +46,7 @@ FilesystemMediaSetCompilerImpl::FilesystemMediaSetCompilerImpl() :
     .createDirectoryHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::createDirectory, this ) )
     .checkFileExistenceHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::checkFileExistence, this ) )
     .createFileHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::createFile, this ) )
+    .fileSizeHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::fileSize, this ) )
     .writeFileHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::writeFile, this ) )
     .readFileHandler( std::bind_front( &FilesystemMediaSetCompilerImpl::readFile, this ) );
 }
@@ -115,6 +121,36 @@ FilesystemMediaSetCompiler& FilesystemMediaSetCompilerImpl::mediaSetName( std::s
   return *this;
 }
 
+FilesystemMediaSetCompiler& FilesystemMediaSetCompilerImpl::statistics( MediaSetStatisticsPtr statistics )
+{
+  assert( mediaSetCompilerV );
+  statisticsV = statistics;
+  mediaSetCompilerV->statistics( std::move( statistics ) );
+  return *this;
+}
+
+FilesystemMediaSetCompiler& FilesystemMediaSetCompilerImpl::progressHandler( ByteProgressHandler progressHandler )
+{
+  assert( mediaSetCompilerV );
+  mediaSetCompilerV->progressHandler( std::move( progressHandler ) );
+  return *this;
+}
+
+FilesystemMediaSetCompiler& FilesystemMediaSetCompilerImpl::stopToken( std::stop_token stopToken )
+{
+  assert( mediaSetCompilerV );
+  stopTokenV = stopToken;
+  mediaSetCompilerV->stopToken( std::move( stopToken ) );
+  return *this;
+}
+
+FilesystemMediaSetCompiler& FilesystemMediaSetCompilerImpl::filePlacementStrategy(
+  const FilePlacementStrategy filePlacementStrategy )
+{
+  filePlacementStrategyV = filePlacementStrategy;
+  return *this;
+}
+
 MediaSetPaths FilesystemMediaSetCompilerImpl::operator()()
 {
   if ( sourceBasePathV.empty() || filePathMappingV.empty() || outputBasePathV.empty() || mediaSetNameV.empty() )
@@ -124,6 +160,21 @@ MediaSetPaths FilesystemMediaSetCompilerImpl::operator()()
   }
 
   mediaSetBaseDirectoryV = outputBasePathV / mediaSetNameV;
+  createdPathsV.clear();
+
+  // directories created for the media set base directory (outermost first)
+  std::vector< std::filesystem::path > createdDirectories{};
+  for ( auto directory{ mediaSetBaseDirectoryV };
+    !directory.empty() && !std::filesystem::exists( directory );
+    directory = directory.parent_path() )
+  {
+    createdDirectories.insert( createdDirectories.begin(), directory );
+
+    if ( directory == directory.parent_path() )
+    {
+      break;
+    }
+  }
 
   std::error_code err{};
   std::filesystem::create_directories( mediaSetBaseDirectoryV, err );
@@ -134,11 +185,40 @@ MediaSetPaths FilesystemMediaSetCompilerImpl::operator()()
       << boost::errinfo_file_name{ mediaSetBaseDirectoryV.string() } );
   }
 
+  createdPathsV = std::move( createdDirectories );
+
   assert( mediaSetCompilerV );
-  ( *mediaSetCompilerV )();
+
+  try
+  {
+    ( *mediaSetCompilerV )();
+  }
+  catch ( ... )
+  {
+    // remove everything created by this compilation - existing files and directories are kept
+    SPDLOG_INFO( "Compilation failed - remove created files of '{}'", mediaSetBaseDirectoryV.string() );
+
+    for ( const auto &createdPath : createdPathsV | std::views::reverse )
+    {
+      std::filesystem::remove( createdPath, err );
+    }
+
+    createdPathsV.clear();
+
+    throw;
+  }
+
+  createdPathsV.clear();
+
   return { mediaSetNameV, mediaPathsV };
 }
 
+const Media::CheckValues& FilesystemMediaSetCompilerImpl::checkValues() const
+{
+  assert( mediaSetCompilerV );
+  return mediaSetCompilerV->checkValues();
+}
+
 std::filesystem::path FilesystemMediaSetCompilerImpl::mediumPath( const Arinc665::MediumNumber &mediumNumber ) const
 {
   const auto mediumPath{ mediaPathsV.find( mediumNumber ) };
@@ -158,7 +238,10 @@ void FilesystemMediaSetCompilerImpl::createMedium( const MediumNumber &mediumNum
 
   SPDLOG_TRACE( "Create medium directory '{}'", mPath.string() );
 
-  std::filesystem::create_directory( mPath );
+  if ( std::filesystem::create_directory( mPath ) )
+  {
+    createdPathsV.emplace_back( mPath );
+  }
 }
 
 void FilesystemMediaSetCompilerImpl::createDirectory(
@@ -173,7 +256,10 @@ void FilesystemMediaSetCompilerImpl::createDirectory(
     directory->path().string(),
     directoryPath.string() );
 
-  std::filesystem::create_directory( directoryPath );
+  if ( std::filesystem::create_directory( directoryPath ) )
+  {
+    createdPathsV.emplace_back( std::move( directoryPath ) );
+  }
 }
 
 bool FilesystemMediaSetCompilerImpl::checkFileExistence( const Media::ConstFilePtr &file )
@@ -195,7 +281,24 @@ bool FilesystemMediaSetCompilerImpl::checkFileExistence( const Media::ConstFileP
   return std::filesystem::is_regular_file( filePath );
 }
 
-void FilesystemMediaSetCompilerImpl::createFile( const Media::ConstFilePtr &file )
+std::uint64_t FilesystemMediaSetCompilerImpl::fileSize( const Media::ConstFilePtr &file ) const
+{
+  const auto fileIt{ filePathMappingV.find( file ) };
+
+  if ( fileIt == filePathMappingV.end() )
+  {
+    return 0U;
+  }
+
+  std::error_code err{};
+  const auto size{ std::filesystem::file_size( ( sourceBasePathV / fileIt->second ).lexically_normal(), err ) };
+
+  return err ? 0U : size;
+}
+
+void FilesystemMediaSetCompilerImpl::createFile(
+  const Media::ConstFilePtr &file,
+  const MediaSetCompiler::FileContentHandler &contentHandler )
 {
   // search the file
   const auto fileIt{ filePathMappingV.find( file ) };
@@ -210,10 +313,22 @@ void FilesystemMediaSetCompilerImpl::createFile( const Media::ConstFilePtr &file
   const auto sourceFilePath{ ( sourceBasePathV / fileIt->second ).lexically_normal() };
   const auto destinationFilePath{ mediumPath( file->effectiveMediumNumber() ) / file->path().relative_path() };
 
-  SPDLOG_TRACE( "Copy file from '{}' to '{}'", sourceFilePath.string(), destinationFilePath.string() );
+  SPDLOG_TRACE( "Place file from '{}' to '{}'", sourceFilePath.string(), destinationFilePath.string() );
+
+  const auto start{ std::chrono::steady_clock::now() };
 
-  // copy file
-  std::filesystem::copy( sourceFilePath, destinationFilePath );
+  // place file (reflink, hardlink or copy) - the content is passed to the compiler for CRC and check value calculation
+  FilePlacement_placeFile( sourceFilePath, destinationFilePath, filePlacementStrategyV, stopTokenV, contentHandler );
+  createdPathsV.emplace_back( destinationFilePath );
+
+  if ( statisticsV )
+  {
+    statisticsV->fileWritten(
+      file->effectiveMediumNumber(),
+      file->path(),
+      std::filesystem::file_size( destinationFilePath ),
+      std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ) );
+  }
 }
 
 void FilesystemMediaSetCompilerImpl::writeFile(
@@ -243,6 +358,8 @@ void FilesystemMediaSetCompilerImpl::writeFile(
       << boost::errinfo_file_name{ filePath.string() } );
   }
 
+  createdPathsV.emplace_back( filePath );
+
   // write the data to the buffer
   fileStream.write( reinterpret_cast< const char * >( file.data() ), static_cast< std::streamsize >( file.size() ) );
 }
@@ -252,35 +369,11 @@ Helper::RawData FilesystemMediaSetCompilerImpl::readFile(
   const std::filesystem::path &path )
 {
   // check medium number
-  auto filePath{ mediumPath( mediumNumber ) / path.relative_path() };
+  const auto filePath{ mediumPath( mediumNumber ) / path.relative_path() };
 
   SPDLOG_TRACE( "Read file [{}]:'{}' ('{}')", mediumNumber, path.string(), filePath.string() );
 
-  // check the existence of the file
-  if ( !std::filesystem::is_regular_file( filePath ) )
-  {
-    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "File not found" }
-      << boost::errinfo_file_name{ filePath.string() } );
-  }
-
-  Helper::RawData data( std::filesystem::file_size( filePath ) );
-
-  // load file
-  std::ifstream file{ filePath.string().c_str(), std::ifstream::binary | std::ifstream::in };
-
-  if ( !file.is_open() )
-  {
-    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "Error opening files" }
-      << boost::errinfo_file_name{ filePath.string() } );
-  }
-
-  // read the data to the buffer
-  file.read( reinterpret_cast< char * >( std::data( data ) ), static_cast< std::streamsize >( std::size( data ) ) );
-
-  // return the buffer
-  return data;
+  return FileReader_readFile( filePath );
 }
 
 }
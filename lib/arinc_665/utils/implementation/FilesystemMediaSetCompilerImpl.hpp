@@ -14,9 +14,13 @@
 #define ARINC_665_UTILS_IMPLEMENTATION_FILESYSTEMMEDIASETCOMPILERIMPL_HPP
 
 #include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+#include <arinc_665/utils/MediaSetCompiler.hpp>
 
 #include <helper/RawData.hpp>
 
+#include <filesystem>
+#include <vector>
+
 namespace Arinc665::Utils {
 
 /**
@@ -56,11 +60,26 @@ class FilesystemMediaSetCompilerImpl final : public FilesystemMediaSetCompiler
     //! @copydoc FilesystemMediaSetCompiler::mediaSetName()
     FilesystemMediaSetCompiler &mediaSetName( std::string mediaSetName ) override;
 
+    //! @copydoc FilesystemMediaSetCompiler::statistics()
+    FilesystemMediaSetCompiler &statistics( MediaSetStatisticsPtr statistics ) override;
+
+    //! @copydoc FilesystemMediaSetCompiler::progressHandler()
+    FilesystemMediaSetCompiler &progressHandler( ByteProgressHandler progressHandler ) override;
+
+    //! @copydoc FilesystemMediaSetCompiler::stopToken()
+    FilesystemMediaSetCompiler &stopToken( std::stop_token stopToken ) override;
+
+    //! @copydoc FilesystemMediaSetCompiler::filePlacementStrategy()
+    FilesystemMediaSetCompiler &filePlacementStrategy( FilePlacementStrategy filePlacementStrategy ) override;
+
     /**
      * @brief Entry-point of the Filesystem ARINC 665 Media Set Compiler.
      ***/
     [[nodiscard]] MediaSetPaths operator()() override;
 
+    //! @copydoc FilesystemMediaSetCompiler::checkValues()
+    [[nodiscard]] const Media::CheckValues& checkValues() const override;
+
   private:
     /**
      * @brief Returns the medium path.
@@ -100,15 +119,27 @@ class FilesystemMediaSetCompilerImpl final : public FilesystemMediaSetCompiler
      **/
     [[nodiscard]] bool checkFileExistence( const Media::ConstFilePtr &file );
 
+    /**
+     * @brief File Size Handler.
+     *
+     * @param[in] file
+     *   File
+     *
+     * @return Size of the source file of @p file, or 0 if not mapped.
+     **/
+    [[nodiscard]] std::uint64_t fileSize( const Media::ConstFilePtr &file ) const;
+
     /**
      * @brief Create File Handler.
      *
-     * Copies the file from source to destination.
+     * Places the file from source to destination and passes its content to @p contentHandler.
      *
      * @param[in] file
      *   File to Create
+     * @param[in] contentHandler
+     *   Handler called with the file content.
      **/
-    void createFile( const Media::ConstFilePtr &file );
+    void createFile( const Media::ConstFilePtr &file, const MediaSetCompiler::FileContentHandler &contentHandler );
 
     /**
      * @brief Write File Handler
@@ -151,6 +182,14 @@ class FilesystemMediaSetCompilerImpl final : public FilesystemMediaSetCompiler
     std::filesystem::path mediaSetBaseDirectoryV;
     //! Generated Media Paths
     MediaPaths mediaPathsV;
+    //! Files and Directories created by the current Compilation (in order of creation) - removed on failure
+    std::vector< std::filesystem::path > createdPathsV;
+    //! Statistics
+    MediaSetStatisticsPtr statisticsV;
+    //! Stop Token
+    std::stop_token stopTokenV;
+    //! File Placement Strategy
+    FilePlacementStrategy filePlacementStrategyV{ FilePlacementStrategy::Reflink };
 };
 
 }
@@ -11,16 +11,34 @@
  **/
 
 #include "FilesystemMediaSetCopierImpl.hpp"
+#include "FilePlacement.hpp"
+#include "FileReader.hpp"
+
+#include <arinc_665/utils/ByteProgressTracker.hpp>
 
 #include <arinc_665/files/MediaSetInformation.hpp>
+#include <arinc_665/files/FileListFile.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
 
+#include <arinc_645/Arinc645Crc.hpp>
+#include <arinc_645/CheckValueGenerator.hpp>
+
 #include <helper/Exception.hpp>
 
+#include <spdlog/spdlog.h>
+
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
 #include <format>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace Arinc665::Utils {
 
@@ -42,6 +60,49 @@ FilesystemMediaSetCopier &FilesystemMediaSetCopierImpl::mediaSetName( std::strin
   return *this;
 }
 
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::filePlacementStrategy(
+  const FilePlacementStrategy filePlacementStrategy )
+{
+  filePlacementStrategyV = filePlacementStrategy;
+  return *this;
+}
+
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::checkFileIntegrity( const bool checkFileIntegrity )
+{
+  checkFileIntegrityV = checkFileIntegrity;
+  return *this;
+}
+
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::payloadStore( std::filesystem::path payloadStore )
+{
+  payloadStoreV.reset();
+
+  if ( !payloadStore.empty() )
+  {
+    payloadStoreV.emplace( std::move( payloadStore ) );
+  }
+
+  return *this;
+}
+
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::threadsPerMedium( const std::size_t threadsPerMedium )
+{
+  threadsPerMediumV = threadsPerMedium;
+  return *this;
+}
+
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::progressHandler( ByteProgressHandler progressHandler )
+{
+  progressHandlerV = std::move( progressHandler );
+  return *this;
+}
+
+FilesystemMediaSetCopier& FilesystemMediaSetCopierImpl::stopToken( std::stop_token stopToken )
+{
+  stopTokenV = std::move( stopToken );
+  return *this;
+}
+
 MediaSetPaths FilesystemMediaSetCopierImpl::operator()()
 {
   if ( mediaPathsV.empty() || outputBasePathV.empty() )
@@ -72,23 +133,316 @@ MediaSetPaths FilesystemMediaSetCopierImpl::operator()()
       << boost::errinfo_file_name{ mediaSetBasePath.string() } );
   }
 
-  // iterate over media
-  MediaPaths destinationMediaPaths{};
-  for ( auto const &[ mediumNumber, mediumPath ] : mediaPathsV )
+  try
+  {
+    // prepare media (create directories and collect files)
+    MediaPaths destinationMediaPaths{};
+    std::vector< FileJobs > media{};
+    media.reserve( mediaPathsV.size() );
+
+    for ( auto const &[ mediumNumber, mediumPath ] : mediaPathsV )
+    {
+      auto destinationMediumDir{ std::format( "MEDIUM_{:03d}", static_cast< uint8_t >( mediumNumber ) ) };
+
+      const auto destinationMediumPath{ mediaSetBasePath / destinationMediumDir };
+      std::filesystem::create_directory( destinationMediumPath );
+
+      media.emplace_back( prepareMedium( mediumNumber, mediumPath, destinationMediumPath ) );
+
+      // store medium destination path
+      destinationMediaPaths.try_emplace( mediumNumber, destinationMediumDir );
+    }
+
+    // place the files of all media concurrently
+    placeFiles( media );
+
+    return { mediaSetNameV, destinationMediaPaths };
+  }
+  catch ( ... )
+  {
+    // remove the partially copied media set
+    SPDLOG_INFO( "Copy failed - remove '{}'", mediaSetBasePath.string() );
+    std::error_code err{};
+    std::filesystem::remove_all( mediaSetBasePath, err );
+
+    throw;
+  }
+}
+
+FilesystemMediaSetCopierImpl::FileJobs FilesystemMediaSetCopierImpl::prepareMedium(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &mediumPath,
+  const std::filesystem::path &destinationMediumPath ) const
+{
+  // files to be checked or stored while copying
+  auto mediumFiles{
+    ( checkFileIntegrityV || payloadStoreV ) ? listedFiles( mediumNumber, mediumPath ) : ListedFiles{} };
+
+  // a single thread reads the files in the order of their placement on the medium
+  const bool sequential{ threadsPerMediumV <= 1U };
+
+  FileJobs fileJobs{};
+
+  // directories are created, files are collected
+  for ( const auto &entry : std::filesystem::recursive_directory_iterator{ mediumPath } )
+  {
+    const auto relativePath{ entry.path().lexically_relative( mediumPath ) };
+    auto destinationPath{ destinationMediumPath / relativePath };
+
+    if ( entry.is_directory() )
+    {
+      std::filesystem::create_directory( destinationPath );
+      continue;
+    }
+
+    if ( !entry.is_regular_file() )
+    {
+      continue;
+    }
+
+    std::optional< Files::FileInfo > fileInfo{};
+    if ( auto fileIt{ mediumFiles.find( relativePath ) }; fileIt != mediumFiles.end() )
+    {
+      fileInfo = std::move( fileIt->second );
+      mediumFiles.erase( fileIt );
+    }
+
+    fileJobs.emplace_back( FileJob{
+      .sourceFilePath = entry.path(),
+      .destinationFilePath = std::move( destinationPath ),
+      .size = entry.file_size(),
+      .location = sequential ? FileReader_location( entry.path() ) : 0U,
+      .fileInfo = std::move( fileInfo ) } );
+  }
+
+  // all listed files must be present
+  if ( !mediumFiles.empty() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+      << Helper::AdditionalInfo{ "File of list of files not found" }
+      << boost::errinfo_file_name{ mediumFiles.begin()->second.path().string() } );
+  }
+
+  if ( sequential )
+  {
+    std::ranges::stable_sort( fileJobs, std::ranges::less{}, &FileJob::location );
+  }
+  else
+  {
+    // largest files first to balance the work of the threads
+    std::ranges::stable_sort( fileJobs, std::ranges::greater{}, &FileJob::size );
+  }
+
+  return fileJobs;
+}
+
+void FilesystemMediaSetCopierImpl::placeFiles( const std::vector< FileJobs > &media ) const
+{
+  ByteProgressTracker progress{ progressHandlerV, stopTokenV };
+  std::mutex progressMutex{};
+
+  if ( progress.reporting() )
+  {
+    std::uint64_t totalBytes{ 0U };
+    for ( const auto &fileJobs : media )
+    {
+      for ( const auto &fileJob : fileJobs )
+      {
+        totalBytes += fileJob.size;
+      }
+    }
+
+    progress.totalBytes( totalBytes );
+  }
+
+  // stop the other threads on failure or on external cancellation
+  std::stop_source stopSource{};
+  const std::stop_callback stopCallback{ stopTokenV, [ &stopSource ]() { stopSource.request_stop(); } };
+
+  std::mutex exceptionMutex{};
+  std::exception_ptr exception{};
+
+  // one file index per medium - every medium is processed by its own threads
+  std::vector< std::atomic_size_t > nextFileJobs( media.size() );
+
+  const auto worker{ [ & ]( const FileJobs &fileJobs, std::atomic_size_t &nextFileJob ) {
+    try
+    {
+      for ( auto index{ nextFileJob++ }; ( index < fileJobs.size() ) && !stopSource.stop_requested();
+        index = nextFileJob++ )
+      {
+        const auto &fileJob{ fileJobs[ index ] };
+
+        placeFile( fileJob, stopSource.get_token() );
+
+        // copied files are accounted as a whole
+        const std::lock_guard lock{ progressMutex };
+        progress.currentFile( fileJob.sourceFilePath );
+        progress.advance( fileJob.size );
+      }
+    }
+    catch ( ... )
+    {
+      const std::lock_guard lock{ exceptionMutex };
+      // keep the first exception - following ones are normally caused by the cancellation
+      if ( !exception )
+      {
+        exception = std::current_exception();
+      }
+      stopSource.request_stop();
+    }
+  } };
+
+  {
+    std::vector< std::jthread > workers{};
+    for ( std::size_t medium{ 0U }; medium < media.size(); ++medium )
+    {
+      const auto threads{ std::min( std::max( threadsPerMediumV, std::size_t{ 1U } ), media[ medium ].size() ) };
+
+      for ( std::size_t thread{ 0U }; thread < threads; ++thread )
+      {
+        workers.emplace_back( worker, std::cref( media[ medium ] ), std::ref( nextFileJobs[ medium ] ) );
+      }
+    }
+  }
+
+  if ( exception )
+  {
+    std::rethrow_exception( exception );
+  }
+
+  progress.checkCancelled();
+  progress.finish();
+}
+
+void FilesystemMediaSetCopierImpl::placeFile( const FileJob &fileJob, const std::stop_token &stopToken ) const
+{
+  if ( fileJob.fileInfo )
+  {
+    placeListedFile( fileJob, stopToken );
+    return;
+  }
+
+  FilePlacement_placeFile( fileJob.sourceFilePath, fileJob.destinationFilePath, filePlacementStrategyV, stopToken );
+}
+
+FilesystemMediaSetCopierImpl::ListedFiles FilesystemMediaSetCopierImpl::listedFiles(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &mediumPath )
+{
+  const auto filePath{ mediumPath / ListOfFilesName };
+
+  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
+
+  if ( !file.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+      << Helper::AdditionalInfo{ "Error opening file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  Helper::RawData rawFile( std::filesystem::file_size( filePath ) );
+  file.read( reinterpret_cast< char * >( rawFile.data() ), static_cast< std::streamsize >( rawFile.size() ) );
+
+  if ( !file )
   {
-    auto destinationMediumDir{ std::format( "MEDIUM_{:03d}", static_cast< uint8_t >( mediumNumber ) ) };
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+      << Helper::AdditionalInfo{ "Error reading file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
 
-    // copy medium
-    std::filesystem::copy(
-      mediumPath,
-      mediaSetBasePath / destinationMediumDir,
-      std::filesystem::copy_options::recursive );
+  // must outlive the loop - files() refers into it
+  Files::FileListFile fileListFile{ rawFile };
+  ListedFiles mediumFiles{};
 
-    // store medium destination path
-    destinationMediaPaths.try_emplace( mediumNumber, destinationMediumDir );
+  for ( auto &fileInfo : fileListFile.files() )
+  {
+    if ( fileInfo.memberSequenceNumber != mediumNumber )
+    {
+      continue;
+    }
+
+    auto relativePath{ fileInfo.path().relative_path() };
+    mediumFiles.try_emplace( std::move( relativePath ), std::move( fileInfo ) );
+  }
+
+  return mediumFiles;
+}
+
+void FilesystemMediaSetCopierImpl::placeListedFile( const FileJob &fileJob, const std::stop_token &stopToken ) const
+{
+  const auto &fileInfo{ *fileJob.fileInfo };
+  const auto checkValueType{ fileInfo.checkValue.type() };
+
+  // known payload files are linked without copying or reading them
+  if ( payloadStoreV
+    && ( PayloadStore::KeyType == checkValueType )
+    && payloadStoreV->link( fileInfo.checkValue, fileInfo.crc, fileJob.destinationFilePath ) )
+  {
+    return;
   }
 
-  return { mediaSetNameV, destinationMediaPaths };
+  Arinc645::Arinc645Crc16 crc{};
+
+  // Check Value of the list of files - only calculated, if the integrity is checked
+  auto checkValueGenerator{ Arinc645::CheckValueGenerator::create(
+    checkFileIntegrityV ? checkValueType : Arinc645::CheckValueType::NotUsed ) };
+  assert( checkValueGenerator );
+
+  // Payload Store Key - reuses the Check Value, if it is of the same type
+  const bool separateKey{
+    payloadStoreV && ( checkValueGenerator->type() != PayloadStore::KeyType ) };
+  auto keyGenerator{ Arinc645::CheckValueGenerator::create(
+    separateKey ? PayloadStore::KeyType : Arinc645::CheckValueType::NotUsed ) };
+  assert( keyGenerator );
+
+  // digests are calculated on the copied buffers
+  FilePlacement_placeFile(
+    fileJob.sourceFilePath,
+    fileJob.destinationFilePath,
+    filePlacementStrategyV,
+    stopToken,
+    [ & ]( const Helper::ConstRawDataSpan chunk )
+    {
+      crc.process_bytes( chunk.data(), chunk.size() );
+
+      if ( Arinc645::CheckValueType::NotUsed != checkValueGenerator->type() )
+      {
+        checkValueGenerator->process( std::as_bytes( chunk ) );
+      }
+
+      if ( separateKey )
+      {
+        keyGenerator->process( std::as_bytes( chunk ) );
+      }
+    } );
+
+  const auto checkValue{ checkValueGenerator->checkValue() };
+
+  if ( checkFileIntegrityV )
+  {
+    if ( crc.checksum() != fileInfo.crc )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+        << Helper::AdditionalInfo{ "CRC of file invalid" }
+        << boost::errinfo_file_name{ fileInfo.path().string() } );
+    }
+
+    if ( ( Arinc645::CheckValueType::NotUsed != checkValueType ) && ( fileInfo.checkValue != checkValue ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+        << Helper::AdditionalInfo{ "Check Value of file invalid" }
+        << boost::errinfo_file_name{ fileInfo.path().string() } );
+    }
+  }
+
+  if ( payloadStoreV )
+  {
+    payloadStoreV->add(
+      fileJob.destinationFilePath,
+      separateKey ? keyGenerator->checkValue() : checkValue,
+      crc.checksum() );
+  }
 }
 
 }
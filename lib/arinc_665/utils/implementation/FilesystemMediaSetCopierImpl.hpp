@@ -14,6 +14,16 @@
 #define ARINC_665_UTILS_IMPLEMENTATION_FILESYSTEMMEDIASETCOPIERIMPL_HPP
 
 #include <arinc_665/utils/FilesystemMediaSetCopier.hpp>
+#include <arinc_665/utils/implementation/PayloadStore.hpp>
+
+#include <arinc_665/files/FileInfo.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <stop_token>
+#include <vector>
 
 namespace Arinc665::Utils {
 
@@ -33,15 +43,149 @@ class FilesystemMediaSetCopierImpl final : public FilesystemMediaSetCopier
     //! @copydoc FilesystemMediaSetCopier::mediaSetName()
     FilesystemMediaSetCopier& mediaSetName( std::string mediaSetName ) override;
 
+    //! @copydoc FilesystemMediaSetCopier::filePlacementStrategy()
+    FilesystemMediaSetCopier& filePlacementStrategy( FilePlacementStrategy filePlacementStrategy ) override;
+
+    //! @copydoc FilesystemMediaSetCopier::checkFileIntegrity()
+    FilesystemMediaSetCopier& checkFileIntegrity( bool checkFileIntegrity ) override;
+
+    //! @copydoc FilesystemMediaSetCopier::payloadStore()
+    FilesystemMediaSetCopier& payloadStore( std::filesystem::path payloadStore ) override;
+
+    //! @copydoc FilesystemMediaSetCopier::threadsPerMedium()
+    FilesystemMediaSetCopier& threadsPerMedium( std::size_t threadsPerMedium ) override;
+
+    //! @copydoc FilesystemMediaSetCopier::progressHandler()
+    FilesystemMediaSetCopier& progressHandler( ByteProgressHandler progressHandler ) override;
+
+    //! @copydoc FilesystemMediaSetCopier::stopToken()
+    FilesystemMediaSetCopier& stopToken( std::stop_token stopToken ) override;
+
     [[nodiscard]] MediaSetPaths operator()() override;
 
   private:
+    //! File Information of the List of Files by relative File Path
+    using ListedFiles = std::map< std::filesystem::path, Files::FileInfo >;
+
+    //! File to be placed
+    struct FileJob
+    {
+      //! Source File Path
+      std::filesystem::path sourceFilePath;
+      //! Destination File Path
+      std::filesystem::path destinationFilePath;
+      //! File Size
+      std::uintmax_t size;
+      //! Physical Location of the Source File (only if the medium is copied by one thread)
+      std::uint64_t location;
+      //! File Information from the List of Files (only if the file integrity is checked or a payload store is used)
+      std::optional< Files::FileInfo > fileInfo;
+    };
+
+    //! Files to be placed
+    using FileJobs = std::vector< FileJob >;
+
+    /**
+     * @brief Prepares the Copy of the given Medium.
+     *
+     * Creates the destination directories and collects the files.
+     * When the medium is copied by one thread, the files are ordered by their physical location on the source medium,
+     * which avoids seeks on rotational and other slow media.
+     * Otherwise, they are ordered by descending size to balance the work of the threads.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number.
+     * @param[in] mediumPath
+     *   Source Medium Path.
+     * @param[in] destinationMediumPath
+     *   Destination Medium Path.
+     *
+     * @return Files to be placed.
+     *
+     * @throw Arinc665Exception
+     *   When a file listed within the list of files is missing.
+     **/
+    [[nodiscard]] FileJobs prepareMedium(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &mediumPath,
+      const std::filesystem::path &destinationMediumPath ) const;
+
+    /**
+     * @brief Places the Files of all Media concurrently.
+     *
+     * Each medium is processed by @ref threadsPerMediumV threads.
+     * On failure, the other threads are stopped and the first exception is rethrown.
+     *
+     * @param[in] media
+     *   Files to be placed for each medium.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
+     **/
+    void placeFiles( const std::vector< FileJobs > &media ) const;
+
+    /**
+     * @brief Places the given File.
+     *
+     * @param[in] fileJob
+     *   File to be placed.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     **/
+    void placeFile( const FileJob &fileJob, const std::stop_token &stopToken ) const;
+
+    /**
+     * @brief Decodes the List of Files of the given Medium.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number.
+     * @param[in] mediumPath
+     *   Medium Path.
+     *
+     * @return Information of the files located on the medium.
+     *
+     * @throw Arinc665Exception
+     *   When the list of files cannot be read or decoded.
+     **/
+    [[nodiscard]] static ListedFiles listedFiles(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &mediumPath );
+
+    /**
+     * @brief Places a File listed within the List of Files.
+     *
+     * The CRC, the Check Value and the payload store key are calculated while copying.
+     * If requested, CRC and Check Value are checked against the list of files.
+     * If a payload store is used, known files are linked and the other ones are added to the store.
+     *
+     * @param[in] fileJob
+     *   File to be placed.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     *
+     * @throw Arinc665Exception
+     *   When the CRC or Check Value of the file is invalid.
+     **/
+    void placeListedFile( const FileJob &fileJob, const std::stop_token &stopToken ) const;
+
     //! Media Paths
     MediaPaths mediaPathsV;
     //! Output Base Path
     std::filesystem::path outputBasePathV;
     //! Media Set Name
     std::string mediaSetNameV;
+    //! File Placement Strategy
+    FilePlacementStrategy filePlacementStrategyV{ FilePlacementStrategy::Reflink };
+    //! Check File Integrity while copying
+    bool checkFileIntegrityV{ false };
+    //! Payload Store
+    std::optional< PayloadStore > payloadStoreV;
+    //! Number of Threads per Medium
+    std::size_t threadsPerMediumV{ 1U };
+    //! Progress Handler
+    ByteProgressHandler progressHandlerV;
+    //! Stop Token
+    std::stop_token stopTokenV;
 };
 
 }
@@ -12,6 +12,8 @@
 
 #include "FilesystemMediaSetDecompilerImpl.hpp"
 
+#include "FileReader.hpp"
+
 #include <arinc_665/utils/MediaSetDecompiler.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
@@ -23,7 +25,6 @@
 #include <boost/exception/all.hpp>
 
 #include <cassert>
-#include <fstream>
 
 namespace Arinc665::Utils {
 
@@ -33,7 +34,8 @@ FilesystemMediaSetDecompilerImpl::FilesystemMediaSetDecompilerImpl() :
   assert( mediaSetDecompilerV );
   mediaSetDecompilerV
     ->fileSizeHandler( std::bind_front( &FilesystemMediaSetDecompilerImpl::getFileSize, this ) )
-    .readFileHandler( std::bind_front( &FilesystemMediaSetDecompilerImpl::readFile, this ) );
+    .readFilesHandler( std::bind_front( &FilesystemMediaSetDecompilerImpl::readFiles, this ) )
+    .fileLocationHandler( std::bind_front( &FilesystemMediaSetDecompilerImpl::fileLocation, this ) );
 }
 
 FilesystemMediaSetDecompilerImpl::~FilesystemMediaSetDecompilerImpl() = default;
@@ -54,15 +56,61 @@ FilesystemMediaSetDecompiler& FilesystemMediaSetDecompilerImpl::checkFileIntegri
   return *this;
 }
 
+FilesystemMediaSetDecompiler& FilesystemMediaSetDecompilerImpl::checkListedFiles(
+  const bool checkListedFiles ) noexcept
+{
+  assert( mediaSetDecompilerV );
+  mediaSetDecompilerV->checkListedFiles( checkListedFiles );
+  return *this;
+}
+
+FilesystemMediaSetDecompiler& FilesystemMediaSetDecompilerImpl::lazy( const bool lazy ) noexcept
+{
+  assert( mediaSetDecompilerV );
+  mediaSetDecompilerV->lazy( lazy );
+  return *this;
+}
+
 FilesystemMediaSetDecompiler &FilesystemMediaSetDecompilerImpl::mediaPaths( MediaPaths mediaPaths )
 {
   mediaPathsV = std::move( mediaPaths );
   return *this;
 }
 
+FilesystemMediaSetDecompiler &FilesystemMediaSetDecompilerImpl::statistics( MediaSetStatisticsPtr statistics )
+{
+  assert( mediaSetDecompilerV );
+  mediaSetDecompilerV->statistics( std::move( statistics ) );
+  return *this;
+}
+
+FilesystemMediaSetDecompiler &FilesystemMediaSetDecompilerImpl::byteProgressHandler(
+  ByteProgressHandler byteProgressHandler )
+{
+  assert( mediaSetDecompilerV );
+  mediaSetDecompilerV->byteProgressHandler( std::move( byteProgressHandler ) );
+  return *this;
+}
+
+FilesystemMediaSetDecompiler &FilesystemMediaSetDecompilerImpl::stopToken( std::stop_token stopToken )
+{
+  assert( mediaSetDecompilerV );
+  stopTokenV = stopToken;
+  mediaSetDecompilerV->stopToken( std::move( stopToken ) );
+  return *this;
+}
+
 MediaSetDecompilerResult FilesystemMediaSetDecompilerImpl::operator()()
 {
   assert( mediaSetDecompilerV );
+
+  // does not reference this instance - lazily decompiled media sets read files after the decompiler has been destroyed
+  mediaSetDecompilerV->readFileHandler(
+    [ mediaPaths{ mediaPathsV } ]( const MediumNumber &mediumNumber, const std::filesystem::path &path )
+    {
+      return FileReader_readFile( filePath( mediaPaths, mediumNumber, path ) );
+    } );
+
   return ( *mediaSetDecompilerV )();
 }
 
@@ -70,17 +118,7 @@ size_t FilesystemMediaSetDecompilerImpl::getFileSize(
   const MediumNumber &mediumNumber,
   const std::filesystem::path &path )
 {
-  const auto mediumPath{ mediaPathsV.find( mediumNumber ) };
-
-  if ( mediaPathsV.end() == mediumPath )
-  {
-    BOOST_THROW_EXCEPTION(
-      Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "Medium not found" }
-      << boost::errinfo_file_name{ path.string() } );
-  }
-
-  const auto filePath{ mediumPath->second / path.relative_path() };
+  const auto filePath{ this->filePath( mediaPathsV, mediumNumber, path ) };
 
   if ( !std::filesystem::is_regular_file( filePath ) )
   {
@@ -93,54 +131,50 @@ size_t FilesystemMediaSetDecompilerImpl::getFileSize(
   return std::filesystem::file_size( filePath );
 }
 
-Helper::RawData FilesystemMediaSetDecompilerImpl::readFile(
+std::vector< Helper::RawData > FilesystemMediaSetDecompilerImpl::readFiles(
   const MediumNumber &mediumNumber,
-  const std::filesystem::path &path )
+  const std::span< const std::filesystem::path > paths )
 {
-  const auto mediumPath{ mediaPathsV.find( mediumNumber ) };
+  std::vector< std::filesystem::path > filePaths{};
+  filePaths.reserve( paths.size() );
 
-  if ( mediaPathsV.end() == mediumPath )
+  for ( const auto &path : paths )
   {
-    BOOST_THROW_EXCEPTION(
-      Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "Medium not found" }
-      << boost::errinfo_file_name{ path.string() } );
+    filePaths.emplace_back( filePath( mediaPathsV, mediumNumber, path ) );
   }
 
-  auto filePath{ mediumPath->second / path.relative_path() };
+  return FileReader_readFiles( filePaths, FileReader_DefaultLanes, stopTokenV );
+}
 
-  // check existence of the file
-  if ( !std::filesystem::is_regular_file( filePath ) )
+std::uint64_t FilesystemMediaSetDecompilerImpl::fileLocation(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path ) const
+{
+  // unknown media are reported, when the file is read
+  if ( !mediaPathsV.contains( mediumNumber ) )
   {
-    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "File not found" }
-      << boost::errinfo_file_name{ filePath.string() } );
+    return 0U;
   }
 
-  Helper::RawData data( std::filesystem::file_size( filePath ) );
-
-  // load file
-  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
-
-  if ( !file.is_open() )
-  {
-    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "Error opening file" }
-      << boost::errinfo_file_name{ filePath.string() } );
-  }
+  return FileReader_location( filePath( mediaPathsV, mediumNumber, path ) );
+}
 
-  // read the data to the buffer
-  file.read( reinterpret_cast< char * >( data.data() ), static_cast< std::streamsize >( data.size() ) );
+std::filesystem::path FilesystemMediaSetDecompilerImpl::filePath(
+  const MediaPaths &mediaPaths,
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path )
+{
+  const auto mediumPath{ mediaPaths.find( mediumNumber ) };
 
-  if ( file.bad() || ( file.gcount() != static_cast< std::streamsize >( data.size() ) ) )
+  if ( mediaPaths.end() == mediumPath )
   {
-    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
-      << Helper::AdditionalInfo{ "Error reading file" }
-      << boost::errinfo_file_name{ filePath.string() } );
+    BOOST_THROW_EXCEPTION(
+      Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Medium not found" }
+      << boost::errinfo_file_name{ path.string() } );
   }
 
-  // return the buffer
-  return data;
+  return mediumPath->second / path.relative_path();
 }
 
 }
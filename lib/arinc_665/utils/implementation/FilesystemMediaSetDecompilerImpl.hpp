@@ -15,6 +15,11 @@
 
 #include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
 
+#include <cstdint>
+#include <span>
+#include <stop_token>
+#include <vector>
+
 namespace Arinc665::Utils {
 
 /**
@@ -36,9 +41,24 @@ class FilesystemMediaSetDecompilerImpl final : public FilesystemMediaSetDecompil
     //! @copydoc FilesystemMediaSetDecompiler::checkFileIntegrity()
     FilesystemMediaSetDecompiler& checkFileIntegrity( bool checkFileIntegrity ) noexcept override;
 
+    //! @copydoc FilesystemMediaSetDecompiler::checkListedFiles()
+    FilesystemMediaSetDecompiler& checkListedFiles( bool checkListedFiles ) noexcept override;
+
+    //! @copydoc FilesystemMediaSetDecompiler::lazy()
+    FilesystemMediaSetDecompiler& lazy( bool lazy ) noexcept override;
+
     //! @copydoc FilesystemMediaSetDecompiler::mediaPaths()
     FilesystemMediaSetDecompiler& mediaPaths( MediaPaths mediaPaths ) override;
 
+    //! @copydoc FilesystemMediaSetDecompiler::statistics()
+    FilesystemMediaSetDecompiler& statistics( MediaSetStatisticsPtr statistics ) override;
+
+    //! @copydoc FilesystemMediaSetDecompiler::byteProgressHandler()
+    FilesystemMediaSetDecompiler& byteProgressHandler( ByteProgressHandler byteProgressHandler ) override;
+
+    //! @copydoc FilesystemMediaSetDecompiler::stopToken()
+    FilesystemMediaSetDecompiler& stopToken( std::stop_token stopToken ) override;
+
     /**
      * @brief Entry-point of the ARINC 665 Media Set Importer.
      *
@@ -60,24 +80,62 @@ class FilesystemMediaSetDecompilerImpl final : public FilesystemMediaSetDecompil
     [[nodiscard]] size_t getFileSize( const Arinc665::MediumNumber &mediumNumber, const std::filesystem::path &path );
 
     /**
-     * @brief Reads the give file and returns the data.
+     * @brief Reads the given files concurrently and returns the data.
+     *
+     * @param[in] mediumNumber
+     *   Medium number.
+     * @param[in] paths
+     *   Paths of the files on Medium.
+     *
+     * @return Read file data in the order of @p paths.
+     *
+     * @throw Arinc665Exception
+     *   If a file does not exist or cannot be read.
+     **/
+    [[nodiscard]] std::vector< Helper::RawData > readFiles(
+      const MediumNumber &mediumNumber,
+      std::span< const std::filesystem::path > paths );
+
+    /**
+     * @brief Returns the physical Location of the given File.
+     *
+     * @param[in] mediumNumber
+     *   Medium number.
+     * @param[in] path
+     *   Path of the file on Medium.
+     *
+     * @return Physical location of the file, or 0 if unknown.
+     **/
+    [[nodiscard]] std::uint64_t fileLocation(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path ) const;
+
+    /**
+     * @brief Returns the Path of the given File within the Filesystem.
      *
+     * @param[in] mediaPaths
+     *   Media Paths.
      * @param[in] mediumNumber
      *   Medium number.
      * @param[in] path
      *   Path of the file on Medium.
      *
-     * @return Read file data.
+     * @return File Path.
      *
      * @throw Arinc665Exception
-     *   If the file does not exist or cannot be read.
+     *   If the medium is not known.
      **/
-    [[nodiscard]] Helper::RawData readFile( const MediumNumber &mediumNumber, const std::filesystem::path &path );
+    [[nodiscard]] static std::filesystem::path filePath(
+      const MediaPaths &mediaPaths,
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path );
 
     //! Media Set Decompiler
     MediaSetDecompilerPtr mediaSetDecompilerV;
     //! Media Paths
     MediaPaths mediaPathsV;
+    //! Stop Token
+    std::stop_token stopTokenV;
 };
 
 }
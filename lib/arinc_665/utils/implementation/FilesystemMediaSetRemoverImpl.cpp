@@ -11,11 +11,14 @@
  **/
 
 #include "FilesystemMediaSetRemoverImpl.hpp"
+#include "PayloadStore.hpp"
 
 #include <arinc_665/Arinc665Exception.hpp>
 
 #include <helper/Exception.hpp>
 
+#include <spdlog/spdlog.h>
+
 #include <boost/exception/all.hpp>
 
 namespace Arinc665::Utils {
@@ -26,6 +29,12 @@ FilesystemMediaSetRemover& FilesystemMediaSetRemoverImpl::mediaSetPaths( MediaSe
   return * this;
 }
 
+FilesystemMediaSetRemover& FilesystemMediaSetRemoverImpl::payloadStore( std::filesystem::path payloadStore )
+{
+  payloadStoreV = std::move( payloadStore );
+  return *this;
+}
+
 void FilesystemMediaSetRemoverImpl::operator()()
 {
   if ( mediaSetPathsV.second.empty() )
@@ -46,6 +55,13 @@ void FilesystemMediaSetRemoverImpl::operator()()
     // remove media set directories
     std::filesystem::remove_all( mediaSetPathsV.first );
   }
+
+  // free the payload objects, which have only been referenced by the removed media set
+  if ( !payloadStoreV.empty() )
+  {
+    const auto removedObjects{ PayloadStore{ payloadStoreV }.collectGarbage() };
+    SPDLOG_INFO( "Removed {} unreferenced payload objects", removedObjects );
+  }
 }
 
 }
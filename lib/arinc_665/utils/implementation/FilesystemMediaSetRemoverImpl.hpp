@@ -27,11 +27,16 @@ class FilesystemMediaSetRemoverImpl final : public FilesystemMediaSetRemover
     //! @copydoc FilesystemMediaSetRemover::mediaSetPaths()
     FilesystemMediaSetRemover& mediaSetPaths( MediaSetPaths mediaSetPaths ) override;
 
+    //! @copydoc FilesystemMediaSetRemover::payloadStore()
+    FilesystemMediaSetRemover& payloadStore( std::filesystem::path payloadStore ) override;
+
     void operator()() override;
 
   private:
     //! Media Set Paths
     MediaSetPaths mediaSetPathsV{};
+    //! Payload Store Directory
+    std::filesystem::path payloadStoreV{};
 };
 
 }
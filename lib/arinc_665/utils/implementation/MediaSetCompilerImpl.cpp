@@ -12,6 +12,9 @@
 
 #include "MediaSetCompilerImpl.hpp"
 
+#include <arinc_665/utils/ByteProgressTracker.hpp>
+#include <arinc_665/utils/MediaSetStatistics.hpp>
+
 #include <arinc_665/media/MediaSet.hpp>
 #include <arinc_665/media/Directory.hpp>
 #include <arinc_665/media/RegularFile.hpp>
@@ -25,6 +28,7 @@
 #include <arinc_665/files/BatchFile.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <arinc_645/Arinc645Crc.hpp>
 #include <arinc_645/CheckValueGenerator.hpp>
@@ -35,7 +39,11 @@
 
 #include <boost/exception/all.hpp>
 
+#include <chrono>
+#include <functional>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace Arinc665::Utils {
 
@@ -99,8 +107,34 @@ MediaSetCompiler &MediaSetCompilerImpl::createLoadHeaderFiles( const FileCreatio
   return *this;
 }
 
+MediaSetCompiler &MediaSetCompilerImpl::statistics( MediaSetStatisticsPtr statistics )
+{
+  statisticsV = std::move( statistics );
+  return *this;
+}
+
+MediaSetCompiler &MediaSetCompilerImpl::fileSizeHandler( FileSizeHandler fileSizeHandler )
+{
+  fileSizeHandlerV = std::move( fileSizeHandler );
+  return *this;
+}
+
+MediaSetCompiler &MediaSetCompilerImpl::progressHandler( ByteProgressHandler progressHandler )
+{
+  progressHandlerV = std::move( progressHandler );
+  return *this;
+}
+
+MediaSetCompiler &MediaSetCompilerImpl::stopToken( std::stop_token stopToken )
+{
+  stopTokenV = std::move( stopToken );
+  return *this;
+}
+
 void MediaSetCompilerImpl::operator()()
 {
+  ARINC_665_TRACE_SCOPE( "compiler", "Compile Media Set" );
+
   if ( !mediaSetV || !createMediumHandlerV || !createDirectoryHandlerV
     || !checkFileExistenceHandlerV || !createFileHandlerV || !writeFileHandlerV
     || !readFileHandlerV )
@@ -111,14 +145,24 @@ void MediaSetCompilerImpl::operator()()
 
   SPDLOG_INFO( "Export Media Set '{}'", mediaSetV->partNumber() );
 
+  progressV = ByteProgressTracker{ progressHandlerV, stopTokenV };
+  checkValuesV.clear();
+  fileDigestsV.clear();
+  fileCheckValueTypesV = fileCheckValueTypes();
+
+  if ( progressV.reporting() && fileSizeHandlerV )
+  {
+    progressV.totalBytes( totalBytes() );
+  }
+
   // first export medium (directories and regular files)
   for ( MediumNumber mediumNumber{ 1U }; mediumNumber <= mediaSetV->lastMediumNumber(); ++mediumNumber )
   {
     // create the medium (i.e. create directory)
     createMediumHandlerV( mediumNumber );
 
-    // export regular files
-    for ( const auto &file : mediaSetV->regularFiles() )
+    // export regular files of this medium
+    for ( const auto &file : mediaSetV->regularFiles( mediumNumber ) )
     {
       exportRegularFile( file );
     }
@@ -153,6 +197,13 @@ void MediaSetCompilerImpl::operator()()
 
   // export "list of files" for all media
   exportListOfFiles();
+
+  progressV.finish();
+}
+
+const Media::CheckValues& MediaSetCompilerImpl::checkValues() const
+{
+  return checkValuesV;
 }
 
 void MediaSetCompilerImpl::exportDirectory(
@@ -163,14 +214,14 @@ void MediaSetCompilerImpl::exportDirectory(
 
   createDirectoryHandlerV( mediumNumber, directory );
 
-  // export regular files
-  for ( const auto &file : directory->regularFiles() )
+  // export regular files of this medium
+  for ( const auto &file : directory->regularFiles( mediumNumber ) )
   {
     exportRegularFile( file );
   }
 
-  // export sub-directories
-  for ( const auto &subDirectory : directory->subdirectories() )
+  // export sub-directories, which contain files of this medium
+  for ( const auto &subDirectory : directory->subdirectories( mediumNumber ) )
   {
     exportDirectory( mediumNumber, subDirectory );
   }
@@ -181,7 +232,7 @@ void MediaSetCompilerImpl::exportRegularFile( const Media::ConstRegularFilePtr &
   SPDLOG_INFO( "Export Regular File to [{}]:'{}'", file->effectiveMediumNumber().toString(), file->path().string() );
 
   // regular file mus be created by callback
-  createFileHandlerV( file );
+  createFile( file );
 }
 
 void MediaSetCompilerImpl::exportLoad( const Media::ConstLoadPtr &load )
@@ -189,30 +240,13 @@ void MediaSetCompilerImpl::exportLoad( const Media::ConstLoadPtr &load )
   SPDLOG_INFO( "Export Load to [{}]:'{}'", load->effectiveMediumNumber().toString(), load->path().string() );
 
   // check load header creation policy
-  switch ( createLoadHeaderFilesV )
+  if ( generateFile( createLoadHeaderFilesV, load ) )
   {
-    case FileCreationPolicy::None:
-      createFileHandlerV( load );
-      break;
-
-    case FileCreationPolicy::NoneExisting:
-      if ( checkFileExistenceHandlerV( load ) )
-      {
-        createFileHandlerV( load );
-      }
-      else
-      {
-        createLoadHeaderFile( *load );
-      }
-      break;
-
-    case FileCreationPolicy::All:
-      createLoadHeaderFile( *load );
-      break;
-
-    default:
-      BOOST_THROW_EXCEPTION( Arinc665Exception()
-        << Helper::AdditionalInfo{ "Invalid value of createLoadHeaderFiles" } );
+    createLoadHeaderFile( *load );
+  }
+  else
+  {
+    createFile( load );
   }
 }
 
@@ -221,31 +255,13 @@ void MediaSetCompilerImpl::exportBatch( const Media::ConstBatchPtr &batch )
   SPDLOG_INFO( "Export Batch to [{}]:'{}'", batch->effectiveMediumNumber().toString(), batch->path().string() );
 
   // check batch file creation policy
-  switch ( createBatchFilesV )
+  if ( generateFile( createBatchFilesV, batch ) )
   {
-    case FileCreationPolicy::None:
-      createFileHandlerV( batch );
-      break;
-
-    case FileCreationPolicy::NoneExisting:
-      // check batch file creation policy
-      if ( checkFileExistenceHandlerV( batch ) )
-      {
-        createFileHandlerV( batch );
-      }
-      else
-      {
-        createBatchFile( *batch );
-      }
-      break;
-
-    case FileCreationPolicy::All:
-      createBatchFile( *batch );
-      break;
-
-    default:
-      BOOST_THROW_EXCEPTION( Arinc665Exception()
-        << Helper::AdditionalInfo{ "Invalid value of createBatchFiles" } );
+    createBatchFile( *batch );
+  }
+  else
+  {
+    createFile( batch );
   }
 }
 
@@ -261,7 +277,7 @@ void MediaSetCompilerImpl::exportListOfLoads() const
   {
     auto thwIds{ load->targetHardwareIds() };
     loadListFile.load( Files::LoadInfo{
-      std::string{ load->partNumber() },
+      Symbol{ load->partNumber() },
       std::string{ load->name() },
       load->effectiveMediumNumber(),
       Files::LoadInfo::ThwIds{ thwIds.begin(), thwIds.end() } } );
@@ -278,7 +294,13 @@ void MediaSetCompilerImpl::exportListOfLoads() const
 
     loadListFile.mediaSequenceNumber( mediumNumber );
 
-    writeFileHandlerV( mediumNumber, filename, static_cast< Helper::RawData >( loadListFile ) );
+    Helper::RawData rawLoadListFile{};
+    {
+      MediaSetStatistics::ScopedPhase encodePhase{ statisticsV.get(), MediaSetStatistics::Phase::Encode };
+      rawLoadListFile = static_cast< Helper::RawData >( loadListFile );
+    }
+
+    writeFile( mediumNumber, filename, rawLoadListFile );
   }
 }
 
@@ -292,7 +314,7 @@ void MediaSetCompilerImpl::exportListOfBatches() const
   for ( const auto &batch : mediaSetV->recursiveBatches() )
   {
     batchListFile.batch( Files::BatchInfo{
-      std::string{ batch->partNumber() },
+      Symbol{ batch->partNumber() },
       std::string{ batch->name() },
       batch->effectiveMediumNumber() } );
   }
@@ -308,7 +330,13 @@ void MediaSetCompilerImpl::exportListOfBatches() const
 
     batchListFile.mediaSequenceNumber( mediumNumber );
 
-    writeFileHandlerV( mediumNumber, filename, static_cast< Helper::RawData >( batchListFile ) );
+    Helper::RawData rawBatchListFile{};
+    {
+      MediaSetStatistics::ScopedPhase encodePhase{ statisticsV.get(), MediaSetStatistics::Phase::Encode };
+      rawBatchListFile = static_cast< Helper::RawData >( batchListFile );
+    }
+
+    writeFile( mediumNumber, filename, rawBatchListFile );
   }
 }
 
@@ -316,11 +344,23 @@ void MediaSetCompilerImpl::exportListOfFiles() const
 {
   Files::FilesInfo filesInfo{};
 
+  const auto files{ mediaSetV->recursiveFiles() };
+  const auto digests{ fileDigests( files ) };
+  auto digestIt{ digests.begin() };
+
   /* add all files, load header files, and batch files to file list */
-  for ( const auto &file : mediaSetV->recursiveFiles() )
+  for ( const auto &file : files )
   {
-    const auto &[ fileCrc, fileCheckValue ]{
-      fileCrcCheckValue( file->effectiveMediumNumber(), file->path(), file->effectiveCheckValueType() ) };
+    const auto &[ fileCrc, fileCheckValue ]{ *digestIt++ };
+
+    // update check values (CRC and Check Value if provided)
+    auto &fileCheckValues{ checkValuesV[ file ] };
+    fileCheckValues.emplace( Arinc645::CheckValue::crc16( fileCrc ) );
+
+    if ( Arinc645::CheckValue::NoCheckValue != fileCheckValue )
+    {
+      fileCheckValues.emplace( fileCheckValue );
+    }
 
     filesInfo.emplace_back( Files::FileInfo{
       .filename = std::string{ file->name() },
@@ -380,15 +420,23 @@ void MediaSetCompilerImpl::exportListOfFiles() const
     // add Files
     fileListFile.files().insert( fileListFile.files().end(), filesInfo.begin(), filesInfo.end() );
 
-    writeFileHandlerV( mediumNumber, filename, static_cast< Helper::RawData >( fileListFile ) );
+    Helper::RawData rawFileListFile{};
+    {
+      MediaSetStatistics::ScopedPhase encodePhase{ statisticsV.get(), MediaSetStatistics::Phase::Encode };
+      rawFileListFile = static_cast< Helper::RawData >( fileListFile );
+    }
+
+    writeFile( mediumNumber, filename, rawFileListFile );
   }
 }
 
 void MediaSetCompilerImpl::createLoadHeaderFile( const Media::Load &load ) const
 {
+  ARINC_665_TRACE_SCOPE_DETAIL( "compiler", "Create Load Header File", load.name() );
+
   Files::LoadHeaderFile loadHeaderFile{ arinc665VersionV };
   loadHeaderFile.partFlags( load.partFlags() );
-  loadHeaderFile.partNumber( std::string{ load.partNumber() } );
+  loadHeaderFile.partNumber( Symbol{ load.partNumber() } );
   for ( const auto &[ thwId, positions ] : load.targetHardwareIdPositions() )
   {
     loadHeaderFile.targetHardwareId( thwId );
@@ -398,16 +446,39 @@ void MediaSetCompilerImpl::createLoadHeaderFile( const Media::Load &load ) const
   }
   loadHeaderFile.loadType( load.loadType() );
 
+  const auto dataFiles{ load.dataFiles( true ) };
+  const auto supportFiles{ load.supportFiles( true ) };
+
+  // files not digested during creation are read back - the next file is read, while the current one is digested
+  std::vector< Media::ConstFilePtr > undigestedFiles{};
+  for ( const auto &loadFiles : { std::cref( dataFiles ), std::cref( supportFiles ) } )
+  {
+    for ( const auto &[ file, partNumber, checkValueType ] : loadFiles.get() )
+    {
+      if ( !fileDigest( file, checkValueType.value_or( Arinc645::CheckValueType::NotUsed ) ) )
+      {
+        undigestedFiles.emplace_back( file );
+      }
+    }
+  }
+
+  ReadAhead< Helper::RawData > undigestedRawFiles{
+    undigestedFiles.size(),
+    [ this, &undigestedFiles ]( const std::size_t index )
+    {
+      return readFile( undigestedFiles[ index ]->effectiveMediumNumber(), undigestedFiles[ index ]->path() );
+    } };
+
   // Process data files and add info to load header.
-  for ( const auto &file : load.dataFiles( true ) )
+  for ( const auto &file : dataFiles )
   {
-    loadHeaderFile.dataFile( loadFileInformation( file ) );
+    loadHeaderFile.dataFile( loadFileInformation( file, undigestedRawFiles ) );
   }
 
   // Process support files and add info to load header.
-  for ( const auto &file: load.supportFiles( true ) )
+  for ( const auto &file: supportFiles )
   {
-    loadHeaderFile.supportFile( loadFileInformation( file ) );
+    loadHeaderFile.supportFile( loadFileInformation( file, undigestedRawFiles ) );
   }
 
   // User Defined Data
@@ -418,7 +489,11 @@ void MediaSetCompilerImpl::createLoadHeaderFile( const Media::Load &load ) const
   loadHeaderFile.loadCheckValueType( load.effectiveLoadCheckValueType() );
 
   // RAW load header used for load Check Value and CRC calculation
-  auto rawLoadHeader{ Helper::RawData( loadHeaderFile ) };
+  Helper::RawData rawLoadHeader{};
+  {
+    MediaSetStatistics::ScopedPhase encodePhase{ statisticsV.get(), MediaSetStatistics::Phase::Encode };
+    rawLoadHeader = Helper::RawData( loadHeaderFile );
+  }
 
   // Calculate Load Check Value (Only for supported version)
   if ( SupportedArinc665Version::Supplement345 == arinc665VersionV )
@@ -426,23 +501,17 @@ void MediaSetCompilerImpl::createLoadHeaderFile( const Media::Load &load ) const
     auto checkValueGenerator{ Arinc645::CheckValueGenerator::create( load.effectiveLoadCheckValueType() ) };
     assert( checkValueGenerator );
 
-    Files::LoadHeaderFile::processLoadCheckValue( rawLoadHeader, *checkValueGenerator );
-
-    // load data files for Load Check Value.
-    for ( const auto &[ file, partNumber, checkValueType ] : load.dataFiles() )
     {
-      auto rawDataFile{ readFileHandlerV( file->effectiveMediumNumber(), file->path() ) };
-
-      checkValueGenerator->process( std::as_bytes( Helper::RawDataSpan{ rawDataFile } ) );
+      MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+      Files::LoadHeaderFile::processLoadCheckValue( rawLoadHeader, *checkValueGenerator );
     }
 
-    // load support files for Load Check Value.
-    for ( const auto &[ file, partNumber, checkValueType ] : load.supportFiles() )
+    // load data and support files for Load Check Value.
+    processLoadFiles( load, [ & ]( const Helper::ConstRawDataSpan chunk )
     {
-      auto rawSupportFile{ readFileHandlerV( file->effectiveMediumNumber(), file->path() ) };
-
-      checkValueGenerator->process( std::as_bytes( Helper::RawDataSpan{ rawSupportFile } ) );
-    }
+      MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+      checkValueGenerator->process( std::as_bytes( chunk ) );
+    } );
 
     Files::LoadHeaderFile::encodeLoadCheckValue( rawLoadHeader, checkValueGenerator->checkValue() );
   }
@@ -451,52 +520,90 @@ void MediaSetCompilerImpl::createLoadHeaderFile( const Media::Load &load ) const
   // Calculate load CRC
   Arinc645::Arinc645Crc32 loadCrc{};
 
-  Files::LoadHeaderFile::processLoadCrc( rawLoadHeader, loadCrc );
-
-  // load data files for load CRC.
-  for ( const auto &[ file, partNumber, checkValueType ] : load.dataFiles() )
   {
-    auto rawDataFile{ readFileHandlerV( file->effectiveMediumNumber(), file->path() ) };
-
-    loadCrc.process_bytes( std::to_address( rawDataFile.begin() ), rawDataFile.size() );
+    MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+    Files::LoadHeaderFile::processLoadCrc( rawLoadHeader, loadCrc );
   }
 
-  // load support files for load CRC.
-  for ( const auto &[ file, partNumber, checkValueType ] : load.supportFiles() )
+  // load data and support files for load CRC.
+  processLoadFiles( load, [ & ]( const Helper::ConstRawDataSpan chunk )
   {
-    auto rawSupportFile{ readFileHandlerV( file->effectiveMediumNumber(), file->path() ) };
-
-    loadCrc.process_bytes( std::to_address( rawSupportFile.begin() ), rawSupportFile.size() );
-  }
+    MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+    loadCrc.process_bytes( chunk.data(), chunk.size() );
+  } );
 
   // set load CRC
   Files::LoadHeaderFile::encodeLoadCrc( rawLoadHeader, loadCrc.checksum() );
 
   // Write Load Header File
-  writeFileHandlerV( load.effectiveMediumNumber(), load.path(), rawLoadHeader );
+  writeFile( load.effectiveMediumNumber(), load.path(), rawLoadHeader );
 }
 
-Files::LoadFileInfo MediaSetCompilerImpl::loadFileInformation( const Media::ConstLoadFile &loadFile ) const
+Files::LoadFileInfo MediaSetCompilerImpl::loadFileInformation(
+  const Media::ConstLoadFile &loadFile,
+  ReadAhead< Helper::RawData > &undigestedRawFiles ) const
 {
   const auto &[ file, partNumber, checkValueType ] = loadFile;
 
-  // read file
-  const auto rawDataFile{ readFileHandlerV( file->effectiveMediumNumber(), file->path() ) };
+  ARINC_665_TRACE_SCOPE_DETAIL( "digest", "Load File Digest", file->name() );
+
+  const auto loadFileCheckValueType{ checkValueType.value_or( Arinc645::CheckValueType::NotUsed ) };
+
+  std::uint64_t fileLength{ 0U };
+  uint16_t fileCrc{ 0U };
+  Arinc645::CheckValue checkValue{ Arinc645::CheckValue::NoCheckValue };
+
+  if ( auto digest{ fileDigest( file, loadFileCheckValueType ) }; digest )
+  {
+    // data and support files are digested during their creation
+    std::tie( fileLength, fileCrc, checkValue ) = std::move( *digest );
+  }
+  else
+  {
+    // read file
+    const auto rawDataFile{ undigestedRawFiles.next() };
+
+    Arinc645::Arinc645Crc16 crc{};
+    auto checkValueGenerator{ Arinc645::CheckValueGenerator::create( loadFileCheckValueType ) };
+    assert( checkValueGenerator );
+
+    progressV.currentFile( file->path() );
+    progressV.process( rawDataFile, [ & ]( const Helper::ConstRawDataSpan chunk )
+    {
+      {
+        MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+        crc.process_bytes( chunk.data(), chunk.size() );
+      }
+
+      MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+      checkValueGenerator->process( std::as_bytes( chunk ) );
+    } );
+
+    fileLength = rawDataFile.size();
+    fileCrc = crc.checksum();
+    checkValue = checkValueGenerator->checkValue();
+  }
+
+  // Add check value if provided - CRC 16 is added within exportListOfFiles
+  if ( Arinc645::CheckValue::NoCheckValue != checkValue )
+  {
+    checkValuesV[ file ].emplace( checkValue );
+  }
 
   return Files::LoadFileInfo{
     .filename = std::string{ file->name() },
     .partNumber = partNumber,
-    .length = rawDataFile.size(),
-    .crc = Files::Arinc665File::calculateChecksum( rawDataFile ),
-    .checkValue = Arinc645::CheckValueGenerator::checkValue(
-      checkValueType.value_or( Arinc645::CheckValueType::NotUsed ),
-      std::as_bytes( Helper::ConstRawDataSpan{ rawDataFile } ) ).value_or( Arinc645::CheckValue::NoCheckValue) };
+    .length = fileLength,
+    .crc = fileCrc,
+    .checkValue = std::move( checkValue ) };
 }
 
 void MediaSetCompilerImpl::createBatchFile( const Media::Batch &batch ) const
 {
+  ARINC_665_TRACE_SCOPE_DETAIL( "compiler", "Create Batch File", batch.name() );
+
   Files::BatchFile batchFile{ arinc665VersionV };
-  batchFile.partNumber( std::string{ batch.partNumber() } );
+  batchFile.partNumber( Symbol{ batch.partNumber() } );
   batchFile.comment( std::string{ batch.comment() } );
 
   // iterate over targets
@@ -510,14 +617,126 @@ void MediaSetCompilerImpl::createBatchFile( const Media::Batch &batch ) const
       // add load to target batch information
       batchLoadsInfo.emplace_back( Files::BatchLoadInfo{
         .headerFilename = std::string{ load->name() },
-        .partNumber = std::string{ load->partNumber() } } );
+        .partNumber = Symbol{ load->partNumber() } } );
     }
 
     // add target
     batchFile.targetHardware( Files::BatchTargetInfo{ targetHwId, std::move( batchLoadsInfo ) } );
   }
 
-  writeFileHandlerV( batch.effectiveMediumNumber(), batch.path(), static_cast< Helper::RawData >( batchFile ) );
+  Helper::RawData rawBatchFile{};
+  {
+    MediaSetStatistics::ScopedPhase encodePhase{ statisticsV.get(), MediaSetStatistics::Phase::Encode };
+    rawBatchFile = static_cast< Helper::RawData >( batchFile );
+  }
+
+  writeFile( batch.effectiveMediumNumber(), batch.path(), rawBatchFile );
+}
+
+std::optional< std::tuple< std::uint64_t, uint16_t, Arinc645::CheckValue > > MediaSetCompilerImpl::fileDigest(
+  const Media::ConstFilePtr &file,
+  const Arinc645::CheckValueType checkValueType ) const
+{
+  const auto digestIt{ fileDigestsV.find( file ) };
+
+  if ( digestIt == fileDigestsV.end() )
+  {
+    return {};
+  }
+
+  const auto &[ size, crc, checkValues ]{ digestIt->second };
+  const auto checkValueIt{ checkValues.find( checkValueType ) };
+
+  if ( checkValueIt == checkValues.end() )
+  {
+    return {};
+  }
+
+  return std::tuple{ size, crc, checkValueIt->second };
+}
+
+std::vector< Digest > MediaSetCompilerImpl::fileDigests( const Media::ConstFiles &files ) const
+{
+  std::vector< Digest > digests( files.size() );
+
+  // files read back from the output medium (index within files, check value type, file data)
+  std::vector< std::tuple< std::size_t, Arinc645::CheckValueType, Helper::RawData > > batch{};
+  std::uint64_t batchSize{ 0U };
+
+  const auto digestBatch{ [ & ]
+  {
+    if ( batch.empty() )
+    {
+      return;
+    }
+
+    ARINC_665_TRACE_SCOPE_DETAIL( "digest", "Batch Digest", std::to_string( batch.size() ) );
+
+    std::vector< DigestRequest > requests{};
+    requests.reserve( batch.size() );
+    for ( const auto &[ index, checkValueType, rawFile ] : batch )
+    {
+      requests.emplace_back( DigestRequest{ .data = rawFile, .checkValueType = checkValueType } );
+    }
+
+    std::vector< Digest > batchDigests{};
+    {
+      MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+      batchDigests = BatchDigest_calculate( requests, 0U, stopTokenV );
+    }
+
+    progressV.advance( batchSize );
+
+    for ( std::size_t request{ 0U }; request < batch.size(); ++request )
+    {
+      digests[ std::get< 0 >( batch[ request ] ) ] = std::move( batchDigests[ request ] );
+    }
+
+    batch.clear();
+    batchSize = 0U;
+  } };
+
+  // created files have been digested during creation - generated files are read back
+  std::vector< std::size_t > undigestedFiles{};
+  std::vector< Media::ConstFilePtr > filePtrs{ files.begin(), files.end() };
+
+  for ( std::size_t index{ 0U }; index < filePtrs.size(); ++index )
+  {
+    if ( const auto digest{ fileDigest( filePtrs[ index ], filePtrs[ index ]->effectiveCheckValueType() ) }; digest )
+    {
+      digests[ index ] = Digest{ .crc = std::get< 1 >( *digest ), .checkValue = std::get< 2 >( *digest ) };
+    }
+    else
+    {
+      undigestedFiles.emplace_back( index );
+    }
+  }
+
+  // the next files are read, while the current batch is collected and digested
+  ReadAhead< Helper::RawData > rawFiles{ undigestedFiles.size(), [ & ]( const std::size_t index )
+  {
+    const auto &file{ filePtrs[ undigestedFiles[ index ] ] };
+    return readFile( file->effectiveMediumNumber(), file->path() );
+  } };
+
+  for ( const auto index : undigestedFiles )
+  {
+    progressV.checkCancelled();
+    progressV.currentFile( filePtrs[ index ]->path() );
+
+    auto rawFile{ rawFiles.next() };
+    batchSize += rawFile.size();
+    batch.emplace_back( index, filePtrs[ index ]->effectiveCheckValueType(), std::move( rawFile ) );
+
+    if ( batchSize >= DigestBatchSize )
+    {
+      digestBatch();
+    }
+  }
+
+  digestBatch();
+
+  return digests;
 }
 
 std::tuple< uint16_t, Arinc645::CheckValue > MediaSetCompilerImpl::fileCrcCheckValue(
@@ -525,17 +744,241 @@ std::tuple< uint16_t, Arinc645::CheckValue > MediaSetCompilerImpl::fileCrcCheckV
   const std::filesystem::path &filename,
   const Arinc645::CheckValueType checkValueType ) const
 {
+  ARINC_665_TRACE_SCOPE_DETAIL( "digest", "File Digest", filename.generic_string() );
+
   auto checkValueGenerator{ Arinc645::CheckValueGenerator::create( checkValueType ) };
   assert( checkValueGenerator );
 
-  const auto rawFile{ readFileHandlerV( mediumNumber, filename ) };
+  const auto rawFile{ readFile( mediumNumber, filename ) };
+
+  Arinc645::Arinc645Crc16 crc{};
+
+  progressV.currentFile( filename );
+  progressV.process( rawFile, [ & ]( const Helper::ConstRawDataSpan chunk )
+  {
+    {
+      MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+      crc.process_bytes( chunk.data(), chunk.size() );
+    }
+
+    MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+    checkValueGenerator->process( std::as_bytes( chunk ) );
+  } );
+
+  return { crc.checksum(), checkValueGenerator->checkValue() };
+}
+
+Helper::RawData MediaSetCompilerImpl::readFile(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path ) const
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "handler", "Read File", path.generic_string() );
+
+  if ( !statisticsV )
+  {
+    return readFileHandlerV( mediumNumber, path );
+  }
+
+  const auto start{ std::chrono::steady_clock::now() };
+  Helper::RawData rawFile{};
+  {
+    MediaSetStatistics::ScopedPhase readPhase{ statisticsV.get(), MediaSetStatistics::Phase::Read };
+    rawFile = readFileHandlerV( mediumNumber, path );
+  }
+
+  statisticsV->fileRead(
+    mediumNumber,
+    path,
+    rawFile.size(),
+    std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ) );
+
+  return rawFile;
+}
+
+void MediaSetCompilerImpl::writeFile(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path,
+  const Helper::ConstRawDataSpan file ) const
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "handler", "Write File", path.generic_string() );
 
-  const auto crc{ Files::Arinc665File::calculateChecksum( rawFile ) };
+  if ( !statisticsV )
+  {
+    writeFileHandlerV( mediumNumber, path, file );
+    return;
+  }
 
-  checkValueGenerator->process( std::as_bytes( Helper::ConstRawDataSpan{ rawFile } ) );
-  const auto checkValue = checkValueGenerator->checkValue();
+  const auto start{ std::chrono::steady_clock::now() };
+  {
+    MediaSetStatistics::ScopedPhase writePhase{ statisticsV.get(), MediaSetStatistics::Phase::Write };
+    writeFileHandlerV( mediumNumber, path, file );
+  }
+
+  statisticsV->fileWritten(
+    mediumNumber,
+    path,
+    file.size(),
+    std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ) );
+}
+
+void MediaSetCompilerImpl::createFile( const Media::ConstFilePtr &file ) const
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "handler", "Create File", file->path().generic_string() );
+
+  progressV.checkCancelled();
+  progressV.currentFile( file->path() );
+
+  Arinc645::Arinc645Crc16 crc{};
+  std::vector< std::tuple< Arinc645::CheckValueType, Arinc645::CheckValueGeneratorPtr > > checkValueGenerators{};
+
+  if ( const auto checkValueTypesIt{ fileCheckValueTypesV.find( file ) };
+    checkValueTypesIt != fileCheckValueTypesV.end() )
+  {
+    for ( const auto checkValueType : checkValueTypesIt->second )
+    {
+      auto checkValueGenerator{ Arinc645::CheckValueGenerator::create( checkValueType ) };
+      assert( checkValueGenerator );
+      checkValueGenerators.emplace_back( checkValueType, std::move( checkValueGenerator ) );
+    }
+  }
+
+  FileDigest digest{};
+
+  {
+    // the digest is calculated on the buffers of the handler and therefore accounted to the create phase
+    MediaSetStatistics::ScopedPhase createPhase{ statisticsV.get(), MediaSetStatistics::Phase::Create };
+    createFileHandlerV( file, [ & ]( const Helper::ConstRawDataSpan chunk )
+    {
+      digest.size += chunk.size();
+      crc.process_bytes( chunk.data(), chunk.size() );
+
+      for ( const auto &[ checkValueType, checkValueGenerator ] : checkValueGenerators )
+      {
+        checkValueGenerator->process( std::as_bytes( chunk ) );
+      }
+    } );
+  }
 
-  return { crc, checkValue };
+  digest.crc = crc.checksum();
+  for ( const auto &[ checkValueType, checkValueGenerator ] : checkValueGenerators )
+  {
+    digest.checkValues.try_emplace( checkValueType, checkValueGenerator->checkValue() );
+  }
+
+  fileDigestsV.insert_or_assign( file, std::move( digest ) );
+
+  // created files are accounted as a whole
+  progressV.advance( ( progressV.reporting() && fileSizeHandlerV ) ? fileSizeHandlerV( file ) : 0U );
+}
+
+bool MediaSetCompilerImpl::generateFile( const FileCreationPolicy policy, const Media::ConstFilePtr &file ) const
+{
+  switch ( policy )
+  {
+    case FileCreationPolicy::None:
+      return false;
+
+    case FileCreationPolicy::NoneExisting:
+      return !checkFileExistenceHandlerV( file );
+
+    case FileCreationPolicy::All:
+      return true;
+
+    default:
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Invalid value of file creation policy" } );
+  }
+}
+
+MediaSetCompilerImpl::FileCheckValueTypes MediaSetCompilerImpl::fileCheckValueTypes() const
+{
+  FileCheckValueTypes checkValueTypes{};
+
+  // check value of the list of files
+  for ( const auto &file : mediaSetV->recursiveFiles() )
+  {
+    checkValueTypes[ file ].emplace( file->effectiveCheckValueType() );
+  }
+
+  // check values of data and support files within generated load headers
+  for ( const auto &load : mediaSetV->recursiveLoads() )
+  {
+    if ( !generateFile( createLoadHeaderFilesV, load ) )
+    {
+      continue;
+    }
+
+    for ( const auto &loadFiles : { load->dataFiles( true ), load->supportFiles( true ) } )
+    {
+      for ( const auto &[ file, partNumber, checkValueType ] : loadFiles )
+      {
+        checkValueTypes[ file ].emplace( checkValueType.value_or( Arinc645::CheckValueType::NotUsed ) );
+      }
+    }
+  }
+
+  return checkValueTypes;
+}
+
+std::uint64_t MediaSetCompilerImpl::totalBytes() const
+{
+  std::uint64_t totalBytes{ 0U };
+
+  // each file is either created (and digested on creation) or generated and hashed for the list of files
+  for ( const auto &file : mediaSetV->recursiveFiles() )
+  {
+    totalBytes += fileSizeHandlerV( file );
+  }
+
+  // generated load headers hash data and support files for load CRC and Load Check Value
+  // (file information is taken from the digests of the created files)
+  const std::uint64_t loadFilePasses{ ( SupportedArinc665Version::Supplement345 == arinc665VersionV ) ? 2U : 1U };
+
+  for ( const auto &load : mediaSetV->recursiveLoads() )
+  {
+    if ( !generateFile( createLoadHeaderFilesV, load ) )
+    {
+      continue;
+    }
+
+    for ( const auto &loadFiles : { load->dataFiles(), load->supportFiles() } )
+    {
+      for ( const auto &[ file, partNumber, checkValueType ] : loadFiles )
+      {
+        totalBytes += loadFilePasses * fileSizeHandlerV( file );
+      }
+    }
+  }
+
+  return totalBytes;
+}
+
+void MediaSetCompilerImpl::processLoadFiles(
+  const Media::Load &load,
+  const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor ) const
+{
+  std::vector< Media::ConstFilePtr > files{};
+  for ( const auto &loadFiles : { load.dataFiles(), load.supportFiles() } )
+  {
+    for ( const auto &[ file, partNumber, checkValueType ] : loadFiles )
+    {
+      files.emplace_back( file );
+    }
+  }
+
+  // the next files are read, while the current file is processed
+  ReadAhead< Helper::RawData > rawFiles{ files.size(), [ this, &files ]( const std::size_t index )
+  {
+    return readFile( files[ index ]->effectiveMediumNumber(), files[ index ]->path() );
+  } };
+
+  for ( const auto &file : files )
+  {
+    const auto rawFile{ rawFiles.next() };
+
+    progressV.currentFile( file->path() );
+    progressV.process( rawFile, chunkProcessor );
+  }
 }
 
 }
@@ -14,6 +14,19 @@
 #define ARINC_665_UTILS_IMPLEMENTATION_MEDIASETCOMPILERIMPL_HPP
 
 #include <arinc_665/utils/MediaSetCompiler.hpp>
+#include <arinc_665/utils/ByteProgressTracker.hpp>
+#include <arinc_665/utils/BatchDigest.hpp>
+#include <arinc_665/utils/implementation/ReadAhead.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <vector>
 
 namespace Arinc665::Utils {
 
@@ -58,12 +71,45 @@ class MediaSetCompilerImpl final : public MediaSetCompiler
     //! @copydoc MediaSetCompiler::createLoadHeaderFiles()
     MediaSetCompiler &createLoadHeaderFiles( FileCreationPolicy createLoadHeaderFiles ) override;
 
+    //! @copydoc MediaSetCompiler::statistics()
+    MediaSetCompiler &statistics( MediaSetStatisticsPtr statistics ) override;
+
+    //! @copydoc MediaSetCompiler::fileSizeHandler()
+    MediaSetCompiler &fileSizeHandler( FileSizeHandler fileSizeHandler ) override;
+
+    //! @copydoc MediaSetCompiler::progressHandler()
+    MediaSetCompiler &progressHandler( ByteProgressHandler progressHandler ) override;
+
+    //! @copydoc MediaSetCompiler::stopToken()
+    MediaSetCompiler &stopToken( std::stop_token stopToken ) override;
+
     /**
      * @brief Entry-point of the ARINC 665 Media Set Exporter.
      ***/
     void operator()() override;
 
+    //! @copydoc MediaSetCompiler::checkValues()
+    [[nodiscard]] const Media::CheckValues& checkValues() const override;
+
   private:
+    //! CRC-16 and Check Values of a File, calculated while the file is created
+    struct FileDigest
+    {
+      //! File Size
+      std::uint64_t size{ 0U };
+      //! CRC-16
+      uint16_t crc{ 0U };
+      //! Check Values by Check Value Type
+      std::map< Arinc645::CheckValueType, Arinc645::CheckValue > checkValues;
+    };
+
+    //! Check Value Types required for the List of Files and Load Headers by File
+    using FileCheckValueTypes =
+      std::map< Media::ConstFilePtr, std::set< Arinc645::CheckValueType >, std::owner_less<> >;
+
+    //! Maximum Size of read Files, which are digested as a Batch
+    static constexpr std::size_t DigestBatchSize{ 64U * 1024U * 1024U };
+
     /**
      * @brief Called to export the given Directory.
      *
@@ -136,10 +182,14 @@ class MediaSetCompilerImpl final : public MediaSetCompiler
      *
      * @param[in] loadFile
      *   Load File.
+     * @param[in,out] undigestedRawFiles
+     *   Content of the load files, which have not been digested during creation (in order of the calls).
      *
      * @return Processed Load File Information
      **/
-    [[nodiscard]] Files::LoadFileInfo loadFileInformation( const Media::ConstLoadFile &loadFile ) const;
+    [[nodiscard]] Files::LoadFileInfo loadFileInformation(
+      const Media::ConstLoadFile &loadFile,
+      ReadAhead< Helper::RawData > &undigestedRawFiles ) const;
 
     /**
      * @brief Creates the Batch File.
@@ -149,6 +199,36 @@ class MediaSetCompilerImpl final : public MediaSetCompiler
      **/
     void createBatchFile( const Media::Batch &batch ) const;
 
+    /**
+     * @brief Returns the Digest of the given file calculated during its creation.
+     *
+     * @param[in] file
+     *   File.
+     * @param[in] checkValueType
+     *   Desired Check Value Type.
+     *
+     * @return File Size, CRC16 and Check Value as std::tuple.
+     * @retval {}
+     *   If the file has not been created or the Check Value has not been calculated.
+     **/
+    [[nodiscard]] std::optional< std::tuple< std::uint64_t, uint16_t, Arinc645::CheckValue > > fileDigest(
+      const Media::ConstFilePtr &file,
+      Arinc645::CheckValueType checkValueType ) const;
+
+    /**
+     * @brief Returns CRC-16 and Check Value of the given files.
+     *
+     * Files digested during creation are taken from the cache (see fileDigest()).
+     * All other files are read with the @ref readFileHandler() from the output medium and digested in batches (see
+     * BatchDigest_calculate()).
+     *
+     * @param[in] files
+     *   Files. The effective Check Value Type of each file is calculated.
+     *
+     * @return CRC16 and Check Value in the order of @p files.
+     **/
+    [[nodiscard]] std::vector< Digest > fileDigests( const Media::ConstFiles &files ) const;
+
     /**
      * @brief Calculates CRC-16 and Check Value of the given file.
      *
@@ -169,6 +249,94 @@ class MediaSetCompilerImpl final : public MediaSetCompiler
       const std::filesystem::path &filename,
       Arinc645::CheckValueType checkValueType ) const;
 
+    /**
+     * @brief Reads the given file via the Read File Handler and records statistics.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Relative Path on Medium.
+     *
+     * @return File Data.
+     **/
+    [[nodiscard]] Helper::RawData readFile( const MediumNumber &mediumNumber, const std::filesystem::path &path ) const;
+
+    /**
+     * @brief Writes the given file via the Write File Handler and records statistics.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Relative Path on Medium.
+     * @param[in] file
+     *   File Data.
+     **/
+    void writeFile(
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path,
+      Helper::ConstRawDataSpan file ) const;
+
+    /**
+     * @brief Creates the given File via the Create File Handler and records statistics.
+     *
+     * The CRC-16 and the Check Values required for the file are calculated on the content passed by the handler and
+     * stored as File Digest.
+     *
+     * @param[in] file
+     *   File to be created.
+     **/
+    void createFile( const Media::ConstFilePtr &file ) const;
+
+    /**
+     * @brief Returns if the given Load Header or Batch File shall be generated.
+     *
+     * @param[in] policy
+     *   File Creation Policy.
+     * @param[in] file
+     *   Load Header or Batch File.
+     *
+     * @return If the file shall be generated by the compiler.
+     * @throw Arinc665Exception
+     *   When @p policy is invalid.
+     **/
+    [[nodiscard]] bool generateFile( FileCreationPolicy policy, const Media::ConstFilePtr &file ) const;
+
+    /**
+     * @brief Collects the Check Value Types required for each File.
+     *
+     * These are the check value type of the file itself (List of Files) and the check value types used for the file
+     * within load headers.
+     *
+     * @return Check Value Types by File.
+     **/
+    [[nodiscard]] FileCheckValueTypes fileCheckValueTypes() const;
+
+    /**
+     * @brief Calculates the Total Number of Bytes processed during compilation.
+     *
+     * Uses the File Size Handler.
+     * Accounts the created files (digested during creation), the file digests of generated files for the list of
+     * files, and the load CRC and Load Check Value passes of generated load headers.
+     *
+     * @return Total Number of Bytes.
+     **/
+    [[nodiscard]] std::uint64_t totalBytes() const;
+
+    /**
+     * @brief Reads the Data and Support Files of the given Load and processes them in chunks.
+     *
+     * @param[in] load
+     *   Load.
+     * @param[in] chunkProcessor
+     *   Chunk Processor.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
+     **/
+    void processLoadFiles(
+      const Media::Load &load,
+      const std::function< void( Helper::ConstRawDataSpan chunk ) > &chunkProcessor ) const;
+
     //! ARINC 665 Version used for exporting
     SupportedArinc665Version arinc665VersionV{ SupportedArinc665Version::Supplement2 };
     //! Indicates if batch files shall be created by Media set Exporter
@@ -190,6 +358,22 @@ class MediaSetCompilerImpl final : public MediaSetCompiler
     WriteFileHandler writeFileHandlerV;
     //! Read File Handler
     ReadFileHandler readFileHandlerV;
+    //! Statistics
+    MediaSetStatisticsPtr statisticsV;
+    //! File Size Handler
+    FileSizeHandler fileSizeHandlerV;
+    //! Progress Handler
+    ByteProgressHandler progressHandlerV;
+    //! Stop Token
+    std::stop_token stopTokenV;
+    //! Byte Progress of the current Compilation
+    mutable ByteProgressTracker progressV;
+    //! Check Values calculated during the current Compilation
+    mutable Media::CheckValues checkValuesV;
+    //! Check Value Types required for each File during the current Compilation
+    FileCheckValueTypes fileCheckValueTypesV;
+    //! Digests of the Files created during the current Compilation
+    mutable std::map< Media::ConstFilePtr, FileDigest, std::owner_less<> > fileDigestsV;
 };
 
 }
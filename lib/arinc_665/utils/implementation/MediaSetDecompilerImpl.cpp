@@ -12,13 +12,18 @@
 
 #include "MediaSetDecompilerImpl.hpp"
 
+#include <arinc_665/utils/BatchDigest.hpp>
+#include <arinc_665/utils/MediaSetStatistics.hpp>
+
 #include <arinc_665/media/Directory.hpp>
 #include <arinc_665/media/Load.hpp>
 #include <arinc_665/media/Batch.hpp>
 #include <arinc_665/media/RegularFile.hpp>
 
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
+#include <arinc_645/Arinc645Crc.hpp>
 #include <arinc_645/CheckValueGenerator.hpp>
 
 #include <helper/Exception.hpp>
@@ -27,6 +32,11 @@
 
 #include <boost/exception/all.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+
 namespace Arinc665::Utils {
 
 MediaSetDecompiler &MediaSetDecompilerImpl::fileSizeHandler( FileSizeHandler fileSizeHandler )
@@ -41,29 +51,83 @@ MediaSetDecompiler &MediaSetDecompilerImpl::readFileHandler( ReadFileHandler rea
   return *this;
 }
 
+MediaSetDecompiler &MediaSetDecompilerImpl::readFilesHandler( ReadFilesHandler readFilesHandler )
+{
+  readFilesHandlerV = std::move( readFilesHandler );
+  return *this;
+}
+
+MediaSetDecompiler &MediaSetDecompilerImpl::fileLocationHandler( FileLocationHandler fileLocationHandler )
+{
+  fileLocationHandlerV = std::move( fileLocationHandler );
+  return *this;
+}
+
 MediaSetDecompiler &MediaSetDecompilerImpl::progressHandler( ProgressHandler progressHandler )
 {
   progressHandlerV = std::move( progressHandler );
   return *this;
 }
 
+MediaSetDecompiler &MediaSetDecompilerImpl::byteProgressHandler( ByteProgressHandler byteProgressHandler )
+{
+  byteProgressHandlerV = std::move( byteProgressHandler );
+  return *this;
+}
+
+MediaSetDecompiler &MediaSetDecompilerImpl::stopToken( std::stop_token stopToken )
+{
+  stopTokenV = std::move( stopToken );
+  return *this;
+}
+
 MediaSetDecompiler &MediaSetDecompilerImpl::checkFileIntegrity( const bool checkFileIntegrity ) noexcept
 {
   checkFileIntegrityV = checkFileIntegrity;
   return *this;
 }
 
+MediaSetDecompiler &MediaSetDecompilerImpl::checkListedFiles( const bool checkListedFiles ) noexcept
+{
+  checkListedFilesV = checkListedFiles;
+  return *this;
+}
+
+MediaSetDecompiler &MediaSetDecompilerImpl::lazy( const bool lazy ) noexcept
+{
+  lazyV = lazy;
+  return *this;
+}
+
+MediaSetDecompiler &MediaSetDecompilerImpl::statistics( MediaSetStatisticsPtr statistics )
+{
+  statisticsV = std::move( statistics );
+  return *this;
+}
+
 MediaSetDecompilerResult MediaSetDecompilerImpl::operator()()
 {
+  ARINC_665_TRACE_SCOPE( "decompiler", "Decompile Media Set" );
+
   if ( !fileSizeHandlerV || !readFileHandlerV )
   {
     BOOST_THROW_EXCEPTION( Arinc665Exception()
       << Helper::AdditionalInfo{ "Missing file size or read file handler" } );
   }
 
+  byteProgressV = ByteProgressTracker{ byteProgressHandlerV, stopTokenV };
+
   // create Media set
   mediaSetV = Media::MediaSet::create();
 
+  // shared by the content loaders of the loads and batches
+  if ( lazyV )
+  {
+    lazyContextV = std::make_shared< LazyContext >();
+    lazyContextV->readFileHandler = readFileHandlerV;
+    lazyContextV->statistics = statisticsV;
+  }
+
   // 1st Medium
   loadFirstMedium();
 
@@ -73,13 +137,31 @@ MediaSetDecompilerResult MediaSetDecompilerImpl::operator()()
   // finally, add all files (regular, load headers, batches) to the media set
   files();
 
+  byteProgressV.finish();
+  lazyContextV.reset();
+
   return { std::move( mediaSetV ), std::move( checkValuesV ) };
 }
 
+template< typename ListFileT, typename... TablesT >
+ListFileT MediaSetDecompilerImpl::decodeListFile(
+  const MediumNumber &mediumNumber,
+  std::string_view filename,
+  TablesT &...tables ) const
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "decompiler", "Decode List File", filename );
+
+  const auto rawListFile{ readFile( mediumNumber, filename ) };
+
+  MediaSetStatistics::ScopedPhase decodePhase{ statisticsV.get(), MediaSetStatistics::Phase::ListFileDecode };
+  return ListFileT{ rawListFile, tables... };
+}
+
 void MediaSetDecompilerImpl::loadFirstMedium()
 {
   // Load "list of files" file
-  fileListFileV = readFileHandlerV( MediumNumber{ 1U }, Arinc665::ListOfFilesName );
+  fileListFileV =
+    decodeListFile< Files::FileListFile >( MediumNumber{ 1U }, Arinc665::ListOfFilesName, filesInfoTableV );
 
   if ( fileListFileV.mediaSequenceNumber() != MediumNumber{ 1U } )
   {
@@ -98,7 +180,7 @@ void MediaSetDecompilerImpl::loadFirstMedium()
   // indicator, that LOADS.LUM present in FILES.LUM
   bool listOfLoadsFilePresent{ false };
 
-  for ( const auto &fileInfo : fileListFileV.files() )
+  for ( const auto &fileInfo : filesInfoTableV.entries() )
   {
     // get file type
     // skip list files and handle load headers and batch files separate
@@ -149,7 +231,7 @@ void MediaSetDecompilerImpl::loadFirstMedium()
     }
 
     // update files information
-    filesInfosV.emplace( fileInfo.filename, fileInfo );
+    filesInfosV.emplace( fileInfo.filename, Files::FileInfoTable::fileInfo( fileInfo ) );
   }
 
   // Load List File
@@ -173,7 +255,7 @@ void MediaSetDecompilerImpl::loadFirstMedium()
   mediaSetV->partNumber( std::string{ fileListFileV.mediaSetPn() } );
 
   // Load "list of loads" file
-  loadListFileV = readFileHandlerV( MediumNumber{ 1U }, Arinc665::ListOfLoadsName );
+  loadListFileV = decodeListFile< Files::LoadListFile >( MediumNumber{ 1U }, Arinc665::ListOfLoadsName );
 
   for ( const auto &load : loadListFileV.loads() )
   {
@@ -207,7 +289,7 @@ void MediaSetDecompilerImpl::loadFirstMedium()
   // Load "list of batches" file
   if ( batchListFilePresentV )
   {
-    batchListFileV = readFileHandlerV( MediumNumber{ 1U }, Arinc665::ListOfBatchesName );
+    batchListFileV = decodeListFile< Files::BatchListFile >( MediumNumber{ 1U }, Arinc665::ListOfBatchesName );
 
     for ( const auto &batch : batchListFileV.batches() )
     {
@@ -255,9 +337,12 @@ void MediaSetDecompilerImpl::loadFurtherMedia() const
     // Load "list of files" file
 
     // compare current list of files to first one
+    Files::FileInfoTable mediumFilesInfoTable{};
     if (
-      const Files::FileListFile mediumFileListFile{ readFileHandlerV( mediumNumber, Arinc665::ListOfFilesName ) };
+      const auto mediumFileListFile{
+        decodeListFile< Files::FileListFile >( mediumNumber, Arinc665::ListOfFilesName, mediumFilesInfoTable ) };
       !mediumFileListFile.belongsToSameMediaSet( fileListFileV )
+        || !mediumFilesInfoTable.belongsToSameMediaSet( filesInfoTableV )
         || ( mediumNumber != mediumFileListFile.mediaSequenceNumber() ) )
     {
       BOOST_THROW_EXCEPTION( Arinc665Exception()
@@ -272,7 +357,7 @@ void MediaSetDecompilerImpl::loadFurtherMedia() const
 
     // check against stored version
     if (
-      const Files::LoadListFile mediumLoadListFile{ readFileHandlerV( mediumNumber, Arinc665::ListOfLoadsName ) };
+      const auto mediumLoadListFile{ decodeListFile< Files::LoadListFile >( mediumNumber, Arinc665::ListOfLoadsName ) };
       !mediumLoadListFile.belongsToSameMediaSet( loadListFileV )
         || ( mediumNumber != mediumLoadListFile.mediaSequenceNumber() ) )
     {
@@ -286,7 +371,8 @@ void MediaSetDecompilerImpl::loadFurtherMedia() const
     {
       // check against stored version
       if (
-        const Files::BatchListFile mediumBatchListFile{ readFileHandlerV( mediumNumber, Arinc665::ListOfBatchesName ) };
+        const auto mediumBatchListFile{
+          decodeListFile< Files::BatchListFile >( mediumNumber, Arinc665::ListOfBatchesName ) };
         !mediumBatchListFile.belongsToSameMediaSet( batchListFileV )
           || ( mediumNumber != mediumBatchListFile.mediaSequenceNumber() ) )
       {
@@ -337,6 +423,24 @@ void MediaSetDecompilerImpl::files()
 
   // finally fill loads and batches with data
 
+  // on first access in lazy mode
+  if ( lazyV )
+  {
+    lazyContextV->regularFileCrcs = regularFileCrcsV;
+
+    for ( const auto &[ file, loadInfo ] : loadsV )
+    {
+      deferLoad( *file, loadInfo.first, loadInfo.second );
+    }
+
+    for ( const auto &[ file, batchInfo ] : batchesV )
+    {
+      deferBatch( *file, batchInfo.first, batchInfo.second );
+    }
+
+    return;
+  }
+
   // iterate over load headers
   for ( const auto &[ file, loadInfo ] : loadsV )
   {
@@ -370,6 +474,7 @@ void MediaSetDecompilerImpl::regularFile( Media::ContainerEntity &parent, const
   }
 
   // add to deferred load handling
+  regularFileCrcsV.try_emplace( file.get(), fileInfo.crc );
   regularFilesV.try_emplace( std::move( file ), fileInfo );
 }
 
@@ -384,6 +489,11 @@ void MediaSetDecompilerImpl::loadFile(
   auto load{ parent.addLoad( loadInfo.headerFilename, loadInfo.memberSequenceNumber ) };
   assert( load );
 
+  // part number and THW IDs are provided by the list of loads (positions by the load header file)
+  load->partNumber( loadInfo.partNumber );
+  load->targetHardwareIds(
+    Media::Load::TargetHardwareIds{ loadInfo.targetHardwareIds.begin(), loadInfo.targetHardwareIds.end() } );
+
   // set check value indicator
   load->checkValueType( fileInfo.checkValue.type() );
 
@@ -410,6 +520,9 @@ void MediaSetDecompilerImpl::batchFile(
   auto batch{ parent.addBatch( batchInfo.filename, batchInfo.memberSequenceNumber ) };
   assert( batch );
 
+  // part number is provided by the list of batches
+  batch->partNumber( batchInfo.partNumber );
+
   // set check value indicator
   batch->checkValueType( fileInfo.checkValue.type() );
 
@@ -430,46 +543,14 @@ void MediaSetDecompilerImpl::addLoad(
   const Files::FileInfo &fileInfo,
   const Files::LoadInfo &loadInfo )
 {
-  // decode load header
-  const auto rawLoadHeaderFile{ readFileHandlerV( fileInfo.memberSequenceNumber, fileInfo.path() ) };
-  const Files::LoadHeaderFile loadHeaderFile{ rawLoadHeaderFile };
+  ARINC_665_TRACE_SCOPE_DETAIL( "decompiler", "Add Load", fileInfo.filename );
 
-  // validate load part number to load information
-  if ( loadInfo.partNumber != loadHeaderFile.partNumber() )
-  {
-    BOOST_THROW_EXCEPTION(
-      Arinc665Exception()
-      << Helper::AdditionalInfo{ "Load part number inconsistent" }
-      << boost::errinfo_file_name{ std::string{ loadInfo.headerFilename } } );
-  }
-
-  // validate THW IDs of load header against the list of loads
-  if (
-    std::multiset< std::string, std::less<> >{ loadInfo.targetHardwareIds.begin(), loadInfo.targetHardwareIds.end() }
-    != std::multiset< std::string, std::less<> >{
-      loadHeaderFile.targetHardwareIds().begin(),
-      loadHeaderFile.targetHardwareIds().end() } )
-  {
-    BOOST_THROW_EXCEPTION(
-      Arinc665Exception()
-      << Helper::AdditionalInfo{ "Load THW IDs inconsistent" }
-      << boost::errinfo_file_name{ std::string{ loadInfo.headerFilename } } );
-  }
+  // decode load header
+  const auto rawLoadHeaderFile{ readFile( fileInfo.memberSequenceNumber, fileInfo.path() ) };
+  const auto [ loadHeaderFile, dataFilesInfo, supportFilesInfo ]{
+    decodeLoadHeaderFile( rawLoadHeaderFile, statisticsV.get(), loadInfo ) };
 
-  load.partFlags( loadHeaderFile.partFlags() );
-  load.partNumber( std::string{ loadHeaderFile.partNumber() } );
-  load.loadType( loadHeaderFile.loadType() );
-  Media::Load::TargetHardwareIdPositions thwIdsPositions{};
-  for ( const auto &[ thwId, positions ] : loadHeaderFile.targetHardwareIdsPositions() )
-  {
-    thwIdsPositions.try_emplace( thwId, positions.begin(), positions.end() );
-  }
-  for ( const auto &thwId : loadHeaderFile.targetHardwareIds() )
-  {
-    // if not previously added - add it now with empty positions
-    thwIdsPositions.try_emplace( thwId );
-  }
-  load.targetHardwareIdPositions( std::move( thwIdsPositions ) );
+  loadHeaderAttributes( load, loadHeaderFile );
 
   // Load Check CRC and Load Check Value
   Arinc645::Arinc645Crc32 loadCrc{};
@@ -478,56 +559,96 @@ void MediaSetDecompilerImpl::addLoad(
 
   if ( checkFileIntegrityV )
   {
-    Files::LoadHeaderFile::processLoadCrc( rawLoadHeaderFile, loadCrc );
+    // load files are hashed again for load CRC and Load Check Value
+    if ( byteProgressV.reporting() )
+    {
+      for ( const auto &loadFileInfo : dataFilesInfo.entries() )
+      {
+        byteProgressV.addTotalBytes( loadFileInfo.length );
+      }
+
+      for ( const auto &loadFileInfo : supportFilesInfo.entries() )
+      {
+        byteProgressV.addTotalBytes( loadFileInfo.length );
+      }
+    }
+
+    {
+      MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+      Files::LoadHeaderFile::processLoadCrc( rawLoadHeaderFile, loadCrc );
+    }
+
+    MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
     Files::LoadHeaderFile::processLoadCheckValue( rawLoadHeaderFile, *loadCheckValueGenerator );
   }
 
-  // iterate over data files
-  for ( const auto &loadFileInfo : loadHeaderFile.dataFiles() )
+  // resolve data and support files - start search in parent directory of load (according ARINC 665-5)
+  const auto resolveLoadFiles{ [ & ]( const Files::LoadFileInfoTable &loadFilesInfo )
   {
-    // start search in parent directory of load (according ARINC 665-5)
-    const auto dataFilePtr{ loadFile( *load.parent(), loadFileInfo.filename, loadFileInfo.crc ) };
+    std::vector<
+      std::tuple< Media::RegularFilePtr, const Files::FileInfo *, const Files::LoadFileInfoTable::Entry * > > files{};
 
-    const auto dataFileInfo{ regularFilesV.find( dataFilePtr ) };
-    assert( dataFileInfo != regularFilesV.end() );
+    for ( const auto &loadFileInfo : loadFilesInfo.entries() )
+    {
+      auto filePtr{ loadFile( *mediaSetV, *load.parent(), regularFileCrcsV, loadFileInfo.filename, loadFileInfo.crc ) };
 
+      const auto regularFileInfo{ regularFilesV.find( filePtr ) };
+      assert( regularFileInfo != regularFilesV.end() );
+
+      files.emplace_back( std::move( filePtr ), &regularFileInfo->second, &loadFileInfo );
+    }
+
+    return files;
+  } };
+
+  const auto dataFiles{ resolveLoadFiles( dataFilesInfo ) };
+  const auto supportFiles{ resolveLoadFiles( supportFilesInfo ) };
+
+  // the next load files are read, while the current file is digested
+  ReadAhead< Helper::RawData > rawLoadFiles{
+    checkFileIntegrityV ? dataFiles.size() + supportFiles.size() : 0U,
+    [ & ]( const std::size_t index )
+    {
+      const auto &loadFileInfo{ *std::get< 1 >(
+        index < dataFiles.size() ? dataFiles[ index ] : supportFiles[ index - dataFiles.size() ] ) };
+      return readFile( loadFileInfo.memberSequenceNumber, loadFileInfo.path() );
+    } };
+
+  // iterate over data files
+  for ( const auto &[ dataFilePtr, dataFileInfo, loadFileInfo ] : dataFiles )
+  {
     // perform file check
     // in ARINC 665-2 File Size of Data File is stored as multiple of 16 bit
     checkLoadFile(
       loadCrc,
       *loadCheckValueGenerator,
-      dataFileInfo->second,
-      loadFileInfo,
+      rawLoadFiles,
+      *dataFileInfo,
+      *loadFileInfo,
       loadHeaderFile.arincVersion() == SupportedArinc665Version::Supplement2 );
 
-    load.dataFile( dataFilePtr, loadFileInfo.partNumber, loadFileInfo.checkValue.type() );
+    load.dataFile( dataFilePtr, loadFileInfo->partNumber, loadFileInfo->checkValue.type() );
 
     // Add check value if provided - CRC 16 is not added, as it is handled
     // within addFiles
-    if ( Arinc645::CheckValue::NoCheckValue != loadFileInfo.checkValue )
+    if ( Arinc645::CheckValue::NoCheckValue != loadFileInfo->checkValue )
     {
-      checkValuesV[ dataFilePtr ].emplace( loadFileInfo.checkValue );
+      checkValuesV[ dataFilePtr ].emplace( loadFileInfo->checkValue );
     }
   }
 
   // iterate over support files
-  for ( const auto &loadFileInfo : loadHeaderFile.supportFiles() )
+  for ( const auto &[ supportFilePtr, supportFileInfo, loadFileInfo ] : supportFiles )
   {
-    // start search in parent directory of load (according ARINC 665-5)
-    auto supportFilePtr{ loadFile( *load.parent(), loadFileInfo.filename, loadFileInfo.crc ) };
-
-    const auto supportFileInfo{ regularFilesV.find( supportFilePtr ) };
-    assert( supportFileInfo != regularFilesV.end() );
+    checkLoadFile( loadCrc, *loadCheckValueGenerator, rawLoadFiles, *supportFileInfo, *loadFileInfo, false );
 
-    checkLoadFile( loadCrc, *loadCheckValueGenerator, supportFileInfo->second, loadFileInfo, false );
-
-    load.supportFile( supportFilePtr, loadFileInfo.partNumber, loadFileInfo.checkValue.type() );
+    load.supportFile( supportFilePtr, loadFileInfo->partNumber, loadFileInfo->checkValue.type() );
 
     // Add check value if provided - CRC 16 is not added, as it is handled
     // within addFiles
-    if ( Arinc645::CheckValue::NoCheckValue != loadFileInfo.checkValue )
+    if ( Arinc645::CheckValue::NoCheckValue != loadFileInfo->checkValue )
     {
-      checkValuesV[ supportFilePtr ].emplace( loadFileInfo.checkValue );
+      checkValuesV[ supportFilePtr ].emplace( loadFileInfo->checkValue );
     }
   }
 
@@ -550,6 +671,124 @@ void MediaSetDecompilerImpl::addLoad(
         << boost::errinfo_file_name{ fileInfo.filename } );
     }
   }
+}
+
+void MediaSetDecompilerImpl::deferLoad(
+  Media::Load &load,
+  const Files::FileInfo &fileInfo,
+  const Files::LoadInfo &loadInfo ) const
+{
+  load.contentLoader( [ context{ lazyContextV }, fileInfo, loadInfo ]( Media::File &file )
+  {
+    loadDeferredLoad( *context, static_cast< Media::Load & >( file ), fileInfo, loadInfo );
+  } );
+}
+
+void MediaSetDecompilerImpl::loadDeferredLoad(
+  LazyContext &context,
+  Media::Load &load,
+  const Files::FileInfo &fileInfo,
+  const Files::LoadInfo &loadInfo )
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "decompiler", "Load Deferred Load", fileInfo.filename );
+
+  const std::lock_guard lock{ context.mutex };
+
+  // decode load header
+  const auto rawLoadHeaderFile{
+    readFile( context.readFileHandler, context.statistics.get(), fileInfo.memberSequenceNumber, fileInfo.path() ) };
+  const auto [ loadHeaderFile, dataFilesInfo, supportFilesInfo ]{
+    decodeLoadHeaderFile( rawLoadHeaderFile, context.statistics.get(), loadInfo ) };
+
+  const auto mediaSet{ load.mediaSet() };
+  const auto parent{ load.parent() };
+
+  if ( !mediaSet || !parent )
+  {
+    BOOST_THROW_EXCEPTION(
+      Arinc665Exception()
+      << Helper::AdditionalInfo{ "Load not part of a media set" }
+      << boost::errinfo_file_name{ fileInfo.filename } );
+  }
+
+  // resolve data and support files - the load is only modified, when all files are resolved
+  const auto resolveLoadFiles{ [ & ]( const Files::LoadFileInfoTable &loadFilesInfo )
+  {
+    Media::ConstLoadFiles files{};
+
+    for ( const auto &loadFileInfo : loadFilesInfo.entries() )
+    {
+      auto file{ loadFile( *mediaSet, *parent, context.regularFileCrcs, loadFileInfo.filename, loadFileInfo.crc ) };
+
+      // check CRC against list of files (sizes and check values are not checked in lazy mode)
+      if (
+        const auto fileCrc{ context.regularFileCrcs.find( file.get() ) };
+        ( fileCrc == context.regularFileCrcs.end() ) || ( fileCrc->second != loadFileInfo.crc ) )
+      {
+        BOOST_THROW_EXCEPTION(
+          Arinc665Exception()
+          << Helper::AdditionalInfo{ "Load File CRC inconsistent" }
+          << boost::errinfo_file_name{ std::string{ loadFileInfo.filename } } );
+      }
+
+      files.emplace_back( std::move( file ), loadFileInfo.partNumber, loadFileInfo.checkValue.type() );
+    }
+
+    return files;
+  } };
+
+  const auto dataFiles{ resolveLoadFiles( dataFilesInfo ) };
+  const auto supportFiles{ resolveLoadFiles( supportFilesInfo ) };
+
+  loadHeaderAttributes( load, loadHeaderFile );
+  load.dataFiles( dataFiles );
+  load.supportFiles( supportFiles );
+}
+
+MediaSetDecompilerImpl::DecodedLoadHeaderFile MediaSetDecompilerImpl::decodeLoadHeaderFile(
+  const Helper::RawData &rawLoadHeaderFile,
+  MediaSetStatistics * const statistics,
+  const Files::LoadInfo &loadInfo )
+{
+  DecodedLoadHeaderFile decoded{};
+  {
+    MediaSetStatistics::ScopedPhase decodePhase{ statistics, MediaSetStatistics::Phase::LoadHeaderDecode };
+    decoded.loadHeaderFile = Files::LoadHeaderFile{ rawLoadHeaderFile, decoded.dataFiles, decoded.supportFiles };
+  }
+  const auto &loadHeaderFile{ decoded.loadHeaderFile };
+
+  // validate load part number to load information
+  if ( loadInfo.partNumber != loadHeaderFile.partNumber() )
+  {
+    BOOST_THROW_EXCEPTION(
+      Arinc665Exception()
+      << Helper::AdditionalInfo{ "Load part number inconsistent" }
+      << boost::errinfo_file_name{ std::string{ loadInfo.headerFilename } } );
+  }
+
+  // validate THW IDs of load header against the list of loads (order independent, compares interned symbols)
+  if ( !std::ranges::is_permutation( loadInfo.targetHardwareIds, loadHeaderFile.targetHardwareIds() ) )
+  {
+    BOOST_THROW_EXCEPTION(
+      Arinc665Exception()
+      << Helper::AdditionalInfo{ "Load THW IDs inconsistent" }
+      << boost::errinfo_file_name{ std::string{ loadInfo.headerFilename } } );
+  }
+
+  return decoded;
+}
+
+void MediaSetDecompilerImpl::loadHeaderAttributes( Media::Load &load, const Files::LoadHeaderFile &loadHeaderFile )
+{
+  load.partFlags( loadHeaderFile.partFlags() );
+  load.loadType( loadHeaderFile.loadType() );
+
+  // THW IDs are already set from the list of loads - only their positions are assigned, which keeps the THW IDs
+  // readable without loading the deferred content
+  for ( const auto &[ thwId, positions ] : loadHeaderFile.targetHardwareIdsPositions() )
+  {
+    load.targetHardwareId( thwId, Media::Load::Positions{ positions.begin(), positions.end() } );
+  }
 
   // User Defined Data
   auto loadUserDefinedData{ loadHeaderFile.userDefinedData() };
@@ -559,11 +798,13 @@ void MediaSetDecompilerImpl::addLoad(
 }
 
 Media::RegularFilePtr MediaSetDecompilerImpl::loadFile(
+  Media::MediaSet &mediaSet,
   Media::ContainerEntity &parent,
+  const RegularFileCrcs &regularFileCrcs,
   std::string_view filename,
-  const uint16_t crc ) const
+  const uint16_t crc )
 {
-  auto files{ mediaSetV->recursiveRegularFiles( filename ) };
+  auto files{ mediaSet.recursiveRegularFiles( filename ) };
 
   // no file found is a failure
   if ( files.empty() )
@@ -602,18 +843,11 @@ Media::RegularFilePtr MediaSetDecompilerImpl::loadFile(
   // find file with same CRC
   for ( const auto &file : files )
   {
-    for ( const auto &checkValue : checkValuesV.at( file ) )
+    if ( const auto fileCrc{ regularFileCrcs.find( file.get() ) };
+      ( fileCrc != regularFileCrcs.end() ) && ( crc == fileCrc->second ) )
     {
-      if ( Arinc645::CheckValueType::Crc16 == checkValue.type() )
-      {
-        if (
-          const auto crcConverted{ Arinc645::CheckValue::crc16( checkValue ) };
-          crcConverted && ( crc == *crcConverted ) )
-        {
-          // CRC matches
-          return file;
-        }
-      }
+      // CRC matches
+      return file;
     }
   }
 
@@ -626,8 +860,41 @@ void MediaSetDecompilerImpl::addBatch(
   const Files::FileInfo &fileInfo,
   const Files::BatchInfo &batchInfo )
 {
-  // Decode batch File
-  Files::BatchFile batchFile{ readFileHandlerV( fileInfo.memberSequenceNumber, fileInfo.path() ) };
+  ARINC_665_TRACE_SCOPE_DETAIL( "decompiler", "Add Batch", fileInfo.filename );
+
+  decodeBatchFile( batch, readFile( fileInfo.memberSequenceNumber, fileInfo.path() ), statisticsV.get(), batchInfo );
+}
+
+void MediaSetDecompilerImpl::deferBatch(
+  Media::Batch &batch,
+  const Files::FileInfo &fileInfo,
+  const Files::BatchInfo &batchInfo ) const
+{
+  batch.contentLoader( [ context{ lazyContextV }, fileInfo, batchInfo ]( Media::File &file )
+  {
+    ARINC_665_TRACE_SCOPE_DETAIL( "decompiler", "Load Deferred Batch", fileInfo.filename );
+
+    const std::lock_guard lock{ context->mutex };
+
+    decodeBatchFile(
+      static_cast< Media::Batch & >( file ),
+      readFile( context->readFileHandler, context->statistics.get(), fileInfo.memberSequenceNumber, fileInfo.path() ),
+      context->statistics.get(),
+      batchInfo );
+  } );
+}
+
+void MediaSetDecompilerImpl::decodeBatchFile(
+  Media::Batch &batch,
+  const Helper::RawData &rawBatchFile,
+  MediaSetStatistics * const statistics,
+  const Files::BatchInfo &batchInfo )
+{
+  Files::BatchFile batchFile{};
+  {
+    MediaSetStatistics::ScopedPhase decodePhase{ statistics, MediaSetStatistics::Phase::BatchFileDecode };
+    batchFile = rawBatchFile;
+  }
 
   // validate batch part number to batch information
   if ( batchInfo.partNumber != batchFile.partNumber() )
@@ -638,8 +905,18 @@ void MediaSetDecompilerImpl::addBatch(
       << boost::errinfo_file_name{ std::string{ batchInfo.filename } } );
   }
 
-  batch.partNumber( std::string{ batchFile.partNumber() } );
-  batch.comment( std::string{ batchFile.comment() } );
+  const auto mediaSet{ batch.mediaSet() };
+
+  if ( !mediaSet )
+  {
+    BOOST_THROW_EXCEPTION(
+      Arinc665Exception()
+      << Helper::AdditionalInfo{ "Batch not part of a media set" }
+      << boost::errinfo_file_name{ std::string{ batchInfo.filename } } );
+  }
+
+  // the batch is only modified, when all loads are found
+  Media::ConstBatchInformation targets{};
 
   // iterate over target hardware
   for ( const auto &targetHardware : batchFile.targetsHardware() )
@@ -650,7 +927,7 @@ void MediaSetDecompilerImpl::addBatch(
     for ( const auto& load : targetHardware.loads )
     {
       // start search in parent directory of batch (according ARINC 665-5)
-      const auto loads{ mediaSetV->recursiveLoads( load.headerFilename ) };
+      const auto loads{ mediaSet->recursiveLoads( load.headerFilename ) };
 
       if ( loads.empty() )
       {
@@ -668,7 +945,7 @@ void MediaSetDecompilerImpl::addBatch(
           << boost::errinfo_file_name{ std::string{ load.headerFilename } } );
       }
 
-      // check that Part Number Information matches
+      // check that Part Number Information matches (provided by the list of loads)
       if ( loads.front()->partNumber() != load.partNumber )
       {
         BOOST_THROW_EXCEPTION(
@@ -680,8 +957,15 @@ void MediaSetDecompilerImpl::addBatch(
       batchLoads.emplace_back( loads.front() );
     }
 
-    // add Target Hardware/ Position
-    batch.target( targetHardware.targetHardwareIdPosition, batchLoads );
+    targets.try_emplace( targetHardware.targetHardwareIdPosition, std::move( batchLoads ) );
+  }
+
+  batch.comment( std::string{ batchFile.comment() } );
+
+  // add Target Hardware/ Position
+  for ( const auto &[ targetHardwareIdPosition, loads ] : targets )
+  {
+    batch.target( targetHardwareIdPosition, loads );
   }
 }
 
@@ -719,50 +1003,124 @@ Media::ContainerEntityPtr MediaSetDecompilerImpl::checkCreateDirectory( const st
 
 void MediaSetDecompilerImpl::checkMediumFiles( const MediumNumber &mediumNumber ) const
 {
-  // iterate over files
+  // skip file integrity checks if requested (never performed in lazy mode)
+  if ( !checkFileIntegrityV || !checkListedFilesV || lazyV )
+  {
+    return;
+  }
+
+  // files of the current medium
+  struct MediumFile
+  {
+    //! File Information
+    const Files::FileInfo *fileInfo;
+    //! File Size - bounds the batches of read files
+    std::size_t size;
+    //! Physical Location - defines the order of reads
+    std::uint64_t location;
+  };
+
+  std::vector< MediumFile > mediumFiles{};
   for ( const auto &[ filename, fileInfo ] : filesInfosV )
   {
-    // skip files, which are not part of the current medium
-    if ( fileInfo.memberSequenceNumber != mediumNumber )
+    if ( fileInfo.memberSequenceNumber == mediumNumber )
     {
-      continue;
+      const auto fileSize{ fileSizeHandlerV( mediumNumber, fileInfo.path() ) };
+      mediumFiles.emplace_back( MediumFile{
+        .fileInfo = &fileInfo,
+        .size = fileSize,
+        .location = fileLocationHandlerV ? fileLocationHandlerV( mediumNumber, fileInfo.path() ) : 0U } );
+      byteProgressV.addTotalBytes( fileSize );
     }
+  }
+
+  // read files in the order of their placement on the medium - avoids seeks on rotational and slow media
+  std::ranges::stable_sort( mediumFiles, std::ranges::less{}, &MediumFile::location );
 
-    // skip file integrity checks if requested
-    if ( !checkFileIntegrityV )
+  // files are read and digested in batches
+  std::vector< std::pair< std::size_t, std::vector< std::filesystem::path > > > batches{};
+  std::size_t batchSize{ DigestBatchSize };
+
+  for ( std::size_t index{ 0U }; index < mediumFiles.size(); ++index )
+  {
+    if ( batchSize >= DigestBatchSize )
     {
-      continue;
+      batches.emplace_back( index, std::vector< std::filesystem::path >{} );
+      batchSize = 0U;
     }
 
-    checkFileIntegrity( fileInfo );
+    batches.back().second.emplace_back( mediumFiles[ index ].fileInfo->path() );
+    batchSize += mediumFiles[ index ].size;
+  }
+
+  // the next batch is read, while the current batch is digested
+  ReadAhead< std::vector< Helper::RawData > > rawBatches{ batches.size(), [ & ]( const std::size_t index )
+  {
+    return readFiles( mediumNumber, batches[ index ].second );
+  } };
+
+  for ( const auto &[ firstFile, paths ] : batches )
+  {
+    byteProgressV.checkCancelled();
+    byteProgressV.currentFile( paths.front() );
+
+    auto rawFiles{ rawBatches.next() };
+
+    FileContents files{};
+    files.reserve( rawFiles.size() );
+    for ( std::size_t index{ 0U }; index < rawFiles.size(); ++index )
+    {
+      files.emplace_back( mediumFiles[ firstFile + index ].fileInfo, std::move( rawFiles[ index ] ) );
+    }
+
+    checkFilesIntegrity( files );
   }
 }
 
-void MediaSetDecompilerImpl::checkFileIntegrity( const Files::FileInfo &fileInfo ) const
+void MediaSetDecompilerImpl::checkFilesIntegrity( const FileContents &files ) const
 {
-  SPDLOG_TRACE( "Check file '{}'", fileInfo.path().generic_string() );
+  if ( files.empty() )
+  {
+    return;
+  }
+
+  ARINC_665_TRACE_SCOPE_DETAIL( "digest", "Batch Digest", std::to_string( files.size() ) );
 
-  const auto rawFile{ readFileHandlerV( fileInfo.memberSequenceNumber, fileInfo.path() ) };
+  std::vector< DigestRequest > requests{};
+  requests.reserve( files.size() );
+  std::uint64_t batchSize{ 0U };
 
-  // compare checksums
-  if (
-    const auto crc{ Files::Arinc665File::calculateChecksum( rawFile ) };
-    crc != fileInfo.crc )
+  for ( const auto &[ fileInfo, rawFile ] : files )
   {
-    BOOST_THROW_EXCEPTION( Arinc665Exception()
-      << Helper::AdditionalInfo{ "CRC of file invalid" }
-      << boost::errinfo_file_name{ fileInfo.path().string() } );
+    SPDLOG_TRACE( "Check file '{}'", fileInfo->path().generic_string() );
+    requests.emplace_back( DigestRequest{ .data = rawFile, .checkValueType = fileInfo->checkValue.type() } );
+    batchSize += rawFile.size();
   }
 
-  // Check and compare Check Value
-  if (
-    Arinc645::CheckValueType::NotUsed != fileInfo.checkValue.type() )
+  std::vector< Digest > digests{};
   {
-    const auto checkValueCalculated{ Arinc645::CheckValueGenerator::checkValue(
-      fileInfo.checkValue.type(),
-      std::as_bytes( Helper::ConstRawDataSpan{ rawFile } ) ) };
+    MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+    digests = BatchDigest_calculate( requests, 0U, stopTokenV );
+  }
 
-    if ( fileInfo.checkValue != checkValueCalculated )
+  byteProgressV.advance( batchSize );
+
+  for ( std::size_t index{ 0U }; index < files.size(); ++index )
+  {
+    const auto &fileInfo{ *files[ index ].first };
+
+    // compare checksums
+    if ( digests[ index ].crc != fileInfo.crc )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "CRC of file invalid" }
+        << boost::errinfo_file_name{ fileInfo.path().string() } );
+    }
+
+    // Check and compare Check Value
+    if (
+      ( Arinc645::CheckValueType::NotUsed != fileInfo.checkValue.type() )
+      && ( fileInfo.checkValue != digests[ index ].checkValue ) )
     {
       BOOST_THROW_EXCEPTION( Arinc665Exception()
         << Helper::AdditionalInfo{ "Check Value of file invalid" }
@@ -774,10 +1132,13 @@ void MediaSetDecompilerImpl::checkFileIntegrity( const Files::FileInfo &fileInfo
 void MediaSetDecompilerImpl::checkLoadFile(
   Arinc645::Arinc645Crc32 &loadCrc,
   Arinc645::CheckValueGenerator &loadCheckValueGenerator,
+  ReadAhead< Helper::RawData > &rawLoadFiles,
   const Files::FileInfo &fileInfo,
-  const Files::LoadFileInfo &loadFileInfo,
+  const Files::LoadFileInfoTable::Entry &loadFileInfo,
   bool fileSize16Bit ) const
 {
+  ARINC_665_TRACE_SCOPE_DETAIL( "digest", "Load File Digest", fileInfo.filename );
+
   // get memorised file size ( only when file integrity is checked)
   if ( checkFileIntegrityV )
   {
@@ -792,7 +1153,7 @@ void MediaSetDecompilerImpl::checkLoadFile(
 
       BOOST_THROW_EXCEPTION( Arinc665Exception()
         << Helper::AdditionalInfo{ "Load File Size inconsistent" }
-        << boost::errinfo_file_name{ loadFileInfo.filename } );
+        << boost::errinfo_file_name{ std::string{ loadFileInfo.filename } } );
     }
   }
 
@@ -802,7 +1163,7 @@ void MediaSetDecompilerImpl::checkLoadFile(
     BOOST_THROW_EXCEPTION(
       Arinc665Exception()
       << Helper::AdditionalInfo{ "Load File CRC inconsistent" }
-      << boost::errinfo_file_name{ loadFileInfo.filename } );
+      << boost::errinfo_file_name{ std::string{ loadFileInfo.filename } } );
   }
 
   // Check File Check Value
@@ -811,21 +1172,33 @@ void MediaSetDecompilerImpl::checkLoadFile(
   // Load CRC, Load Check Value and File Check Value Check
   if ( checkFileIntegrityV )
   {
-    const auto rawDataFile{ readFileHandlerV( fileInfo.memberSequenceNumber, fileInfo.path() ) };
+    const auto rawDataFile{ rawLoadFiles.next() };
 
-    loadCrc.process_bytes( rawDataFile.data(), rawDataFile.size() );
-    loadCheckValueGenerator.process( std::as_bytes( Helper::ConstRawDataSpan{ rawDataFile } ) );
+    // Load File Check Value is only calculated, when not already checked against the file list
+    auto fileCheckValueGenerator{ Arinc645::CheckValueGenerator::create(
+      fileCheckValueChecked ? Arinc645::CheckValueType::NotUsed : loadFileInfo.checkValue.type() ) };
+    assert( fileCheckValueGenerator );
+
+    byteProgressV.currentFile( fileInfo.path() );
+    byteProgressV.process( rawDataFile, [ & ]( const Helper::ConstRawDataSpan chunk )
+    {
+      {
+        MediaSetStatistics::ScopedPhase crcPhase{ statisticsV.get(), MediaSetStatistics::Phase::Crc };
+        loadCrc.process_bytes( chunk.data(), chunk.size() );
+      }
+
+      MediaSetStatistics::ScopedPhase checkValuePhase{ statisticsV.get(), MediaSetStatistics::Phase::CheckValue };
+      loadCheckValueGenerator.process( std::as_bytes( chunk ) );
+      fileCheckValueGenerator->process( std::as_bytes( chunk ) );
+    } );
 
     // Load file Check Value
-    if ( !fileCheckValueChecked
-      && ( Arinc645::CheckValueGenerator::checkValue(
-        loadFileInfo.checkValue.type(),
-        std::as_bytes( Helper::ConstRawDataSpan{ rawDataFile } ) ) != loadFileInfo.checkValue ) )
+    if ( !fileCheckValueChecked && ( fileCheckValueGenerator->checkValue() != loadFileInfo.checkValue ) )
     {
       BOOST_THROW_EXCEPTION(
         Arinc665Exception()
           << Helper::AdditionalInfo{ "Load File Check Value inconsistent" }
-          << boost::errinfo_file_name{ loadFileInfo.filename } );
+          << boost::errinfo_file_name{ std::string{ loadFileInfo.filename } } );
     }
   }
 }
@@ -854,4 +1227,86 @@ bool MediaSetDecompilerImpl::checkCheckValues(
   return false;
 }
 
+Helper::RawData MediaSetDecompilerImpl::readFile(
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path ) const
+{
+  return readFile( readFileHandlerV, statisticsV.get(), mediumNumber, path );
+}
+
+Helper::RawData MediaSetDecompilerImpl::readFile(
+  const ReadFileHandler &readFileHandler,
+  MediaSetStatistics * const statistics,
+  const MediumNumber &mediumNumber,
+  const std::filesystem::path &path )
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "handler", "Read File", path.generic_string() );
+
+  if ( nullptr == statistics )
+  {
+    return readFileHandler( mediumNumber, path );
+  }
+
+  const auto start{ std::chrono::steady_clock::now() };
+  Helper::RawData rawFile{};
+  {
+    MediaSetStatistics::ScopedPhase readPhase{ statistics, MediaSetStatistics::Phase::Read };
+    rawFile = readFileHandler( mediumNumber, path );
+  }
+
+  statistics->fileRead(
+    mediumNumber,
+    path,
+    rawFile.size(),
+    std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ) );
+
+  return rawFile;
+}
+
+std::vector< Helper::RawData > MediaSetDecompilerImpl::readFiles(
+  const MediumNumber &mediumNumber,
+  const std::span< const std::filesystem::path > paths ) const
+{
+  std::vector< Helper::RawData > rawFiles{};
+
+  if ( !readFilesHandlerV )
+  {
+    rawFiles.reserve( paths.size() );
+    for ( const auto &path : paths )
+    {
+      rawFiles.emplace_back( readFile( mediumNumber, path ) );
+    }
+
+    return rawFiles;
+  }
+
+  ARINC_665_TRACE_SCOPE_DETAIL( "handler", "Read Files", std::to_string( paths.size() ) );
+
+  const auto start{ std::chrono::steady_clock::now() };
+  {
+    MediaSetStatistics::ScopedPhase readPhase{ statisticsV.get(), MediaSetStatistics::Phase::Read };
+    rawFiles = readFilesHandlerV( mediumNumber, paths );
+  }
+
+  if ( rawFiles.size() != paths.size() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Read files handler returned wrong number of files" } );
+  }
+
+  if ( statisticsV && !paths.empty() )
+  {
+    // files are read concurrently - the duration of the batch is distributed evenly
+    const auto duration{ std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - start ) / paths.size() };
+
+    for ( std::size_t index{ 0U }; index < paths.size(); ++index )
+    {
+      statisticsV->fileRead( mediumNumber, paths[ index ], rawFiles[ index ].size(), duration );
+    }
+  }
+
+  return rawFiles;
+}
+
 }
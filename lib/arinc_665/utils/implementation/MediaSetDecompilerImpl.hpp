@@ -16,15 +16,26 @@
 #include <arinc_665/utils/MediaSetDecompiler.hpp>
 
 #include <arinc_665/files/FileListFile.hpp>
+#include <arinc_665/files/FileInfoTable.hpp>
 #include <arinc_665/files/LoadListFile.hpp>
 #include <arinc_665/files/BatchListFile.hpp>
 #include <arinc_665/files/LoadHeaderFile.hpp>
+#include <arinc_665/files/LoadFileInfoTable.hpp>
 #include <arinc_665/files/BatchFile.hpp>
 
 #include <arinc_665/media/Media.hpp>
+#include <arinc_665/utils/ByteProgressTracker.hpp>
+#include <arinc_665/utils/implementation/ReadAhead.hpp>
+
 #include <arinc_665/media/MediaSet.hpp>
 
+#include <cstddef>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace Arinc665::Utils {
 
@@ -45,12 +56,33 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
     //! @copydoc MediaSetDecompiler::readFileHandler()
     MediaSetDecompiler& readFileHandler( ReadFileHandler readFileHandler ) override;
 
+    //! @copydoc MediaSetDecompiler::readFilesHandler()
+    MediaSetDecompiler& readFilesHandler( ReadFilesHandler readFilesHandler ) override;
+
+    //! @copydoc MediaSetDecompiler::fileLocationHandler()
+    MediaSetDecompiler& fileLocationHandler( FileLocationHandler fileLocationHandler ) override;
+
     //! @copydoc MediaSetDecompiler::progressHandler()
     MediaSetDecompiler& progressHandler( ProgressHandler progressHandler ) override;
 
+    //! @copydoc MediaSetDecompiler::byteProgressHandler()
+    MediaSetDecompiler& byteProgressHandler( ByteProgressHandler byteProgressHandler ) override;
+
+    //! @copydoc MediaSetDecompiler::stopToken()
+    MediaSetDecompiler& stopToken( std::stop_token stopToken ) override;
+
     //! @copydoc MediaSetDecompiler::checkFileIntegrity()
     MediaSetDecompiler& checkFileIntegrity( bool checkFileIntegrity ) noexcept override;
 
+    //! @copydoc MediaSetDecompiler::checkListedFiles()
+    MediaSetDecompiler& checkListedFiles( bool checkListedFiles ) noexcept override;
+
+    //! @copydoc MediaSetDecompiler::lazy()
+    MediaSetDecompiler& lazy( bool lazy ) noexcept override;
+
+    //! @copydoc MediaSetDecompiler::statistics()
+    MediaSetDecompiler& statistics( MediaSetStatisticsPtr statistics ) override;
+
     /**
      * @brief Entry-point of the ARINC 665 Media Set Decompiler.
      *
@@ -61,10 +93,46 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
   private:
     //! Files Information (From File List File) (filename -> file information)
     using FilesInformation = std::multimap< std::string, Files::FileInfo, std::less<> >;
+    //! File Information and File Data of read Files
+    using FileContents = std::vector< std::pair< const Files::FileInfo *, Helper::RawData > >;
     //! Loads Information from List of Loads (filenames -> Load Information)
     using LoadsInformation = std::map< std::string, Files::LoadInfo, std::less<> >;
     //! Batches Information from List of Batches (filename -> Batch Information)
     using BatchesInformation = std::map< std::string, Files::BatchInfo, std::less<> >;
+    //! CRCs of the Regular Files from List of Files (used to resolve load files)
+    using RegularFileCrcs = std::map< const Media::RegularFile *, uint16_t >;
+
+    /**
+     * @brief Context of the deferred Load and Batch Decoding (lazy mode).
+     *
+     * Shared by the content loaders of all loads and batches of the decompiled media set.
+     * It does not reference the decompiler, which might be destroyed before the content is loaded.
+     **/
+    struct LazyContext
+    {
+      //! Serialises the content loaders (read file handler and statistics are not thread-safe)
+      std::mutex mutex;
+      //! Read File Handler
+      ReadFileHandler readFileHandler;
+      //! Statistics
+      MediaSetStatisticsPtr statistics;
+      //! CRCs of the Regular Files
+      RegularFileCrcs regularFileCrcs;
+    };
+
+    //! Load Header File with its bulk decoded Data and Support Files
+    struct DecodedLoadHeaderFile
+    {
+      //! Load Header File (data files and support files are empty)
+      Files::LoadHeaderFile loadHeaderFile;
+      //! Data Files
+      Files::LoadFileInfoTable dataFiles;
+      //! Support Files
+      Files::LoadFileInfoTable supportFiles;
+    };
+
+    //! Maximum Size of read Files, which are digested as a Batch
+    static constexpr std::size_t DigestBatchSize{ 64U * 1024U * 1024U };
 
     /**
      * @brief Loads the first Medium of the Media Set.
@@ -99,6 +167,8 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      * @sa @ref batchFile()
      * @sa @ref addLoad()
      * @sa @ref addBatch()
+     * @sa @ref deferLoad()
+     * @sa @ref deferBatch()
      * @sa @ref checkCreateDirectory()
      **/
     void files();
@@ -116,6 +186,8 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
     /**
      * @brief Add Load Header File
      *
+     * The part number and target hardware IDs are set from the list of loads.
+     *
      * @param[in,out] parent
      *   Parent Container
      * @param[in] fileInfo
@@ -128,6 +200,8 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
     /**
      * @brief Add Batch File
      *
+     * The part number is set from the list of batches.
+     *
      * @param[in,out] parent
      *   Parent Container
      * @param[in] fileInfo
@@ -154,11 +228,80 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      **/
     void addLoad( Media::Load &load, const Files::FileInfo &fileInfo, const Files::LoadInfo &loadInfo );
 
+    /**
+     * @brief Adds the Content Loader, which adds the Load information to the Load on first access (lazy mode).
+     *
+     * @param[in,out] load
+     *   Load
+     * @param[in] fileInfo
+     *   File information
+     * @param[in] loadInfo
+     *   Load Information.
+     **/
+    void deferLoad( Media::Load &load, const Files::FileInfo &fileInfo, const Files::LoadInfo &loadInfo ) const;
+
+    /**
+     * @brief Adds the Load information to the Load on first access (lazy mode).
+     *
+     * Only the consistency of the load header file to the list of loads and the list of files is checked.
+     *
+     * @param[in] context
+     *   Lazy Context.
+     * @param[in,out] load
+     *   Load
+     * @param[in] fileInfo
+     *   File information
+     * @param[in] loadInfo
+     *   Load Information.
+     *
+     * @throw Arinc665Exception
+     *   When the load header file is inconsistent.
+     **/
+    static void loadDeferredLoad(
+      LazyContext &context,
+      Media::Load &load,
+      const Files::FileInfo &fileInfo,
+      const Files::LoadInfo &loadInfo );
+
+    /**
+     * @brief Decodes the Load Header File and checks it against the Load Information.
+     *
+     * @param[in] rawLoadHeaderFile
+     *   Raw Load Header File.
+     * @param[in] statistics
+     *   Statistics. Can be nullptr.
+     * @param[in] loadInfo
+     *   Load Information.
+     *
+     * @return Decoded Load Header File and its Data and Support Files.
+     *
+     * @throw Arinc665Exception
+     *   When the part number or the target hardware IDs are inconsistent to the list of loads.
+     **/
+    [[nodiscard]] static DecodedLoadHeaderFile decodeLoadHeaderFile(
+      const Helper::RawData &rawLoadHeaderFile,
+      MediaSetStatistics *statistics,
+      const Files::LoadInfo &loadInfo );
+
+    /**
+     * @brief Sets the Load Attributes from the Load Header File (without data and support files).
+     *
+     * @param[in,out] load
+     *   Load
+     * @param[in] loadHeaderFile
+     *   Load Header File.
+     **/
+    static void loadHeaderAttributes( Media::Load &load, const Files::LoadHeaderFile &loadHeaderFile );
+
     /**
      * @brief Returns a load file (data or support file) according to ARINC 665 rules.
      *
+     * @param[in] mediaSet
+     *   Media Set
      * @param[in] parent
      *   Parent Container of Load
+     * @param[in] regularFileCrcs
+     *   CRCs of the Regular Files.
      * @param[in] filename
      *   Filename of file to search for
      * @param[in] crc
@@ -168,7 +311,12 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      * @throw Arinc665Exception
      *   If no file can be found.
      **/
-    Media::RegularFilePtr loadFile( Media::ContainerEntity &parent, std::string_view filename, uint16_t crc ) const;
+    [[nodiscard]] static Media::RegularFilePtr loadFile(
+      Media::MediaSet &mediaSet,
+      Media::ContainerEntity &parent,
+      const RegularFileCrcs &regularFileCrcs,
+      std::string_view filename,
+      uint16_t crc );
 
     /**
      * @brief Add the batch information to the Batch.
@@ -184,6 +332,42 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      **/
     void addBatch( Media::Batch &batch, const Files::FileInfo &fileInfo, const Files::BatchInfo &batchInfo );
 
+    /**
+     * @brief Adds the Content Loader, which adds the Batch information to the Batch on first access (lazy mode).
+     *
+     * @param[in,out] batch
+     *   Batch
+     * @param[in] fileInfo
+     *   File information
+     * @param[in] batchInfo
+     *   Batch Information
+     **/
+    void deferBatch( Media::Batch &batch, const Files::FileInfo &fileInfo, const Files::BatchInfo &batchInfo ) const;
+
+    /**
+     * @brief Decodes the Batch File and adds the Batch information to the Batch.
+     *
+     * Used by addBatch() and the content loader of deferBatch().
+     * The batch is only modified, when the batch file is consistent.
+     *
+     * @param[in,out] batch
+     *   Batch
+     * @param[in] rawBatchFile
+     *   Raw Batch File.
+     * @param[in] statistics
+     *   Statistics. Can be nullptr.
+     * @param[in] batchInfo
+     *   Batch Information
+     *
+     * @throw Arinc665Exception
+     *   When the batch file is inconsistent or a load cannot be found.
+     **/
+    static void decodeBatchFile(
+      Media::Batch &batch,
+      const Helper::RawData &rawBatchFile,
+      MediaSetStatistics *statistics,
+      const Files::BatchInfo &batchInfo );
+
     /**
      * @brief Creates the logical directory entry if not already created and return its representation.
      *
@@ -212,16 +396,17 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      * @brief Check File Integrity
      *
      * Calculates and compares File CRC and File Check Value against stored ones.
+     * The files are digested in parallel (see BatchDigest_calculate()).
      *
-     * @param[in] fileInfo
-     *   File Information.
+     * @param[in] files
+     *   File Information and File Data of the files to check.
      *
      * @throw Arinc665Exception
      *   When File CRC does not match.
      * @throw Arinc665Exception
      *   When File Check Value does not match.
      **/
-    void checkFileIntegrity( const Files::FileInfo &fileInfo ) const;
+    void checkFilesIntegrity( const FileContents &files ) const;
 
     /**
      * @brief Preform Checks of Load Files (data and support).
@@ -234,6 +419,8 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
      *   Load CRC
      * @param[in,out] loadCheckValueGenerator
      *   Load Check Value Generator
+     * @param[in,out] rawLoadFiles
+     *   Content of the Load Files (in order of the calls). Only used, when the file integrity is checked.
      * @param[in] fileInfo
      *   File Information
      * @param[in] loadFileInfo
@@ -248,8 +435,9 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
     void checkLoadFile(
       Arinc645::Arinc645Crc32 &loadCrc,
       Arinc645::CheckValueGenerator &loadCheckValueGenerator,
+      ReadAhead< Helper::RawData > &rawLoadFiles,
       const Files::FileInfo &fileInfo,
-      const Files::LoadFileInfo &loadFileInfo,
+      const Files::LoadFileInfoTable::Entry &loadFileInfo,
       bool fileSize16Bit ) const;
 
     /**
@@ -275,14 +463,100 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
       const Arinc645::CheckValue &fileListCheckValue,
       const Arinc645::CheckValue &loadFileCheckValue ) const;
 
+    /**
+     * @brief Reads the given file via the Read File Handler and records statistics.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Relative Path on Medium.
+     *
+     * @return File Data.
+     **/
+    [[nodiscard]] Helper::RawData readFile( const MediumNumber &mediumNumber, const std::filesystem::path &path ) const;
+
+    /**
+     * @brief Reads the given file via the given Read File Handler and records statistics.
+     *
+     * @param[in] readFileHandler
+     *   Read File Handler.
+     * @param[in] statistics
+     *   Statistics. Can be nullptr.
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] path
+     *   Relative Path on Medium.
+     *
+     * @return File Data.
+     **/
+    [[nodiscard]] static Helper::RawData readFile(
+      const ReadFileHandler &readFileHandler,
+      MediaSetStatistics *statistics,
+      const MediumNumber &mediumNumber,
+      const std::filesystem::path &path );
+
+    /**
+     * @brief Reads the given files via the Read Files Handler and records statistics.
+     *
+     * Falls back to readFile() for each file, if no Read Files Handler is set.
+     *
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] paths
+     *   Relative Paths on Medium.
+     *
+     * @return File Data in the order of @p paths.
+     **/
+    [[nodiscard]] std::vector< Helper::RawData > readFiles(
+      const MediumNumber &mediumNumber,
+      std::span< const std::filesystem::path > paths ) const;
+
+    /**
+     * @brief Reads and decodes the given List File.
+     *
+     * @tparam ListFileT
+     *   List File Type.
+     * @tparam TablesT
+     *   Types of the bulk decoded Tables.
+     * @param[in] mediumNumber
+     *   Medium Number
+     * @param[in] filename
+     *   Filename of List File.
+     * @param[out] tables
+     *   Tables, which are passed to the list file constructor (e.g. the file information table of the file list).
+     *
+     * @return Decoded List File.
+     **/
+    template< typename ListFileT, typename... TablesT >
+    [[nodiscard]] ListFileT decodeListFile(
+      const MediumNumber &mediumNumber,
+      std::string_view filename,
+      TablesT &...tables ) const;
+
     //! File Size Handler
     FileSizeHandler fileSizeHandlerV;
     //! Read File Handler
     ReadFileHandler readFileHandlerV;
+    //! Read Files Handler
+    ReadFilesHandler readFilesHandlerV;
+    //! File Location Handler
+    FileLocationHandler fileLocationHandlerV;
     //! Progress Handler
     ProgressHandler progressHandlerV;
     //! Check File Integrity
     bool checkFileIntegrityV{ true };
+    //! Check Listed Files (only if checkFileIntegrityV is set)
+    bool checkListedFilesV{ true };
+    //! Lazy Decompilation
+    bool lazyV{ false };
+    //! Statistics
+    MediaSetStatisticsPtr statisticsV;
+    //! Byte Progress Handler
+    ByteProgressHandler byteProgressHandlerV;
+    //! Stop Token
+    std::stop_token stopTokenV;
+    //! Byte Progress of the current Decompilation
+    mutable ByteProgressTracker byteProgressV;
 
     //! Media Set
     Media::MediaSetPtr mediaSetV;
@@ -291,6 +565,8 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
 
     //! File List File (Load by loadFirstMedium(), used by @ref loadFurtherMedia())
     Files::FileListFile fileListFileV;
+    //! File Information of the File List File (Load by loadFirstMedium(), used by @ref loadFurtherMedia())
+    Files::FileInfoTable filesInfoTableV;
     //! Load List File (Load by loadFirstMedium(), used by @ref loadFurtherMedia())
     Files::LoadListFile loadListFileV;
     //! Batch List File (Load by loadFirstMedium(), used by @ref loadFurtherMedia())
@@ -310,6 +586,10 @@ class MediaSetDecompilerImpl final : public MediaSetDecompiler
       std::map< Media::RegularFilePtr, Files::FileInfo, std::owner_less< Media::RegularFilePtr > >;
     //! Regular Files
     RegularFilesMap regularFilesV;
+    //! CRCs of the Regular Files
+    RegularFileCrcs regularFileCrcsV;
+    //! Context of the deferred Load and Batch Decoding (only in lazy mode)
+    std::shared_ptr< LazyContext > lazyContextV;
     //! Loads Map
     using LoadsMap =
       std::map< Media::LoadPtr, std::pair< Files::FileInfo, Files::LoadInfo >, std::owner_less< Media::LoadPtr > >;
@@ -15,10 +15,17 @@
 #include <arinc_665/media/MediaSet.hpp>
 #include <arinc_665/media/File.hpp>
 #include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/RegularFile.hpp>
 
 #include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
 
+#include <arinc_665/files/FileListFile.hpp>
+#include <arinc_665/files/FileInfoTable.hpp>
+#include <arinc_665/files/LoadHeaderFile.hpp>
+#include <arinc_665/files/LoadFileInfoTable.hpp>
+
 #include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
 
 #include <helper/Exception.hpp>
 
@@ -29,16 +36,71 @@
 
 #include <boost/exception/all.hpp>
 
+#include <fstream>
+#include <map>
+#include <set>
 #include <utility>
 
 namespace Arinc665::Utils {
 
+namespace {
+
+/**
+ * @brief Reads the given file.
+ *
+ * @param[in] filePath
+ *   Path of the file.
+ *
+ * @return File content.
+ *
+ * @throw Arinc665Exception
+ *   When the file cannot be read.
+ **/
+Helper::RawData readFile( const std::filesystem::path &filePath )
+{
+  if ( !std::filesystem::is_regular_file( filePath ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "File not found" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  Helper::RawData data( std::filesystem::file_size( filePath ) );
+
+  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
+
+  if ( !file.is_open() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error opening file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  file.read( reinterpret_cast< char * >( data.data() ), static_cast< std::streamsize >( data.size() ) );
+
+  if ( file.bad() || ( file.gcount() != static_cast< std::streamsize >( data.size() ) ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error reading file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  return data;
+}
+
+}
+
 MediaSetManagerImpl::MediaSetManagerImpl(
   std::filesystem::path directory,
   const bool checkFileIntegrity,
-  LoadProgressHandler loadProgressHandler ) :
+  LoadProgressHandler loadProgressHandler,
+  MediaSetLoadedHandler mediaSetLoadedHandler,
+  std::stop_token stopToken,
+  const bool lazy ) :
   directoryV{ std::move( directory ) }
 {
+  ARINC_665_TRACE_SCOPE( "manager", "Load Media Set Manager" );
+
   const auto configurationFile{ directoryV / ConfigurationFilename };
 
   if ( !std::filesystem::is_regular_file( configurationFile ) )
@@ -54,13 +116,24 @@ MediaSetManagerImpl::MediaSetManagerImpl(
 
   auto configuration{ Arinc665::Utils::MediaSetManagerConfiguration{ configurationProperties } };
 
-  loadMediaSets( configuration.mediaSets, checkFileIntegrity, std::move( loadProgressHandler ) );
+  loadMediaSets(
+    configuration.mediaSets,
+    checkFileIntegrity,
+    std::move( loadProgressHandler ),
+    mediaSetLoadedHandler,
+    stopToken,
+    lazy );
 
   mediaSetDefaultsV = std::move( configuration.defaults );
 }
 
 MediaSetManagerImpl::~MediaSetManagerImpl()
 {
+  if ( !saveConfigurationV )
+  {
+    return;
+  }
+
   try
   {
     saveConfiguration();
@@ -90,7 +163,7 @@ MediaSetManagerConfiguration MediaSetManagerImpl::configuration() const
 {
   MediaSetManagerConfiguration configuration{};
 
-  for ( const auto &[ partNumber, mediaSetPaths ] : mediaSetsPathsV )
+  for ( const auto &[ partNumber, mediaSetPaths ] : currentMediaSets()->paths )
   {
     configuration.mediaSets.emplace_back( mediaSetPaths );
   }
@@ -116,6 +189,11 @@ void MediaSetManagerImpl::saveConfiguration()
   }
 }
 
+void MediaSetManagerImpl::discardConfiguration() noexcept
+{
+  saveConfigurationV = false;
+}
+
 const std::filesystem::path& MediaSetManagerImpl::directory() const
 {
   return directoryV;
@@ -123,15 +201,16 @@ const std::filesystem::path& MediaSetManagerImpl::directory() const
 
 bool MediaSetManagerImpl::hasMediaSet( std::string_view partNumber ) const
 {
-  return mediaSetsInformationV.contains( partNumber );
+  return currentMediaSets()->information.contains( partNumber );
 }
 
 std::optional< MediaSetManagerImpl::MediaSetInformation > MediaSetManagerImpl::mediaSet(
   std::string_view partNumber ) const
 {
-  auto mediaSet{ mediaSetsInformationV.find( partNumber ) };
+  const auto mediaSets{ currentMediaSets() };
+  auto mediaSet{ mediaSets->information.find( partNumber ) };
 
-  if ( mediaSet == mediaSetsInformationV.end() )
+  if ( mediaSet == mediaSets->information.end() )
   {
     return {};
   }
@@ -139,13 +218,32 @@ std::optional< MediaSetManagerImpl::MediaSetInformation > MediaSetManagerImpl::m
   return mediaSet->second;
 }
 
-const MediaSetManagerImpl::MediaSetsInformation& MediaSetManagerImpl::mediaSets() const
+MediaSetManagerImpl::ConstMediaSetsInformationPtr MediaSetManagerImpl::mediaSetsSnapshot() const
 {
-  return mediaSetsInformationV;
+  auto mediaSets{ currentMediaSets() };
+  const auto &information{ mediaSets->information };
+
+  // shares the ownership of the registered media sets
+  return { std::move( mediaSets ), &information };
+}
+
+std::optional< MediaSetPaths > MediaSetManagerImpl::mediaSetPaths( std::string_view partNumber ) const
+{
+  const auto mediaSets{ currentMediaSets() };
+  auto mediaSetPaths{ mediaSets->paths.find( partNumber ) };
+
+  if ( mediaSetPaths == mediaSets->paths.end() )
+  {
+    return {};
+  }
+
+  return mediaSetPaths->second;
 }
 
 void MediaSetManagerImpl::registerMediaSet( const MediaSetPaths &mediaSetPaths, const bool checkFileIntegrity )
 {
+  ARINC_665_TRACE_SCOPE_DETAIL( "manager", "Register Media Set", mediaSetPaths.first.generic_string() );
+
   auto decompiler( FilesystemMediaSetDecompiler::create() );
   assert( decompiler );
 
@@ -154,71 +252,190 @@ void MediaSetManagerImpl::registerMediaSet( const MediaSetPaths &mediaSetPaths,
     ->checkFileIntegrity( checkFileIntegrity )
     .mediaPaths( absoluteMediaPaths( mediaSetPaths ) );
 
-  // import media set
+  // import media set - readers are not blocked meanwhile
   auto [ impMediaSet, checkValues ]{ ( *decompiler )() };
   assert( impMediaSet );
 
-  if ( mediaSet( impMediaSet->partNumber() ) )
+  modifyMediaSets( [ & ]( MediaSets &mediaSets )
   {
-    BOOST_THROW_EXCEPTION( Arinc665Exception()
-      << Helper::AdditionalInfo{ "Media Set already exist" } );
-  }
+    if ( mediaSets.information.contains( impMediaSet->partNumber() ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set already exist" } );
+    }
 
-  std::string partNumber{ impMediaSet->partNumber() };
+    std::string partNumber{ impMediaSet->partNumber() };
 
-  // add to media sets information
-  mediaSetsInformationV.try_emplace( partNumber, std::move( impMediaSet ), std::move( checkValues ) );
+    // add to media sets information
+    mediaSets.information.try_emplace( partNumber, std::move( impMediaSet ), std::move( checkValues ) );
 
-  // add to media sets paths
-  mediaSetsPathsV.try_emplace( partNumber, mediaSetPaths );
+    // add to media sets paths
+    mediaSets.paths.try_emplace( std::move( partNumber ), mediaSetPaths );
+  } );
 }
 
-MediaSetPaths MediaSetManagerImpl::deregisterMediaSet( std::string_view partNumber )
+void MediaSetManagerImpl::registerMediaSet(
+  const MediaSetPaths &mediaSetPaths,
+  Media::ConstMediaSetPtr mediaSet,
+  Media::CheckValues checkValues,
+  const bool verify )
 {
-  auto mediaSetInformation{ mediaSetsInformationV.extract( std::string{ partNumber } ) };
+  CompiledMediaSetsInformation mediaSets{};
+  mediaSets.emplace_back( mediaSetPaths, std::move( mediaSet ), std::move( checkValues ) );
 
-  // extract from media sets information
-  if ( !mediaSetInformation )
+  registerMediaSets( std::move( mediaSets ), verify );
+}
+
+void MediaSetManagerImpl::registerMediaSets( CompiledMediaSetsInformation mediaSets, const bool verify )
+{
+  ARINC_665_TRACE_SCOPE( "manager", "Register Compiled Media Sets" );
+
+  // check all media sets before the first one is registered
+  std::set< std::string_view, std::less<> > partNumbers{};
+
+  for ( const auto &[ mediaSetPaths, mediaSet, checkValues ] : mediaSets )
   {
-    BOOST_THROW_EXCEPTION( Arinc665Exception()
-      << Helper::AdditionalInfo{ "Media Set not found" } );
+    if ( !mediaSet )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set not provided" } );
+    }
+
+    if ( hasMediaSet( mediaSet->partNumber() ) || !partNumbers.emplace( mediaSet->partNumber() ).second )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set already exist" }
+        << boost::errinfo_file_name{ mediaSetPaths.first.string() } );
+    }
+
+    if ( verify )
+    {
+      verifyMediaSet( mediaSetPaths, *mediaSet, checkValues );
+    }
   }
 
-  // extract from media sets paths
-  auto mediaSetPaths{ mediaSetsPathsV.extract( std::string{ partNumber } ) };
+  modifyMediaSets( [ & ]( MediaSets &registeredMediaSets )
+  {
+    // check again, as media sets might have been registered concurrently during verification
+    for ( const auto &[ mediaSetPaths, mediaSet, checkValues ] : mediaSets )
+    {
+      if ( registeredMediaSets.information.contains( mediaSet->partNumber() ) )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665Exception()
+          << Helper::AdditionalInfo{ "Media Set already exist" }
+          << boost::errinfo_file_name{ mediaSetPaths.first.string() } );
+      }
+    }
+
+    for ( auto &[ mediaSetPaths, mediaSet, checkValues ] : mediaSets )
+    {
+      std::string partNumber{ mediaSet->partNumber() };
+
+      // add to media sets information
+      registeredMediaSets.information.try_emplace( partNumber, std::move( mediaSet ), std::move( checkValues ) );
+
+      // add to media sets paths
+      registeredMediaSets.paths.try_emplace( std::move( partNumber ), std::move( mediaSetPaths ) );
+    }
+  } );
+}
 
-  if ( !mediaSetPaths )
+MediaSetPaths MediaSetManagerImpl::deregisterMediaSet( std::string_view partNumber )
+{
+  MediaSetPaths extractedMediaSetPaths{};
+
+  modifyMediaSets( [ & ]( MediaSets &mediaSets )
   {
-    BOOST_THROW_EXCEPTION( Arinc665Exception()
-      << Helper::AdditionalInfo{ "Media Set paths not found" } );
-  }
+    auto mediaSetInformation{ mediaSets.information.extract( std::string{ partNumber } ) };
+
+    // extract from media sets information
+    if ( !mediaSetInformation )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set not found" } );
+    }
+
+    // extract from media sets paths
+    auto mediaSetPaths{ mediaSets.paths.extract( std::string{ partNumber } ) };
+
+    if ( !mediaSetPaths )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set paths not found" } );
+    }
+
+    extractedMediaSetPaths = std::move( mediaSetPaths.mapped() );
+  } );
 
   // return the extracted paths information
-  return mediaSetPaths.mapped();
+  return extractedMediaSetPaths;
 }
 
-Media::ConstLoads MediaSetManagerImpl::loads() const
+void MediaSetManagerImpl::updateMediaSet(
+  std::string_view partNumber,
+  Media::ConstMediaSetPtr mediaSet,
+  Media::CheckValues checkValues )
 {
-  Media::ConstLoads loads{};
+  ARINC_665_TRACE_SCOPE_DETAIL( "manager", "Update Media Set", partNumber );
 
-  for ( const auto &[ partNumber, mediaSet ] : mediaSetsInformationV )
+  if ( !mediaSet || ( mediaSet->partNumber() != partNumber ) )
   {
-    loads.splice( loads.end(), mediaSet.first->recursiveLoads() );
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Media Set Part Number differs" } );
   }
 
-  return loads;
+  modifyMediaSets( [ & ]( MediaSets &mediaSets )
+  {
+    auto mediaSetInformation{ mediaSets.information.find( partNumber ) };
+
+    if ( mediaSetInformation == mediaSets.information.end() )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set not found" } );
+    }
+
+    mediaSetInformation->second = { std::move( mediaSet ), std::move( checkValues ) };
+  } );
 }
 
-Media::ConstBatches MediaSetManagerImpl::batches() const
+Media::ConstLoads MediaSetManagerImpl::loads() const
 {
-  Media::ConstBatches batches{};
+  return currentMediaSets()->index->loads();
+}
 
-  for ( const auto &[ partNumber, mediaSet ] : mediaSetsInformationV )
-  {
-    batches.splice( batches.end(), mediaSet.first->recursiveBatches() );
-  }
+Media::ConstLoads MediaSetManagerImpl::loads( const LoadsQuery &query ) const
+{
+  return currentMediaSets()->index->loads( query );
+}
+
+Media::ConstLoads MediaSetManagerImpl::loadsByPartNumber( std::string_view partNumber ) const
+{
+  return loads( LoadsQuery{ .partNumber = std::string{ partNumber } } );
+}
+
+Media::ConstLoads MediaSetManagerImpl::loadsByHeaderFilename( std::string_view headerFilename ) const
+{
+  return loads( LoadsQuery{ .headerFilename = std::string{ headerFilename } } );
+}
+
+Media::ConstLoads MediaSetManagerImpl::compatibleLoads(
+  std::string_view targetHardwareId,
+  std::optional< std::string_view > position ) const
+{
+  return loads( LoadsQuery{
+    .targetHardwareId = std::string{ targetHardwareId },
+    .targetHardwareIdPosition =
+      position ? std::optional< std::string >{ std::string{ *position } } : std::nullopt } );
+}
 
-  return batches;
+Media::ConstLoads MediaSetManagerImpl::loadsByType( const uint16_t loadTypeId ) const
+{
+  return loads( LoadsQuery{ .loadTypeId = loadTypeId } );
+}
+
+Media::ConstBatches MediaSetManagerImpl::batches() const
+{
+  return currentMediaSets()->index->batches();
 }
 
 std::filesystem::path MediaSetManagerImpl::filePath( const Media::ConstFilePtr &file ) const
@@ -228,9 +445,10 @@ std::filesystem::path MediaSetManagerImpl::filePath( const Media::ConstFilePtr &
     SPDLOG_ERROR( "Given file is empty" );
   }
 
-  auto mediaSetIt{ mediaSetsPathsV.find( file->mediaSet()->partNumber() ) };
+  const auto mediaSets{ currentMediaSets() };
+  auto mediaSetIt{ mediaSets->paths.find( file->mediaSet()->partNumber() ) };
 
-  if ( mediaSetIt == mediaSetsPathsV.end() )
+  if ( mediaSetIt == mediaSets->paths.end() )
   {
     SPDLOG_ERROR( "Media Set not found" );
     return {};
@@ -248,13 +466,54 @@ std::filesystem::path MediaSetManagerImpl::filePath( const Media::ConstFilePtr &
     / file->path().relative_path() ).lexically_normal();
 }
 
+MediaSetManagerImpl::ConstMediaSetsPtr MediaSetManagerImpl::currentMediaSets() const
+{
+  const std::lock_guard lock{ mediaSetsMutexV };
+  return mediaSetsV;
+}
+
+void MediaSetManagerImpl::modifyMediaSets( const std::function< void( MediaSets &mediaSets ) > &modifier )
+{
+  const std::lock_guard modifyLock{ modifyMutexV };
+
+  // readers keep using the current version, until the modified copy is published
+  auto mediaSets{ std::make_shared< MediaSets >( *currentMediaSets() ) };
+  modifier( *mediaSets );
+  mediaSets->index = std::make_shared< const MediaSetManagerIndex >( mediaSets->information );
+
+  ConstMediaSetsPtr publishedMediaSets{ std::move( mediaSets ) };
+
+  {
+    const std::lock_guard lock{ mediaSetsMutexV };
+    mediaSetsV.swap( publishedMediaSets );
+  }
+
+  // the previous version is released outside the lock (if not referenced by readers)
+}
+
 void MediaSetManagerImpl::loadMediaSets(
   const MediaSetManagerConfiguration::MediaSetsPaths &mediaSetsPaths,
   const bool checkFileIntegrity,
-  LoadProgressHandler loadProgressHandler )
+  LoadProgressHandler loadProgressHandler,
+  const MediaSetLoadedHandler &mediaSetLoadedHandler,
+  const std::stop_token &stopToken,
+  const bool lazy )
 {
+  // the loaded media sets replace the registered ones - modifications in between would be lost
+  const std::lock_guard modifyLock{ modifyMutexV };
+
+  MediaSets mediaSets{};
+
   for ( size_t mediaSetCounter{ 1U }; auto const &mediaSetPaths : mediaSetsPaths )
   {
+    if ( stopToken.stop_requested() )
+    {
+      BOOST_THROW_EXCEPTION( OperationCancelled{}
+        << Helper::AdditionalInfo{ "Operation cancelled by request" } );
+    }
+
+    ARINC_665_TRACE_SCOPE_DETAIL( "manager", "Load Media Set", mediaSetPaths.first.generic_string() );
+
     auto decompiler{ FilesystemMediaSetDecompiler::create() };
     assert( decompiler );
 
@@ -268,7 +527,9 @@ void MediaSetManagerImpl::loadMediaSets(
         }
       } )
       .checkFileIntegrity( checkFileIntegrity )
-      .mediaPaths( absoluteMediaPaths( mediaSetPaths ) );
+      .lazy( lazy )
+      .mediaPaths( absoluteMediaPaths( mediaSetPaths ) )
+      .stopToken( stopToken );
 
     // import media set
     auto [ impMediaSet, checkValues ]{ ( *decompiler )() };
@@ -276,15 +537,31 @@ void MediaSetManagerImpl::loadMediaSets(
 
     std::string partNumber{ impMediaSet->partNumber() };
 
+    if ( mediaSetLoadedHandler )
+    {
+      mediaSetLoadedHandler( impMediaSet );
+    }
+
     // add to media sets information
-    mediaSetsInformationV.try_emplace( partNumber, std::move( impMediaSet ), std::move( checkValues ) );
+    mediaSets.information.try_emplace( partNumber, std::move( impMediaSet ), std::move( checkValues ) );
 
     // add to media sets paths
-    mediaSetsPathsV.try_emplace( partNumber, mediaSetPaths );
+    mediaSets.paths.try_emplace( partNumber, mediaSetPaths );
 
     // increment media set Index Counter
     ++mediaSetCounter;
   }
+
+  mediaSets.index = std::make_shared< const MediaSetManagerIndex >( mediaSets.information );
+
+  ConstMediaSetsPtr publishedMediaSets{ std::make_shared< const MediaSets >( std::move( mediaSets ) ) };
+
+  {
+    const std::lock_guard lock{ mediaSetsMutexV };
+    mediaSetsV.swap( publishedMediaSets );
+  }
+
+  // the previous version is released outside the lock (if not referenced by readers)
 }
 
 MediaPaths MediaSetManagerImpl::absoluteMediaPaths( const MediaSetPaths &mediaSetPaths ) const
@@ -300,4 +577,163 @@ MediaPaths MediaSetManagerImpl::absoluteMediaPaths( const MediaSetPaths &mediaSe
   return absoluteMediaPaths;
 }
 
+void MediaSetManagerImpl::verifyMediaSet(
+  const MediaSetPaths &mediaSetPaths,
+  const Media::MediaSet &mediaSet,
+  const Media::CheckValues &checkValues ) const
+{
+  ARINC_665_TRACE_SCOPE_DETAIL( "manager", "Verify Media Set", mediaSetPaths.first.generic_string() );
+
+  const auto mediaPaths{ absoluteMediaPaths( mediaSetPaths ) };
+
+  // checks, that the check values of the file contains the given check value
+  const auto checkCheckValue{
+    [ &checkValues ](
+      const Media::ConstFilePtr &file,
+      const Arinc645::CheckValue &checkValue,
+      const std::filesystem::path &filePath )
+    {
+      const auto fileCheckValues{ checkValues.find( file ) };
+
+      if ( ( checkValues.end() == fileCheckValues ) || !fileCheckValues->second.contains( checkValue ) )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665Exception()
+          << Helper::AdditionalInfo{ "Check Value inconsistent" }
+          << boost::errinfo_file_name{ filePath.string() } );
+      }
+    } };
+
+  // files of media set (medium number and path -> file)
+  std::map< std::pair< MediumNumber, std::string >, Media::ConstFilePtr, std::less<> > files{};
+  for ( const auto &file : mediaSet.recursiveFiles() )
+  {
+    files.try_emplace( { file->effectiveMediumNumber(), file->path().generic_string() }, file );
+  }
+
+  // check list of files of each medium (the file CRC is checked during decoding)
+  for ( const auto &[ mediumNumber, mediumPath ] : mediaPaths )
+  {
+    Files::FileInfoTable filesInfo{};
+    const Files::FileListFile fileListFile{ readFile( mediumPath / ListOfFilesName ), filesInfo };
+
+    if ( ( fileListFile.mediaSetPn() != mediaSet.partNumber() )
+      || ( fileListFile.mediaSequenceNumber() != mediumNumber ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "List of files inconsistent" }
+        << boost::errinfo_file_name{ ( mediumPath / ListOfFilesName ).string() } );
+    }
+
+    if ( filesInfo.size() < mediaSet.recursiveNumberOfFiles() )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "List of files incomplete" }
+        << boost::errinfo_file_name{ ( mediumPath / ListOfFilesName ).string() } );
+    }
+
+    for ( const auto &fileInfo : filesInfo.entries() )
+    {
+      // files of other media are checked with the list of files of their medium
+      if ( fileInfo.memberSequenceNumber != mediumNumber )
+      {
+        continue;
+      }
+
+      const auto filePath{ mediumPath / fileInfo.path().relative_path() };
+
+      if ( !std::filesystem::is_regular_file( filePath ) )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665Exception()
+          << Helper::AdditionalInfo{ "File not found" }
+          << boost::errinfo_file_name{ filePath.string() } );
+      }
+
+      // list of loads and list of batches are not part of the media set
+      if ( ( fileInfo.filename == ListOfLoadsName ) || ( fileInfo.filename == ListOfBatchesName ) )
+      {
+        continue;
+      }
+
+      const auto file{ files.find( std::make_pair( mediumNumber, fileInfo.path().generic_string() ) ) };
+
+      if ( files.end() == file )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665Exception()
+          << Helper::AdditionalInfo{ "File not part of Media Set" }
+          << boost::errinfo_file_name{ filePath.string() } );
+      }
+
+      checkCheckValue( file->second, Arinc645::CheckValue::crc16( fileInfo.crc ), filePath );
+
+      if ( Arinc645::CheckValue::NoCheckValue != fileInfo.checkValue )
+      {
+        checkCheckValue( file->second, fileInfo.checkValue, filePath );
+      }
+    }
+  }
+
+  // checks the load files against the load header file information
+  const auto checkLoadFiles{
+    [ & ](
+      const Media::Load &load,
+      const Media::ConstLoadFiles &loadFiles,
+      const Files::LoadFileInfoTable &loadFilesInfo,
+      const bool length16Bit )
+    {
+      if ( loadFiles.size() != loadFilesInfo.size() )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665Exception()
+          << Helper::AdditionalInfo{ "Load files inconsistent" }
+          << boost::errinfo_file_name{ std::string{ load.name() } } );
+      }
+
+      auto loadFileInfo{ loadFilesInfo.entries().begin() };
+      for ( const auto &[ file, partNumber, checkValueType ] : loadFiles )
+      {
+        const auto filePath{ mediaPaths.at( file->effectiveMediumNumber() ) / file->path().relative_path() };
+
+        if ( ( file->name() != loadFileInfo->filename ) || ( partNumber != loadFileInfo->partNumber ) )
+        {
+          BOOST_THROW_EXCEPTION( Arinc665Exception()
+            << Helper::AdditionalInfo{ "Load file inconsistent" }
+            << boost::errinfo_file_name{ filePath.string() } );
+        }
+
+        // in ARINC 665-2 File Size of Data File is stored as multiple of 16 bit
+        const auto fileSize{ std::filesystem::file_size( filePath ) };
+        if ( length16Bit ? ( fileSize / 2U != loadFileInfo->length / 2U ) : ( fileSize != loadFileInfo->length ) )
+        {
+          BOOST_THROW_EXCEPTION( Arinc665Exception()
+            << Helper::AdditionalInfo{ "File size inconsistent" }
+            << boost::errinfo_file_name{ filePath.string() } );
+        }
+
+        if ( Arinc645::CheckValue::NoCheckValue != loadFileInfo->checkValue )
+        {
+          checkCheckValue( file, loadFileInfo->checkValue, filePath );
+        }
+
+        ++loadFileInfo;
+      }
+    } };
+
+  // check load files against load header files
+  for ( const auto &load : mediaSet.recursiveLoads() )
+  {
+    Files::LoadFileInfoTable dataFilesInfo{};
+    Files::LoadFileInfoTable supportFilesInfo{};
+    const Files::LoadHeaderFile loadHeaderFile{
+      readFile( mediaPaths.at( load->effectiveMediumNumber() ) / load->path().relative_path() ),
+      dataFilesInfo,
+      supportFilesInfo };
+
+    checkLoadFiles(
+      *load,
+      load->dataFiles(),
+      dataFilesInfo,
+      SupportedArinc665Version::Supplement2 == loadHeaderFile.arincVersion() );
+    checkLoadFiles( *load, load->supportFiles(), supportFilesInfo, false );
+  }
+}
+
 }
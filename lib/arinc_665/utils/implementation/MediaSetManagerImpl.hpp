@@ -16,17 +16,32 @@
 #include <arinc_665/utils/Utils.hpp>
 #include <arinc_665/utils/MediaSetManager.hpp>
 #include <arinc_665/utils/MediaSetManagerConfiguration.hpp>
+#include <arinc_665/utils/implementation/MediaSetManagerIndex.hpp>
 
 #include <arinc_665/files/Files.hpp>
 
 #include <arinc_645/CheckValue.hpp>
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+
 namespace Arinc665::Utils {
 
 /**
  * @brief Implementation of MediaSetManager.
  *
  * Uses the FilesystemMediaSetManager to import the Media Sets from the disk.
+ *
+ * The registered media sets (information and paths) are held within an immutable MediaSets instance.
+ * Readers take a reference to the current instance and work on it without further synchronisation.
+ * Writers copy the current instance, modify the copy and publish it (see modifyMediaSets()).
+ * All writers, including loadMediaSets(), are serialised by modifyMutexV.
+ * Only taking the reference and publishing are guarded by mediaSetsMutexV, so readers never wait for the work of a
+ * writer.
+ * Each instance contains the query index of its loads and batches (see MediaSetManagerIndex), which is replaced
+ * before publishing and built on its first query.
  **/
 class MediaSetManagerImpl final : public MediaSetManager
 {
@@ -40,11 +55,20 @@ class MediaSetManagerImpl final : public MediaSetManager
      *   If set to @p true, additional file integrity steps are performed
      * @param[in] loadProgressHandler
      *   Handler for load progress.
+     * @param[in] mediaSetLoadedHandler
+     *   Handler called for each loaded media set.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     * @param[in] lazy
+     *   If set to @p true, the media sets are decompiled lazily.
      **/
     MediaSetManagerImpl(
       std::filesystem::path directory,
       bool checkFileIntegrity,
-      LoadProgressHandler loadProgressHandler );
+      LoadProgressHandler loadProgressHandler,
+      MediaSetLoadedHandler mediaSetLoadedHandler,
+      std::stop_token stopToken,
+      bool lazy );
 
     ~MediaSetManagerImpl() override;
 
@@ -64,6 +88,9 @@ class MediaSetManagerImpl final : public MediaSetManager
     //! @copydoc MediaSetManager::saveConfiguration()
     void saveConfiguration() override;
 
+    //! @copydoc MediaSetManager::discardConfiguration()
+    void discardConfiguration() noexcept override;
+
     //! @copydoc MediaSetManager::directory()
     [[nodiscard]] const std::filesystem::path& directory() const override;
 
@@ -74,18 +101,54 @@ class MediaSetManagerImpl final : public MediaSetManager
     //! @copydoc MediaSetManager::mediaSet(std::string_view) const
     [[nodiscard]] std::optional< MediaSetInformation > mediaSet( std::string_view partNumber ) const override;
 
-    //! @copydoc MediaSetManager::mediaSets() const
-    [[nodiscard]] const MediaSetsInformation& mediaSets() const override;
+    //! @copydoc MediaSetManager::mediaSetsSnapshot() const
+    [[nodiscard]] ConstMediaSetsInformationPtr mediaSetsSnapshot() const override;
+
+    //! @copydoc MediaSetManager::mediaSetPaths() const
+    [[nodiscard]] std::optional< MediaSetPaths > mediaSetPaths( std::string_view partNumber ) const override;
 
     //! @copydoc MediaSetManager::registerMediaSet()
     void registerMediaSet( const MediaSetPaths &mediaSetPaths, bool checkFileIntegrity = true ) override;
 
+    //! @copydoc MediaSetManager::registerMediaSet(const MediaSetPaths&,Media::ConstMediaSetPtr,Media::CheckValues,bool)
+    void registerMediaSet(
+      const MediaSetPaths &mediaSetPaths,
+      Media::ConstMediaSetPtr mediaSet,
+      Media::CheckValues checkValues,
+      bool verify = true ) override;
+
+    //! @copydoc MediaSetManager::registerMediaSets()
+    void registerMediaSets( CompiledMediaSetsInformation mediaSets, bool verify = true ) override;
+
     //! @copydoc MediaSetManager::deregisterMediaSet()
     [[nodiscard]] MediaSetPaths deregisterMediaSet( std::string_view partNumber ) override;
 
+    //! @copydoc MediaSetManager::updateMediaSet()
+    void updateMediaSet(
+      std::string_view partNumber,
+      Media::ConstMediaSetPtr mediaSet,
+      Media::CheckValues checkValues ) override;
+
     //! @copydoc MediaSetManager::loads() const
     [[nodiscard]] Media::ConstLoads loads() const override;
 
+    //! @copydoc MediaSetManager::loads(const LoadsQuery&) const
+    [[nodiscard]] Media::ConstLoads loads( const LoadsQuery &query ) const override;
+
+    //! @copydoc MediaSetManager::loadsByPartNumber() const
+    [[nodiscard]] Media::ConstLoads loadsByPartNumber( std::string_view partNumber ) const override;
+
+    //! @copydoc MediaSetManager::loadsByHeaderFilename() const
+    [[nodiscard]] Media::ConstLoads loadsByHeaderFilename( std::string_view headerFilename ) const override;
+
+    //! @copydoc MediaSetManager::compatibleLoads() const
+    [[nodiscard]] Media::ConstLoads compatibleLoads(
+      std::string_view targetHardwareId,
+      std::optional< std::string_view > position = {} ) const override;
+
+    //! @copydoc MediaSetManager::loadsByType() const
+    [[nodiscard]] Media::ConstLoads loadsByType( uint16_t loadTypeId ) const override;
+
     //! @copydoc MediaSetManager::batches() const
     [[nodiscard]] Media::ConstBatches batches() const override;
 
@@ -93,20 +156,73 @@ class MediaSetManagerImpl final : public MediaSetManager
     [[nodiscard]] std::filesystem::path filePath( const Media::ConstFilePtr &file ) const override;
 
   private:
+    //! Media Set Paths Map (Part Number -> Media Set Paths)
+    using MediaSetsPaths = std::map< std::string, MediaSetPaths, std::less<> >;
+
+    //! Registered Media Sets - never modified after publishing
+    struct MediaSets
+    {
+      //! Media Sets Information
+      MediaSetsInformation information;
+      //! Media Sets Paths
+      MediaSetsPaths paths;
+      //! Index of the Loads and Batches of the Media Sets
+      std::shared_ptr< const MediaSetManagerIndex > index{ std::make_shared< const MediaSetManagerIndex >() };
+    };
+
+    //! Immutable Registered Media Sets
+    using ConstMediaSetsPtr = std::shared_ptr< const MediaSets >;
+
+    /**
+     * @brief Returns the current Registered Media Sets.
+     *
+     * @return Current Registered Media Sets.
+     **/
+    [[nodiscard]] ConstMediaSetsPtr currentMediaSets() const;
+
+    /**
+     * @brief Modifies the Registered Media Sets.
+     *
+     * Writers are serialised.
+     * The modifier operates on a copy of the current registered media sets, which is indexed and published
+     * afterwards.
+     * The index is rebuilt completely (see MediaSetManagerIndex for the cost).
+     * If the modifier throws, nothing is published.
+     *
+     * @param[in] modifier
+     *   Modification of the Registered Media Sets.
+     **/
+    void modifyMediaSets( const std::function< void( MediaSets &mediaSets ) > &modifier );
+
     /**
      * @brief Load Media Sets.
      *
+     * The loaded media sets replace the registered media sets.
+     * Modifications are blocked while loading, as they would be lost otherwise.
+     *
      * @param[in] mediaSetsPaths
      *   Media Sets Paths.
      * @param[in] checkFileIntegrity
      *   If set to true additional file integrity steps are performed
      * @param[in] loadProgressHandler
      *   Handler for load progress.
+     * @param[in] mediaSetLoadedHandler
+     *   Handler called for each loaded media set.
+     * @param[in] stopToken
+     *   Stop Token used for Cancellation.
+     * @param[in] lazy
+     *   If set to true, the media sets are decompiled lazily.
+     *
+     * @throw OperationCancelled
+     *   When cancellation has been requested.
      **/
     void loadMediaSets(
       const MediaSetManagerConfiguration::MediaSetsPaths &mediaSetsPaths,
       bool checkFileIntegrity,
-      LoadProgressHandler loadProgressHandler );
+      LoadProgressHandler loadProgressHandler,
+      const MediaSetLoadedHandler &mediaSetLoadedHandler,
+      const std::stop_token &stopToken,
+      bool lazy );
 
     /**
      * @brief Converts the given Media Set Paths to absolute Media Paths.
@@ -121,17 +237,39 @@ class MediaSetManagerImpl final : public MediaSetManager
      **/
     [[nodiscard]] MediaPaths absoluteMediaPaths( const MediaSetPaths &mediaSetPaths ) const;
 
-    //! Media Set Paths Map (Part Number -> Media Set Paths)
-    using MediaSetsPaths = std::map< std::string, MediaSetPaths, std::less<> >;
+    /**
+     * @brief Verifies the written Media Set against the given Media Set and Check Values.
+     *
+     * Only the list of files and the load header files are read.
+     * Files are checked for existence and size, their content is not read.
+     *
+     * @param[in] mediaSetPaths
+     *   Media Set Paths information.
+     * @param[in] mediaSet
+     *   Media Set
+     * @param[in] checkValues
+     *   Check Values of the Media Set.
+     *
+     * @throw Arinc665Exception
+     *   When the verification fails.
+     **/
+    void verifyMediaSet(
+      const MediaSetPaths &mediaSetPaths,
+      const Media::MediaSet &mediaSet,
+      const Media::CheckValues &checkValues ) const;
 
     //! Media Set Manager Directory
     const std::filesystem::path directoryV;
     //! Media Set Defaults
     MediaSetDefaults mediaSetDefaultsV;
-    //! Media Sets Information
-    MediaSetsInformation mediaSetsInformationV;
-    //! Media Sets Paths
-    MediaSetsPaths mediaSetsPathsV;
+    //! Persist the Configuration on Destruction
+    bool saveConfigurationV{ true };
+    //! Guards mediaSetsV (only the pointer, not the referenced media sets)
+    mutable std::mutex mediaSetsMutexV;
+    //! Registered Media Sets (current version)
+    ConstMediaSetsPtr mediaSetsV{ std::make_shared< const MediaSets >() };
+    //! Serialises the Modifications of the Registered Media Sets
+    std::mutex modifyMutexV;
 };
 
 }
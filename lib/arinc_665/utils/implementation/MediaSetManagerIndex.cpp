@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::MediaSetManagerIndex.
+ **/
+
+#include "MediaSetManagerIndex.hpp"
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Load.hpp>
+
+#include <algorithm>
+
+namespace Arinc665::Utils {
+
+MediaSetManagerIndex::MediaSetManagerIndex( MediaSetManager::MediaSetsInformation mediaSets ) :
+  mediaSetsV{ std::move( mediaSets ) }
+{
+}
+
+Media::ConstLoads MediaSetManagerIndex::loads() const
+{
+  build();
+
+  Media::ConstLoads loads{};
+
+  for ( const auto &entry : loadsV )
+  {
+    loads.emplace_back( entry.load );
+  }
+
+  return loads;
+}
+
+Media::ConstLoads MediaSetManagerIndex::loads( const MediaSetManager::LoadsQuery &query ) const
+{
+  build();
+
+  Media::ConstLoads loads{};
+
+  const auto candidatePositions{ candidates( query ) };
+
+  if ( !candidatePositions )
+  {
+    for ( const auto &entry : loadsV )
+    {
+      if ( matches( entry, query ) )
+      {
+        loads.emplace_back( entry.load );
+      }
+    }
+
+    return loads;
+  }
+
+  for ( const auto position : *candidatePositions )
+  {
+    if ( const auto &entry{ loadsV[ position ] }; matches( entry, query ) )
+    {
+      loads.emplace_back( entry.load );
+    }
+  }
+
+  return loads;
+}
+
+const Media::ConstBatches& MediaSetManagerIndex::batches() const
+{
+  build();
+
+  return batchesV;
+}
+
+void MediaSetManagerIndex::build() const
+{
+  // the indices are assigned when complete, so a failed build (e.g. an unreadable load header) is repeated
+  std::call_once( builtV, [ this ]{
+    Loads loads{};
+    TargetHardwareIds targetHardwareIds{};
+    Media::ConstBatches batches{};
+
+    for ( const auto &[ mediaSetPartNumber, mediaSetInformation ] : mediaSetsV )
+    {
+      const auto &mediaSet{ mediaSetInformation.first };
+
+      for ( auto &load : mediaSet->recursiveLoads() )
+      {
+        const auto position{ loads.size() };
+
+        for ( const auto &[ targetHardwareId, positions ] : load->targetHardwareIdPositions() )
+        {
+          if ( positions.empty() )
+          {
+            targetHardwareIds.emplace(
+              std::pair{ std::string_view{ targetHardwareId }, std::string_view{} },
+              position );
+            continue;
+          }
+
+          for ( const auto &targetHardwarePosition : positions )
+          {
+            targetHardwareIds.emplace(
+              std::pair{ std::string_view{ targetHardwareId }, std::string_view{ targetHardwarePosition } },
+              position );
+          }
+        }
+
+        const auto &loadType{ load->loadType() };
+
+        loads.push_back( LoadEntry{
+          .load = load,
+          .partNumber = load->partNumber(),
+          .headerFilename = load->name(),
+          .loadTypeId = loadType ? std::optional< uint16_t >{ loadType->second } : std::nullopt,
+          .mediaSetPartNumber = mediaSet->partNumber() } );
+      }
+
+      batches.splice( batches.end(), mediaSet->recursiveBatches() );
+    }
+
+    loadsV = std::move( loads );
+    targetHardwareIdsV = std::move( targetHardwareIds );
+    batchesV = std::move( batches );
+  } );
+}
+
+std::optional< MediaSetManagerIndex::Positions > MediaSetManagerIndex::candidates(
+  const MediaSetManager::LoadsQuery &query ) const
+{
+  // most selective criteria first
+  if ( query.partNumber )
+  {
+    return positions< PartNumberTag >( std::string_view{ *query.partNumber } );
+  }
+
+  if ( query.headerFilename )
+  {
+    return positions< HeaderFilenameTag >( std::string_view{ *query.headerFilename } );
+  }
+
+  if ( query.targetHardwareId )
+  {
+    Positions positions{};
+
+    const auto addRange{ [ & ]( const auto &range )
+    {
+      for ( auto it{ range.first }; it != range.second; ++it )
+      {
+        positions.push_back( it->second );
+      }
+    } };
+
+    if ( query.targetHardwareIdPosition )
+    {
+      // loads for the position and loads without position restriction
+      addRange( targetHardwareIdsV.equal_range( { *query.targetHardwareId, *query.targetHardwareIdPosition } ) );
+      addRange( targetHardwareIdsV.equal_range( { *query.targetHardwareId, std::string_view{} } ) );
+    }
+    else
+    {
+      // all positions of the target hardware ID (the empty position is ordered first)
+      for ( auto it{ targetHardwareIdsV.lower_bound( { *query.targetHardwareId, std::string_view{} } ) };
+        ( it != targetHardwareIdsV.end() ) && ( it->first.first == *query.targetHardwareId );
+        ++it )
+      {
+        positions.push_back( it->second );
+      }
+    }
+
+    // a load is indexed for each of its positions
+    std::ranges::sort( positions );
+    positions.erase( std::ranges::unique( positions ).begin(), positions.end() );
+
+    return positions;
+  }
+
+  if ( query.mediaSetPartNumber )
+  {
+    return positions< MediaSetPartNumberTag >( std::string_view{ *query.mediaSetPartNumber } );
+  }
+
+  if ( query.loadTypeId )
+  {
+    return positions< LoadTypeIdTag >( query.loadTypeId );
+  }
+
+  return {};
+}
+
+template< typename Tag, typename Key >
+MediaSetManagerIndex::Positions MediaSetManagerIndex::positions( const Key &key ) const
+{
+  Positions positions{};
+
+  const auto [ begin, end ]{ loadsV.get< Tag >().equal_range( key ) };
+
+  for ( auto it{ begin }; it != end; ++it )
+  {
+    positions.push_back( static_cast< std::size_t >( loadsV.project< 0 >( it ) - loadsV.begin() ) );
+  }
+
+  // keep the order of loads()
+  std::ranges::sort( positions );
+
+  return positions;
+}
+
+bool MediaSetManagerIndex::matches( const LoadEntry &entry, const MediaSetManager::LoadsQuery &query )
+{
+  if ( ( query.partNumber && ( entry.partNumber != *query.partNumber ) )
+    || ( query.headerFilename && ( entry.headerFilename != *query.headerFilename ) )
+    || ( query.loadTypeId && ( entry.loadTypeId != query.loadTypeId ) )
+    || ( query.mediaSetPartNumber && ( entry.mediaSetPartNumber != *query.mediaSetPartNumber ) ) )
+  {
+    return false;
+  }
+
+  if ( !query.targetHardwareId )
+  {
+    return true;
+  }
+
+  const auto &targetHardwareIdPositions{ entry.load->targetHardwareIdPositions() };
+  const auto positions{ targetHardwareIdPositions.find( *query.targetHardwareId ) };
+
+  if ( positions == targetHardwareIdPositions.end() )
+  {
+    return false;
+  }
+
+  return !query.targetHardwareIdPosition
+    || positions->second.empty()
+    || positions->second.contains( *query.targetHardwareIdPosition );
+}
+
+}
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::MediaSetManagerIndex.
+ **/
+
+#ifndef ARINC_665_UTILS_IMPLEMENTATION_MEDIASETMANAGERINDEX_HPP
+#define ARINC_665_UTILS_IMPLEMENTATION_MEDIASETMANAGERINDEX_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+#include <arinc_665/utils/MediaSetManager.hpp>
+
+#include <arinc_665/media/Media.hpp>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/random_access_index.hpp>
+#include <boost/multi_index/tag.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Query Index of the Loads and Batches of the registered Media Sets.
+ *
+ * The index is built for a fixed set of media sets and is never modified afterwards.
+ * The keys reference the strings of the indexed loads and media sets, which are kept alive by the index.
+ *
+ * The index is built on the first query and not on construction.
+ * Indexing accesses the load type and target hardware positions of each load, which are part of the load header
+ * file.
+ * So media sets decompiled lazily (see MediaSetDecompiler::lazy()) keep their load header files unread until the
+ * loads are queried.
+ *
+ * Loads are indexed by their part number, header filename, load type and media set part number.
+ * The target hardware IDs are indexed separately, as a load has several of them.
+ *
+ * @par Rebuild Cost
+ * The index is not updated incrementally, but rebuilt from all media sets for each registration and
+ * de-registration (see MediaSetManagerImpl::modifyMediaSets()).
+ * This costs O(L log L) for L loads in total plus the traversal of all media sets, which is small compared to the
+ * decompilation of a registered media set.
+ * The rebuild is done by the first querying thread after publishing.
+ * Concurrent queries of the same index wait for it, queries of other published versions are not blocked.
+ * An incremental update is not possible in place, as the index is shared by the published snapshots, and the
+ * positions stored within the target hardware index change when loads are removed.
+ **/
+class ARINC_665_EXPORT MediaSetManagerIndex
+{
+  public:
+    //! Builds an empty index.
+    MediaSetManagerIndex() = default;
+
+    /**
+     * @brief Initialises the Index for the given Media Sets.
+     *
+     * The index is built on the first query.
+     *
+     * @param[in] mediaSets
+     *   Media Sets to index.
+     **/
+    explicit MediaSetManagerIndex( MediaSetManager::MediaSetsInformation mediaSets );
+
+    /**
+     * @brief Returns all Loads.
+     *
+     * @return All loads (ordered by media set part number).
+     **/
+    [[nodiscard]] Media::ConstLoads loads() const;
+
+    /**
+     * @brief Returns the Loads matching the Query.
+     *
+     * The index of the most selective criterion is used to determine the candidates, which are checked against the
+     * other criteria afterwards.
+     *
+     * @param[in] query
+     *   Loads Query.
+     *
+     * @return Matching loads (ordered like loads()).
+     **/
+    [[nodiscard]] Media::ConstLoads loads( const MediaSetManager::LoadsQuery &query ) const;
+
+    /**
+     * @brief Returns all Batches.
+     *
+     * @return All batches (ordered by media set part number).
+     **/
+    [[nodiscard]] const Media::ConstBatches& batches() const;
+
+  private:
+    //! Index Tag: Load Part Number
+    struct PartNumberTag{};
+    //! Index Tag: Load Header Filename
+    struct HeaderFilenameTag{};
+    //! Index Tag: Load Type ID
+    struct LoadTypeIdTag{};
+    //! Index Tag: Media Set Part Number
+    struct MediaSetPartNumberTag{};
+
+    //! Indexed Load
+    struct LoadEntry
+    {
+      //! Load
+      Media::ConstLoadPtr load;
+      //! Load Part Number
+      std::string_view partNumber;
+      //! Load Header Filename
+      std::string_view headerFilename;
+      //! Load Type ID
+      std::optional< uint16_t > loadTypeId;
+      //! Media Set Part Number
+      std::string_view mediaSetPartNumber;
+    };
+
+    //! Loads Container (random access index keeps the order of loads())
+    using Loads = boost::multi_index_container<
+      LoadEntry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::random_access<>,
+        boost::multi_index::ordered_non_unique<
+          boost::multi_index::tag< PartNumberTag >,
+          boost::multi_index::member< LoadEntry, std::string_view, &LoadEntry::partNumber >,
+          std::less<> >,
+        boost::multi_index::ordered_non_unique<
+          boost::multi_index::tag< HeaderFilenameTag >,
+          boost::multi_index::member< LoadEntry, std::string_view, &LoadEntry::headerFilename >,
+          std::less<> >,
+        boost::multi_index::ordered_non_unique<
+          boost::multi_index::tag< LoadTypeIdTag >,
+          boost::multi_index::member< LoadEntry, std::optional< uint16_t >, &LoadEntry::loadTypeId > >,
+        boost::multi_index::ordered_non_unique<
+          boost::multi_index::tag< MediaSetPartNumberTag >,
+          boost::multi_index::member< LoadEntry, std::string_view, &LoadEntry::mediaSetPartNumber >,
+          std::less<> > > >;
+
+    /**
+     * @brief Target Hardware Index ((Target Hardware ID, Position) -> Position within loadsV).
+     *
+     * Loads without position restriction are indexed with an empty position.
+     **/
+    using TargetHardwareIds = std::multimap< std::pair< std::string_view, std::string_view >, std::size_t >;
+
+    //! Positions within loadsV
+    using Positions = std::vector< std::size_t >;
+
+    /**
+     * @brief Builds the Index, if not already done.
+     *
+     * Must be called by each query before accessing the indices.
+     **/
+    void build() const;
+
+    /**
+     * @brief Returns the Candidates for the Query.
+     *
+     * @param[in] query
+     *   Loads Query.
+     *
+     * @return Positions of the candidates within loadsV (ordered and unique).
+     * @retval {}
+     *   If the query provides no indexed criterion (all loads are candidates).
+     **/
+    [[nodiscard]] std::optional< Positions > candidates( const MediaSetManager::LoadsQuery &query ) const;
+
+    /**
+     * @brief Returns the Positions of the Loads within the given Range of an ordered Index.
+     *
+     * @tparam Tag
+     *   Index Tag.
+     * @tparam Key
+     *   Key Type.
+     *
+     * @param[in] key
+     *   Key to look up.
+     *
+     * @return Positions within loadsV (ordered).
+     **/
+    template< typename Tag, typename Key >
+    [[nodiscard]] Positions positions( const Key &key ) const;
+
+    /**
+     * @brief Checks if the Load matches all Criteria of the Query.
+     *
+     * @param[in] entry
+     *   Indexed Load.
+     * @param[in] query
+     *   Loads Query.
+     *
+     * @return If the load matches the query.
+     **/
+    [[nodiscard]] static bool matches( const LoadEntry &entry, const MediaSetManager::LoadsQuery &query );
+
+    //! Indexed Media Sets
+    const MediaSetManager::MediaSetsInformation mediaSetsV;
+    //! Guards the Build of the Index
+    mutable std::once_flag builtV;
+    //! Indexed Loads
+    mutable Loads loadsV;
+    //! Target Hardware Index
+    mutable TargetHardwareIds targetHardwareIdsV;
+    //! All Batches
+    mutable Media::ConstBatches batchesV;
+};
+
+}
+
+#endif
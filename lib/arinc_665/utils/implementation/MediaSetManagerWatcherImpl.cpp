@@ -0,0 +1,611 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::MediaSetManagerWatcherImpl.
+ **/
+
+#if defined( __linux__ )
+
+#include "MediaSetManagerWatcherImpl.hpp"
+
+#include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
+#include <arinc_665/utils/MediaSetManagerConfiguration.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+#include <arinc_665/Trace.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/exception/all.hpp>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <system_error>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+//! Events watched within the directories of media sets
+constexpr uint32_t MediaSetEvents{
+  IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF };
+
+//! Events watched within the Media Set Manager directory (configuration file written or replaced, directory created)
+constexpr uint32_t ConfigurationEvents{ IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO };
+
+/**
+ * @brief Returns the Content of the Configuration File, as written by MediaSetManager::saveConfiguration().
+ *
+ * @param[in] configuration
+ *   Media Set Manager Configuration.
+ *
+ * @return Content of the configuration file.
+ **/
+std::string configurationContent( const MediaSetManagerConfiguration &configuration )
+{
+  std::ostringstream stream{};
+  boost::property_tree::write_json( stream, configuration.toProperties() );
+  return std::move( stream ).str();
+}
+
+}
+
+MediaSetManagerWatcherImpl::MediaSetManagerWatcherImpl(
+  const MediaSetManager &mediaSetManager,
+  ChangeHandler changeHandler,
+  const bool checkFileIntegrity ) :
+  directoryV{ mediaSetManager.directory() },
+  changeHandlerV{ std::move( changeHandler ) },
+  checkFileIntegrityV{ checkFileIntegrity },
+  inotifyV{ ::inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) }
+{
+  if ( inotifyV.get() < 0 )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Initialising file system watching failed" }
+      << boost::errinfo_errno{ errno } );
+  }
+
+  configurationWatchV = ::inotify_add_watch( inotifyV.get(), directoryV.c_str(), ConfigurationEvents );
+
+  if ( configurationWatchV < 0 )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665Exception()
+      << Helper::AdditionalInfo{ "Watching Media Set Manager directory failed" }
+      << boost::errinfo_errno{ errno }
+      << boost::errinfo_file_name{ directoryV.string() } );
+  }
+
+  watch( mediaSetManager );
+
+  threadV = std::jthread{ std::bind_front( &MediaSetManagerWatcherImpl::run, this ) };
+}
+
+void MediaSetManagerWatcherImpl::watch( const MediaSetManager &mediaSetManager )
+{
+  WatchedMediaSets mediaSets{};
+
+  // consistent view, even if the media set manager is modified concurrently
+  const auto mediaSetsInformation{ mediaSetManager.mediaSetsSnapshot() };
+
+  // the configuration file written by the media set manager itself is not reported
+  auto knownConfiguration{ configurationContent( mediaSetManager.configuration() ) };
+
+  for ( const auto &[ partNumber, mediaSetInformation ] : *mediaSetsInformation )
+  {
+    if ( auto mediaSetPaths{ mediaSetManager.mediaSetPaths( partNumber ) }; mediaSetPaths )
+    {
+      auto mediaSet{ mediaSetPaths->first };
+      mediaSets.try_emplace( std::move( mediaSet ), WatchedMediaSet{ partNumber, std::move( *mediaSetPaths ) } );
+    }
+  }
+
+  const std::lock_guard lock{ mutexV };
+
+  knownConfigurationV = std::move( knownConfiguration );
+
+  // media sets no longer registered or registered with other paths
+  for ( auto watchedIt{ watchedMediaSetsV.begin() }; watchedIt != watchedMediaSetsV.end(); )
+  {
+    const auto mediaSetIt{ mediaSets.find( watchedIt->first ) };
+
+    if ( ( mediaSetIt == mediaSets.end() )
+      || ( mediaSetIt->second.mediaSetPaths != watchedIt->second.mediaSetPaths ) )
+    {
+      removeWatches( watchedIt->first );
+      pendingMediaSetsV.erase( watchedIt->first );
+      watchedIt = watchedMediaSetsV.erase( watchedIt );
+    }
+    else
+    {
+      watchedIt->second.partNumber = mediaSetIt->second.partNumber;
+      watchedIt->second.configured = true;
+      ++watchedIt;
+    }
+  }
+
+  // newly registered media sets
+  for ( auto &[ mediaSet, watchedMediaSet ] : mediaSets )
+  {
+    if ( !watchedMediaSetsV.contains( mediaSet ) )
+    {
+      addWatches( watchedMediaSet.mediaSetPaths );
+      watchedMediaSetsV.try_emplace( mediaSet, std::move( watchedMediaSet ) );
+    }
+  }
+}
+
+void MediaSetManagerWatcherImpl::run( const std::stop_token &stopToken )
+{
+  while ( !stopToken.stop_requested() )
+  {
+    ::pollfd pollFd{ .fd = inotifyV.get(), .events = POLLIN, .revents = 0 };
+
+    if ( ::poll( &pollFd, 1U, static_cast< int >( PollInterval.count() ) ) > 0 )
+    {
+      readEvents();
+    }
+
+    {
+      const std::lock_guard lock{ mutexV };
+
+      if ( ( pendingMediaSetsV.empty() && !configurationPendingV )
+        || ( std::chrono::steady_clock::now() - lastEventV < QuietPeriod ) )
+      {
+        continue;
+      }
+    }
+
+    try
+    {
+      processChanges( stopToken );
+    }
+    catch ( const OperationCancelled & )
+    {
+      return;
+    }
+    catch ( const boost::exception &e )
+    {
+      spdlog::error( "Processing Media Set Manager changes: {}", boost::diagnostic_information( e ) );
+    }
+    catch ( const std::exception &e )
+    {
+      spdlog::error( "Processing Media Set Manager changes: {}", e.what() );
+    }
+  }
+}
+
+void MediaSetManagerWatcherImpl::readEvents()
+{
+  alignas( ::inotify_event ) std::array< char, 16U * 1024U > buffer{};
+
+  for ( ;; )
+  {
+    const auto size{ ::read( inotifyV.get(), buffer.data(), buffer.size() ) };
+
+    // no more events available (EAGAIN) or error
+    if ( size <= 0 )
+    {
+      return;
+    }
+
+    const std::lock_guard lock{ mutexV };
+
+    for ( std::size_t offset{ 0U }; offset < static_cast< std::size_t >( size ); )
+    {
+      ::inotify_event event{};
+      std::memcpy( &event, buffer.data() + offset, sizeof( event ) );
+      const std::string_view name{ event.len > 0U ? buffer.data() + offset + sizeof( event ) : "" };
+      offset += sizeof( event ) + event.len;
+
+      // events lost - check everything
+      if ( 0U != ( event.mask & IN_Q_OVERFLOW ) )
+      {
+        for ( const auto &[ mediaSet, watchedMediaSet ] : watchedMediaSetsV )
+        {
+          pendingMediaSetsV.insert( mediaSet );
+        }
+        configurationPendingV = true;
+        lastEventV = std::chrono::steady_clock::now();
+        continue;
+      }
+
+      if ( event.wd == configurationWatchV )
+      {
+        if ( 0U != ( event.mask & IN_ISDIR ) )
+        {
+          // re-created media set directory
+          for ( const auto &[ mediaSet, watchedMediaSet ] : watchedMediaSetsV )
+          {
+            if ( !mediaSet.empty() && ( *mediaSet.begin() == name ) )
+            {
+              addWatches( watchedMediaSet.mediaSetPaths );
+              pendingMediaSetsV.insert( mediaSet );
+              lastEventV = std::chrono::steady_clock::now();
+            }
+          }
+        }
+        else if ( name == MediaSetManager::ConfigurationFilename )
+        {
+          configurationPendingV = true;
+          lastEventV = std::chrono::steady_clock::now();
+        }
+        continue;
+      }
+
+      const auto watchedDirectory{ watchDescriptorsV.find( event.wd ) };
+
+      // watch of removed media set
+      if ( watchedDirectory == watchDescriptorsV.end() )
+      {
+        continue;
+      }
+
+      // watch removed by the kernel (directory deleted)
+      if ( 0U != ( event.mask & IN_IGNORED ) )
+      {
+        watchDescriptorsV.erase( watchedDirectory );
+        continue;
+      }
+
+      const auto mediaSet{ watchedDirectory->second.mediaSet };
+
+      if ( ( 0U != ( event.mask & IN_ISDIR ) ) && ( 0U != ( event.mask & ( IN_CREATE | IN_MOVED_TO ) ) ) )
+      {
+        addDirectoryWatches( mediaSet, watchedDirectory->second.directory / name );
+      }
+
+      pendingMediaSetsV.insert( mediaSet );
+      lastEventV = std::chrono::steady_clock::now();
+    }
+  }
+}
+
+void MediaSetManagerWatcherImpl::processChanges( const std::stop_token &stopToken )
+{
+  std::set< std::filesystem::path > pendingMediaSets{};
+  bool configurationPending{ false };
+
+  {
+    const std::lock_guard lock{ mutexV };
+    pendingMediaSets = std::exchange( pendingMediaSetsV, {} );
+    configurationPending = std::exchange( configurationPendingV, false );
+  }
+
+  if ( configurationPending )
+  {
+    processConfiguration( stopToken );
+  }
+
+  for ( const auto &mediaSet : pendingMediaSets )
+  {
+    WatchedMediaSet watchedMediaSet{};
+    bool removed{ false };
+
+    {
+      const std::lock_guard lock{ mutexV };
+
+      const auto watchedIt{ watchedMediaSetsV.find( mediaSet ) };
+
+      // removed in between
+      if ( watchedIt == watchedMediaSetsV.end() )
+      {
+        continue;
+      }
+
+      watchedMediaSet = watchedIt->second;
+
+      // media set removed from the configuration file before, which directory is gone now
+      if ( !watchedMediaSet.configured && !std::filesystem::exists( directoryV / mediaSet ) )
+      {
+        removeWatches( mediaSet );
+        watchedMediaSetsV.erase( watchedIt );
+        removed = true;
+      }
+      else
+      {
+        // re-add watches of replaced directories
+        addWatches( watchedMediaSet.mediaSetPaths );
+      }
+    }
+
+    if ( removed )
+    {
+      if ( !watchedMediaSet.partNumber.empty() )
+      {
+        changeHandlerV( Change{
+          .type = ChangeType::MediaSetRemoved,
+          .mediaSetPaths = std::move( watchedMediaSet.mediaSetPaths ),
+          .partNumber = std::move( watchedMediaSet.partNumber ),
+          .mediaSetInformation = {},
+          .error = {} } );
+      }
+
+      continue;
+    }
+
+    ARINC_665_TRACE_SCOPE_DETAIL( "manager", "Media Set Changed", mediaSet.generic_string() );
+
+    changeHandlerV( decompile( watchedMediaSet.mediaSetPaths, watchedMediaSet.partNumber, stopToken ) );
+  }
+}
+
+void MediaSetManagerWatcherImpl::processConfiguration( const std::stop_token &stopToken )
+{
+  std::string content{};
+
+  {
+    std::ifstream file{ directoryV / MediaSetManager::ConfigurationFilename, std::ios::binary };
+    std::ostringstream stream{};
+    stream << file.rdbuf();
+    content = std::move( stream ).str();
+  }
+
+  {
+    const std::lock_guard lock{ mutexV };
+
+    // written by the media set manager itself or already processed
+    if ( content == knownConfigurationV )
+    {
+      return;
+    }
+  }
+
+  MediaSetManagerConfiguration configuration{};
+
+  try
+  {
+    std::istringstream stream{ content };
+    boost::property_tree::ptree configurationProperties{};
+    boost::property_tree::json_parser::read_json( stream, configurationProperties );
+    configuration.fromProperties( configurationProperties );
+  }
+  catch ( const boost::property_tree::ptree_error &e )
+  {
+    // the next write of the configuration file is reported again
+    spdlog::warn( "Reading changed Media Set Manager configuration: {}", e.what() );
+    return;
+  }
+
+  std::map< std::filesystem::path, MediaSetPaths > configuredMediaSets{};
+  for ( auto &mediaSetPaths : configuration.mediaSets )
+  {
+    auto mediaSet{ mediaSetPaths.first };
+    configuredMediaSets.try_emplace( std::move( mediaSet ), std::move( mediaSetPaths ) );
+  }
+
+  std::list< Change > removedMediaSets{};
+  std::list< MediaSetPaths > addedMediaSets{};
+
+  {
+    const std::lock_guard lock{ mutexV };
+
+    knownConfigurationV = std::move( content );
+
+    // removed media sets (or media sets with changed media paths, which are added again)
+    for ( auto watchedIt{ watchedMediaSetsV.begin() }; watchedIt != watchedMediaSetsV.end(); )
+    {
+      const auto configuredIt{ configuredMediaSets.find( watchedIt->first ) };
+
+      if ( ( configuredIt != configuredMediaSets.end() )
+        && ( configuredIt->second == watchedIt->second.mediaSetPaths ) )
+      {
+        watchedIt->second.configured = true;
+        ++watchedIt;
+        continue;
+      }
+
+      // a media set is only removed, when its directory is gone - keep watching it until then
+      if ( ( configuredIt == configuredMediaSets.end() )
+        && std::filesystem::exists( directoryV / watchedIt->first ) )
+      {
+        if ( watchedIt->second.configured )
+        {
+          spdlog::warn(
+            "Media Set '{}' removed from configuration, but its directory still exists - keeping it",
+            watchedIt->first.string() );
+        }
+
+        watchedIt->second.configured = false;
+        ++watchedIt;
+        continue;
+      }
+
+      if ( !watchedIt->second.partNumber.empty() )
+      {
+        removedMediaSets.emplace_back( Change{
+          .type = ChangeType::MediaSetRemoved,
+          .mediaSetPaths = watchedIt->second.mediaSetPaths,
+          .partNumber = watchedIt->second.partNumber,
+          .mediaSetInformation = {},
+          .error = {} } );
+      }
+
+      removeWatches( watchedIt->first );
+      pendingMediaSetsV.erase( watchedIt->first );
+      watchedIt = watchedMediaSetsV.erase( watchedIt );
+    }
+
+    // added media sets
+    for ( auto &[ mediaSet, mediaSetPaths ] : configuredMediaSets )
+    {
+      if ( !watchedMediaSetsV.contains( mediaSet ) )
+      {
+        addWatches( mediaSetPaths );
+        watchedMediaSetsV.try_emplace( mediaSet, WatchedMediaSet{ {}, mediaSetPaths } );
+        addedMediaSets.emplace_back( std::move( mediaSetPaths ) );
+      }
+    }
+  }
+
+  for ( auto &change : removedMediaSets )
+  {
+    changeHandlerV( std::move( change ) );
+  }
+
+  for ( const auto &mediaSetPaths : addedMediaSets )
+  {
+    changeHandlerV( decompile( mediaSetPaths, {}, stopToken ) );
+  }
+}
+
+MediaSetManagerWatcher::Change MediaSetManagerWatcherImpl::decompile(
+  const MediaSetPaths &mediaSetPaths,
+  const std::string &partNumber,
+  const std::stop_token &stopToken )
+{
+  Change change{
+    .type = partNumber.empty() ? ChangeType::MediaSetAdded : ChangeType::MediaSetUpdated,
+    .mediaSetPaths = mediaSetPaths,
+    .partNumber = partNumber,
+    .mediaSetInformation = {},
+    .error = {} };
+
+  try
+  {
+    MediaPaths mediaPaths{};
+    for ( const auto &[ mediumNumber, mediumPath ] : mediaSetPaths.second )
+    {
+      mediaPaths.try_emplace( mediumNumber, ( directoryV / mediaSetPaths.first / mediumPath ).lexically_normal() );
+    }
+
+    auto decompiler{ FilesystemMediaSetDecompiler::create() };
+    assert( decompiler );
+
+    decompiler
+      ->checkFileIntegrity( checkFileIntegrityV )
+      .mediaPaths( std::move( mediaPaths ) )
+      .stopToken( stopToken );
+
+    auto [ mediaSet, checkValues ]{ ( *decompiler )() };
+    assert( mediaSet );
+
+    if ( !partNumber.empty() && ( mediaSet->partNumber() != partNumber ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set Part Number changed" }
+        << boost::errinfo_file_name{ mediaSetPaths.first.string() } );
+    }
+
+    change.mediaSetInformation.emplace( std::move( mediaSet ), std::move( checkValues ) );
+  }
+  catch ( const OperationCancelled & )
+  {
+    throw;
+  }
+  catch ( const boost::exception &e )
+  {
+    change.type = ChangeType::MediaSetInvalid;
+    change.error = boost::diagnostic_information( e );
+  }
+  catch ( const std::exception &e )
+  {
+    change.type = ChangeType::MediaSetInvalid;
+    change.error = e.what();
+  }
+
+  if ( ChangeType::MediaSetAdded == change.type )
+  {
+    const std::lock_guard lock{ mutexV };
+
+    if ( auto watchedIt{ watchedMediaSetsV.find( mediaSetPaths.first ) }; watchedIt != watchedMediaSetsV.end() )
+    {
+      watchedIt->second.partNumber = change.mediaSetInformation->first->partNumber();
+    }
+  }
+
+  return change;
+}
+
+void MediaSetManagerWatcherImpl::addWatches( const MediaSetPaths &mediaSetPaths )
+{
+  // the media set directory itself, to detect re-created media
+  const auto mediaSetDirectory{ ( directoryV / mediaSetPaths.first ).lexically_normal() };
+  addDirectoryWatches( mediaSetPaths.first, mediaSetDirectory );
+
+  // media located outside the media set directory
+  for ( const auto &[ mediumNumber, mediumPath ] : mediaSetPaths.second )
+  {
+    const auto mediumDirectory{ ( mediaSetDirectory / mediumPath ).lexically_normal() };
+
+    if ( const auto relativePath{ mediumDirectory.lexically_relative( mediaSetDirectory ) };
+      relativePath.empty() || ( *relativePath.begin() == ".." ) )
+    {
+      addDirectoryWatches( mediaSetPaths.first, mediumDirectory );
+    }
+  }
+}
+
+void MediaSetManagerWatcherImpl::addDirectoryWatches(
+  const std::filesystem::path &mediaSet,
+  const std::filesystem::path &directory )
+{
+  const auto addWatch{ [ this, &mediaSet ]( const std::filesystem::path &watchedDirectory )
+  {
+    const auto watchDescriptor{
+      ::inotify_add_watch( inotifyV.get(), watchedDirectory.c_str(), MediaSetEvents | IN_ONLYDIR ) };
+
+    if ( watchDescriptor < 0 )
+    {
+      spdlog::warn(
+        "Watching '{}' failed: {}",
+        watchedDirectory.string(),
+        std::error_code{ errno, std::generic_category() }.message() );
+      return;
+    }
+
+    watchDescriptorsV.insert_or_assign( watchDescriptor, WatchedDirectory{ mediaSet, watchedDirectory } );
+  } };
+
+  addWatch( directory );
+
+  std::error_code error{};
+  for ( std::filesystem::recursive_directory_iterator it{ directory, error }, end{}; it != end; it.increment( error ) )
+  {
+    if ( it->is_directory( error ) && !it->is_symlink( error ) )
+    {
+      addWatch( it->path() );
+    }
+  }
+}
+
+void MediaSetManagerWatcherImpl::removeWatches( const std::filesystem::path &mediaSet )
+{
+  for ( auto watchIt{ watchDescriptorsV.begin() }; watchIt != watchDescriptorsV.end(); )
+  {
+    if ( watchIt->second.mediaSet == mediaSet )
+    {
+      ::inotify_rm_watch( inotifyV.get(), watchIt->first );
+      watchIt = watchDescriptorsV.erase( watchIt );
+    }
+    else
+    {
+      ++watchIt;
+    }
+  }
+}
+
+}
+
+#endif
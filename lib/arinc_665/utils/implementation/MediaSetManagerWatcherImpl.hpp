@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::MediaSetManagerWatcherImpl.
+ **/
+
+#ifndef ARINC_665_UTILS_MEDIASETMANAGERWATCHERIMPL_HPP
+#define ARINC_665_UTILS_MEDIASETMANAGERWATCHERIMPL_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+#include <arinc_665/utils/MediaSetManagerWatcher.hpp>
+#include <arinc_665/utils/implementation/FileDescriptor.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Implementation of MediaSetManagerWatcher using Linux inotify.
+ *
+ * The directories of each watched media set are watched recursively.
+ * Watches for newly created directories are added, when their creation is reported.
+ * The Media Set Manager directory is watched for the configuration file.
+ *
+ * The configuration file is only processed, when its content differs from the configuration of the Media Set
+ * Manager last passed to watch(), so writes of the Media Set Manager itself are ignored.
+ * A media set removed from the configuration file is only reported as removed, when its directory is gone.
+ *
+ * The watcher thread polls the inotify file descriptor.
+ * Events are mapped to the media set (by its watch descriptor) and collected, until no event has been received for
+ * QuietPeriod.
+ **/
+class MediaSetManagerWatcherImpl final : public MediaSetManagerWatcher
+{
+  public:
+    //! Time without Events, before collected Changes are processed.
+    static constexpr std::chrono::milliseconds QuietPeriod{ 500 };
+    //! Maximum Time the Watcher Thread waits for Events, before checking for Stop Requests and pending Changes.
+    static constexpr std::chrono::milliseconds PollInterval{ 100 };
+
+    /**
+     * @brief Initialises the Watcher and starts the Watcher Thread.
+     *
+     * @param[in] mediaSetManager
+     *   Media Set Manager.
+     * @param[in] changeHandler
+     *   Handler called for each detected change.
+     * @param[in] checkFileIntegrity
+     *   If set to true, additional file integrity checks are performed, when media sets are decompiled.
+     *
+     * @throw Arinc665Exception
+     *   When inotify cannot be initialised.
+     **/
+    MediaSetManagerWatcherImpl(
+      const MediaSetManager &mediaSetManager,
+      ChangeHandler changeHandler,
+      bool checkFileIntegrity );
+
+    //! @copydoc MediaSetManagerWatcher::watch()
+    void watch( const MediaSetManager &mediaSetManager ) override;
+
+  private:
+    //! Watched Media Set
+    struct WatchedMediaSet
+    {
+      //! Part Number (empty if the media set could not be decompiled after it has been added)
+      std::string partNumber;
+      //! Media Set Paths
+      MediaSetPaths mediaSetPaths;
+      //! Media Set is listed by the configuration file (otherwise it is removed, when its directory is gone)
+      bool configured{ true };
+    };
+
+    //! Watched Directory
+    struct WatchedDirectory
+    {
+      //! Media Set Path (key of the watched media set)
+      std::filesystem::path mediaSet;
+      //! Absolute Directory Path
+      std::filesystem::path directory;
+    };
+
+    //! Watched Media Sets (Media Set Path -> Watched Media Set)
+    using WatchedMediaSets = std::map< std::filesystem::path, WatchedMediaSet >;
+
+    /**
+     * @brief Watcher Thread.
+     *
+     * @param[in] stopToken
+     *   Stop Token of the thread.
+     **/
+    void run( const std::stop_token &stopToken );
+
+    //! Reads all available Events and collects the affected Media Sets.
+    void readEvents();
+
+    /**
+     * @brief Processes the collected Changes.
+     *
+     * @param[in] stopToken
+     *   Stop Token used to cancel decompilation.
+     *
+     * @throw OperationCancelled
+     *   When the watcher is stopped.
+     **/
+    void processChanges( const std::stop_token &stopToken );
+
+    /**
+     * @brief Determines the Media Sets added to or removed from the Configuration File.
+     *
+     * @param[in] stopToken
+     *   Stop Token used to cancel decompilation.
+     *
+     * @throw OperationCancelled
+     *   When the watcher is stopped.
+     **/
+    void processConfiguration( const std::stop_token &stopToken );
+
+    /**
+     * @brief Decompiles the Media Set and updates the watched Media Set.
+     *
+     * @param[in] mediaSetPaths
+     *   Media Set Paths.
+     * @param[in] partNumber
+     *   Part Number of the registered Media Set (empty for added media sets).
+     * @param[in] stopToken
+     *   Stop Token used to cancel decompilation.
+     *
+     * @return Change to publish.
+     *
+     * @throw OperationCancelled
+     *   When the watcher is stopped.
+     **/
+    [[nodiscard]] Change decompile(
+      const MediaSetPaths &mediaSetPaths,
+      const std::string &partNumber,
+      const std::stop_token &stopToken );
+
+    /**
+     * @brief Adds the Watches for the Media Set.
+     *
+     * Must be called with locked mutexV.
+     * Already watched directories keep their watch descriptor.
+     *
+     * @param[in] mediaSetPaths
+     *   Media Set Paths.
+     **/
+    void addWatches( const MediaSetPaths &mediaSetPaths );
+
+    /**
+     * @brief Adds Watches for the Directory and all its Sub-Directories.
+     *
+     * Must be called with locked mutexV.
+     *
+     * @param[in] mediaSet
+     *   Media Set Path.
+     * @param[in] directory
+     *   Absolute Directory Path.
+     **/
+    void addDirectoryWatches( const std::filesystem::path &mediaSet, const std::filesystem::path &directory );
+
+    /**
+     * @brief Removes the Watches of the Media Set.
+     *
+     * Must be called with locked mutexV.
+     *
+     * @param[in] mediaSet
+     *   Media Set Path.
+     **/
+    void removeWatches( const std::filesystem::path &mediaSet );
+
+    //! Media Set Manager Directory
+    const std::filesystem::path directoryV;
+    //! Change Handler
+    ChangeHandler changeHandlerV;
+    //! Check File Integrity
+    const bool checkFileIntegrityV;
+    //! inotify File Descriptor
+    FileDescriptor inotifyV;
+    //! Watch Descriptor of the Media Set Manager Directory
+    int configurationWatchV{ -1 };
+    //! Protects the watched media sets, watch descriptors and collected changes.
+    std::mutex mutexV;
+    //! Watched Media Sets
+    WatchedMediaSets watchedMediaSetsV;
+    //! Watch Descriptors (Watch Descriptor -> Watched Directory)
+    std::map< int, WatchedDirectory > watchDescriptorsV;
+    //! Media Sets with collected Changes (Media Set Paths)
+    std::set< std::filesystem::path > pendingMediaSetsV;
+    //! Collected Change of the Configuration File
+    bool configurationPendingV{ false };
+    //! Content of the Configuration File as written by the Media Set Manager itself or last processed
+    std::string knownConfigurationV;
+    //! Time of the last Event
+    std::chrono::steady_clock::time_point lastEventV;
+    //! Watcher Thread - last member, so it is stopped before the other members are destroyed
+    std::jthread threadV;
+};
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665::Utils::PayloadStore.
+ **/
+
+#include "PayloadStore.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <format>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Removes the Write Permissions of the File.
+ *
+ * Failures are logged only.
+ *
+ * @param[in] filePath
+ *   File Path.
+ **/
+void writeProtect( const std::filesystem::path &filePath )
+{
+  std::error_code err{};
+  std::filesystem::permissions(
+    filePath,
+    std::filesystem::perms::owner_write | std::filesystem::perms::group_write | std::filesystem::perms::others_write,
+    std::filesystem::perm_options::remove,
+    err );
+
+  if ( err )
+  {
+    SPDLOG_WARN( "Write protect '{}': {}", filePath.string(), err.message() );
+  }
+}
+
+/**
+ * @brief Stores a Copy of the File as Object.
+ *
+ * The copy is created beside the file, so it is located on the same volume as the store.
+ *
+ * @param[in] filePath
+ *   File Path.
+ * @param[in] object
+ *   Object Path.
+ *
+ * @return If the object is stored (also by a concurrent operation).
+ **/
+bool storeCopy( const std::filesystem::path &filePath, const std::filesystem::path &object )
+{
+  auto copyPath{ filePath };
+  copyPath += ".object";
+
+  // a write-protected leftover of an interrupted operation cannot be overwritten
+  std::error_code err{};
+  std::filesystem::remove( copyPath, err );
+
+  if ( std::filesystem::copy_file( filePath, copyPath, err ); err )
+  {
+    SPDLOG_WARN( "Copy '{}': {}", filePath.string(), err.message() );
+    std::filesystem::remove( copyPath, err );
+    return false;
+  }
+
+  writeProtect( copyPath );
+
+  std::filesystem::create_hard_link( copyPath, object, err );
+  const bool stored{ !err || ( err == std::errc::file_exists ) };
+
+  if ( !stored )
+  {
+    SPDLOG_WARN( "Store '{}': {}", filePath.string(), err.message() );
+  }
+
+  std::filesystem::remove( copyPath, err );
+
+  return stored;
+}
+
+}
+
+PayloadStore::PayloadStore( std::filesystem::path directory ) :
+  directoryV{ std::move( directory ) }
+{
+}
+
+bool PayloadStore::link(
+  const Arinc645::CheckValue &key,
+  const uint16_t crc,
+  const std::filesystem::path &destinationFilePath ) const
+{
+  const auto storeLock{ lock( false ) };
+  if ( storeLock.get() < 0 )
+  {
+    return false;
+  }
+
+  std::error_code err{};
+  std::filesystem::create_hard_link( objectPath( key, crc ), destinationFilePath, err );
+
+  return !err;
+}
+
+void PayloadStore::add(
+  const std::filesystem::path &filePath,
+  const Arinc645::CheckValue &key,
+  const uint16_t crc ) const
+{
+  const auto object{ objectPath( key, crc ) };
+
+  const auto storeLock{ lock( false ) };
+  if ( storeLock.get() < 0 )
+  {
+    return;
+  }
+
+  std::error_code err{};
+  std::filesystem::create_directories( object.parent_path(), err );
+
+  const auto linkCount{ std::filesystem::hard_link_count( filePath, err ) };
+  if ( err )
+  {
+    SPDLOG_WARN( "Store '{}': {}", filePath.string(), err.message() );
+    return;
+  }
+
+  if ( 1U == linkCount )
+  {
+    // new object - objects must not be modified, as they are shared by media sets
+    if ( std::filesystem::create_hard_link( filePath, object, err ); !err )
+    {
+      writeProtect( object );
+      return;
+    }
+
+    if ( err != std::errc::file_exists )
+    {
+      SPDLOG_WARN( "Store '{}': {}", filePath.string(), err.message() );
+      return;
+    }
+  }
+  else
+  {
+    // the file shares its inode with other files (e.g. placed as hardlink to its source file), which must neither
+    // become read-only, nor keep the object referenced - so a copy becomes the object
+    if ( std::filesystem::equivalent( filePath, object, err ) )
+    {
+      // already linked to the object
+      return;
+    }
+
+    if ( !storeCopy( filePath, object ) )
+    {
+      return;
+    }
+  }
+
+  // object already stored - replace the file by a link to the object
+  auto linkPath{ filePath };
+  linkPath += ".link";
+
+  if ( std::filesystem::create_hard_link( object, linkPath, err ); err )
+  {
+    SPDLOG_WARN( "Link '{}': {}", object.string(), err.message() );
+    return;
+  }
+
+  if ( std::filesystem::rename( linkPath, filePath, err ); err )
+  {
+    SPDLOG_WARN( "Replace '{}': {}", filePath.string(), err.message() );
+    std::filesystem::remove( linkPath, err );
+  }
+}
+
+std::size_t PayloadStore::collectGarbage() const
+{
+  std::error_code err{};
+
+  if ( !std::filesystem::is_directory( directoryV, err ) )
+  {
+    return 0U;
+  }
+
+  // no links are created or removed during the collection
+  const auto storeLock{ lock( true ) };
+  if ( storeLock.get() < 0 )
+  {
+    return 0U;
+  }
+
+  // objects only linked by the store
+  std::vector< std::filesystem::path > unreferencedObjects{};
+  for ( const auto &entry : std::filesystem::recursive_directory_iterator{ directoryV, err } )
+  {
+    if ( ( entry.path().filename() != LockFile )
+      && entry.is_regular_file( err )
+      && ( 1U == entry.hard_link_count( err ) ) )
+    {
+      unreferencedObjects.emplace_back( entry.path() );
+    }
+  }
+
+  std::size_t removedObjects{ 0U };
+  for ( const auto &object : unreferencedObjects )
+  {
+    SPDLOG_TRACE( "Remove unreferenced object '{}'", object.string() );
+
+    if ( std::filesystem::remove( object, err ) )
+    {
+      ++removedObjects;
+    }
+  }
+
+  return removedObjects;
+}
+
+FileDescriptor PayloadStore::lock( const bool exclusive ) const
+{
+  std::error_code err{};
+  std::filesystem::create_directories( directoryV, err );
+
+  const auto lockFilePath{ directoryV / LockFile };
+  const int fd{ ::open( lockFilePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666 ) };
+  if ( fd < 0 )
+  {
+    SPDLOG_WARN( "Open lock file '{}': {}", lockFilePath.string(), std::generic_category().message( errno ) );
+    return FileDescriptor{ -1 };
+  }
+
+  // blocks until the lock is granted
+  while ( 0 != ::flock( fd, exclusive ? LOCK_EX : LOCK_SH ) )
+  {
+    if ( EINTR != errno )
+    {
+      SPDLOG_WARN( "Lock '{}': {}", lockFilePath.string(), std::generic_category().message( errno ) );
+      ::close( fd );
+      return FileDescriptor{ -1 };
+    }
+  }
+
+  return FileDescriptor{ fd };
+}
+
+std::filesystem::path PayloadStore::objectPath( const Arinc645::CheckValue &key, const uint16_t crc ) const
+{
+  std::string name{};
+  for ( const auto byte : key.value() )
+  {
+    name += std::format( "{:02x}", static_cast< uint8_t >( byte ) );
+  }
+
+  // objects are distributed to sub-directories by the first key byte
+  auto directory{ name.substr( 0U, 2U ) };
+  name += std::format( "-{:04x}", crc );
+
+  return directoryV / directory / name;
+}
+
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::PayloadStore.
+ **/
+
+#ifndef ARINC_665_UTILS_IMPLEMENTATION_PAYLOADSTORE_HPP
+#define ARINC_665_UTILS_IMPLEMENTATION_PAYLOADSTORE_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <arinc_665/utils/implementation/FileDescriptor.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Content-addressed Store of Payload Files.
+ *
+ * Objects are keyed by the SHA-256 digest and the ARINC 665 file CRC of their content.
+ * The files of the media sets are hardlinks to the objects.
+ * So the link count of an object is its reference count - an object with a link count of 1 is only referenced by
+ * the store itself and can be removed (see collectGarbage()).
+ *
+ * Objects are read-only, as a modification of a media set file would modify all media sets sharing the object.
+ * Therefore, files added to the store become read-only too.
+ * Files, which share their inode with other files (e.g. placed by FilePlacementStrategy::Hardlink), are copied into
+ * the store instead.
+ * Otherwise, the linked source files would become read-only and would keep the object referenced forever.
+ *
+ * The store must be located on the same volume as the media sets.
+ * All operations can be called concurrently - also by different processes.
+ * link() and add() share the store lock (@ref LockFile), while collectGarbage() holds it exclusively.
+ * So an object cannot be removed between a lookup and the creation of its link.
+ **/
+class ARINC_665_EXPORT PayloadStore
+{
+  public:
+    //! Check Value Type used as Object Key
+    static constexpr Arinc645::CheckValueType KeyType{ Arinc645::CheckValueType::Sha256 };
+    //! Name of the Lock File within the Store Directory
+    static constexpr std::string_view LockFile{ ".lock" };
+
+    /**
+     * @brief Initialises the Payload Store.
+     *
+     * @param[in] directory
+     *   Store Directory. Created on demand.
+     **/
+    explicit PayloadStore( std::filesystem::path directory );
+
+    /**
+     * @brief Links the stored Object to the Destination Path.
+     *
+     * @param[in] key
+     *   Object Key (check value of type @ref KeyType).
+     * @param[in] crc
+     *   ARINC 665 File CRC.
+     * @param[in] destinationFilePath
+     *   Destination File Path. The file must not exist.
+     *
+     * @return If the object is stored and has been linked.
+     *   If the store cannot be locked, @p false is returned.
+     **/
+    [[nodiscard]] bool link(
+      const Arinc645::CheckValue &key,
+      uint16_t crc,
+      const std::filesystem::path &destinationFilePath ) const;
+
+    /**
+     * @brief Adds the given File to the Store.
+     *
+     * If the object is already stored, the file is replaced by a link to the object.
+     * Otherwise, the file becomes the object and is made read-only.
+     * If the file has further hardlinks, a copy of it becomes the object and the file is replaced by a link to it.
+     * Failures are not reported, as the file itself stays valid.
+     *
+     * @param[in] filePath
+     *   File Path (within the media set).
+     * @param[in] key
+     *   Object Key (check value of type @ref KeyType).
+     * @param[in] crc
+     *   ARINC 665 File CRC.
+     **/
+    void add( const std::filesystem::path &filePath, const Arinc645::CheckValue &key, uint16_t crc ) const;
+
+    /**
+     * @brief Removes all Objects, which are not referenced by any media set.
+     *
+     * Concurrent link() and add() operations are blocked until the collection has finished.
+     *
+     * @return Number of removed objects.
+     *   If the store cannot be locked, no object is removed.
+     **/
+    std::size_t collectGarbage() const;
+
+  private:
+    /**
+     * @brief Locks the Store.
+     *
+     * The lock is released, when the returned file descriptor is closed.
+     *
+     * @param[in] exclusive
+     *   If the lock is acquired exclusively (garbage collection) or shared (link and add).
+     *
+     * @return File Descriptor of the locked Lock File (-1 on failure).
+     **/
+    [[nodiscard]] FileDescriptor lock( bool exclusive ) const;
+
+    /**
+     * @brief Returns the Object Path for the given Key.
+     *
+     * @param[in] key
+     *   Object Key.
+     * @param[in] crc
+     *   ARINC 665 File CRC.
+     *
+     * @return Object Path.
+     **/
+    [[nodiscard]] std::filesystem::path objectPath( const Arinc645::CheckValue &key, uint16_t crc ) const;
+
+    //! Store Directory
+    std::filesystem::path directoryV;
+};
+
+}
+
+#endif
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665::Utils::ReadAhead.
+ **/
+
+#ifndef ARINC_665_UTILS_IMPLEMENTATION_READAHEAD_HPP
+#define ARINC_665_UTILS_IMPLEMENTATION_READAHEAD_HPP
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+namespace Arinc665::Utils {
+
+/**
+ * @brief Read-Ahead Pipeline Stage.
+ *
+ * Reads a sequence of items (e.g. files) on a producer thread, while the consumer processes the previous items.
+ * At most @p depth items are read in advance, which bounds the memory in flight.
+ * So reading and processing overlap and the throughput approaches the maximum of both instead of their sum.
+ *
+ * The read handler is called from the producer thread, but never concurrently.
+ * Exceptions of the read handler are rethrown by next() after all items read before have been consumed.
+ * On destruction, the producer is stopped after its current item.
+ *
+ * @tparam T
+ *   Item Type (e.g. Helper::RawData).
+ **/
+template< typename T >
+class ReadAhead
+{
+  public:
+    //! Default Number of Items read in advance (double buffering)
+    static constexpr std::size_t DefaultDepth{ 2U };
+
+    /**
+     * @brief Reads the Item with the given Index.
+     *
+     * @param[in] index
+     *   Item Index.
+     *
+     * @return Read Item.
+     **/
+    using ReadHandler = std::function< T( std::size_t index ) >;
+
+    /**
+     * @brief Starts reading the Items.
+     *
+     * @param[in] count
+     *   Number of Items.
+     * @param[in] readHandler
+     *   Read Handler.
+     * @param[in] depth
+     *   Maximum number of items read in advance (at least 1).
+     **/
+    ReadAhead( std::size_t count, ReadHandler readHandler, std::size_t depth = DefaultDepth );
+
+    ReadAhead( const ReadAhead & ) = delete;
+    ReadAhead &operator=( const ReadAhead & ) = delete;
+
+    /**
+     * @brief Returns the next Item.
+     *
+     * Blocks until the item has been read.
+     * Must not be called more than @p count times.
+     *
+     * @return Next Item.
+     **/
+    [[nodiscard]] T next();
+
+  private:
+    /**
+     * @brief Producer Thread.
+     *
+     * @param[in] stopToken
+     *   Stop Token of the Producer Thread.
+     **/
+    void produce( const std::stop_token &stopToken );
+
+    //! Number of Items
+    const std::size_t countV;
+    //! Maximum Number of Items read in advance
+    const std::size_t depthV;
+    //! Read Handler
+    ReadHandler readHandlerV;
+    //! Number of consumed Items
+    std::size_t consumedV{ 0U };
+    //! Protects @ref itemsV and @ref exceptionV
+    std::mutex mutexV;
+    //! Signals produced and consumed Items
+    std::condition_variable_any conditionV;
+    //! Read Items, not yet consumed
+    std::deque< T > itemsV;
+    //! Exception of the Read Handler
+    std::exception_ptr exceptionV;
+    //! Producer Thread - declared last to be stopped and joined first
+    std::jthread producerV;
+};
+
+template< typename T >
+ReadAhead< T >::ReadAhead( const std::size_t count, ReadHandler readHandler, const std::size_t depth ) :
+  countV{ count },
+  depthV{ std::max( depth, std::size_t{ 1U } ) },
+  readHandlerV{ std::move( readHandler ) }
+{
+  if ( 0U != countV )
+  {
+    producerV = std::jthread{ [ this ]( const std::stop_token &stopToken ) { produce( stopToken ); } };
+  }
+}
+
+template< typename T >
+T ReadAhead< T >::next()
+{
+  assert( consumedV < countV );
+  ++consumedV;
+
+  std::unique_lock lock{ mutexV };
+  conditionV.wait( lock, [ this ] { return !itemsV.empty() || exceptionV; } );
+
+  if ( itemsV.empty() )
+  {
+    std::rethrow_exception( exceptionV );
+  }
+
+  auto item{ std::move( itemsV.front() ) };
+  itemsV.pop_front();
+  lock.unlock();
+
+  conditionV.notify_all();
+
+  return item;
+}
+
+template< typename T >
+void ReadAhead< T >::produce( const std::stop_token &stopToken )
+{
+  for ( std::size_t index{ 0U }; index < countV; ++index )
+  {
+    {
+      std::unique_lock lock{ mutexV };
+      if ( !conditionV.wait( lock, stopToken, [ this ] { return itemsV.size() < depthV; } ) )
+      {
+        return;
+      }
+    }
+
+    try
+    {
+      auto item{ readHandlerV( index ) };
+
+      const std::lock_guard lock{ mutexV };
+      itemsV.emplace_back( std::move( item ) );
+    }
+    catch ( ... )
+    {
+      {
+        const std::lock_guard lock{ mutexV };
+        exceptionV = std::current_exception();
+      }
+
+      conditionV.notify_all();
+      return;
+    }
+
+    conditionV.notify_all();
+  }
+}
+
+}
+
+#endif
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Function Arinc665::Utils::FilePlacement_placeFile.
+ **/
+
+#include <arinc_665/utils/implementation/FilePlacement.hpp>
+
+#include <arinc_665/utils/ByteProgressTracker.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stop_token>
+#include <string>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+//! Size of the Source File (several chunks)
+constexpr std::size_t SourceFileSize{ 3U * ByteProgressTracker::ChunkSize + 17U };
+
+/**
+ * @brief Creates the Source File.
+ *
+ * @param[in] path
+ *   File Path.
+ **/
+void createSourceFile( const std::filesystem::path &path )
+{
+  std::ofstream file{ path, std::ios::binary };
+
+  for ( std::size_t index{ 0U }; index < SourceFileSize; ++index )
+  {
+    file.put( static_cast< char >( index * 7U ) );
+  }
+}
+
+/**
+ * @brief Reads the File Content.
+ *
+ * @param[in] path
+ *   File Path.
+ *
+ * @return File Content.
+ **/
+std::string readFile( const std::filesystem::path &path )
+{
+  std::ifstream file{ path, std::ios::binary };
+  return std::string{ std::istreambuf_iterator< char >{ file }, {} };
+}
+
+//! @return If the File is writable by anyone.
+bool writable( const std::filesystem::path &path )
+{
+  return std::filesystem::perms::none != ( std::filesystem::status( path ).permissions()
+    & ( std::filesystem::perms::owner_write
+      | std::filesystem::perms::group_write
+      | std::filesystem::perms::others_write ) );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( FilePlacementTest )
+
+//! Each strategy places the file or falls back to a weaker strategy
+BOOST_AUTO_TEST_CASE( fallback )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto source{ directory.path() / "source" };
+  createSourceFile( source );
+  const auto content{ readFile( source ) };
+
+  for ( const auto strategy : {
+    FilePlacementStrategy::Copy,
+    FilePlacementStrategy::KernelCopy,
+    FilePlacementStrategy::Reflink,
+    FilePlacementStrategy::Hardlink } )
+  {
+    const auto destination{ directory.path() / "destination" };
+
+    const auto usedStrategy{ FilePlacement_placeFile( source, destination, strategy ) };
+
+    // the strategies are ordered from the weakest to the strongest one
+    BOOST_CHECK( usedStrategy <= strategy );
+    BOOST_CHECK( readFile( destination ) == content );
+
+    // source and destination are located on the same volume
+    if ( FilePlacementStrategy::Hardlink == strategy )
+    {
+      BOOST_CHECK( FilePlacementStrategy::Hardlink == usedStrategy );
+      BOOST_CHECK( std::filesystem::equivalent( source, destination ) );
+      // the shared inode is write protected
+      BOOST_CHECK( !writable( source ) );
+    }
+    else
+    {
+      BOOST_CHECK( !std::filesystem::equivalent( source, destination ) );
+      BOOST_CHECK( writable( source ) );
+    }
+
+    std::filesystem::remove( destination );
+  }
+}
+
+//! The chunk processor gets the complete content - the in-kernel copy is replaced by the plain copy
+BOOST_AUTO_TEST_CASE( fallbackChunkProcessor )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto source{ directory.path() / "source" };
+  createSourceFile( source );
+  const auto content{ readFile( source ) };
+
+  for ( const auto strategy : {
+    FilePlacementStrategy::Copy,
+    FilePlacementStrategy::KernelCopy,
+    FilePlacementStrategy::Reflink,
+    FilePlacementStrategy::Hardlink } )
+  {
+    const auto destination{ directory.path() / "destination" };
+    std::string processedContent{};
+
+    const auto usedStrategy{ FilePlacement_placeFile(
+      source,
+      destination,
+      strategy,
+      {},
+      [ &processedContent ]( Helper::ConstRawDataSpan chunk )
+      {
+        processedContent.append( reinterpret_cast< const char * >( chunk.data() ), chunk.size() );
+      } ) };
+
+    BOOST_CHECK( FilePlacementStrategy::KernelCopy != usedStrategy );
+    BOOST_CHECK( usedStrategy <= strategy );
+    BOOST_CHECK( processedContent == content );
+    BOOST_CHECK( readFile( destination ) == content );
+
+    std::filesystem::remove( destination );
+  }
+}
+
+//! The destination file is removed, when the chunk processor fails
+BOOST_AUTO_TEST_CASE( chunkProcessorFailure )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto source{ directory.path() / "source" };
+  createSourceFile( source );
+
+  for ( const auto strategy : {
+    FilePlacementStrategy::Copy,
+    FilePlacementStrategy::KernelCopy,
+    FilePlacementStrategy::Reflink,
+    FilePlacementStrategy::Hardlink } )
+  {
+    const auto destination{ directory.path() / "destination" };
+    std::size_t chunks{ 0U };
+
+    BOOST_CHECK_THROW(
+      static_cast< void >( FilePlacement_placeFile(
+        source,
+        destination,
+        strategy,
+        {},
+        [ &chunks ]( Helper::ConstRawDataSpan )
+        {
+          if ( ++chunks == 2U )
+          {
+            BOOST_THROW_EXCEPTION( Arinc665Exception{} );
+          }
+        } ) ),
+      Arinc665Exception );
+
+    BOOST_CHECK( !std::filesystem::exists( destination ) );
+    BOOST_CHECK( std::filesystem::exists( source ) );
+    // not write protected by the failed hardlink placement
+    BOOST_CHECK( writable( source ) );
+  }
+}
+
+//! The destination file is removed on cancellation
+BOOST_AUTO_TEST_CASE( cancellation )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto source{ directory.path() / "source" };
+  const auto destination{ directory.path() / "destination" };
+  createSourceFile( source );
+
+  std::stop_source stopSource{};
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( FilePlacement_placeFile(
+      source,
+      destination,
+      FilePlacementStrategy::Copy,
+      stopSource.get_token(),
+      [ &stopSource ]( Helper::ConstRawDataSpan )
+      {
+        stopSource.request_stop();
+      } ) ),
+    OperationCancelled );
+
+  BOOST_CHECK( !std::filesystem::exists( destination ) );
+}
+
+//! An existing destination file is kept
+BOOST_AUTO_TEST_CASE( existingDestination )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto source{ directory.path() / "source" };
+  const auto destination{ directory.path() / "destination" };
+  createSourceFile( source );
+  std::ofstream{ destination } << "existing";
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( FilePlacement_placeFile( source, destination, FilePlacementStrategy::Copy ) ),
+    Arinc665Exception );
+
+  BOOST_CHECK( std::filesystem::exists( destination ) );
+  BOOST_CHECK_EQUAL( std::filesystem::file_size( destination ), 8U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Module Arinc665::Utils FileReader.
+ **/
+
+#include <arinc_665/utils/implementation/FileReader.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Creates a File.
+ *
+ * @param[in] path
+ *   File Path.
+ * @param[in] content
+ *   File Content.
+ **/
+void createFile( const std::filesystem::path &path, const std::string &content )
+{
+  std::ofstream{ path, std::ios::binary } << content;
+}
+
+/**
+ * @brief Returns the Data as String.
+ *
+ * @param[in] data
+ *   Data.
+ *
+ * @return Data as String.
+ **/
+std::string toString( const Helper::RawData &data )
+{
+  return std::string{ reinterpret_cast< const char * >( data.data() ), data.size() };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( FileReaderTest )
+
+//! Reading a single file
+BOOST_AUTO_TEST_CASE( readFile )
+{
+  const Test::TemporaryDirectory directory{};
+  createFile( directory.path() / "file", "CONTENT" );
+  createFile( directory.path() / "empty", "" );
+
+  BOOST_CHECK_EQUAL( toString( FileReader_readFile( directory.path() / "file" ) ), "CONTENT" );
+  BOOST_CHECK( FileReader_readFile( directory.path() / "empty" ).empty() );
+
+  BOOST_CHECK_THROW( static_cast< void >( FileReader_readFile( directory.path() / "missing" ) ), Arinc665Exception );
+  BOOST_CHECK_THROW( static_cast< void >( FileReader_readFile( directory.path() ) ), Arinc665Exception );
+}
+
+//! The data of several files is returned in the requested order
+BOOST_AUTO_TEST_CASE( readFiles )
+{
+  const Test::TemporaryDirectory directory{};
+
+  std::vector< std::filesystem::path > filePaths{};
+  for ( std::size_t index{ 0U }; index < 50U; ++index )
+  {
+    filePaths.emplace_back( directory.path() / ( "file" + std::to_string( index ) ) );
+    createFile( filePaths.back(), std::string( index, 'A' ) + std::to_string( index ) );
+  }
+
+  const auto files{ FileReader_readFiles( filePaths, 4U ) };
+  BOOST_REQUIRE_EQUAL( files.size(), filePaths.size() );
+
+  for ( std::size_t index{ 0U }; index < files.size(); ++index )
+  {
+    BOOST_CHECK_EQUAL( toString( files[ index ] ), std::string( index, 'A' ) + std::to_string( index ) );
+  }
+
+  filePaths.emplace_back( directory.path() / "missing" );
+  BOOST_CHECK_THROW( static_cast< void >( FileReader_readFiles( filePaths, 4U ) ), Arinc665Exception );
+}
+
+//! The location lookup does not fail for missing files
+BOOST_AUTO_TEST_CASE( location )
+{
+  const Test::TemporaryDirectory directory{};
+  createFile( directory.path() / "file", "CONTENT" );
+
+  BOOST_CHECK_EQUAL( FileReader_location( directory.path() / "missing" ), 0U );
+  BOOST_CHECK_NO_THROW( static_cast< void >( FileReader_location( directory.path() / "file" ) ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::MediaSetManagerIndex.
+ **/
+
+#include <arinc_665/utils/implementation/MediaSetManagerIndex.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Directory.hpp>
+#include <arinc_665/media/Load.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Creates the indexed Media Sets.
+ *
+ * - Media Set `MS1`:
+ *   - `PN1` (`L1.LUH`): `THW1` at positions `L` and `R`, load type 1
+ *   - `PN2` (`L2.LUH`): `THW1` without positions, `THW2` at position `C`
+ *   - `PN3` (`DIR/L3.LUH`): `THW2` without positions, load type 2
+ * - Media Set `MS2`:
+ *   - `PN1` (`L1.LUH`): `THW1` at position `R`
+ *   - Batch `BATCH.LUB`
+ *
+ * @return Media Sets Information.
+ **/
+MediaSetManager::MediaSetsInformation mediaSets()
+{
+  auto mediaSet1{ Media::MediaSet::create() };
+  mediaSet1->partNumber( "MS1" );
+
+  auto load1{ mediaSet1->addLoad( "L1.LUH" ) };
+  load1->partNumber( "PN1" );
+  load1->targetHardwareId( "THW1", { "L", "R" } );
+  load1->loadType( std::pair{ std::string{ "TYPE1" }, uint16_t{ 1U } } );
+
+  auto load2{ mediaSet1->addLoad( "L2.LUH" ) };
+  load2->partNumber( "PN2" );
+  load2->targetHardwareId( "THW1" );
+  load2->targetHardwareId( "THW2", { "C" } );
+
+  auto load3{ mediaSet1->addSubdirectory( "DIR" )->addLoad( "L3.LUH" ) };
+  load3->partNumber( "PN3" );
+  load3->targetHardwareId( "THW2" );
+  load3->loadType( std::pair{ std::string{ "TYPE2" }, uint16_t{ 2U } } );
+
+  auto mediaSet2{ Media::MediaSet::create() };
+  mediaSet2->partNumber( "MS2" );
+
+  auto load4{ mediaSet2->addLoad( "L1.LUH" ) };
+  load4->partNumber( "PN1" );
+  load4->targetHardwareId( "THW1", { "R" } );
+
+  static_cast< void >( mediaSet2->addBatch( "BATCH.LUB" ) );
+
+  MediaSetManager::MediaSetsInformation mediaSets{};
+  mediaSets.try_emplace( "MS1", mediaSet1, Media::CheckValues{} );
+  mediaSets.try_emplace( "MS2", mediaSet2, Media::CheckValues{} );
+  return mediaSets;
+}
+
+/**
+ * @brief Returns the Names of the Loads.
+ *
+ * @param[in] loads
+ *   Loads.
+ *
+ * @return `<Media Set Part Number>:<Load Part Number>` of each load.
+ **/
+std::vector< std::string > names( const Media::ConstLoads &loads )
+{
+  std::vector< std::string > names{};
+
+  for ( const auto &load : loads )
+  {
+    names.emplace_back(
+      std::string{ load->mediaSet()->partNumber() } + ":" + std::string{ load->partNumber() } );
+  }
+
+  return names;
+}
+
+//! Checks the Names of the Loads matching the Query.
+void checkQuery(
+  const MediaSetManagerIndex &index,
+  const MediaSetManager::LoadsQuery &query,
+  const std::vector< std::string > &expected )
+{
+  const auto loads{ names( index.loads( query ) ) };
+  BOOST_CHECK_EQUAL_COLLECTIONS( loads.begin(), loads.end(), expected.begin(), expected.end() );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerIndexTest )
+
+//! Empty index
+BOOST_AUTO_TEST_CASE( empty )
+{
+  const MediaSetManagerIndex index{};
+
+  BOOST_CHECK( index.loads().empty() );
+  BOOST_CHECK( index.loads( { .partNumber = "PN1" } ).empty() );
+  BOOST_CHECK( index.batches().empty() );
+}
+
+//! All loads and batches
+BOOST_AUTO_TEST_CASE( all )
+{
+  const auto information{ mediaSets() };
+  const MediaSetManagerIndex index{ information };
+
+  // loads of subdirectories first
+  const auto loads{ names( index.loads() ) };
+  const std::vector< std::string > expected{ "MS1:PN3", "MS1:PN1", "MS1:PN2", "MS2:PN1" };
+  BOOST_CHECK_EQUAL_COLLECTIONS( loads.begin(), loads.end(), expected.begin(), expected.end() );
+
+  // a query without criteria matches all loads
+  checkQuery( index, {}, expected );
+
+  BOOST_CHECK_EQUAL( index.batches().size(), 1U );
+}
+
+//! Lookup by load part number, header filename, load type, and media set
+BOOST_AUTO_TEST_CASE( lookup )
+{
+  const auto information{ mediaSets() };
+  const MediaSetManagerIndex index{ information };
+
+  checkQuery( index, { .partNumber = "PN1" }, { "MS1:PN1", "MS2:PN1" } );
+  checkQuery( index, { .partNumber = "PN4" }, {} );
+
+  checkQuery( index, { .headerFilename = "L1.LUH" }, { "MS1:PN1", "MS2:PN1" } );
+  checkQuery( index, { .headerFilename = "L3.LUH" }, { "MS1:PN3" } );
+
+  checkQuery( index, { .loadTypeId = 1U }, { "MS1:PN1" } );
+  checkQuery( index, { .loadTypeId = 2U }, { "MS1:PN3" } );
+  checkQuery( index, { .loadTypeId = 3U }, {} );
+
+  checkQuery( index, { .mediaSetPartNumber = "MS1" }, { "MS1:PN3", "MS1:PN1", "MS1:PN2" } );
+  checkQuery( index, { .mediaSetPartNumber = "MS3" }, {} );
+}
+
+//! Combined criteria
+BOOST_AUTO_TEST_CASE( combined )
+{
+  const auto information{ mediaSets() };
+  const MediaSetManagerIndex index{ information };
+
+  checkQuery( index, { .partNumber = "PN1", .mediaSetPartNumber = "MS2" }, { "MS2:PN1" } );
+  checkQuery( index, { .partNumber = "PN1", .loadTypeId = 1U }, { "MS1:PN1" } );
+  checkQuery( index, { .headerFilename = "L1.LUH", .targetHardwareId = "THW1", .targetHardwareIdPosition = "L" },
+    { "MS1:PN1" } );
+  checkQuery( index, { .partNumber = "PN3", .targetHardwareId = "THW1" }, {} );
+  checkQuery( index, { .targetHardwareId = "THW2", .loadTypeId = 2U }, { "MS1:PN3" } );
+}
+
+//! Target hardware ID and position matching
+BOOST_AUTO_TEST_CASE( targetHardware )
+{
+  const auto information{ mediaSets() };
+  const MediaSetManagerIndex index{ information };
+
+  // all positions
+  checkQuery( index, { .targetHardwareId = "THW1" }, { "MS1:PN1", "MS1:PN2", "MS2:PN1" } );
+  checkQuery( index, { .targetHardwareId = "THW2" }, { "MS1:PN3", "MS1:PN2" } );
+  checkQuery( index, { .targetHardwareId = "THW3" }, {} );
+
+  // loads without positions match all positions
+  checkQuery(
+    index,
+    { .targetHardwareId = "THW1", .targetHardwareIdPosition = "L" },
+    { "MS1:PN1", "MS1:PN2" } );
+  checkQuery(
+    index,
+    { .targetHardwareId = "THW1", .targetHardwareIdPosition = "R" },
+    { "MS1:PN1", "MS1:PN2", "MS2:PN1" } );
+  checkQuery( index, { .targetHardwareId = "THW1", .targetHardwareIdPosition = "X" }, { "MS1:PN2" } );
+  checkQuery(
+    index,
+    { .targetHardwareId = "THW2", .targetHardwareIdPosition = "C" },
+    { "MS1:PN3", "MS1:PN2" } );
+  checkQuery( index, { .targetHardwareId = "THW2", .targetHardwareIdPosition = "L" }, { "MS1:PN3" } );
+
+  // the position is only checked together with the target hardware ID
+  checkQuery(
+    index,
+    { .targetHardwareIdPosition = "L" },
+    { "MS1:PN3", "MS1:PN1", "MS1:PN2", "MS2:PN1" } );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
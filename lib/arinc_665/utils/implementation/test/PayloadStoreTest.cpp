@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::PayloadStore.
+ **/
+
+#include <arinc_665/utils/implementation/PayloadStore.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+//! File CRC used for the Test Objects
+constexpr uint16_t Crc{ 0x1234U };
+//! Size of the Object Key (SHA-256 digest)
+constexpr std::size_t KeySize{ 32U };
+
+/**
+ * @brief Returns an Object Key.
+ *
+ * @param[in] value
+ *   Value of all key bytes.
+ *
+ * @return Object Key.
+ **/
+Arinc645::CheckValue key( const uint8_t value )
+{
+  return Arinc645::CheckValue{
+    PayloadStore::KeyType,
+    std::vector< std::byte >( KeySize, std::byte{ value } ) };
+}
+
+/**
+ * @brief Creates a File.
+ *
+ * @param[in] path
+ *   File Path.
+ **/
+void createFile( const std::filesystem::path &path )
+{
+  std::ofstream{ path, std::ios::binary } << "PAYLOAD";
+}
+
+//! @return If the File is writable by anyone.
+bool writable( const std::filesystem::path &path )
+{
+  return std::filesystem::perms::none != ( std::filesystem::status( path ).permissions()
+    & ( std::filesystem::perms::owner_write
+      | std::filesystem::perms::group_write
+      | std::filesystem::perms::others_write ) );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( PayloadStoreTest )
+
+//! Unknown objects are not linked
+BOOST_AUTO_TEST_CASE( linkUnknown )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+
+  BOOST_CHECK( !payloadStore.link( key( 1U ), Crc, directory.path() / "file" ) );
+  BOOST_CHECK( !std::filesystem::exists( directory.path() / "file" ) );
+}
+
+//! Added files are linked and write protected
+BOOST_AUTO_TEST_CASE( addLink )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+  const auto file{ directory.path() / "file" };
+  const auto linkedFile{ directory.path() / "linked" };
+  createFile( file );
+
+  payloadStore.add( file, key( 1U ), Crc );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file ), 2U );
+  BOOST_CHECK( !writable( file ) );
+
+  // the CRC is part of the key
+  BOOST_CHECK( !payloadStore.link( key( 1U ), static_cast< uint16_t >( Crc + 1U ), linkedFile ) );
+
+  BOOST_CHECK( payloadStore.link( key( 1U ), Crc, linkedFile ) );
+  BOOST_CHECK( std::filesystem::equivalent( file, linkedFile ) );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file ), 3U );
+
+  // existing destination
+  BOOST_CHECK( !payloadStore.link( key( 1U ), Crc, linkedFile ) );
+}
+
+//! A file with the content of a stored object is replaced by a link to the object
+BOOST_AUTO_TEST_CASE( addExisting )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+  const auto file1{ directory.path() / "file1" };
+  const auto file2{ directory.path() / "file2" };
+  createFile( file1 );
+  createFile( file2 );
+
+  payloadStore.add( file1, key( 1U ), Crc );
+  payloadStore.add( file2, key( 1U ), Crc );
+
+  BOOST_CHECK( std::filesystem::equivalent( file1, file2 ) );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file1 ), 3U );
+  BOOST_CHECK( !std::filesystem::exists( directory.path() / "file2.link" ) );
+}
+
+//! A file sharing its inode with another file is copied into the store
+BOOST_AUTO_TEST_CASE( addHardlinked )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+  const auto source{ directory.path() / "source" };
+  const auto file1{ directory.path() / "file1" };
+  const auto file2{ directory.path() / "file2" };
+  createFile( source );
+
+  // placed as hardlinks to the source file
+  std::filesystem::create_hard_link( source, file1 );
+  std::filesystem::create_hard_link( source, file2 );
+
+  // new object
+  payloadStore.add( file1, key( 1U ), Crc );
+  BOOST_CHECK( !std::filesystem::equivalent( source, file1 ) );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file1 ), 2U );
+  BOOST_CHECK( !writable( file1 ) );
+  BOOST_CHECK( !std::filesystem::exists( directory.path() / "file1.object" ) );
+
+  // existing object
+  payloadStore.add( file2, key( 1U ), Crc );
+  BOOST_CHECK( std::filesystem::equivalent( file1, file2 ) );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file1 ), 3U );
+
+  // already linked to the object
+  payloadStore.add( file2, key( 1U ), Crc );
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( file1 ), 3U );
+
+  // the source file is not modified
+  BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( source ), 1U );
+  BOOST_CHECK( writable( source ) );
+
+  // the object is released with the media set files
+  std::filesystem::remove( file1 );
+  std::filesystem::remove( file2 );
+  BOOST_CHECK_EQUAL( payloadStore.collectGarbage(), 1U );
+  BOOST_CHECK( std::filesystem::exists( source ) );
+}
+
+//! Only unreferenced objects are removed
+BOOST_AUTO_TEST_CASE( collectGarbage )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+  const auto file1{ directory.path() / "file1" };
+  const auto file2{ directory.path() / "file2" };
+  createFile( file1 );
+  createFile( file2 );
+
+  // no store directory
+  BOOST_CHECK_EQUAL( payloadStore.collectGarbage(), 0U );
+
+  payloadStore.add( file1, key( 1U ), Crc );
+  payloadStore.add( file2, key( 2U ), Crc );
+  BOOST_CHECK_EQUAL( payloadStore.collectGarbage(), 0U );
+
+  std::filesystem::remove( file1 );
+  BOOST_CHECK_EQUAL( payloadStore.collectGarbage(), 1U );
+  BOOST_CHECK( !payloadStore.link( key( 1U ), Crc, file1 ) );
+  BOOST_CHECK( payloadStore.link( key( 2U ), Crc, directory.path() / "linked" ) );
+
+  // the lock file is not an object
+  BOOST_CHECK( std::filesystem::exists( directory.path() / "store" / PayloadStore::LockFile ) );
+}
+
+//! The garbage collection waits for concurrent link and add operations
+BOOST_AUTO_TEST_CASE( collectGarbageLocked )
+{
+  const Test::TemporaryDirectory directory{};
+  const PayloadStore payloadStore{ directory.path() / "store" };
+  const auto file{ directory.path() / "file" };
+  createFile( file );
+  payloadStore.add( file, key( 1U ), Crc );
+  std::filesystem::remove( file );
+
+  // shared lock as held by link() and add() of another process
+  const auto lockFilePath{ directory.path() / "store" / PayloadStore::LockFile };
+  const int fd{ ::open( lockFilePath.c_str(), O_RDWR | O_CLOEXEC ) };
+  BOOST_REQUIRE( fd >= 0 );
+  BOOST_REQUIRE_EQUAL( ::flock( fd, LOCK_SH ), 0 );
+
+  auto removedObjects{ std::async( std::launch::async, [ &payloadStore ] {
+    return payloadStore.collectGarbage();
+  } ) };
+
+  BOOST_CHECK( std::future_status::timeout == removedObjects.wait_for( std::chrono::milliseconds{ 100 } ) );
+
+  ::close( fd );
+  BOOST_CHECK_EQUAL( removedObjects.get(), 1U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
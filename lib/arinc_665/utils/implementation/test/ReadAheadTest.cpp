@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::ReadAhead.
+ **/
+
+#include <arinc_665/utils/implementation/ReadAhead.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace Arinc665::Utils {
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( ReadAheadTest )
+
+//! The items are returned in the order of their indices
+BOOST_AUTO_TEST_CASE( ordering )
+{
+  constexpr std::size_t count{ 100U };
+
+  for ( const std::size_t depth : { std::size_t{ 0U }, std::size_t{ 1U }, ReadAhead< std::size_t >::DefaultDepth,
+    std::size_t{ 8U } } )
+  {
+    ReadAhead< std::size_t > readAhead{ count, []( const std::size_t index ) { return index * 3U; }, depth };
+
+    for ( std::size_t index{ 0U }; index < count; ++index )
+    {
+      BOOST_CHECK_EQUAL( readAhead.next(), index * 3U );
+    }
+  }
+}
+
+//! At most depth items are read in advance
+BOOST_AUTO_TEST_CASE( depth )
+{
+  constexpr std::size_t count{ 20U };
+  constexpr std::size_t depth{ 3U };
+  std::atomic_size_t consumed{ 0U };
+  std::atomic_size_t maxInAdvance{ 0U };
+
+  ReadAhead< std::size_t > readAhead{
+    count,
+    [ &consumed, &maxInAdvance ]( const std::size_t index )
+    {
+      const auto inAdvance{ index - consumed.load() };
+      if ( inAdvance > maxInAdvance.load() )
+      {
+        maxInAdvance.store( inAdvance );
+      }
+      return index;
+    },
+    depth };
+
+  for ( std::size_t index{ 0U }; index < count; ++index )
+  {
+    // slow consumer - the producer runs ahead
+    std::this_thread::sleep_for( std::chrono::milliseconds{ 1 } );
+    BOOST_CHECK_EQUAL( readAhead.next(), index );
+    consumed.fetch_add( 1U );
+  }
+
+  // the item currently passed to the consumer is not yet counted as consumed
+  BOOST_CHECK( maxInAdvance.load() <= depth );
+  BOOST_CHECK( maxInAdvance.load() >= 1U );
+}
+
+//! The exception of the read handler is rethrown after the items read before
+BOOST_AUTO_TEST_CASE( exception )
+{
+  ReadAhead< std::size_t > readAhead{
+    10U,
+    []( const std::size_t index )
+    {
+      if ( 3U == index )
+      {
+        throw std::runtime_error{ "read error" };
+      }
+      return index;
+    } };
+
+  for ( std::size_t index{ 0U }; index < 3U; ++index )
+  {
+    BOOST_CHECK_EQUAL( readAhead.next(), index );
+  }
+
+  BOOST_CHECK_THROW( static_cast< void >( readAhead.next() ), std::runtime_error );
+}
+
+//! Destruction stops the producer, without consuming all items
+BOOST_AUTO_TEST_CASE( destruction )
+{
+  std::atomic_size_t reads{ 0U };
+
+  {
+    ReadAhead< std::size_t > readAhead{ 1000U, [ &reads ]( const std::size_t index ) {
+      reads.fetch_add( 1U );
+      return index;
+    } };
+
+    BOOST_CHECK_EQUAL( readAhead.next(), 0U );
+  }
+
+  BOOST_CHECK( reads.load() < 1000U );
+
+  // no items - no producer
+  const ReadAhead< std::size_t > empty{ 0U, []( std::size_t ) -> std::size_t {
+    BOOST_FAIL( "Read handler called without items" );
+    return 0U;
+  } };
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Module Arinc665::Utils BatchDigest.
+ **/
+
+#include <arinc_665/utils/BatchDigest.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_645/Arinc645Crc.hpp>
+#include <arinc_645/CheckValueGenerator.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <stop_token>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Creates a Buffer.
+ *
+ * @param[in] size
+ *   Buffer Size.
+ * @param[in] seed
+ *   Seed of the buffer content.
+ *
+ * @return Buffer.
+ **/
+Helper::RawData buffer( const std::size_t size, const std::size_t seed )
+{
+  Helper::RawData data( size );
+
+  for ( std::size_t index{ 0U }; index < size; ++index )
+  {
+    data[ index ] = static_cast< std::byte >( ( index * 13U ) + seed );
+  }
+
+  return data;
+}
+
+/**
+ * @brief Digests the Buffer sequentially.
+ *
+ * @param[in] request
+ *   Digest Request.
+ *
+ * @return Expected Digest.
+ **/
+Digest expectedDigest( const DigestRequest &request )
+{
+  Arinc645::Arinc645Crc16 crc{};
+  crc.process_bytes( request.data.data(), request.data.size() );
+
+  return {
+    .crc = crc.checksum(),
+    .checkValue = Arinc645::CheckValueGenerator::checkValue( request.checkValueType, request.data ).value_or(
+      Arinc645::CheckValue::NoCheckValue ) };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( BatchDigestTest )
+
+//! Empty batch
+BOOST_AUTO_TEST_CASE( empty )
+{
+  BOOST_CHECK( BatchDigest_calculate( {} ).empty() );
+}
+
+//! The digests are equal to the sequential calculation and returned in the order of the requests
+BOOST_AUTO_TEST_CASE( calculate )
+{
+  std::vector< Helper::RawData > buffers{};
+  std::vector< DigestRequest > requests{};
+
+  const Arinc645::CheckValueType checkValueTypes[]{
+    Arinc645::CheckValueType::NotUsed,
+    Arinc645::CheckValueType::Crc32,
+    Arinc645::CheckValueType::Md5,
+    Arinc645::CheckValueType::Sha1,
+    Arinc645::CheckValueType::Sha256 };
+
+  // different sizes (including an empty buffer), so that the processing order differs from the request order
+  for ( std::size_t index{ 0U }; index < 20U; ++index )
+  {
+    buffers.emplace_back( buffer( ( index * 7919U ) % 65536U, index ) );
+  }
+
+  for ( std::size_t index{ 0U }; index < buffers.size(); ++index )
+  {
+    requests.emplace_back( DigestRequest{
+      .data = buffers[ index ],
+      .checkValueType = checkValueTypes[ index % std::size( checkValueTypes ) ] } );
+  }
+
+  for ( const auto lanes : { std::size_t{ 1U }, std::size_t{ 4U }, std::size_t{ 0U } } )
+  {
+    const auto digests{ BatchDigest_calculate( requests, lanes ) };
+    BOOST_REQUIRE_EQUAL( digests.size(), requests.size() );
+
+    for ( std::size_t index{ 0U }; index < requests.size(); ++index )
+    {
+      const auto expected{ expectedDigest( requests[ index ] ) };
+      BOOST_CHECK_EQUAL( digests[ index ].crc, expected.crc );
+      BOOST_CHECK( digests[ index ].checkValue == expected.checkValue );
+    }
+  }
+}
+
+//! Cancellation
+BOOST_AUTO_TEST_CASE( cancellation )
+{
+  const auto data{ buffer( 1024U, 0U ) };
+  const std::vector< DigestRequest > requests( 8U, DigestRequest{ .data = data } );
+
+  std::stop_source stopSource{};
+  stopSource.request_stop();
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( BatchDigest_calculate( requests, 2U, stopSource.get_token() ) ),
+    OperationCancelled );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
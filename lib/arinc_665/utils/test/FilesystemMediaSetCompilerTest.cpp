@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::FilesystemMediaSetCompiler.
+ **/
+
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Directory.hpp>
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Creates the Compiler for a Media Set with a Load and two Data Files.
+ *
+ * @param[in] sourceDirectory
+ *   Directory of the source files.
+ * @param[in] outputDirectory
+ *   Output Base Directory.
+ * @param[in] mapSecondFile
+ *   If the second data file is mapped to a source file.
+ *
+ * @return Compiler.
+ **/
+FilesystemMediaSetCompilerPtr compiler(
+  const std::filesystem::path &sourceDirectory,
+  const std::filesystem::path &outputDirectory,
+  const bool mapSecondFile )
+{
+  std::ofstream{ sourceDirectory / "DATA1.BIN", std::ios::binary } << "DATA1";
+  std::ofstream{ sourceDirectory / "DATA2.BIN", std::ios::binary } << "DATA2";
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  auto directory{ mediaSet->addSubdirectory( "DIR" ) };
+  auto file1{ directory->addRegularFile( "DATA1.BIN", MediumNumber{ 1U } ) };
+  auto file2{ directory->addRegularFile( "DATA2.BIN", MediumNumber{ 1U } ) };
+  auto load{ directory->addLoad( "LOAD.LUH", MediumNumber{ 1U } ) };
+  load->partNumber( "LOAD" );
+  load->targetHardwareId( "THW" );
+  load->dataFile( file1, "DATA1" );
+  load->dataFile( file2, "DATA2" );
+
+  FilePathMapping filePathMapping{ { file1, std::filesystem::path{ "DATA1.BIN" } } };
+  if ( mapSecondFile )
+  {
+    filePathMapping.try_emplace( file2, "DATA2.BIN" );
+  }
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::None )
+    .createLoadHeaderFiles( FileCreationPolicy::All )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( std::move( filePathMapping ) )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "MEDIASET" );
+
+  return compiler;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( FilesystemMediaSetCompilerTest )
+
+//! Successful compilation
+BOOST_AUTO_TEST_CASE( compile )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory outputDirectory{};
+
+  const auto mediaSetPaths{ ( *compiler( sourceDirectory.path(), outputDirectory.path(), true ) )() };
+
+  const auto mediumDirectory{
+    outputDirectory.path() / mediaSetPaths.first / mediaSetPaths.second.at( MediumNumber{ 1U } ) };
+  BOOST_CHECK( std::filesystem::is_regular_file( mediumDirectory / "DIR" / "DATA1.BIN" ) );
+  BOOST_CHECK( std::filesystem::is_regular_file( mediumDirectory / "DIR" / "DATA2.BIN" ) );
+  BOOST_CHECK( std::filesystem::is_regular_file( mediumDirectory / "DIR" / "LOAD.LUH" ) );
+  BOOST_CHECK( std::filesystem::is_regular_file( mediumDirectory / "FILES.LUM" ) );
+}
+
+//! All files and directories created by the failed compilation are removed
+BOOST_AUTO_TEST_CASE( failureRemovesCreatedDirectories )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory outputDirectory{};
+  const auto outputBasePath{ outputDirectory.path() / "NOT" / "EXISTING" };
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( ( *compiler( sourceDirectory.path(), outputBasePath, false ) )() ),
+    Arinc665Exception );
+
+  BOOST_CHECK( !std::filesystem::exists( outputDirectory.path() / "NOT" ) );
+  BOOST_CHECK( std::filesystem::exists( outputDirectory.path() ) );
+}
+
+//! Existing files and directories are kept on failure
+BOOST_AUTO_TEST_CASE( failureKeepsExistingFiles )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory outputDirectory{};
+  const auto mediumDirectory{ outputDirectory.path() / "MEDIASET" / "MEDIUM_001" };
+
+  // the list of files is written last - the compilation fails after all other files have been written
+  std::filesystem::create_directories( mediumDirectory );
+  std::ofstream{ mediumDirectory / "FILES.LUM" } << "EXISTING";
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( ( *compiler( sourceDirectory.path(), outputDirectory.path(), true ) )() ),
+    Arinc665Exception );
+
+  BOOST_CHECK( std::filesystem::is_regular_file( mediumDirectory / "FILES.LUM" ) );
+  BOOST_CHECK( !std::filesystem::exists( mediumDirectory / "DIR" ) );
+  BOOST_CHECK( !std::filesystem::exists( mediumDirectory / "LOADS.LUM" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
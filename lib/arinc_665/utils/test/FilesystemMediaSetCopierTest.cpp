@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::FilesystemMediaSetCopier.
+ **/
+
+#include <arinc_665/utils/FilesystemMediaSetCopier.hpp>
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/utils/implementation/PayloadStore.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Compiles a Media Set with two Data Files on each Medium.
+ *
+ * The files are listed with a SHA-256 check value.
+ *
+ * @param[in] directory
+ *   Base Directory.
+ * @param[in] media
+ *   Number of Media.
+ *
+ * @return Media Paths of the compiled Media Set.
+ **/
+MediaPaths compileMediaSet( const std::filesystem::path &directory, const uint8_t media )
+{
+  const auto sourceDirectory{ directory / "source" };
+  const auto outputDirectory{ directory / "compiled" };
+  std::filesystem::create_directories( sourceDirectory );
+  std::filesystem::create_directories( outputDirectory );
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  mediaSet->filesCheckValueType( Arinc645::CheckValueType::Sha256 );
+
+  FilePathMapping filePathMapping{};
+  for ( uint8_t medium{ 1U }; medium <= media; ++medium )
+  {
+    for ( const auto &name : { "DATA1", "DATA2" } )
+    {
+      const auto filename{ std::string{ name } + "_" + std::to_string( medium ) + ".BIN" };
+      std::ofstream{ sourceDirectory / filename, std::ios::binary } << std::string( 1000U * medium, name[ 4 ] );
+      filePathMapping.try_emplace(
+        mediaSet->addRegularFile( filename, MediumNumber{ medium } ),
+        std::filesystem::path{ filename } );
+    }
+  }
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::None )
+    .createLoadHeaderFiles( FileCreationPolicy::None )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( std::move( filePathMapping ) )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "MEDIASET" );
+
+  auto [ mediaSetPath, mediaPaths ]{ ( *compiler )() };
+
+  for ( auto &[ mediumNumber, mediumPath ] : mediaPaths )
+  {
+    mediumPath = outputDirectory / mediaSetPath / mediumPath;
+  }
+
+  return mediaPaths;
+}
+
+/**
+ * @brief Reads the File Content.
+ *
+ * @param[in] path
+ *   File Path.
+ *
+ * @return File Content.
+ **/
+std::string readFile( const std::filesystem::path &path )
+{
+  std::ifstream file{ path, std::ios::binary };
+  return std::string{ std::istreambuf_iterator< char >{ file }, {} };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( FilesystemMediaSetCopierTest )
+
+//! The copied files are checked against the list of files while copying
+BOOST_AUTO_TEST_CASE( checkFileIntegrity )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediaPaths{ compileMediaSet( directory.path(), 1U ) };
+  const auto outputDirectory{ directory.path() / "copied" };
+  std::filesystem::create_directories( outputDirectory );
+
+  const auto copier{ FilesystemMediaSetCopier::create() };
+  copier->mediaPaths( mediaPaths )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "COPY" )
+    .checkFileIntegrity( true );
+
+  const auto copiedPaths{ ( *copier )() };
+  const auto copiedMediumPath{ outputDirectory / copiedPaths.first / copiedPaths.second.at( MediumNumber{ 1U } ) };
+  BOOST_CHECK(
+    readFile( copiedMediumPath / "DATA1_1.BIN" ) == readFile( mediaPaths.at( MediumNumber{ 1U } ) / "DATA1_1.BIN" ) );
+  std::filesystem::remove_all( outputDirectory / copiedPaths.first );
+
+  // modified file (same size)
+  std::ofstream{ mediaPaths.at( MediumNumber{ 1U } ) / "DATA2_1.BIN", std::ios::binary | std::ios::trunc }
+    << std::string( 1000U, 'X' );
+
+  BOOST_CHECK_THROW( static_cast< void >( ( *copier )() ), Arinc665Exception );
+  BOOST_CHECK( !std::filesystem::exists( outputDirectory / "COPY" ) );
+
+  // without integrity check, the modified file is copied
+  copier->checkFileIntegrity( false );
+  BOOST_CHECK_NO_THROW( static_cast< void >( ( *copier )() ) );
+}
+
+//! A listed file, which is missing on the medium, is reported
+BOOST_AUTO_TEST_CASE( missingFile )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediaPaths{ compileMediaSet( directory.path(), 1U ) };
+  const auto outputDirectory{ directory.path() / "copied" };
+  std::filesystem::create_directories( outputDirectory );
+
+  std::filesystem::remove( mediaPaths.at( MediumNumber{ 1U } ) / "DATA1_1.BIN" );
+
+  const auto copier{ FilesystemMediaSetCopier::create() };
+  copier->mediaPaths( mediaPaths )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "COPY" )
+    .checkFileIntegrity( true );
+
+  BOOST_CHECK_THROW( static_cast< void >( ( *copier )() ), Arinc665Exception );
+  BOOST_CHECK( !std::filesystem::exists( outputDirectory / "COPY" ) );
+}
+
+//! Files placed as hardlinks to the source media are not used as objects of the payload store
+BOOST_AUTO_TEST_CASE( hardlinkPayloadStore )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediaPaths{ compileMediaSet( directory.path(), 1U ) };
+  const auto outputDirectory{ directory.path() / "copied" };
+  const auto payloadStoreDirectory{ directory.path() / "store" };
+  std::filesystem::create_directories( outputDirectory );
+
+  const auto copier{ FilesystemMediaSetCopier::create() };
+  copier->mediaPaths( mediaPaths )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "COPY" )
+    .filePlacementStrategy( FilePlacementStrategy::Hardlink )
+    .payloadStore( payloadStoreDirectory )
+    .checkFileIntegrity( true );
+
+  const auto copiedPaths{ ( *copier )() };
+  const auto copiedMediumPath{ outputDirectory / copiedPaths.first / copiedPaths.second.at( MediumNumber{ 1U } ) };
+
+  // all files listed within the list of files (data files and list of loads) are stored
+  std::size_t storedFiles{ 0U };
+  for ( const auto &entry : std::filesystem::directory_iterator{ copiedMediumPath } )
+  {
+    if ( entry.path().filename() == "FILES.LUM" )
+    {
+      continue;
+    }
+
+    const auto sourceFile{ mediaPaths.at( MediumNumber{ 1U } ) / entry.path().filename() };
+
+    BOOST_CHECK( readFile( entry.path() ) == readFile( sourceFile ) );
+    BOOST_CHECK( !std::filesystem::equivalent( entry.path(), sourceFile ) );
+    BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( sourceFile ), 1U );
+    // media set file and object
+    BOOST_CHECK_EQUAL( std::filesystem::hard_link_count( entry.path() ), 2U );
+    ++storedFiles;
+  }
+
+  BOOST_CHECK_EQUAL( storedFiles, 3U );
+
+  // the objects are released with the copied media set
+  std::filesystem::remove_all( outputDirectory / copiedPaths.first );
+  BOOST_CHECK_EQUAL( PayloadStore{ payloadStoreDirectory }.collectGarbage(), storedFiles );
+}
+
+//! All media are copied concurrently with several threads per medium
+BOOST_AUTO_TEST_CASE( concurrentMedia )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediaPaths{ compileMediaSet( directory.path(), 3U ) };
+  const auto outputDirectory{ directory.path() / "copied" };
+  std::filesystem::create_directories( outputDirectory );
+
+  for ( const auto threadsPerMedium : { std::size_t{ 1U }, std::size_t{ 4U } } )
+  {
+    const auto mediaSetName{ "COPY" + std::to_string( threadsPerMedium ) };
+    std::uint64_t totalBytes{ 0U };
+    std::uint64_t processedBytes{ 0U };
+
+    const auto copier{ FilesystemMediaSetCopier::create() };
+    copier->mediaPaths( mediaPaths )
+      .outputBasePath( outputDirectory )
+      .mediaSetName( mediaSetName )
+      .checkFileIntegrity( true )
+      .threadsPerMedium( threadsPerMedium )
+      .progressHandler( [ &totalBytes, &processedBytes ]( const ByteProgress &progress ) {
+        totalBytes = progress.totalBytes;
+        processedBytes = progress.processedBytes;
+      } );
+
+    const auto copiedPaths{ ( *copier )() };
+    BOOST_CHECK_EQUAL( copiedPaths.first, mediaSetName );
+    BOOST_REQUIRE_EQUAL( copiedPaths.second.size(), mediaPaths.size() );
+
+    std::uint64_t sourceBytes{ 0U };
+    for ( const auto &[ mediumNumber, mediumPath ] : mediaPaths )
+    {
+      const auto copiedMediumPath{ outputDirectory / copiedPaths.first / copiedPaths.second.at( mediumNumber ) };
+
+      for ( const auto &entry : std::filesystem::recursive_directory_iterator{ mediumPath } )
+      {
+        if ( !entry.is_regular_file() )
+        {
+          continue;
+        }
+
+        sourceBytes += entry.file_size();
+        BOOST_CHECK(
+          readFile( entry.path() ) == readFile( copiedMediumPath / entry.path().lexically_relative( mediumPath ) ) );
+      }
+    }
+
+    BOOST_CHECK_EQUAL( totalBytes, sourceBytes );
+    BOOST_CHECK_EQUAL( processedBytes, sourceBytes );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,340 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::MediaSetDecompiler.
+ **/
+
+#include <arinc_665/utils/MediaSetDecompiler.hpp>
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/media/Batch.hpp>
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/exception/all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+//! Data Files of the Media Set
+const std::vector< std::string > DataFiles{ "A.BIN", "B.BIN", "C.BIN", "D.BIN" };
+
+/**
+ * @brief Compiles a Media Set with the Data Files on a single Medium.
+ *
+ * @param[in] directory
+ *   Base Directory.
+ *
+ * @return Medium Directory.
+ **/
+std::filesystem::path compileMediaSet( const std::filesystem::path &directory )
+{
+  const auto sourceDirectory{ directory / "source" };
+  const auto outputDirectory{ directory / "output" };
+  std::filesystem::create_directories( sourceDirectory );
+  std::filesystem::create_directories( outputDirectory );
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+
+  FilePathMapping filePathMapping{};
+  for ( const auto &filename : DataFiles )
+  {
+    std::ofstream{ sourceDirectory / filename, std::ios::binary } << filename;
+    filePathMapping.try_emplace( mediaSet->addRegularFile( filename, MediumNumber{ 1U } ), filename );
+  }
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::None )
+    .createLoadHeaderFiles( FileCreationPolicy::None )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( std::move( filePathMapping ) )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "MEDIASET" );
+
+  const auto mediaSetPaths{ ( *compiler )() };
+
+  return outputDirectory / mediaSetPaths.first / mediaSetPaths.second.at( MediumNumber{ 1U } );
+}
+
+/**
+ * @brief Compiles a Media Set with a Load and a Batch on a single Medium.
+ *
+ * The load header file and batch file are created by the compiler.
+ *
+ * @param[in] directory
+ *   Base Directory.
+ *
+ * @return Medium Directory.
+ **/
+std::filesystem::path compileLoadMediaSet( const std::filesystem::path &directory )
+{
+  const auto sourceDirectory{ directory / "source" };
+  const auto outputDirectory{ directory / "output" };
+  std::filesystem::create_directories( sourceDirectory );
+  std::filesystem::create_directories( outputDirectory );
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+
+  FilePathMapping filePathMapping{};
+  auto load{ mediaSet->addLoad( "LOAD.LUH", MediumNumber{ 1U } ) };
+  load->partNumber( "LOAD" );
+  load->targetHardwareId( "THW" );
+  for ( const auto &filename : DataFiles )
+  {
+    std::ofstream{ sourceDirectory / filename, std::ios::binary } << filename;
+    auto file{ mediaSet->addRegularFile( filename, MediumNumber{ 1U } ) };
+    load->dataFile( file, filename );
+    filePathMapping.try_emplace( std::move( file ), filename );
+  }
+
+  auto batch{ mediaSet->addBatch( "BATCH.LUB", MediumNumber{ 1U } ) };
+  batch->partNumber( "BATCH" );
+  batch->comment( "COMMENT" );
+  batch->target( "THW", load );
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::All )
+    .createLoadHeaderFiles( FileCreationPolicy::All )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( std::move( filePathMapping ) )
+    .outputBasePath( outputDirectory )
+    .mediaSetName( "MEDIASET" );
+
+  const auto mediaSetPaths{ ( *compiler )() };
+
+  return outputDirectory / mediaSetPaths.first / mediaSetPaths.second.at( MediumNumber{ 1U } );
+}
+
+/**
+ * @brief Returns how often Files with the given Extension have been read.
+ *
+ * @param[in] readPaths
+ *   Read Paths.
+ * @param[in] extension
+ *   File Extension.
+ *
+ * @return Number of reads of files with @p extension.
+ **/
+std::size_t numberOfReads( const std::vector< std::filesystem::path > &readPaths, std::string_view extension )
+{
+  return static_cast< std::size_t >( std::ranges::count_if( readPaths, [ extension ]( const auto &path ) {
+    return path.extension() == extension;
+  } ) );
+}
+
+/**
+ * @brief Reads the File from the Medium.
+ *
+ * @param[in] mediumDirectory
+ *   Medium Directory.
+ * @param[in] path
+ *   Relative Path on Medium.
+ *
+ * @return File Data.
+ **/
+Helper::RawData readFile( const std::filesystem::path &mediumDirectory, const std::filesystem::path &path )
+{
+  std::ifstream file{ mediumDirectory / path.relative_path(), std::ios::binary };
+  const std::string content{ std::istreambuf_iterator< char >{ file }, {} };
+  const auto data{ std::as_bytes( std::span{ content } ) };
+  return Helper::RawData{ data.begin(), data.end() };
+}
+
+/**
+ * @brief Returns the simulated physical Location of the File.
+ *
+ * The data files are placed in reverse order of the list of files, all other files are placed before them.
+ *
+ * @param[in] path
+ *   Relative Path on Medium.
+ *
+ * @return Physical location of the file.
+ **/
+std::uint64_t location( const std::filesystem::path &path )
+{
+  const auto dataFile{ std::ranges::find( DataFiles, path.filename().string() ) };
+
+  if ( DataFiles.end() == dataFile )
+  {
+    return 0U;
+  }
+
+  return static_cast< std::uint64_t >( DataFiles.end() - dataFile );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetDecompilerTest )
+
+//! The files of the integrity check are read in the order of their physical location
+BOOST_AUTO_TEST_CASE( readOrder )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediumDirectory{ compileMediaSet( directory.path() ) };
+
+  std::vector< std::filesystem::path > readPaths{};
+
+  auto decompiler{ MediaSetDecompiler::create() };
+  decompiler
+    ->fileSizeHandler( [ &mediumDirectory ]( const MediumNumber &, const std::filesystem::path &path ) {
+      return static_cast< size_t >( std::filesystem::file_size( mediumDirectory / path.relative_path() ) );
+    } )
+    .readFileHandler( [ &mediumDirectory ]( const MediumNumber &, const std::filesystem::path &path ) {
+      return readFile( mediumDirectory, path );
+    } )
+    // records the read order of the integrity check
+    .readFilesHandler(
+      [ &mediumDirectory, &readPaths ]( const MediumNumber &, const std::span< const std::filesystem::path > paths )
+      {
+        std::vector< Helper::RawData > files{};
+        for ( const auto &path : paths )
+        {
+          readPaths.emplace_back( path );
+          files.emplace_back( readFile( mediumDirectory, path ) );
+        }
+        return files;
+      } )
+    .fileLocationHandler( []( const MediumNumber &, const std::filesystem::path &path ) {
+      return location( path );
+    } )
+    .checkFileIntegrity( true );
+
+  const auto mediaSet{ ( *decompiler )().first };
+  BOOST_REQUIRE( mediaSet );
+  BOOST_CHECK_EQUAL( mediaSet->partNumber(), "MEDIASET" );
+
+  BOOST_CHECK( std::ranges::is_sorted( readPaths, std::ranges::less{}, location ) );
+
+  for ( const auto &filename : DataFiles )
+  {
+    BOOST_CHECK( std::ranges::any_of( readPaths, [ &filename ]( const auto &path ) {
+      return path.filename() == filename;
+    } ) );
+  }
+}
+
+//! Load header files and batch files are read on first access to the content of the load or batch
+BOOST_AUTO_TEST_CASE( lazy )
+{
+  const Test::TemporaryDirectory directory{};
+  const auto mediumDirectory{ compileLoadMediaSet( directory.path() ) };
+
+  std::vector< std::filesystem::path > readPaths{};
+  bool failRead{ false };
+
+  auto decompiler{ MediaSetDecompiler::create() };
+  decompiler
+    ->fileSizeHandler( [ &mediumDirectory ]( const MediumNumber &, const std::filesystem::path &path ) {
+      return static_cast< size_t >( std::filesystem::file_size( mediumDirectory / path.relative_path() ) );
+    } )
+    .readFileHandler(
+      [ &mediumDirectory, &readPaths, &failRead ]( const MediumNumber &, const std::filesystem::path &path )
+      {
+        readPaths.emplace_back( path );
+
+        if ( failRead )
+        {
+          BOOST_THROW_EXCEPTION( Arinc665Exception{}
+            << Helper::AdditionalInfo{ "Simulated read failure" }
+            << boost::errinfo_file_name{ path.string() } );
+        }
+
+        return readFile( mediumDirectory, path );
+      } )
+    // ignored in lazy mode
+    .checkFileIntegrity( true )
+    .lazy( true );
+
+  const auto mediaSet{ ( *decompiler )().first };
+  BOOST_REQUIRE( mediaSet );
+  BOOST_REQUIRE_EQUAL( mediaSet->recursiveNumberOfLoads(), 1U );
+  BOOST_REQUIRE_EQUAL( mediaSet->recursiveNumberOfBatches(), 1U );
+
+  const auto load{ mediaSet->recursiveLoads().front() };
+  const auto batch{ mediaSet->recursiveBatches().front() };
+
+  // only the list files have been read
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUH" ), 0U );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUB" ), 0U );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".BIN" ), 0U );
+  BOOST_CHECK( !load->contentLoaded() );
+  BOOST_CHECK( !batch->contentLoaded() );
+
+  // provided by the list of loads and list of batches
+  BOOST_CHECK_EQUAL( load->partNumber(), "LOAD" );
+  BOOST_CHECK_EQUAL( load->targetHardwareIds().size(), 1U );
+  BOOST_CHECK_EQUAL( batch->partNumber(), "BATCH" );
+  BOOST_CHECK( !load->contentLoaded() );
+  BOOST_CHECK( !batch->contentLoaded() );
+
+  // a failed loader is retried on next access
+  failRead = true;
+  BOOST_CHECK_THROW( std::ignore = load->dataFiles(), Arinc665Exception );
+  BOOST_CHECK( !load->contentLoaded() );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUH" ), 1U );
+
+  failRead = false;
+  BOOST_CHECK_EQUAL( load->dataFiles().size(), DataFiles.size() );
+  BOOST_CHECK( load->contentLoaded() );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUH" ), 2U );
+
+  // loaded once
+  BOOST_CHECK_EQUAL( load->targetHardwareIdPositions().size(), 1U );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUH" ), 2U );
+
+  // batch is loaded independently
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUB" ), 0U );
+  BOOST_CHECK( !batch->contentLoaded() );
+  BOOST_CHECK_EQUAL( batch->comment(), "COMMENT" );
+  BOOST_CHECK( batch->contentLoaded() );
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".LUB" ), 1U );
+
+  const auto targetLoads{ batch->target( "THW" ) };
+  BOOST_REQUIRE_EQUAL( targetLoads.size(), 1U );
+  BOOST_CHECK( targetLoads.front() == load );
+
+  // data files are never read
+  BOOST_CHECK_EQUAL( numberOfReads( readPaths, ".BIN" ), 0U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
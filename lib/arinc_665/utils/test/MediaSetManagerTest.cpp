@@ -0,0 +1,530 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::MediaSetManager.
+ **/
+
+#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <arinc_645/CheckValue.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <set>
+#include <stop_token>
+#include <string>
+#include <string_view>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+/**
+ * @brief Compiles a simple Media Set into the Media Set Manager directory.
+ *
+ * @param[in] mediaSetManager
+ *   Media Set Manager.
+ * @param[in] sourceDirectory
+ *   Directory for the source file.
+ * @param[in] partNumber
+ *   Media Set Part Number.
+ *
+ * @return Compiled Media Set Information.
+ **/
+MediaSetManager::CompiledMediaSetInformation compileMediaSet(
+  MediaSetManager &mediaSetManager,
+  const std::filesystem::path &sourceDirectory,
+  const std::string &partNumber )
+{
+  const std::filesystem::path sourceFile{ partNumber + ".BIN" };
+  std::ofstream{ sourceDirectory / sourceFile, std::ios::binary } << "DATA";
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( partNumber );
+  auto file{ mediaSet->addRegularFile( "DATA.BIN", MediumNumber{ 1U } ) };
+  auto load{ mediaSet->addLoad( "LOAD.LUH", MediumNumber{ 1U } ) };
+  load->partNumber( partNumber + "LOAD" );
+  load->targetHardwareId( "THW" );
+  load->dataFile( file, "DATA" );
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::None )
+    .createLoadHeaderFiles( FileCreationPolicy::All )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( FilePathMapping{ { file, sourceFile } } )
+    .outputBasePath( mediaSetManager.directory() )
+    .mediaSetName( partNumber );
+
+  auto mediaSetPaths{ ( *compiler )() };
+  return { std::move( mediaSetPaths ), std::move( mediaSet ), compiler->checkValues() };
+}
+
+/**
+ * @brief Compiles a simple Media Set into the Media Set Manager directory and registers it.
+ *
+ * @param[in] mediaSetManager
+ *   Media Set Manager.
+ * @param[in] sourceDirectory
+ *   Directory for the source file.
+ * @param[in] partNumber
+ *   Media Set Part Number.
+ **/
+void importMediaSet(
+  MediaSetManager &mediaSetManager,
+  const std::filesystem::path &sourceDirectory,
+  const std::string &partNumber )
+{
+  auto [ mediaSetPaths, mediaSet, checkValues ]{ compileMediaSet( mediaSetManager, sourceDirectory, partNumber ) };
+  mediaSetManager.registerMediaSet( mediaSetPaths, std::move( mediaSet ), std::move( checkValues ) );
+}
+
+/**
+ * @brief Returns the Path of a File on the first Medium of a compiled Media Set.
+ *
+ * @param[in] mediaSetManager
+ *   Media Set Manager.
+ * @param[in] mediaSetPaths
+ *   Media Set Paths of the compiled Media Set.
+ * @param[in] filename
+ *   Filename.
+ *
+ * @return Path of the File.
+ **/
+std::filesystem::path mediumFile(
+  const MediaSetManager &mediaSetManager,
+  const MediaSetPaths &mediaSetPaths,
+  const std::string_view filename )
+{
+  return mediaSetManager.directory() / mediaSetPaths.first / mediaSetPaths.second.at( MediumNumber{ 1U } ) / filename;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerTest )
+
+//! Import by another instance followed by reload
+BOOST_AUTO_TEST_CASE( importReload )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+  const auto managerDirectory{ directory.path() / "manager" };
+
+  BOOST_CHECK_NO_THROW( MediaSetManager::create( managerDirectory ) );
+
+  // long-running instance (e.g. the service)
+  auto mediaSetManager{ MediaSetManager::load( managerDirectory ) };
+  BOOST_CHECK( mediaSetManager->mediaSetsSnapshot()->empty() );
+
+  // import by another instance (e.g. the import command)
+  {
+    auto importManager{ MediaSetManager::load( managerDirectory ) };
+    importMediaSet( *importManager, sourceDirectory.path(), "MEDIASET1" );
+    importManager->saveConfiguration();
+    importManager->discardConfiguration();
+  }
+
+  // reload - the stale instance must not overwrite the imported configuration
+  auto reloadedMediaSetManager{ MediaSetManager::load( managerDirectory ) };
+  mediaSetManager->discardConfiguration();
+  mediaSetManager.reset();
+
+  BOOST_CHECK( reloadedMediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  // the configuration file still contains the imported media set
+  const auto loadedMediaSetManager{ MediaSetManager::load( managerDirectory ) };
+  BOOST_CHECK( loadedMediaSetManager->hasMediaSet( "MEDIASET1" ) );
+  loadedMediaSetManager->discardConfiguration();
+}
+
+//! Configuration is persisted on destruction by default
+BOOST_AUTO_TEST_CASE( saveOnDestruction )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+  const auto managerDirectory{ directory.path() / "manager" };
+
+  BOOST_CHECK_NO_THROW( MediaSetManager::create( managerDirectory ) );
+
+  {
+    auto mediaSetManager{ MediaSetManager::load( managerDirectory ) };
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+  }
+
+  const auto mediaSetManager{ MediaSetManager::load( managerDirectory ) };
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+}
+
+//! The loaded handler is called for each media set
+BOOST_AUTO_TEST_CASE( mediaSetLoadedHandler )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+  const auto managerDirectory{ directory.path() / "manager" };
+
+  {
+    auto mediaSetManager{ MediaSetManager::loadOrCreate( managerDirectory ) };
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" );
+  }
+
+  std::set< std::string, std::less<> > loadedMediaSets{};
+
+  const auto mediaSetManager{ MediaSetManager::load(
+    managerDirectory,
+    false,
+    {},
+    [ &loadedMediaSets ]( const Media::ConstMediaSetPtr &mediaSet )
+    {
+      BOOST_REQUIRE( mediaSet );
+      BOOST_CHECK( loadedMediaSets.emplace( mediaSet->partNumber() ).second );
+    } ) };
+
+  BOOST_CHECK( ( loadedMediaSets == std::set< std::string, std::less<> >{ "MEDIASET1", "MEDIASET2" } ) );
+  BOOST_CHECK_EQUAL( mediaSetManager->mediaSetsSnapshot()->size(), 2U );
+}
+
+//! Loading is cancelled between two media sets
+BOOST_AUTO_TEST_CASE( loadCancellation )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+  const auto managerDirectory{ directory.path() / "manager" };
+
+  {
+    auto mediaSetManager{ MediaSetManager::loadOrCreate( managerDirectory ) };
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" );
+  }
+
+  std::stop_source stopSource{};
+  std::size_t loadedMediaSets{ 0U };
+
+  BOOST_CHECK_THROW(
+    static_cast< void >( MediaSetManager::load(
+      managerDirectory,
+      false,
+      {},
+      [ &stopSource, &loadedMediaSets ]( const Media::ConstMediaSetPtr & )
+      {
+        ++loadedMediaSets;
+        stopSource.request_stop();
+      },
+      stopSource.get_token() ) ),
+    OperationCancelled );
+
+  BOOST_CHECK_EQUAL( loadedMediaSets, 1U );
+
+  // the configuration is not modified by the cancelled load
+  const auto mediaSetManager{ MediaSetManager::load( managerDirectory ) };
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET2" ) );
+}
+
+//! Lazily loaded media sets read their load header files on the first query of the loads
+BOOST_AUTO_TEST_CASE( lazyLoad )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+  const auto managerDirectory{ directory.path() / "manager" };
+
+  {
+    auto mediaSetManager{ MediaSetManager::loadOrCreate( managerDirectory ) };
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+    importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" );
+  }
+
+  const auto mediaSetManager{ MediaSetManager::load( managerDirectory, true, {}, {}, {}, true ) };
+
+  const auto mediaSets{ mediaSetManager->mediaSetsSnapshot() };
+  BOOST_REQUIRE_EQUAL( mediaSets->size(), 2U );
+
+  Media::ConstLoads loads{};
+  for ( const auto &[ partNumber, mediaSet ] : *mediaSets )
+  {
+    loads.splice( loads.end(), mediaSet.first->recursiveLoads() );
+  }
+
+  BOOST_REQUIRE_EQUAL( loads.size(), 2U );
+  for ( const auto &load : loads )
+  {
+    BOOST_CHECK( !load->contentLoaded() );
+  }
+
+  // media set queries do not access the loads
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+  BOOST_CHECK( mediaSetManager->mediaSet( "MEDIASET2" ) );
+  for ( const auto &load : loads )
+  {
+    BOOST_CHECK( !load->contentLoaded() );
+  }
+
+  // the index is built on the first loads query
+  const auto thwLoads{ mediaSetManager->loads( MediaSetManager::LoadsQuery{ .targetHardwareId = "THW" } ) };
+  BOOST_CHECK_EQUAL( thwLoads.size(), 2U );
+  for ( const auto &load : loads )
+  {
+    BOOST_CHECK( load->contentLoaded() );
+  }
+
+  mediaSetManager->discardConfiguration();
+}
+
+//! Several media sets are registered at once - either all or none of them
+BOOST_AUTO_TEST_CASE( registerMediaSets )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() / "manager" ) };
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+
+  const auto mediaSet2{ compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" ) };
+  const auto mediaSet3{ compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET3" ) };
+  const auto mediaSet4{ compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET4" ) };
+
+  mediaSetManager->registerMediaSets( { mediaSet2, mediaSet3 } );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET2" ) );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET3" ) );
+
+  // already registered media set
+  BOOST_CHECK_THROW( mediaSetManager->registerMediaSets( { mediaSet4, mediaSet2 } ), Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET4" ) );
+
+  // media set contained twice
+  BOOST_CHECK_THROW( mediaSetManager->registerMediaSets( { mediaSet4, mediaSet4 } ), Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET4" ) );
+
+  BOOST_CHECK_EQUAL( mediaSetManager->mediaSetsSnapshot()->size(), 3U );
+
+  mediaSetManager->registerMediaSets( { mediaSet4 } );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET4" ) );
+}
+
+//! Verification fails for a file of the list of files, which has been deleted after compilation
+BOOST_AUTO_TEST_CASE( verifyDeletedFile )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() / "manager" ) };
+  const auto [ mediaSetPaths, mediaSet, checkValues ]{
+    compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" ) };
+
+  BOOST_REQUIRE( std::filesystem::remove( mediumFile( *mediaSetManager, mediaSetPaths, "DATA.BIN" ) ) );
+
+  BOOST_CHECK_THROW( mediaSetManager->registerMediaSet( mediaSetPaths, mediaSet, checkValues ), Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  // without verification the media set is registered
+  mediaSetManager->registerMediaSet( mediaSetPaths, mediaSet, checkValues, false );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+  mediaSetManager->discardConfiguration();
+}
+
+//! Verification fails for truncated load files
+BOOST_AUTO_TEST_CASE( verifyTruncatedLoadFile )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() / "manager" ) };
+
+  // data file of the load (the list of files is still consistent, as the file content is not read)
+  const auto [ mediaSetPaths1, mediaSet1, checkValues1 ]{
+    compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" ) };
+  std::filesystem::resize_file( mediumFile( *mediaSetManager, mediaSetPaths1, "DATA.BIN" ), 2U );
+
+  BOOST_CHECK_THROW(
+    mediaSetManager->registerMediaSet( mediaSetPaths1, mediaSet1, checkValues1 ),
+    Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  // load header file
+  const auto [ mediaSetPaths2, mediaSet2, checkValues2 ]{
+    compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" ) };
+  const auto loadHeaderFile{ mediumFile( *mediaSetManager, mediaSetPaths2, "LOAD.LUH" ) };
+  std::filesystem::resize_file( loadHeaderFile, std::filesystem::file_size( loadHeaderFile ) - 4U );
+
+  BOOST_CHECK_THROW(
+    mediaSetManager->registerMediaSet( mediaSetPaths2, mediaSet2, checkValues2 ),
+    Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET2" ) );
+
+  BOOST_CHECK( mediaSetManager->mediaSetsSnapshot()->empty() );
+  mediaSetManager->discardConfiguration();
+}
+
+//! Verification fails for a list of files, which is inconsistent to the check values reported by the compiler
+BOOST_AUTO_TEST_CASE( verifyCheckValueMismatch )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() / "manager" ) };
+
+  // CRC of the list of files differs from the CRC reported by the compiler
+  auto [ mediaSetPaths1, mediaSet1, checkValues1 ]{
+    compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" ) };
+
+  bool replaced{ false };
+  for ( auto &[ file, fileCheckValues ] : checkValues1 )
+  {
+    if ( file->name() != "DATA.BIN" )
+    {
+      continue;
+    }
+
+    const auto crc{ std::ranges::find_if(
+      fileCheckValues,
+      []( const auto &checkValue ) { return Arinc645::CheckValue::crc16( checkValue ).has_value(); } ) };
+    BOOST_REQUIRE( fileCheckValues.end() != crc );
+
+    fileCheckValues = {
+      Arinc645::CheckValue::crc16( static_cast< uint16_t >( ~*Arinc645::CheckValue::crc16( *crc ) ) ) };
+    replaced = true;
+  }
+  BOOST_REQUIRE( replaced );
+
+  BOOST_CHECK_THROW(
+    mediaSetManager->registerMediaSet( mediaSetPaths1, mediaSet1, checkValues1 ),
+    Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  // corrupted list of files (file CRC)
+  const auto [ mediaSetPaths2, mediaSet2, checkValues2 ]{
+    compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" ) };
+  {
+    std::fstream listOfFiles{
+      mediumFile( *mediaSetManager, mediaSetPaths2, ListOfFilesName ),
+      std::ios::binary | std::ios::in | std::ios::out };
+    listOfFiles.seekg( -1, std::ios::end );
+    const auto crc{ static_cast< char >( ~listOfFiles.get() ) };
+    listOfFiles.seekp( -1, std::ios::end );
+    listOfFiles.put( crc );
+  }
+
+  BOOST_CHECK_THROW(
+    mediaSetManager->registerMediaSet( mediaSetPaths2, mediaSet2, checkValues2 ),
+    Arinc665Exception );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET2" ) );
+  mediaSetManager->discardConfiguration();
+}
+
+//! Readers keep a consistent snapshot, while media sets are registered and de-registered concurrently
+BOOST_AUTO_TEST_CASE( concurrentModification )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  const auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() / "manager" ) };
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+  const auto mediaSet2{ compileMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" ) };
+
+  std::atomic_bool modifying{ true };
+
+  // snapshot held during all modifications
+  const auto initialSnapshot{ mediaSetManager->mediaSetsSnapshot() };
+
+  // returns the number of inconsistent observations
+  const auto read{ [ & ]
+  {
+    std::size_t inconsistencies{ 0U };
+
+    do
+    {
+      const auto snapshot{ mediaSetManager->mediaSetsSnapshot() };
+      const auto size{ snapshot->size() };
+
+      if ( ( ( 1U != size ) && ( 2U != size ) ) || !snapshot->contains( "MEDIASET1" ) )
+      {
+        ++inconsistencies;
+      }
+
+      for ( const auto &[ partNumber, mediaSetInformation ] : *snapshot )
+      {
+        if ( mediaSetInformation.first->partNumber() != partNumber )
+        {
+          ++inconsistencies;
+        }
+      }
+
+      // queries of the current version
+      if ( const auto loads{ mediaSetManager->loads() }; ( loads.size() != 1U ) && ( loads.size() != 2U ) )
+      {
+        ++inconsistencies;
+      }
+
+      if ( !mediaSetManager->mediaSetPaths( "MEDIASET1" ) )
+      {
+        ++inconsistencies;
+      }
+
+      // the snapshots are not modified by the concurrent modifications
+      if ( ( snapshot->size() != size ) || ( initialSnapshot->size() != 1U ) )
+      {
+        ++inconsistencies;
+      }
+    } while ( modifying );
+
+    return inconsistencies;
+  } };
+
+  auto reader1{ std::async( std::launch::async, read ) };
+  auto reader2{ std::async( std::launch::async, read ) };
+
+  auto writer{ std::async( std::launch::async, [ & ]
+  {
+    for ( std::size_t modification{ 0U }; modification < 200U; ++modification )
+    {
+      mediaSetManager->registerMediaSets( { mediaSet2 }, false );
+      static_cast< void >( mediaSetManager->deregisterMediaSet( "MEDIASET2" ) );
+    }
+  } ) };
+
+  BOOST_CHECK_NO_THROW( writer.get() );
+  modifying = false;
+
+  BOOST_CHECK_EQUAL( reader1.get(), 0U );
+  BOOST_CHECK_EQUAL( reader2.get(), 0U );
+
+  const auto mediaSets{ mediaSetManager->mediaSetsSnapshot() };
+  BOOST_CHECK_EQUAL( mediaSets->size(), 1U );
+  BOOST_CHECK( mediaSets->contains( "MEDIASET1" ) );
+  BOOST_CHECK_EQUAL( mediaSetManager->loads().size(), 1U );
+
+  // registered afterwards - not visible within the previous snapshots
+  mediaSetManager->registerMediaSets( { mediaSet2 }, false );
+  BOOST_CHECK_EQUAL( mediaSetManager->mediaSetsSnapshot()->size(), 2U );
+  BOOST_CHECK_EQUAL( mediaSets->size(), 1U );
+  BOOST_CHECK_EQUAL( initialSnapshot->size(), 1U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
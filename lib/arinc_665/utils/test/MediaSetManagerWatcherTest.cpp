@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::MediaSetManagerWatcher.
+ **/
+
+#include <arinc_665/utils/MediaSetManagerWatcher.hpp>
+#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+#if defined( __linux__ )
+
+namespace {
+
+//! Maximum Time to wait for an expected Change
+constexpr std::chrono::seconds ChangeTimeout{ 10 };
+
+//! Time to wait for unexpected Changes (exceeds the quiet period of the watcher)
+constexpr std::chrono::seconds SettleTime{ 2 };
+
+/**
+ * @brief Records the Changes reported by the Watcher.
+ *
+ * The changes are reported within the watcher thread.
+ **/
+class ChangeRecorder
+{
+  public:
+    /**
+     * @brief Returns the Change Handler, which records the changes.
+     *
+     * @return Change Handler.
+     **/
+    [[nodiscard]] MediaSetManagerWatcher::ChangeHandler handler()
+    {
+      return [ this ]( MediaSetManagerWatcher::Change change )
+      {
+        {
+          const std::lock_guard lock{ mutexV };
+          changesV.emplace_back( std::move( change ) );
+        }
+        conditionV.notify_all();
+      };
+    }
+
+    /**
+     * @brief Waits for the next Change.
+     *
+     * @param[in] timeout
+     *   Maximum Time to wait.
+     *
+     * @return Next change, or no value, when no change has been reported within @p timeout.
+     **/
+    [[nodiscard]] std::optional< MediaSetManagerWatcher::Change > next(
+      const std::chrono::milliseconds timeout = ChangeTimeout )
+    {
+      std::unique_lock lock{ mutexV };
+
+      if ( !conditionV.wait_for( lock, timeout, [ this ]{ return !changesV.empty(); } ) )
+      {
+        return {};
+      }
+
+      auto change{ std::move( changesV.front() ) };
+      changesV.erase( changesV.begin() );
+      return change;
+    }
+
+  private:
+    //! Protects the changes
+    std::mutex mutexV;
+    //! Signals recorded changes
+    std::condition_variable conditionV;
+    //! Recorded Changes
+    std::vector< MediaSetManagerWatcher::Change > changesV;
+};
+
+/**
+ * @brief Compiles a simple Media Set into the Media Set Manager directory and registers it.
+ *
+ * @param[in] mediaSetManager
+ *   Media Set Manager.
+ * @param[in] sourceDirectory
+ *   Directory for the source file.
+ * @param[in] partNumber
+ *   Media Set Part Number.
+ *
+ * @return Absolute Path of the Data File on the first medium.
+ **/
+std::filesystem::path importMediaSet(
+  MediaSetManager &mediaSetManager,
+  const std::filesystem::path &sourceDirectory,
+  const std::string &partNumber )
+{
+  const std::filesystem::path sourceFile{ partNumber + ".BIN" };
+  std::ofstream{ sourceDirectory / sourceFile, std::ios::binary } << "DATA";
+
+  auto mediaSet{ Media::MediaSet::create() };
+  mediaSet->partNumber( partNumber );
+  auto file{ mediaSet->addRegularFile( "DATA.BIN", MediumNumber{ 1U } ) };
+  auto load{ mediaSet->addLoad( "LOAD.LUH", MediumNumber{ 1U } ) };
+  load->partNumber( partNumber + "LOAD" );
+  load->targetHardwareId( "THW" );
+  load->dataFile( file, "DATA" );
+
+  auto compiler{ FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( FileCreationPolicy::None )
+    .createLoadHeaderFiles( FileCreationPolicy::All )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( FilePathMapping{ { file, sourceFile } } )
+    .outputBasePath( mediaSetManager.directory() )
+    .mediaSetName( partNumber );
+
+  auto mediaSetPaths{ ( *compiler )() };
+  const auto dataFile{
+    mediaSetManager.directory() / mediaSetPaths.first / mediaSetPaths.second.at( MediumNumber{ 1U } ) / "DATA.BIN" };
+
+  mediaSetManager.registerMediaSet( mediaSetPaths, std::move( mediaSet ), compiler->checkValues() );
+
+  return dataFile;
+}
+
+/**
+ * @brief Replaces the File by a new File with the given Content.
+ *
+ * The file is replaced, as files of registered media sets might be write protected.
+ *
+ * @param[in] file
+ *   File Path.
+ * @param[in] content
+ *   New Content.
+ **/
+void replaceFile( const std::filesystem::path &file, const std::string &content )
+{
+  std::filesystem::remove( file );
+  std::ofstream{ file, std::ios::binary } << content;
+}
+
+/**
+ * @brief Removes the Media Set from the Configuration File by another Media Set Manager Instance.
+ *
+ * @param[in] directory
+ *   Media Set Manager Directory.
+ * @param[in] partNumber
+ *   Media Set Part Number.
+ **/
+void removeFromConfiguration( const std::filesystem::path &directory, const std::string &partNumber )
+{
+  const auto mediaSetManager{ MediaSetManager::load( directory ) };
+  static_cast< void >( mediaSetManager->deregisterMediaSet( partNumber ) );
+  mediaSetManager->saveConfiguration();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerWatcherTest )
+
+//! Modified payloads of a registered media set are reported
+BOOST_AUTO_TEST_CASE( mediaSetUpdated )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  const auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() ) };
+  const auto dataFile{ importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" ) };
+  mediaSetManager->saveConfiguration();
+
+  ChangeRecorder recorder{};
+  const auto watcher{ MediaSetManagerWatcher::create( *mediaSetManager, recorder.handler() ) };
+
+  // payload written again by another tool
+  replaceFile( dataFile, "DATA" );
+
+  const auto updated{ recorder.next() };
+  BOOST_REQUIRE( updated );
+  BOOST_CHECK( updated->type == MediaSetManagerWatcher::ChangeType::MediaSetUpdated );
+  BOOST_CHECK_EQUAL( updated->partNumber, "MEDIASET1" );
+  BOOST_CHECK( updated->mediaSetPaths == mediaSetManager->mediaSetPaths( "MEDIASET1" ) );
+  BOOST_REQUIRE( updated->mediaSetInformation );
+  BOOST_CHECK_EQUAL( updated->mediaSetInformation->first->partNumber(), "MEDIASET1" );
+  BOOST_CHECK( MediaSetManagerWatcher::apply( *mediaSetManager, *updated ) );
+
+  // payload corrupted - the last valid state is kept
+  replaceFile( dataFile, "CORRUPTED" );
+
+  const auto invalid{ recorder.next() };
+  BOOST_REQUIRE( invalid );
+  BOOST_CHECK( invalid->type == MediaSetManagerWatcher::ChangeType::MediaSetInvalid );
+  BOOST_CHECK_EQUAL( invalid->partNumber, "MEDIASET1" );
+  BOOST_CHECK( !invalid->error.empty() );
+  BOOST_CHECK( !MediaSetManagerWatcher::apply( *mediaSetManager, *invalid ) );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  mediaSetManager->discardConfiguration();
+}
+
+//! Media sets removed from the configuration file, which directory is deleted, are reported as removed
+BOOST_AUTO_TEST_CASE( mediaSetRemoved )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  const auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() ) };
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" );
+  mediaSetManager->saveConfiguration();
+
+  ChangeRecorder recorder{};
+  const auto watcher{ MediaSetManagerWatcher::create( *mediaSetManager, recorder.handler() ) };
+
+  // removed by another tool
+  const auto mediaSetPaths{ mediaSetManager->mediaSetPaths( "MEDIASET1" ) };
+  BOOST_REQUIRE( mediaSetPaths );
+  removeFromConfiguration( directory.path(), "MEDIASET1" );
+  std::filesystem::remove_all( directory.path() / mediaSetPaths->first );
+
+  const auto removed{ recorder.next() };
+  BOOST_REQUIRE( removed );
+  BOOST_CHECK( removed->type == MediaSetManagerWatcher::ChangeType::MediaSetRemoved );
+  BOOST_CHECK_EQUAL( removed->partNumber, "MEDIASET1" );
+  BOOST_CHECK( removed->mediaSetPaths == *mediaSetPaths );
+
+  BOOST_CHECK( MediaSetManagerWatcher::apply( *mediaSetManager, *removed ) );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET2" ) );
+
+  // other media set not affected
+  BOOST_CHECK( !recorder.next( SettleTime ) );
+
+  mediaSetManager->discardConfiguration();
+}
+
+//! Media sets removed from the configuration file are kept, while their directory exists
+BOOST_AUTO_TEST_CASE( removedFromConfiguration )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  const auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() ) };
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+  mediaSetManager->saveConfiguration();
+
+  ChangeRecorder recorder{};
+  const auto watcher{ MediaSetManagerWatcher::create( *mediaSetManager, recorder.handler() ) };
+
+  const auto mediaSetPaths{ mediaSetManager->mediaSetPaths( "MEDIASET1" ) };
+  BOOST_REQUIRE( mediaSetPaths );
+  removeFromConfiguration( directory.path(), "MEDIASET1" );
+
+  // directory still exists - not reported
+  BOOST_CHECK( !recorder.next( SettleTime ) );
+  BOOST_CHECK( mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  // directory deleted afterwards
+  std::filesystem::remove_all( directory.path() / mediaSetPaths->first );
+
+  const auto removed{ recorder.next() };
+  BOOST_REQUIRE( removed );
+  BOOST_CHECK( removed->type == MediaSetManagerWatcher::ChangeType::MediaSetRemoved );
+  BOOST_CHECK_EQUAL( removed->partNumber, "MEDIASET1" );
+  BOOST_CHECK( MediaSetManagerWatcher::apply( *mediaSetManager, *removed ) );
+  BOOST_CHECK( !mediaSetManager->hasMediaSet( "MEDIASET1" ) );
+
+  mediaSetManager->discardConfiguration();
+}
+
+//! Configuration files written by the watched media set manager itself are not reported
+BOOST_AUTO_TEST_CASE( ownConfiguration )
+{
+  const Test::TemporaryDirectory sourceDirectory{};
+  const Test::TemporaryDirectory directory{};
+
+  const auto mediaSetManager{ MediaSetManager::loadOrCreate( directory.path() ) };
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET1" );
+  mediaSetManager->saveConfiguration();
+
+  ChangeRecorder recorder{};
+  const auto watcher{ MediaSetManagerWatcher::create( *mediaSetManager, recorder.handler() ) };
+
+  // written again without modification
+  mediaSetManager->saveConfiguration();
+  BOOST_CHECK( !recorder.next( SettleTime ) );
+
+  // media set registered by the media set manager itself
+  importMediaSet( *mediaSetManager, sourceDirectory.path(), "MEDIASET2" );
+  watcher->watch( *mediaSetManager );
+  mediaSetManager->saveConfiguration();
+  BOOST_CHECK( !recorder.next( SettleTime ) );
+
+  // media set de-registered by the media set manager itself
+  static_cast< void >( mediaSetManager->deregisterMediaSet( "MEDIASET1" ) );
+  watcher->watch( *mediaSetManager );
+  mediaSetManager->saveConfiguration();
+  BOOST_CHECK( !recorder.next( SettleTime ) );
+
+  mediaSetManager->discardConfiguration();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
+
+}
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665::Utils::MediaSetStatistics.
+ **/
+
+#include <arinc_665/utils/MediaSetStatistics.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace Arinc665::Utils {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief Records the File Operations used by the Test Cases.
+ *
+ * I/O Times:
+ * - 001:'LOAD.LUH': 7 ms (2 reads)
+ * - 001:'DATA.BIN': 5 ms
+ * - 002:'DATA.BIN': 6 ms (read and written)
+ * - 002:'FILES.LUM': 1 ms (written)
+ *
+ * @param[in,out] statistics
+ *   Statistics to update.
+ **/
+void recordFiles( MediaSetStatistics &statistics )
+{
+  statistics.fileRead( MediumNumber{ 1U }, "LOAD.LUH", 100U, 3ms );
+  statistics.fileRead( MediumNumber{ 1U }, "DATA.BIN", 1000U, 5ms );
+  statistics.fileRead( MediumNumber{ 2U }, "DATA.BIN", 2000U, 2ms );
+  statistics.fileWritten( MediumNumber{ 2U }, "FILES.LUM", 50U, 1ms );
+  statistics.fileWritten( MediumNumber{ 2U }, "DATA.BIN", 2000U, 4ms );
+  statistics.fileRead( MediumNumber{ 1U }, "LOAD.LUH", 100U, 4ms );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetStatisticsTest )
+
+//! Phase measurements are accumulated per phase
+BOOST_AUTO_TEST_CASE( phases )
+{
+  MediaSetStatistics statistics{};
+
+  statistics.phase( MediaSetStatistics::Phase::Encode, 10ms, 4ms );
+  statistics.phase( MediaSetStatistics::Phase::Encode, 5ms, 3ms );
+  // invalid phase is ignored
+  statistics.phase( MediaSetStatistics::Phase::Count, 1ms, 1ms );
+
+  const auto encode{ statistics.phaseStatistics( MediaSetStatistics::Phase::Encode ) };
+  BOOST_CHECK( encode.wallTime == 15ms );
+  BOOST_CHECK( encode.cpuTime == 7ms );
+  BOOST_CHECK_EQUAL( encode.count, 2U );
+
+  BOOST_CHECK_EQUAL( statistics.phaseStatistics( MediaSetStatistics::Phase::Write ).count, 0U );
+  BOOST_CHECK_EQUAL( statistics.phaseStatistics( MediaSetStatistics::Phase::Count ).count, 0U );
+
+  // measured phases
+  for ( std::size_t execution{ 0U }; execution < 2U; ++execution )
+  {
+    const MediaSetStatistics::ScopedPhase phase{ &statistics, MediaSetStatistics::Phase::Crc };
+    std::this_thread::sleep_for( 2ms );
+  }
+
+  const auto crc{ statistics.phaseStatistics( MediaSetStatistics::Phase::Crc ) };
+  BOOST_CHECK_EQUAL( crc.count, 2U );
+  BOOST_CHECK( crc.wallTime >= 4ms );
+  // sleeping does not consume CPU time
+  BOOST_CHECK( crc.cpuTime < crc.wallTime );
+
+  // phase measurement without statistics
+  {
+    const MediaSetStatistics::ScopedPhase phase{ nullptr, MediaSetStatistics::Phase::Crc };
+  }
+  BOOST_CHECK_EQUAL( statistics.phaseStatistics( MediaSetStatistics::Phase::Crc ).count, 2U );
+
+  statistics.clear();
+  BOOST_CHECK_EQUAL( statistics.phaseStatistics( MediaSetStatistics::Phase::Encode ).count, 0U );
+  BOOST_CHECK( statistics.phaseStatistics( MediaSetStatistics::Phase::Encode ).wallTime == 0ms );
+  BOOST_CHECK_EQUAL( statistics.phaseStatistics( MediaSetStatistics::Phase::Crc ).count, 0U );
+}
+
+//! Read and written bytes are accumulated per file
+BOOST_AUTO_TEST_CASE( files )
+{
+  MediaSetStatistics statistics{};
+  BOOST_CHECK_EQUAL( statistics.bytesRead(), 0U );
+  BOOST_CHECK_EQUAL( statistics.bytesWritten(), 0U );
+
+  recordFiles( statistics );
+
+  BOOST_CHECK_EQUAL( statistics.bytesRead(), 3200U );
+  BOOST_CHECK_EQUAL( statistics.bytesWritten(), 2050U );
+
+  // same path on different media are different files
+  const auto files{ statistics.filesStatistics() };
+  BOOST_REQUIRE_EQUAL( files.size(), 4U );
+
+  const auto &loadHeader{ files.at( { MediumNumber{ 1U }, "LOAD.LUH" } ) };
+  BOOST_CHECK_EQUAL( loadHeader.reads, 2U );
+  BOOST_CHECK_EQUAL( loadHeader.writes, 0U );
+  BOOST_CHECK_EQUAL( loadHeader.bytesRead, 200U );
+  BOOST_CHECK( loadHeader.ioTime == 7ms );
+
+  const auto &data{ files.at( { MediumNumber{ 2U }, "DATA.BIN" } ) };
+  BOOST_CHECK_EQUAL( data.reads, 1U );
+  BOOST_CHECK_EQUAL( data.writes, 1U );
+  BOOST_CHECK_EQUAL( data.bytesRead, 2000U );
+  BOOST_CHECK_EQUAL( data.bytesWritten, 2000U );
+  BOOST_CHECK( data.ioTime == 6ms );
+
+  statistics.clear();
+  BOOST_CHECK( statistics.filesStatistics().empty() );
+  BOOST_CHECK_EQUAL( statistics.bytesRead(), 0U );
+}
+
+//! Slowest files are ranked by their accumulated I/O time
+BOOST_AUTO_TEST_CASE( slowestFiles )
+{
+  MediaSetStatistics statistics{};
+  recordFiles( statistics );
+
+  const auto slowest{ statistics.slowestFiles( 3U ) };
+  BOOST_REQUIRE_EQUAL( slowest.size(), 3U );
+  BOOST_CHECK( slowest[ 0 ].first == MediaSetStatistics::FileKey( MediumNumber{ 1U }, "LOAD.LUH" ) );
+  BOOST_CHECK( slowest[ 0 ].second.ioTime == 7ms );
+  BOOST_CHECK( slowest[ 1 ].first == MediaSetStatistics::FileKey( MediumNumber{ 2U }, "DATA.BIN" ) );
+  BOOST_CHECK( slowest[ 2 ].first == MediaSetStatistics::FileKey( MediumNumber{ 1U }, "DATA.BIN" ) );
+
+  // more files requested than recorded
+  const auto all{ statistics.slowestFiles( 10U ) };
+  BOOST_REQUIRE_EQUAL( all.size(), 4U );
+  BOOST_CHECK( all[ 3 ].first == MediaSetStatistics::FileKey( MediumNumber{ 2U }, "FILES.LUM" ) );
+
+  BOOST_CHECK( statistics.slowestFiles( 0U ).empty() );
+}
+
+//! Printing lists executed phases, byte counters, and slowest files
+BOOST_AUTO_TEST_CASE( print )
+{
+  MediaSetStatistics statistics{};
+  statistics.phase( MediaSetStatistics::Phase::Crc, 2ms, 1ms );
+  recordFiles( statistics );
+
+  std::ostringstream output{};
+  MediaSetStatistics_print( statistics, output, 2U, "> ", "  " );
+  const auto text{ output.str() };
+  BOOST_TEST_MESSAGE( text );
+
+  BOOST_CHECK( text.starts_with( "> Phases:\n> " ) );
+  BOOST_CHECK( text.contains( "  CRC " ) );
+  BOOST_CHECK( text.contains( "count 1\n" ) );
+  // phases not executed are omitted
+  BOOST_CHECK( !text.contains( "Encode" ) );
+  BOOST_CHECK( text.contains( "> Bytes read: 3200\n> Bytes written: 2050\n" ) );
+  BOOST_CHECK( text.contains( "> Slowest Files:\n" ) );
+
+  // slowest files in descending order limited to the requested number
+  const auto loadHeader{ text.find( "[001]:'LOAD.LUH' I/O 7.000 ms, 2 reads (200 bytes), 0 writes (0 bytes)\n" ) };
+  const auto data{ text.find( "[002]:'DATA.BIN' I/O 6.000 ms, 1 reads (2000 bytes), 1 writes (2000 bytes)\n" ) };
+  BOOST_CHECK( loadHeader != std::string::npos );
+  BOOST_CHECK( data != std::string::npos );
+  BOOST_CHECK( loadHeader < data );
+  BOOST_CHECK( !text.contains( "[001]:'DATA.BIN'" ) );
+
+  // without slowest files
+  std::ostringstream summary{};
+  MediaSetStatistics_print( statistics, summary, 0U );
+  BOOST_CHECK( summary.str().ends_with( "Bytes written: 2050\n" ) );
+  BOOST_CHECK( !summary.str().contains( "Slowest Files:" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Function Arinc665::Utils::Parallel_forEach.
+ **/
+
+#include <arinc_665/utils/Parallel.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Arinc665::Utils {
+
+BOOST_AUTO_TEST_SUITE( Arinc665Test )
+BOOST_AUTO_TEST_SUITE( UtilsTest )
+BOOST_AUTO_TEST_SUITE( ParallelTest )
+
+//! Each index is processed exactly once
+BOOST_AUTO_TEST_CASE( forEach )
+{
+  constexpr std::size_t count{ 1000U };
+
+  for ( const auto lanes : { std::size_t{ 1U }, std::size_t{ 4U }, std::size_t{ 0U }, 2U * count } )
+  {
+    std::vector< std::atomic_size_t > calls( count );
+
+    Parallel_forEach( count, lanes, {}, [ &calls ]( const std::size_t index ) {
+      calls[ index ].fetch_add( 1U );
+    } );
+
+    for ( const auto &indexCalls : calls )
+    {
+      BOOST_CHECK_EQUAL( indexCalls.load(), 1U );
+    }
+  }
+
+  // no indices
+  Parallel_forEach( 0U, 4U, {}, []( std::size_t ) {
+    BOOST_FAIL( "Function called without indices" );
+  } );
+}
+
+//! A single lane processes the indices in ascending order within the calling thread
+BOOST_AUTO_TEST_CASE( singleLane )
+{
+  std::vector< std::size_t > indices{};
+
+  Parallel_forEach( 10U, 1U, {}, [ &indices ]( const std::size_t index ) {
+    indices.push_back( index );
+  } );
+
+  BOOST_REQUIRE_EQUAL( indices.size(), 10U );
+  for ( std::size_t index{ 0U }; index < indices.size(); ++index )
+  {
+    BOOST_CHECK_EQUAL( indices[ index ], index );
+  }
+}
+
+//! The exception of the function is rethrown and stops the other lanes
+BOOST_AUTO_TEST_CASE( exception )
+{
+  constexpr std::size_t count{ 10000U };
+  std::atomic_size_t calls{ 0U };
+
+  BOOST_CHECK_THROW(
+    Parallel_forEach( count, 4U, {}, [ &calls ]( const std::size_t index ) {
+      calls.fetch_add( 1U );
+
+      if ( 10U == index )
+      {
+        throw std::runtime_error{ "failure" };
+      }
+    } ),
+    std::runtime_error );
+
+  BOOST_CHECK( calls.load() < count );
+}
+
+//! A failure is not hidden by the cancellation of the other lanes caused by it
+BOOST_AUTO_TEST_CASE( exceptionAfterCancellation )
+{
+  std::atomic_bool cancelled{ false };
+
+  BOOST_CHECK_THROW(
+    Parallel_forEach( 2U, 2U, {}, [ &cancelled ]( const std::size_t index ) {
+      if ( 1U == index )
+      {
+        cancelled = true;
+        cancelled.notify_one();
+        BOOST_THROW_EXCEPTION( OperationCancelled{} );
+      }
+
+      // fail after the other lane has been cancelled
+      cancelled.wait( false );
+      std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+      throw std::runtime_error{ "failure" };
+    } ),
+    std::runtime_error );
+}
+
+//! Cancellation stops all lanes
+BOOST_AUTO_TEST_CASE( cancellation )
+{
+  constexpr std::size_t count{ 10000U };
+  std::atomic_size_t calls{ 0U };
+  std::stop_source stopSource{};
+
+  BOOST_CHECK_THROW(
+    Parallel_forEach( count, 4U, stopSource.get_token(), [ &calls, &stopSource ]( const std::size_t index ) {
+      calls.fetch_add( 1U );
+
+      if ( 10U == index )
+      {
+        stopSource.request_stop();
+      }
+    } ),
+    OperationCancelled );
+
+  BOOST_CHECK( calls.load() < count );
+
+  // cancelled before the start
+  BOOST_CHECK_THROW(
+    Parallel_forEach( count, 4U, stopSource.get_token(), []( std::size_t ) {
+      BOOST_FAIL( "Function called after cancellation" );
+    } ),
+    OperationCancelled );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -12,17 +12,10 @@
 
 #include "ImportMediaSetCommand.hpp"
 
-#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
 
-#include <arinc_665/files/MediaSetInformation.hpp>
-
-#include <arinc_665/utils/MediaSetManager.hpp>
-#include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
-#include <arinc_665/utils/FilesystemMediaSetCopier.hpp>
-
-#include <arinc_665/Arinc665Exception.hpp>
-
-#include <helper/Exception.hpp>
+#include <arinc_665/utils/FilePlacementStrategyDescription.hpp>
 
 #include <spdlog/spdlog.h>
 
@@ -30,6 +23,7 @@
 
 #include <iostream>
 #include <format>
+#include <optional>
 
 namespace Arinc665Commands::MediaSetManager {
 
@@ -61,7 +55,25 @@ ImportMediaSetCommand::ImportMediaSetCommand() :
   (
     "check-file-integrity",
     boost::program_options::value( &checkFileIntegrityV ),
-    "Check File integrity during media set decompilation and registration."
+    "Check File integrity during media set decompilation and copying."
+  )
+  (
+    "file-placement",
+    boost::program_options::value( &filePlacementStrategyV )
+      ->default_value( Arinc665::Utils::FilePlacementStrategy::Reflink ),
+    "File placement strategy:\n"
+      "* 'Copy': Plain copy\n"
+      "* 'KernelCopy': In-kernel copy\n"
+      "* 'Reflink': Copy-on-write clone, if supported by the filesystem\n"
+      "* 'Hardlink': Hardlink, if located on the same volume.\n"
+      "  The source files are made read-only, as they share their content with the media.\n"
+      "Not possible strategies fall back to the next weaker one."
+  )
+  (
+    "threads-per-medium",
+    boost::program_options::value( &threadsPerMediumV )->default_value( 1U ),
+    "Number of files copied concurrently from each medium.\n"
+      "All media are copied concurrently."
   );
 }
 
@@ -77,57 +89,23 @@ void ImportMediaSetCommand::execute( const Commands::Parameters &parameters )
       variablesMap );
     boost::program_options::notify( variablesMap );
 
-    // Media Set Manager
-    const auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
-      mediaSetManagerDirectoryV,
-      checkMediaSetManagerIntegrityV,
-      std::bind_front( &ImportMediaSetCommand::loadProgress, this ) ) };
-
-    // Fill the media paths list
-    Arinc665::Utils::MediaPaths sourceMediaPaths{};
+    // the service may run within another working directory
+    std::vector< std::filesystem::path > mediaSourceDirectories{};
     for ( const auto &mediumSourceDirectory : mediaSourceDirectoriesV )
     {
-      const auto mediumInformation{ Arinc665::Utils::getMediumInformation( mediumSourceDirectory ) };
-
-      if ( !mediumInformation )
-      {
-        BOOST_THROW_EXCEPTION( boost::program_options::invalid_option_value( mediumSourceDirectory ) );
-      }
-
-      sourceMediaPaths.try_emplace( mediumInformation->mediaSequenceNumber, mediumSourceDirectory );
+      mediaSourceDirectories.emplace_back( std::filesystem::absolute( mediumSourceDirectory ) );
     }
 
-    auto importer{ Arinc665::Utils::FilesystemMediaSetDecompiler::create() };
-    assert( importer );
-
-    const auto &defaults{ mediaSetManager->configuration().defaults };
-
-    importer
-      ->checkFileIntegrity( checkFileIntegrityV.value_or( defaults.checkFileIntegrity ) )
-      .mediaPaths( sourceMediaPaths );
-
-    const auto &[ mediaSet, checkValues]{ ( *importer )() };
-
-    if ( mediaSetManager->hasMediaSet( mediaSet->partNumber() ) )
-    {
-      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{} << Helper::AdditionalInfo{ "Media Set already exist" } );
-    }
-
-    const auto copier{ Arinc665::Utils::FilesystemMediaSetCopier::create() };
-    assert( copier );
-
-    copier
-      ->mediaPaths( sourceMediaPaths )
-      .outputBasePath( mediaSetManagerDirectoryV )
-      .mediaSetName( std::string{ mediaSet->partNumber() } );
-
-    auto destinationPaths{ ( *copier )() };
-
-    mediaSetManager->registerMediaSet(
-      { std::move( destinationPaths ) },
-      checkFileIntegrityV.value_or( defaults.checkFileIntegrity ) );
-
-    mediaSetManager->saveConfiguration();
+    std::cout << MediaSetManagerClient_execute(
+      mediaSetManagerDirectoryV,
+      checkMediaSetManagerIntegrityV,
+      std::bind_front( &ImportMediaSetCommand::loadProgress, this ),
+      MediaSetManagerService::ImportMediaSetRequest,
+      MediaSetManagerService::importMediaSetArguments(
+        mediaSourceDirectories,
+        checkFileIntegrityV ? std::optional< bool >{ *checkFileIntegrityV } : std::nullopt,
+        filePlacementStrategyV,
+        threadsPerMediumV ) );
   }
   catch ( const boost::program_options::error & )
   {
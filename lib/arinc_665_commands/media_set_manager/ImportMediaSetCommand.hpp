@@ -15,6 +15,8 @@
 
 #include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
 
+#include <arinc_665/utils/Utils.hpp>
+
 #include <arinc_665/files/Files.hpp>
 
 #include <commands/Commands.hpp>
@@ -22,6 +24,7 @@
 #include <boost/program_options.hpp>
 #include <boost/optional/optional.hpp>
 
+#include <cstddef>
 #include <filesystem>
 #include <vector>
 
@@ -82,6 +85,10 @@ class ARINC_665_COMMANDS_EXPORT ImportMediaSetCommand
     std::vector< std::filesystem::path > mediaSourceDirectoriesV;
     //! Check File Integrity
     boost::optional< bool > checkFileIntegrityV;
+    //! File Placement Strategy
+    Arinc665::Utils::FilePlacementStrategy filePlacementStrategyV{ Arinc665::Utils::FilePlacementStrategy::Reflink };
+    //! Number of Files copied concurrently per Medium
+    std::size_t threadsPerMediumV{ 1U };
 };
 
 }
@@ -12,23 +12,39 @@
 
 #include "ImportMediaSetXmlCommand.hpp"
 
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
+
 #include <arinc_665/media/MediaSet.hpp>
 #include <arinc_665/media/Directory.hpp>
 #include <arinc_665/media/File.hpp>
 
 #include <arinc_665/utils/MediaSetManager.hpp>
 #include <arinc_665/utils/FileCreationPolicyDescription.hpp>
+#include <arinc_665/utils/FilePlacementStrategyDescription.hpp>
 #include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+#include <arinc_665/utils/FilesystemMediaSetRemover.hpp>
+#include <arinc_665/utils/Parallel.hpp>
 
 #include <arinc_665/SupportedArinc665VersionDescription.hpp>
 #include <arinc_665/Arinc665Exception.hpp>
 
+#include <helper/Exception.hpp>
+
 #include <spdlog/spdlog.h>
 
 #include <boost/exception/all.hpp>
 
-#include <iostream>
+#include <algorithm>
+#include <exception>
 #include <format>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 namespace Arinc665Commands::MediaSetManager {
 
@@ -101,6 +117,24 @@ ImportMediaSetXmlCommand::ImportMediaSetXmlCommand() :
     "version",
     boost::program_options::value( &versionV ),
     ( std::string( "ARINC 665 Version:\n" ) + versionValues ).c_str()
+  )
+  (
+    "jobs",
+    boost::program_options::value( &jobsV )
+      ->default_value( std::max( std::size_t{ 1U }, std::size_t{ std::thread::hardware_concurrency() } ) ),
+    "Number of media sets loaded and compiled concurrently."
+  )
+  (
+    "file-placement",
+    boost::program_options::value( &filePlacementStrategyV )
+      ->default_value( Arinc665::Utils::FilePlacementStrategy::Reflink ),
+    "File placement strategy:\n"
+      "* 'Copy': Plain copy\n"
+      "* 'KernelCopy': In-kernel copy\n"
+      "* 'Reflink': Copy-on-write clone, if supported by the filesystem\n"
+      "* 'Hardlink': Hardlink, if located on the same volume.\n"
+      "  The source files are made read-only, as they share their content with the media.\n"
+      "Not possible strategies fall back to the next weaker one."
   );
 }
 
@@ -122,31 +156,135 @@ void ImportMediaSetXmlCommand::execute( const Commands::Parameters &parameters )
       checkMediaSetManagerIntegrityV,
       std::bind_front( &ImportMediaSetXmlCommand::loadProgress, this ) ) };
 
-    // iterate over XML files
-    for ( const auto &mediaSetXmlFile : mediaSetXmlFilesV )
+    const auto &defaults{ mediaSetManager->configuration().defaults };
+    std::mutex outputMutex{};
+
+    // load ARINC 665 XML files
+    std::vector< Arinc665::Utils::LoadXmlResult > mediaSets( mediaSetXmlFilesV.size() );
+
+    Arinc665::Utils::Parallel_forEach( mediaSetXmlFilesV.size(), jobsV, {}, [ & ]( const std::size_t index ) {
+      {
+        const std::lock_guard lock{ outputMutex };
+        std::cout << "Load XML: " << mediaSetXmlFilesV[ index ].string() << "\n";
+      }
+
+      mediaSets[ index ] = Arinc665::Utils::Arinc665Xml_load( mediaSetXmlFilesV[ index ] );
+    } );
+
+    // check for existing media sets before compilation
+    std::set< std::string_view, std::less<> > partNumbers{};
+    for ( const auto &[ mediaSet, filePathMapping ] : mediaSets )
     {
-      std::cout << "Load XML: " << mediaSetXmlFile.string() << "\n";
+      if ( mediaSetManager->hasMediaSet( mediaSet->partNumber() )
+        || !partNumbers.emplace( mediaSet->partNumber() ).second )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{}
+          << Helper::AdditionalInfo{ std::format( "Media Set '{}' already exist", mediaSet->partNumber() ) } );
+      }
+    }
+
+    // compile media sets
+    std::vector< std::optional< Arinc665::Utils::MediaSetManager::CompiledMediaSetInformation > > compiledMediaSets(
+      mediaSets.size() );
 
-      // load ARINC 665 XML file
-      auto [ mediaSet, filePathMapping ]{ Arinc665::Utils::Arinc665Xml_load( mediaSetXmlFile ) };
+    try
+    {
+      // cancels the compilations of the other media sets on failure
+      std::stop_source stopSource{};
+      const auto stopToken{ stopSource.get_token() };
 
-      auto compiler{ Arinc665::Utils::FilesystemMediaSetCompiler::create() };
+      Arinc665::Utils::Parallel_forEach( mediaSets.size(), jobsV, stopToken, [ & ]( const std::size_t index ) {
+        auto &[ mediaSet, filePathMapping ]{ mediaSets[ index ] };
 
-      // set exporter parameters
-      const auto &defaults{ mediaSetManager->configuration().defaults };
-      compiler
-        ->mediaSet( mediaSet )
-        .arinc665Version( versionV.value_or( defaults.version ) )
-        .createBatchFiles( createBatchFilesV.value_or( defaults.batchFileCreationPolicy ) )
-        .createLoadHeaderFiles( createLoadHeaderFilesV.value_or( defaults.loadHeaderFileCreationPolicy ) )
-        .sourceBasePath( mediaSetSourceDirectoryV )
-        .filePathMapping( std::move( filePathMapping ) )
-        .outputBasePath( mediaSetManagerDirectoryV );
+        auto compiler{ Arinc665::Utils::FilesystemMediaSetCompiler::create() };
 
-      auto mediaSetPaths{ ( *compiler )() };
+        // set exporter parameters
+        compiler
+          ->mediaSet( mediaSet )
+          .arinc665Version( versionV.value_or( defaults.version ) )
+          .createBatchFiles( createBatchFilesV.value_or( defaults.batchFileCreationPolicy ) )
+          .createLoadHeaderFiles( createLoadHeaderFilesV.value_or( defaults.loadHeaderFileCreationPolicy ) )
+          .sourceBasePath( mediaSetSourceDirectoryV )
+          .filePathMapping( std::move( filePathMapping ) )
+          .outputBasePath( mediaSetManagerDirectoryV )
+          .filePlacementStrategy( filePlacementStrategyV )
+          .stopToken( stopToken );
 
-      mediaSetManager->registerMediaSet( mediaSetPaths, checkFileIntegrityV.value_or( defaults.checkFileIntegrity ) );
-      mediaSetManager->saveConfiguration();
+        Arinc665::Utils::MediaSetPaths mediaSetPaths{};
+
+        try
+        {
+          mediaSetPaths = ( *compiler )();
+        }
+        catch ( ... )
+        {
+          stopSource.request_stop();
+          throw;
+        }
+
+        {
+          const std::lock_guard lock{ outputMutex };
+          std::cout << "Compiled: " << mediaSet->partNumber() << "\n";
+        }
+
+        compiledMediaSets[ index ].emplace(
+          std::move( mediaSetPaths ),
+          std::move( mediaSet ),
+          compiler->checkValues() );
+      } );
+
+      // register compiled media sets within one transaction without re-reading them
+      Arinc665::Utils::MediaSetManager::CompiledMediaSetsInformation registeredMediaSets{};
+      for ( auto &compiledMediaSet : compiledMediaSets )
+      {
+        auto &[ mediaSetPaths, mediaSet, checkValues ]{ *compiledMediaSet };
+        registeredMediaSets.emplace_back( mediaSetPaths, std::move( mediaSet ), std::move( checkValues ) );
+      }
+
+      mediaSetManager->registerMediaSets(
+        std::move( registeredMediaSets ),
+        checkFileIntegrityV.value_or( defaults.checkFileIntegrity ) );
+    }
+    catch ( ... )
+    {
+      // none of the media sets has been registered - remove the compiled ones
+      for ( const auto &compiledMediaSet : compiledMediaSets )
+      {
+        if ( !compiledMediaSet )
+        {
+          continue;
+        }
+
+        auto mediaSetPaths{ std::get< Arinc665::Utils::MediaSetPaths >( *compiledMediaSet ) };
+        mediaSetPaths.first = mediaSetManagerDirectoryV / mediaSetPaths.first;
+
+        try
+        {
+          const auto remover{ Arinc665::Utils::FilesystemMediaSetRemover::create() };
+          assert( remover );
+          remover->mediaSetPaths( std::move( mediaSetPaths ) );
+          ( *remover )();
+        }
+        catch ( ... )
+        {
+          SPDLOG_WARN( "Removal of compiled media set failed" );
+        }
+      }
+
+      throw;
+    }
+
+    mediaSetManager->saveConfiguration();
+    // a running service may modify the configuration file after the reload
+    mediaSetManager->discardConfiguration();
+
+    // a running service must pick up the imported media sets
+    if ( const auto response{ MediaSetManagerClient_request(
+           mediaSetManagerDirectoryV,
+           MediaSetManagerService::ReloadRequest ) };
+         response )
+    {
+      std::cout << *response;
     }
   }
   catch ( const boost::program_options::error & )
@@ -27,6 +27,7 @@
 #include <boost/program_options.hpp>
 #include <boost/optional/optional.hpp>
 
+#include <cstddef>
 #include <filesystem>
 #include <vector>
 
@@ -36,6 +37,11 @@ namespace Arinc665Commands::MediaSetManager {
  * @brief Import Media Set XML into Media Set Manager %Command
  *
  * Creates a Media Set based on the given XML description and imports them to the media set manager.
+ *
+ * When multiple XML descriptions are given, they are loaded and compiled concurrently (bounded by the `jobs` option).
+ * All compiled media sets are registered within one transaction and the configuration is written once.
+ * If one of the media sets fails, the remaining compilations are cancelled and the already compiled media sets are
+ * removed.
  **/
 class ARINC_665_COMMANDS_EXPORT ImportMediaSetXmlCommand
 {
@@ -90,6 +96,10 @@ class ARINC_665_COMMANDS_EXPORT ImportMediaSetXmlCommand
     boost::optional< Arinc665::SupportedArinc665Version > versionV;
     //! Check File Integrity
     boost::optional< bool > checkFileIntegrityV;
+    //! Number of Media Sets compiled concurrently
+    std::size_t jobsV{ 1U };
+    //! File Placement Strategy
+    Arinc665::Utils::FilePlacementStrategy filePlacementStrategyV{ Arinc665::Utils::FilePlacementStrategy::Reflink };
 };
 
 }
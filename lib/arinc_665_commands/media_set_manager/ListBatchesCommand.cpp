@@ -12,10 +12,8 @@
 
 #include "ListBatchesCommand.hpp"
 
-#include <arinc_665/media/MediaSet.hpp>
-#include <arinc_665/media/Batch.hpp>
-
-#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
 
 #include <boost/exception/all.hpp>
 
@@ -55,33 +53,11 @@ void ListBatchesCommand::execute( const Commands::Parameters &parameters )
       variablesMap );
     boost::program_options::notify( variablesMap );
 
-    // Media Set Manager
-    const auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
+    std::cout << MediaSetManagerClient_execute(
       mediaSetManagerDirectoryV,
       checkMediaSetManagerIntegrityV,
-      std::bind_front( &ListBatchesCommand::loadProgress, this ) ) };
-
-    const auto batches{ mediaSetManager->batches() };
-
-    if ( batches.empty() )
-    {
-      std::cout << "*** No batches within media set manger ***\n";
-    }
-    else
-    {
-      for ( const auto &batch : batches )
-      {
-        std::cout << std::format(
-          "Media Set P/N:  {}\n"
-          "Batch Filename: {}\n"
-          "Batch P/N:      {}\n"
-          "Batch Comment:  {}\n\n",
-          batch->mediaSet()->partNumber(),
-          batch->name(),
-          batch->partNumber(),
-          batch->comment() );
-      }
-    }
+      std::bind_front( &ListBatchesCommand::loadProgress, this ),
+      MediaSetManagerService::ListBatchesRequest );
   }
   catch ( const boost::program_options::error & )
   {
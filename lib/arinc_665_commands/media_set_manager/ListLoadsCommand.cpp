@@ -12,18 +12,38 @@
 
 #include "ListLoadsCommand.hpp"
 
-#include <arinc_665/media/MediaSet.hpp>
-#include <arinc_665/media/Load.hpp>
-
-#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
 
 #include <boost/exception/all.hpp>
 
 #include <iostream>
 #include <format>
+#include <optional>
 
 namespace Arinc665Commands::MediaSetManager {
 
+namespace {
+
+/**
+ * @brief Converts the given Program Option to a Query Criterion.
+ *
+ * @tparam T
+ *   Value Type.
+ *
+ * @param[in] value
+ *   Program Option Value.
+ *
+ * @return Query Criterion.
+ **/
+template< typename T >
+std::optional< T > toOptional( const boost::optional< T > &value )
+{
+  return value ? std::optional< T >{ *value } : std::nullopt;
+}
+
+}
+
 ListLoadsCommand::ListLoadsCommand() :
   optionsDescriptionV{ "List ARINC 665 Loads Options" }
 {
@@ -40,6 +60,37 @@ ListLoadsCommand::ListLoadsCommand() :
     boost::program_options::value( &checkMediaSetManagerIntegrityV )
       ->default_value( true ),
     "Check Media Set Manager integrity during initialisation."
+  )
+  (
+    "load-part-number",
+    boost::program_options::value( &partNumberV )->value_name( "Part Number" ),
+    "List only loads with the given part number."
+  )
+  (
+    "load-header-filename",
+    boost::program_options::value( &headerFilenameV )->value_name( "Filename" ),
+    "List only loads with the given load header filename."
+  )
+  (
+    "target-hardware-id",
+    boost::program_options::value( &targetHardwareIdV )->value_name( "THW ID" ),
+    "List only loads compatible with the given target hardware ID."
+  )
+  (
+    "target-hardware-position",
+    boost::program_options::value( &targetHardwareIdPositionV )->value_name( "Position" ),
+    "List only loads compatible with the given target hardware position.\n"
+      "Requires --target-hardware-id."
+  )
+  (
+    "load-type-id",
+    boost::program_options::value( &loadTypeIdV )->value_name( "ID" ),
+    "List only loads of the given load type ID (decimal)."
+  )
+  (
+    "media-set-part-number",
+    boost::program_options::value( &mediaSetPartNumberV )->value_name( "Part Number" ),
+    "List only loads of the media set with the given part number."
   );
 }
 
@@ -55,38 +106,23 @@ void ListLoadsCommand::execute( const Commands::Parameters &parameters )
       variablesMap );
     boost::program_options::notify( variablesMap );
 
-    // Media Set Manager
-    const auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
-      mediaSetManagerDirectoryV,
-      checkMediaSetManagerIntegrityV,
-      std::bind_front( &ListLoadsCommand::loadProgress, this ) ) };
-
-    const auto loads{ mediaSetManager->loads() };
-
-    if ( loads.empty() )
-    {
-      std::cout << "*** No loads within media set manger ***\n";
-    }
-    else
+    if ( targetHardwareIdPositionV && !targetHardwareIdV )
     {
-      for ( const auto &load : loads )
-      {
-        std::cout << std::format(
-          "Media Set P/N:        {}\n"
-          "Load Header Filename: {}\n"
-          "Load P/N:             {}\n",
-          load->mediaSet()->partNumber(),
-          load->name(),
-          load->partNumber() );
-
-        if ( const auto loadType{ load->loadType() }; loadType )
-        {
-          std::cout << std::format( "Load Type:            {} (0x{:08X})\n", loadType->first, loadType->second );
-        }
-
-        std::cout << "\n";
-      }
+      throw boost::program_options::error{ "--target-hardware-position requires --target-hardware-id" };
     }
+
+    std::cout << MediaSetManagerClient_execute(
+      mediaSetManagerDirectoryV,
+      checkMediaSetManagerIntegrityV,
+      std::bind_front( &ListLoadsCommand::loadProgress, this ),
+      MediaSetManagerService::ListLoadsRequest,
+      MediaSetManagerService::listLoadsArguments( Arinc665::Utils::MediaSetManager::LoadsQuery{
+        .partNumber = toOptional( partNumberV ),
+        .headerFilename = toOptional( headerFilenameV ),
+        .targetHardwareId = toOptional( targetHardwareIdV ),
+        .targetHardwareIdPosition = toOptional( targetHardwareIdPositionV ),
+        .loadTypeId = toOptional( loadTypeIdV ),
+        .mediaSetPartNumber = toOptional( mediaSetPartNumberV ) } ) );
   }
   catch ( const boost::program_options::error & )
   {
@@ -111,7 +147,8 @@ void ListLoadsCommand::execute( const Commands::Parameters &parameters )
 void ListLoadsCommand::help()
 {
   std::cout
-    << "List all loads contained with the Media Set Manager.\n\n"
+    << "List the loads contained with the Media Set Manager.\n"
+    << "If filters are given, only loads matching all of them are listed.\n\n"
     << optionsDescriptionV;
 }
 
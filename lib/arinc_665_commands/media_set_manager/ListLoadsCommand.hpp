@@ -20,8 +20,11 @@
 #include <commands/Commands.hpp>
 
 #include <boost/program_options.hpp>
+#include <boost/optional.hpp>
 
+#include <cstdint>
 #include <filesystem>
+#include <string>
 
 namespace Arinc665Commands::MediaSetManager {
 
@@ -29,6 +32,7 @@ namespace Arinc665Commands::MediaSetManager {
  * @brief List Loads within Media Set Manager %Command.
  *
  * List all loads, which are part of the media sets of the Media Set Manager.
+ * The loads can be filtered by part number, header filename, target hardware, load type, and media set.
  **/
 class ARINC_665_COMMANDS_EXPORT ListLoadsCommand
 {
@@ -71,6 +75,18 @@ class ARINC_665_COMMANDS_EXPORT ListLoadsCommand
     std::filesystem::path mediaSetManagerDirectoryV;
     //! Check Media Set Manager Integrity
     bool checkMediaSetManagerIntegrityV{ true };
+    //! Load Part Number Filter
+    boost::optional< std::string > partNumberV;
+    //! Load Header Filename Filter
+    boost::optional< std::string > headerFilenameV;
+    //! Target Hardware ID Filter
+    boost::optional< std::string > targetHardwareIdV;
+    //! Target Hardware Position Filter
+    boost::optional< std::string > targetHardwareIdPositionV;
+    //! Load Type ID Filter
+    boost::optional< uint16_t > loadTypeIdV;
+    //! Media Set Part Number Filter
+    boost::optional< std::string > mediaSetPartNumberV;
 };
 
 }
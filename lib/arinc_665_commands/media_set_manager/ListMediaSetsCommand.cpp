@@ -12,10 +12,8 @@
 
 #include "ListMediaSetsCommand.hpp"
 
-#include <arinc_665/utils/MediaSetManager.hpp>
-#include <arinc_665/utils/MediaSetPrinter.hpp>
-
-#include <arinc_645/CheckValue.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
 
 #include <spdlog/spdlog.h>
 
@@ -40,8 +38,9 @@ ListMediaSetsCommand::ListMediaSetsCommand() :
   (
     "check-media-set-manager-integrity,i",
     boost::program_options::value( &checkMediaSetManagerIntegrityV )
-      ->default_value( true ),
-    "Check Media Set Manager integrity during initialisation."
+      ->default_value( false ),
+    "Check Media Set Manager integrity during initialisation.\n"
+    "Otherwise, only the list files of the media sets are read."
   );
 }
 
@@ -57,29 +56,11 @@ void ListMediaSetsCommand::execute( const Commands::Parameters &parameters )
       variablesMap );
     boost::program_options::notify( variablesMap );
 
-    // Media Set Manager
-    const auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
+    std::cout << MediaSetManagerClient_execute(
       mediaSetManagerDirectoryV,
       checkMediaSetManagerIntegrityV,
-      std::bind_front( &ListMediaSetsCommand::loadProgress, this ) ) };
-
-    const auto mediaSets{ mediaSetManager->mediaSets() };
-
-    if ( mediaSets.empty() )
-    {
-      std::cout << "*** No media sets within media set manger ***\n";
-    }
-    else
-    {
-      for ( const auto &[ partNumber, mediaSet ] : mediaSetManager->mediaSets() )
-      {
-        std::cout << "Media Set:\n";
-
-        Arinc665::Utils::MediaSetPrinter_print( *mediaSet.first, std::cout, "  ", "  " );
-
-        std::cout << "\n";
-      }
-    }
+      std::bind_front( &ListMediaSetsCommand::loadProgress, this ),
+      MediaSetManagerService::ListMediaSetsRequest );
   }
   catch ( const boost::program_options::error & )
   {
@@ -70,7 +70,7 @@ class ARINC_665_COMMANDS_EXPORT ListMediaSetsCommand
     //! Media Set Manager Directory
     std::filesystem::path mediaSetManagerDirectoryV;
     //! Check Media Set Manager Integrity
-    bool checkMediaSetManagerIntegrityV{ true };
+    bool checkMediaSetManagerIntegrityV{ false };
 };
 
 }
@@ -19,6 +19,8 @@
 #include <arinc_665_commands/media_set_manager/ImportMediaSetXmlCommand.hpp>
 #include <arinc_665_commands/media_set_manager/ImportMediaSetCommand.hpp>
 #include <arinc_665_commands/media_set_manager/RemoveMediaSetCommand.hpp>
+#include <arinc_665_commands/media_set_manager/ServeCommand.hpp>
+#include <arinc_665_commands/media_set_manager/VerifyCommand.hpp>
 
 #include <commands/CommandRegistry.hpp>
 
@@ -78,6 +80,20 @@ void registerCommands( const Commands::CommandRegistryPtr& registry )
     "Remove ARINC 665 Media Set",
     std::bind_front( &RemoveMediaSetCommand::execute, removeMediaSetCommand ),
     std::bind_front( &RemoveMediaSetCommand::help, removeMediaSetCommand ) );
+
+  auto serveCommand{ std::make_shared< ServeCommand >() };
+  registry->command(
+    "Serve",
+    "Serve ARINC 665 Media Set Manager on a local socket",
+    std::bind_front( &ServeCommand::execute, serveCommand ),
+    std::bind_front( &ServeCommand::help, serveCommand ) );
+
+  auto verifyCommand{ std::make_shared< VerifyCommand >() };
+  registry->command(
+    "Verify",
+    "Verify ARINC 665 Media Sets by worker processes",
+    std::bind_front( &VerifyCommand::execute, verifyCommand ),
+    std::bind_front( &VerifyCommand::help, verifyCommand ) );
 }
 
 }
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665Commands::MediaSetManager MediaSetManagerClient.
+ **/
+
+#include "MediaSetManagerClient.hpp"
+
+#include "MediaSetManagerProtocol.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/exception/all.hpp>
+
+#include <istream>
+
+namespace Arinc665Commands::MediaSetManager {
+
+std::optional< std::string > MediaSetManagerClient_request(
+  [[maybe_unused]] const std::filesystem::path &mediaSetManagerDirectory,
+  [[maybe_unused]] const std::string_view request,
+  [[maybe_unused]] const MediaSetManagerService::Arguments &arguments )
+{
+#if defined( BOOST_ASIO_HAS_LOCAL_SOCKETS )
+  const auto socketPath{ Protocol_socketPath( mediaSetManagerDirectory ) };
+
+  if ( !std::filesystem::is_socket( socketPath ) )
+  {
+    return {};
+  }
+
+  boost::asio::io_context ioContext{};
+  boost::asio::local::stream_protocol::socket socket{ ioContext };
+
+  // stale socket or path too long - no service running
+  if ( boost::system::error_code error{};
+       socket.connect( boost::asio::local::stream_protocol::endpoint{ socketPath.string() }, error ) )
+  {
+    return {};
+  }
+
+  boost::asio::write(
+    socket,
+    boost::asio::buffer( Protocol_encodeFrame( request, Protocol_encodeArguments( arguments ) ) ) );
+
+  boost::asio::streambuf buffer{};
+  const auto headerSize{ boost::asio::read_until( socket, buffer, '\n' ) };
+
+  std::string header( headerSize - 1U, '\0' );
+  std::istream stream{ &buffer };
+  stream.read( header.data(), static_cast< std::streamsize >( header.size() ) );
+  stream.ignore( 1 );
+
+  const auto [ keyword, payloadSize ]{ Protocol_decodeHeader( header ) };
+
+  if ( buffer.size() < payloadSize )
+  {
+    boost::asio::read( socket, buffer, boost::asio::transfer_exactly( payloadSize - buffer.size() ) );
+  }
+
+  std::string payload( payloadSize, '\0' );
+  stream.read( payload.data(), static_cast< std::streamsize >( payload.size() ) );
+
+  if ( Protocol_ResponseOk != keyword )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ std::move( payload ) }
+      << boost::errinfo_file_name{ socketPath.string() } );
+  }
+
+  return payload;
+#else
+  // no local sockets on this platform - no service can be running
+  return {};
+#endif
+}
+
+std::string MediaSetManagerClient_execute(
+  const std::filesystem::path &mediaSetManagerDirectory,
+  const bool checkMediaSetManagerIntegrity,
+  Arinc665::Utils::MediaSetManager::LoadProgressHandler loadProgressHandler,
+  const std::string_view request,
+  const MediaSetManagerService::Arguments &arguments )
+{
+  if ( auto response{ MediaSetManagerClient_request( mediaSetManagerDirectory, request, arguments ) }; response )
+  {
+    return std::move( *response );
+  }
+
+  MediaSetManagerService service{
+    mediaSetManagerDirectory,
+    checkMediaSetManagerIntegrity,
+    std::move( loadProgressHandler ) };
+
+  return service( request, arguments );
+}
+
+}
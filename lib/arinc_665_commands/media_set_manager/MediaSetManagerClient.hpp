@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665Commands::MediaSetManager MediaSetManagerClient.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERCLIENT_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERCLIENT_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
+
+#include <arinc_665/utils/MediaSetManager.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @name Media Set Manager Client
+ *
+ * Sends requests to the Media Set Manager Service, which is served by the @ref ServeCommand.
+ * @{
+ **/
+
+/**
+ * @brief Sends the Request to the Media Set Manager Service of the given Directory.
+ *
+ * @param[in] mediaSetManagerDirectory
+ *   Media Set Manager Directory.
+ * @param[in] request
+ *   Request Name.
+ * @param[in] arguments
+ *   Request Arguments.
+ *
+ * @return Response Text, or empty if no service is running for @p mediaSetManagerDirectory.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the service reports a failure of the request.
+ * @throw boost::system::system_error
+ *   When the connection to the service is lost.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::optional< std::string > MediaSetManagerClient_request(
+  const std::filesystem::path &mediaSetManagerDirectory,
+  std::string_view request,
+  const MediaSetManagerService::Arguments &arguments = {} );
+
+/**
+ * @brief Executes the Request by the Media Set Manager Service.
+ *
+ * If a service is running for @p mediaSetManagerDirectory, the request is sent to it.
+ * Otherwise, the media set manager is loaded and the request is executed locally.
+ *
+ * @param[in] mediaSetManagerDirectory
+ *   Media Set Manager Directory.
+ * @param[in] checkMediaSetManagerIntegrity
+ *   Check Media Set Manager integrity, when the media set manager is loaded locally.
+ * @param[in] loadProgressHandler
+ *   Load Progress Handler, when the media set manager is loaded locally.
+ * @param[in] request
+ *   Request Name.
+ * @param[in] arguments
+ *   Request Arguments.
+ *
+ * @return Response Text.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the request fails.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::string MediaSetManagerClient_execute(
+  const std::filesystem::path &mediaSetManagerDirectory,
+  bool checkMediaSetManagerIntegrity,
+  Arinc665::Utils::MediaSetManager::LoadProgressHandler loadProgressHandler,
+  std::string_view request,
+  const MediaSetManagerService::Arguments &arguments = {} );
+
+/** @} **/
+
+}
+
+#endif
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665Commands::MediaSetManager MediaSetManagerProtocol.
+ **/
+
+#include "MediaSetManagerProtocol.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <cassert>
+#include <charconv>
+#include <format>
+
+namespace Arinc665Commands::MediaSetManager {
+
+std::filesystem::path Protocol_socketPath( const std::filesystem::path &mediaSetManagerDirectory )
+{
+  return mediaSetManagerDirectory / Protocol_SocketFilename;
+}
+
+std::string Protocol_encodeFrame( const std::string_view keyword, const std::string_view payload )
+{
+  assert( std::string_view::npos == keyword.find_first_of( " \n" ) );
+  return std::format( "{} {}\n{}", keyword, payload.size(), payload );
+}
+
+std::pair< std::string, std::size_t > Protocol_decodeHeader( const std::string_view header )
+{
+  const auto separator{ header.find( ' ' ) };
+
+  if ( ( std::string_view::npos == separator ) || ( 0U == separator ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Malformed frame header" } );
+  }
+
+  const auto sizeString{ header.substr( separator + 1U ) };
+  std::size_t payloadSize{ 0U };
+
+  if ( const auto [ end, error ]{
+         std::from_chars( sizeString.data(), sizeString.data() + sizeString.size(), payloadSize ) };
+       ( std::errc{} != error ) || ( sizeString.data() + sizeString.size() != end ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Malformed frame header" } );
+  }
+
+  if ( payloadSize > Protocol_MaxPayloadSize )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Frame payload too large" } );
+  }
+
+  return { std::string{ header.substr( 0U, separator ) }, payloadSize };
+}
+
+std::string Protocol_encodeArguments( const std::span< const std::string > arguments )
+{
+  std::string payload{};
+
+  for ( const auto &argument : arguments )
+  {
+    assert( std::string::npos == argument.find( '\0' ) );
+    payload.append( argument );
+    payload.push_back( '\0' );
+  }
+
+  return payload;
+}
+
+std::vector< std::string > Protocol_decodeArguments( std::string_view payload )
+{
+  std::vector< std::string > arguments{};
+
+  while ( !payload.empty() )
+  {
+    const auto end{ payload.find( '\0' ) };
+
+    if ( std::string_view::npos == end )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Unterminated request argument" } );
+    }
+
+    arguments.emplace_back( payload.substr( 0U, end ) );
+    payload.remove_prefix( end + 1U );
+  }
+
+  return arguments;
+}
+
+}
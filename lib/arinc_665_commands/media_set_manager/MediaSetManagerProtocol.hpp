@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665Commands::MediaSetManager MediaSetManagerProtocol.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERPROTOCOL_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERPROTOCOL_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @name Media Set Manager Service Protocol
+ *
+ * Requests and responses are exchanged as frames over a Unix domain socket.
+ * A frame consists of a header line `<Keyword> <Payload Size>\n` followed by the payload.
+ *
+ * - The keyword of a request is the request name (see MediaSetManagerService).
+ *   Its payload contains the request arguments, each terminated by a `\0` character.
+ * - The keyword of a response is @ref Protocol_ResponseOk or @ref Protocol_ResponseError.
+ *   Its payload is the response text or the error message.
+ *
+ * Several requests can be sent over one connection.
+ * @{
+ **/
+
+//! Filename of the Service Socket within the Media Set Manager Directory
+constexpr std::string_view Protocol_SocketFilename{ "MediaSetManager.socket" };
+
+//! Maximum Payload Size of a Frame
+constexpr std::size_t Protocol_MaxPayloadSize{ 16U * 1024U * 1024U };
+
+//! Response Keyword for successful Requests
+constexpr std::string_view Protocol_ResponseOk{ "OK" };
+
+//! Response Keyword for failed Requests
+constexpr std::string_view Protocol_ResponseError{ "ERROR" };
+
+/**
+ * @brief Returns the Service Socket Path of the given Media Set Manager.
+ *
+ * @param[in] mediaSetManagerDirectory
+ *   Media Set Manager Directory.
+ *
+ * @return Service Socket Path.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::filesystem::path Protocol_socketPath(
+  const std::filesystem::path &mediaSetManagerDirectory );
+
+/**
+ * @brief Encodes a Frame.
+ *
+ * @param[in] keyword
+ *   Keyword (must not contain whitespace).
+ * @param[in] payload
+ *   Payload.
+ *
+ * @return Encoded Frame.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::string Protocol_encodeFrame(
+  std::string_view keyword,
+  std::string_view payload );
+
+/**
+ * @brief Decodes a Frame Header Line.
+ *
+ * @param[in] header
+ *   Header Line without the terminating newline.
+ *
+ * @return Keyword and Payload Size.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the header is malformed or the payload size exceeds @ref Protocol_MaxPayloadSize.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::pair< std::string, std::size_t > Protocol_decodeHeader(
+  std::string_view header );
+
+/**
+ * @brief Encodes Request Arguments as Payload.
+ *
+ * @param[in] arguments
+ *   Request Arguments (must not contain `\0` characters).
+ *
+ * @return Payload.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::string Protocol_encodeArguments(
+  std::span< const std::string > arguments );
+
+/**
+ * @brief Decodes Request Arguments from the Payload.
+ *
+ * @param[in] payload
+ *   Payload.
+ *
+ * @return Request Arguments.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the last argument is not terminated.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::vector< std::string > Protocol_decodeArguments( std::string_view payload );
+
+/** @} **/
+
+}
+
+#endif
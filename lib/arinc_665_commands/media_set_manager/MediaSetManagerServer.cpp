@@ -0,0 +1,419 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665Commands::MediaSetManager MediaSetManagerServer.
+ **/
+
+#include "MediaSetManagerServer.hpp"
+
+#include "MediaSetManagerProtocol.hpp"
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/asio.hpp>
+#include <boost/exception/all.hpp>
+
+#include <csignal>
+#include <istream>
+#include <memory>
+#include <utility>
+
+#include <sys/stat.h>
+
+namespace Arinc665Commands::MediaSetManager {
+
+#if defined( BOOST_ASIO_HAS_LOCAL_SOCKETS )
+
+namespace {
+
+/**
+ * @brief Connection to a Client.
+ *
+ * Reads request frames, executes them by the service, and writes the response frames, until the client closes the
+ * connection.
+ * Queries are executed by the I/O thread, mutations by the mutation worker.
+ * The session keeps itself alive by the completion handlers.
+ **/
+class Session final : public std::enable_shared_from_this< Session >
+{
+  public:
+    /**
+     * @brief Initialises the Session.
+     *
+     * @param[in] socket
+     *   Connected Socket.
+     * @param[in,out] service
+     *   Media Set Manager Service.
+     * @param[in] mutationExecutor
+     *   Executor of the Mutation Worker.
+     **/
+    Session(
+      boost::asio::local::stream_protocol::socket socket,
+      MediaSetManagerService &service,
+      boost::asio::thread_pool::executor_type mutationExecutor ) :
+      socketV{ std::move( socket ) },
+      serviceV{ service },
+      mutationExecutorV{ std::move( mutationExecutor ) }
+    {
+    }
+
+    //! Starts reading the first Request.
+    void start()
+    {
+      readHeader();
+    }
+
+  private:
+    //! Reads the Header of the next Request.
+    void readHeader()
+    {
+      boost::asio::async_read_until(
+        socketV,
+        bufferV,
+        '\n',
+        [ self{ shared_from_this() } ]( const boost::system::error_code &error, const std::size_t headerSize )
+        {
+          self->headerRead( error, headerSize );
+        } );
+    }
+
+    /**
+     * @brief Decodes the Header and reads the Payload of the Request.
+     *
+     * @param[in] error
+     *   Read Error.
+     * @param[in] headerSize
+     *   Size of the Header Line including the newline.
+     **/
+    void headerRead( const boost::system::error_code &error, const std::size_t headerSize )
+    {
+      // connection closed by client
+      if ( error )
+      {
+        return;
+      }
+
+      std::string header( headerSize - 1U, '\0' );
+      std::istream stream{ &bufferV };
+      stream.read( header.data(), static_cast< std::streamsize >( header.size() ) );
+      stream.ignore( 1 );
+
+      std::string request{};
+      std::size_t payloadSize{ 0U };
+
+      try
+      {
+        std::tie( request, payloadSize ) = Protocol_decodeHeader( header );
+      }
+      catch ( const boost::exception &e )
+      {
+        // the frame boundaries are lost - respond and close the connection
+        spdlog::warn( "Invalid request: {}", boost::diagnostic_information( e ) );
+        writeResponse( Protocol_ResponseError, "Malformed request", false );
+        return;
+      }
+
+      const auto missing{ ( bufferV.size() < payloadSize ) ? payloadSize - bufferV.size() : 0U };
+
+      boost::asio::async_read(
+        socketV,
+        bufferV,
+        boost::asio::transfer_exactly( missing ),
+        [ self{ shared_from_this() }, request{ std::move( request ) }, payloadSize ](
+          const boost::system::error_code &readError,
+          std::size_t )
+        {
+          if ( !readError )
+          {
+            self->payloadRead( request, payloadSize );
+          }
+        } );
+    }
+
+    /**
+     * @brief Executes the Request and writes the Response.
+     *
+     * Mutations are posted to the mutation worker, so the I/O thread keeps answering the queries of other connections
+     * meanwhile.
+     * Their response is written by the I/O thread again.
+     *
+     * @param[in] request
+     *   Request Name.
+     * @param[in] payloadSize
+     *   Payload Size.
+     **/
+    void payloadRead( const std::string &request, const std::size_t payloadSize )
+    {
+      std::string payload( payloadSize, '\0' );
+      std::istream stream{ &bufferV };
+      stream.read( payload.data(), static_cast< std::streamsize >( payload.size() ) );
+
+      if ( !MediaSetManagerService::isMutation( request ) )
+      {
+        const auto [ keyword, response ]{ execute( request, payload ) };
+        writeResponse( keyword, response, true );
+        return;
+      }
+
+      boost::asio::post(
+        mutationExecutorV,
+        [ self{ shared_from_this() }, request, payload{ std::move( payload ) } ]
+        {
+          auto [ keyword, response ]{ self->execute( request, payload ) };
+
+          boost::asio::post(
+            self->socketV.get_executor(),
+            [ self, keyword, response{ std::move( response ) } ]
+            {
+              self->writeResponse( keyword, response, true );
+            } );
+        } );
+    }
+
+    /**
+     * @brief Executes the Request by the Service.
+     *
+     * @param[in] request
+     *   Request Name.
+     * @param[in] payload
+     *   Request Payload (encoded arguments).
+     *
+     * @return Response Keyword and Response Payload.
+     **/
+    [[nodiscard]] std::pair< std::string_view, std::string > execute(
+      const std::string &request,
+      const std::string &payload )
+    {
+      try
+      {
+        auto response{ serviceV( request, Protocol_decodeArguments( payload ) ) };
+        spdlog::info( "Request '{}' executed", request );
+        return { Protocol_ResponseOk, std::move( response ) };
+      }
+      catch ( const boost::exception &e )
+      {
+        spdlog::warn( "Request '{}' failed: {}", request, boost::diagnostic_information( e ) );
+        return { Protocol_ResponseError, boost::diagnostic_information( e ) };
+      }
+      catch ( const std::exception &e )
+      {
+        spdlog::warn( "Request '{}' failed: {}", request, e.what() );
+        return { Protocol_ResponseError, e.what() };
+      }
+    }
+
+    /**
+     * @brief Writes the Response.
+     *
+     * Responses exceeding @ref Protocol_MaxPayloadSize are replaced by an error response.
+     *
+     * @param[in] keyword
+     *   Response Keyword.
+     * @param[in] payload
+     *   Response Payload.
+     * @param[in] readNext
+     *   If set, the next request is read afterwards.
+     **/
+    void writeResponse( const std::string_view keyword, const std::string &payload, const bool readNext )
+    {
+      // the client rejects larger frames
+      if ( payload.size() > Protocol_MaxPayloadSize )
+      {
+        spdlog::warn( "Response of {} bytes exceeds the maximum payload size", payload.size() );
+        responseV = Protocol_encodeFrame( Protocol_ResponseError, "Response exceeds the maximum payload size" );
+      }
+      else
+      {
+        responseV = Protocol_encodeFrame( keyword, payload );
+      }
+
+      boost::asio::async_write(
+        socketV,
+        boost::asio::buffer( responseV ),
+        [ self{ shared_from_this() }, readNext ]( const boost::system::error_code &error, std::size_t )
+        {
+          if ( !error && readNext )
+          {
+            self->readHeader();
+          }
+        } );
+    }
+
+    //! Socket
+    boost::asio::local::stream_protocol::socket socketV;
+    //! Media Set Manager Service
+    MediaSetManagerService &serviceV;
+    //! Executor of the Mutation Worker
+    boost::asio::thread_pool::executor_type mutationExecutorV;
+    //! Receive Buffer
+    boost::asio::streambuf bufferV{ Protocol_MaxPayloadSize + 64U };
+    //! Response Frame - kept until written
+    std::string responseV;
+};
+
+/**
+ * @brief Accepts the next Connection.
+ *
+ * @param[in,out] acceptor
+ *   Acceptor.
+ * @param[in,out] service
+ *   Media Set Manager Service.
+ * @param[in,out] mutationWorker
+ *   Mutation Worker.
+ **/
+void accept(
+  boost::asio::local::stream_protocol::acceptor &acceptor,
+  MediaSetManagerService &service,
+  boost::asio::thread_pool &mutationWorker )
+{
+  acceptor.async_accept(
+    [ &acceptor, &service, &mutationWorker ](
+      const boost::system::error_code &error,
+      boost::asio::local::stream_protocol::socket socket )
+    {
+      // acceptor closed on shutdown
+      if ( boost::asio::error::operation_aborted == error )
+      {
+        return;
+      }
+
+      if ( !error )
+      {
+        std::make_shared< Session >( std::move( socket ), service, mutationWorker.get_executor() )->start();
+      }
+
+      accept( acceptor, service, mutationWorker );
+    } );
+}
+
+/**
+ * @brief Applies a Change detected by the Media Set Manager Watcher.
+ *
+ * @param[in,out] service
+ *   Media Set Manager Service.
+ * @param[in] change
+ *   Detected Change.
+ **/
+void applyChange( MediaSetManagerService &service, const Arinc665::Utils::MediaSetManagerWatcher::Change &change )
+{
+  try
+  {
+    if ( service.applyChange( change ) )
+    {
+      spdlog::info( "Media Set '{}' changed on disk - updated", change.mediaSetPaths.first.string() );
+    }
+  }
+  catch ( const boost::exception &e )
+  {
+    spdlog::warn(
+      "Applying change of Media Set '{}' failed: {}",
+      change.mediaSetPaths.first.string(),
+      boost::diagnostic_information( e ) );
+  }
+}
+
+}
+
+void MediaSetManagerServer_serve( MediaSetManagerService &service, const bool watch )
+{
+  const auto socketPath{ Protocol_socketPath( service.mediaSetManagerDirectory() ) };
+  const boost::asio::local::stream_protocol::endpoint endpoint{ socketPath.string() };
+
+  // handles the connections and executes the queries
+  boost::asio::io_context ioContext{ 1 };
+
+  if ( std::filesystem::exists( socketPath ) )
+  {
+    boost::asio::local::stream_protocol::socket socket{ ioContext };
+
+    if ( boost::system::error_code error{}; !socket.connect( endpoint, error ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Media Set Manager Service already running" }
+        << boost::errinfo_file_name{ socketPath.string() } );
+    }
+
+    // stale socket of a terminated service
+    std::filesystem::remove( socketPath );
+  }
+
+  boost::asio::local::stream_protocol::acceptor acceptor{ ioContext, endpoint.protocol() };
+
+  // the socket is created by bind() - restrict it to the owner from the beginning (the umask is process-wide, but no
+  // other threads create files yet)
+  const auto previousMask{ ::umask( S_IRWXG | S_IRWXO ) };
+  boost::system::error_code bindError{};
+  acceptor.bind( endpoint, bindError );
+  ::umask( previousMask );
+
+  if ( bindError )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ bindError.message() }
+      << boost::errinfo_file_name{ socketPath.string() } );
+  }
+
+  acceptor.listen();
+
+  boost::asio::signal_set signals{ ioContext, SIGINT, SIGTERM };
+  signals.async_wait( [ &ioContext ]( const boost::system::error_code &, int ) { ioContext.stop(); } );
+
+  // executes the mutations one after another - declared after the I/O context, so it is joined before
+  boost::asio::thread_pool mutationWorker{ 1U };
+
+  accept( acceptor, service, mutationWorker );
+
+  if ( watch )
+  {
+    try
+    {
+      // changes are detected within the watcher thread and applied between the mutations
+      service.watch( [ &mutationWorker, &service ]( Arinc665::Utils::MediaSetManagerWatcher::Change change )
+      {
+        boost::asio::post( mutationWorker, [ &service, change{ std::move( change ) } ]
+        {
+          applyChange( service, change );
+        } );
+      } );
+    }
+    catch ( ... )
+    {
+      std::filesystem::remove( socketPath );
+      throw;
+    }
+  }
+
+  spdlog::info( "Serving Media Set Manager on '{}'", socketPath.string() );
+  ioContext.run();
+
+  // the pending mutations are finished - their responses are not sent anymore
+  mutationWorker.join();
+  // the watcher is stopped after the last mutation, which updates it - changes posted meanwhile are discarded
+  service.watch( {} );
+  acceptor.close();
+  std::filesystem::remove( socketPath );
+}
+
+#else
+
+void MediaSetManagerServer_serve(
+  [[maybe_unused]] MediaSetManagerService &service,
+  [[maybe_unused]] const bool watch )
+{
+  BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+    << Helper::AdditionalInfo{ "Local sockets are not supported on this platform" } );
+}
+
+#endif
+
+}
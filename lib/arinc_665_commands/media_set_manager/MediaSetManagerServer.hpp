@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665Commands::MediaSetManager MediaSetManagerServer.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERSERVER_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERSERVER_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @brief Serves the Media Set Manager Service on its Socket.
+ *
+ * The socket is created within the media set manager directory (see Protocol_socketPath()) and is only accessible by
+ * the owner - already on creation, as the umask is restricted while binding.
+ * A stale socket of a terminated service is replaced.
+ *
+ * Connections are handled asynchronously by a single I/O thread, which also executes the queries.
+ * Mutations (see MediaSetManagerService::isMutation()) are executed one after another by a separate worker thread.
+ * So long-running imports and removals do not block the queries of other connections, which are answered from the
+ * current media set manager state meanwhile.
+ * Responses exceeding @ref Protocol_MaxPayloadSize are replaced by an error response.
+ *
+ * If @p watch is set, modifications of the media set manager by other tools are detected (see
+ * MediaSetManagerService::watch()).
+ * The changes are applied by the worker thread, between the mutations.
+ *
+ * Returns after `SIGINT` or `SIGTERM` has been received.
+ * Pending mutations are finished before, but their responses are not sent anymore.
+ * The socket is removed on return.
+ *
+ * @param[in,out] service
+ *   Media Set Manager Service.
+ * @param[in] watch
+ *   If set, the media set manager directory is watched for modifications.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When another service is already running for the media set manager, the socket cannot be bound, local sockets
+ *   are not supported, or watching fails.
+ * @throw boost::system::system_error
+ *   When the socket cannot be created.
+ **/
+ARINC_665_COMMANDS_EXPORT void MediaSetManagerServer_serve( MediaSetManagerService &service, bool watch = false );
+
+}
+
+#endif
@@ -0,0 +1,453 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665Commands::MediaSetManager::MediaSetManagerService.
+ **/
+
+#include "MediaSetManagerService.hpp"
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/Batch.hpp>
+
+#include <arinc_665/files/MediaSetInformation.hpp>
+
+#include <arinc_665/utils/FilesystemMediaSetCopier.hpp>
+#include <arinc_665/utils/FilesystemMediaSetDecompiler.hpp>
+#include <arinc_665/utils/FilesystemMediaSetRemover.hpp>
+#include <arinc_665/utils/FilePlacementStrategyDescription.hpp>
+#include <arinc_665/utils/MediaSetPrinter.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <cassert>
+#include <charconv>
+#include <format>
+#include <span>
+#include <sstream>
+
+namespace Arinc665Commands::MediaSetManager {
+
+bool MediaSetManagerService::isMutation( const std::string_view request ) noexcept
+{
+  return ( ImportMediaSetRequest == request ) || ( RemoveMediaSetRequest == request ) || ( ReloadRequest == request );
+}
+
+MediaSetManagerService::Arguments MediaSetManagerService::listLoadsArguments(
+  const Arinc665::Utils::MediaSetManager::LoadsQuery &query )
+{
+  // criteria not set are encoded as empty arguments
+  return {
+    query.partNumber.value_or( "" ),
+    query.headerFilename.value_or( "" ),
+    query.targetHardwareId.value_or( "" ),
+    query.targetHardwareIdPosition.value_or( "" ),
+    query.loadTypeId ? std::to_string( *query.loadTypeId ) : "",
+    query.mediaSetPartNumber.value_or( "" ) };
+}
+
+MediaSetManagerService::Arguments MediaSetManagerService::importMediaSetArguments(
+  const std::vector< std::filesystem::path > &mediaSourceDirectories,
+  const std::optional< bool > checkFileIntegrity,
+  const Arinc665::Utils::FilePlacementStrategy filePlacementStrategy,
+  const std::size_t threadsPerMedium )
+{
+  Arguments arguments{
+    checkFileIntegrity ? ( *checkFileIntegrity ? "true" : "false" ) : "",
+    std::string{ Arinc665::Utils::FilePlacementStrategyDescription::instance().name( filePlacementStrategy ) },
+    std::to_string( threadsPerMedium ) };
+
+  for ( const auto &mediumSourceDirectory : mediaSourceDirectories )
+  {
+    arguments.emplace_back( mediumSourceDirectory.string() );
+  }
+
+  return arguments;
+}
+
+MediaSetManagerService::MediaSetManagerService(
+  std::filesystem::path mediaSetManagerDirectory,
+  const bool checkMediaSetManagerIntegrity,
+  Arinc665::Utils::MediaSetManager::LoadProgressHandler loadProgressHandler ) :
+  mediaSetManagerDirectoryV{ std::move( mediaSetManagerDirectory ) },
+  checkMediaSetManagerIntegrityV{ checkMediaSetManagerIntegrity },
+  loadProgressHandlerV{ std::move( loadProgressHandler ) },
+  mediaSetManagerV{ Arinc665::Utils::MediaSetManager::load(
+    mediaSetManagerDirectoryV,
+    checkMediaSetManagerIntegrityV,
+    loadProgressHandlerV,
+    {},
+    {},
+    !checkMediaSetManagerIntegrityV ) }
+{
+}
+
+const std::filesystem::path& MediaSetManagerService::mediaSetManagerDirectory() const noexcept
+{
+  return mediaSetManagerDirectoryV;
+}
+
+std::string MediaSetManagerService::operator()( const std::string_view request, const Arguments &arguments )
+{
+  if ( ListLoadsRequest == request )
+  {
+    return listLoads( arguments );
+  }
+
+  if ( ListBatchesRequest == request )
+  {
+    return listBatches();
+  }
+
+  if ( ListMediaSetsRequest == request )
+  {
+    return listMediaSets();
+  }
+
+  if ( ImportMediaSetRequest == request )
+  {
+    return importMediaSet( arguments );
+  }
+
+  if ( RemoveMediaSetRequest == request )
+  {
+    return removeMediaSet( arguments );
+  }
+
+  if ( ReloadRequest == request )
+  {
+    return reload();
+  }
+
+  BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+    << Helper::AdditionalInfo{ std::format( "Unknown request '{}'", request ) } );
+}
+
+void MediaSetManagerService::watch( Arinc665::Utils::MediaSetManagerWatcher::ChangeHandler changeHandler )
+{
+  // stop the current watcher first, so no change is reported to the old handler afterwards
+  watcherV.reset();
+
+  if ( changeHandler )
+  {
+    watcherV = Arinc665::Utils::MediaSetManagerWatcher::create(
+      *mediaSetManagerV,
+      std::move( changeHandler ),
+      checkMediaSetManagerIntegrityV );
+  }
+}
+
+bool MediaSetManagerService::applyChange( const Arinc665::Utils::MediaSetManagerWatcher::Change &change )
+{
+  const auto modified{ Arinc665::Utils::MediaSetManagerWatcher::apply( *mediaSetManagerV, change ) };
+
+  if ( modified )
+  {
+    updateWatcher();
+  }
+
+  return modified;
+}
+
+Arinc665::Utils::MediaSetManagerPtr MediaSetManagerService::mediaSetManager() const
+{
+  const std::lock_guard lock{ mediaSetManagerMutexV };
+  return mediaSetManagerV;
+}
+
+std::string MediaSetManagerService::listLoads( const Arguments &arguments ) const
+{
+  Arinc665::Utils::MediaSetManager::LoadsQuery query{};
+
+  if ( !arguments.empty() )
+  {
+    // part number, header filename, THW ID, THW position, load type ID, and media set part number
+    if ( 6U != arguments.size() )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Invalid list loads arguments" } );
+    }
+
+    const auto criterion{ []( const std::string &argument ) {
+      return argument.empty() ? std::nullopt : std::optional< std::string >{ argument };
+    } };
+
+    query.partNumber = criterion( arguments[ 0 ] );
+    query.headerFilename = criterion( arguments[ 1 ] );
+    query.targetHardwareId = criterion( arguments[ 2 ] );
+    query.targetHardwareIdPosition = criterion( arguments[ 3 ] );
+    query.mediaSetPartNumber = criterion( arguments[ 5 ] );
+
+    if ( const auto &loadTypeIdArgument{ arguments[ 4 ] }; !loadTypeIdArgument.empty() )
+    {
+      uint16_t loadTypeId{};
+
+      if ( std::errc{} != std::from_chars(
+        loadTypeIdArgument.data(),
+        loadTypeIdArgument.data() + loadTypeIdArgument.size(),
+        loadTypeId ).ec )
+      {
+        BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+          << Helper::AdditionalInfo{ "Invalid list loads arguments" } );
+      }
+
+      query.loadTypeId = loadTypeId;
+    }
+  }
+
+  const auto loads{ mediaSetManager()->loads( query ) };
+
+  if ( loads.empty() )
+  {
+    return "*** No loads within media set manger ***\n";
+  }
+
+  std::string response{};
+
+  for ( const auto &load : loads )
+  {
+    response += std::format(
+      "Media Set P/N:        {}\n"
+      "Load Header Filename: {}\n"
+      "Load P/N:             {}\n",
+      load->mediaSet()->partNumber(),
+      load->name(),
+      load->partNumber() );
+
+    if ( const auto loadType{ load->loadType() }; loadType )
+    {
+      response += std::format( "Load Type:            {} (0x{:08X})\n", loadType->first, loadType->second );
+    }
+
+    response += "\n";
+  }
+
+  return response;
+}
+
+std::string MediaSetManagerService::listBatches() const
+{
+  const auto batches{ mediaSetManager()->batches() };
+
+  if ( batches.empty() )
+  {
+    return "*** No batches within media set manger ***\n";
+  }
+
+  std::string response{};
+
+  for ( const auto &batch : batches )
+  {
+    response += std::format(
+      "Media Set P/N:  {}\n"
+      "Batch Filename: {}\n"
+      "Batch P/N:      {}\n"
+      "Batch Comment:  {}\n\n",
+      batch->mediaSet()->partNumber(),
+      batch->name(),
+      batch->partNumber(),
+      batch->comment() );
+  }
+
+  return response;
+}
+
+std::string MediaSetManagerService::listMediaSets() const
+{
+  // the snapshot stays valid during concurrent imports and removals
+  const auto mediaSets{ mediaSetManager()->mediaSetsSnapshot() };
+
+  if ( mediaSets->empty() )
+  {
+    return "*** No media sets within media set manger ***\n";
+  }
+
+  std::ostringstream response{};
+
+  for ( const auto &[ partNumber, mediaSet ] : *mediaSets )
+  {
+    response << "Media Set:\n";
+
+    // the summary does not access the content of loads and batches, which might be decompiled lazily
+    Arinc665::Utils::MediaSetPrinter_printSummary( *mediaSet.first, response, "  ", "  " );
+
+    response << "\n";
+  }
+
+  return std::move( response ).str();
+}
+
+std::string MediaSetManagerService::importMediaSet( const Arguments &arguments )
+{
+  // check file integrity, file placement strategy, threads per medium, and at least one source directory
+  if ( arguments.size() < 4U )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Invalid import media set arguments" } );
+  }
+
+  std::optional< bool > checkFileIntegrityArgument{};
+  if ( "true" == arguments[ 0 ] )
+  {
+    checkFileIntegrityArgument = true;
+  }
+  else if ( "false" == arguments[ 0 ] )
+  {
+    checkFileIntegrityArgument = false;
+  }
+
+  const auto filePlacementStrategy{
+    Arinc665::Utils::FilePlacementStrategyDescription::instance().enumeration( arguments[ 1 ] ) };
+  std::size_t threadsPerMedium{ 0U };
+  const auto &threadsArgument{ arguments[ 2 ] };
+
+  if ( !filePlacementStrategy
+    || ( std::errc{} != std::from_chars(
+      threadsArgument.data(),
+      threadsArgument.data() + threadsArgument.size(),
+      threadsPerMedium ).ec ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Invalid import media set arguments" } );
+  }
+
+  // Fill the media paths list
+  Arinc665::Utils::MediaPaths sourceMediaPaths{};
+  for ( const auto &mediumSourceDirectory : std::span{ arguments }.subspan( 3U ) )
+  {
+    const auto mediumInformation{ Arinc665::Utils::getMediumInformation( mediumSourceDirectory ) };
+
+    if ( !mediumInformation )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Invalid medium source directory" }
+        << boost::errinfo_file_name{ mediumSourceDirectory } );
+    }
+
+    sourceMediaPaths.try_emplace( mediumInformation->mediaSequenceNumber, mediumSourceDirectory );
+  }
+
+  auto importer{ Arinc665::Utils::FilesystemMediaSetDecompiler::create() };
+  assert( importer );
+
+  const auto &defaults{ mediaSetManagerV->configuration().defaults };
+
+  const auto checkFileIntegrity{ checkFileIntegrityArgument.value_or( defaults.checkFileIntegrity ) };
+
+  // the listed files are checked by the copier on the copied buffers - the decompiler only checks the loads
+  importer
+    ->checkFileIntegrity( checkFileIntegrity )
+    .checkListedFiles( false )
+    .mediaPaths( sourceMediaPaths );
+
+  auto [ mediaSet, checkValues ]{ ( *importer )() };
+
+  if ( mediaSetManagerV->hasMediaSet( mediaSet->partNumber() ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception{} << Helper::AdditionalInfo{ "Media Set already exist" } );
+  }
+
+  const auto copier{ Arinc665::Utils::FilesystemMediaSetCopier::create() };
+  assert( copier );
+
+  copier
+    ->mediaPaths( sourceMediaPaths )
+    .outputBasePath( mediaSetManagerDirectoryV )
+    .mediaSetName( std::string{ mediaSet->partNumber() } )
+    .filePlacementStrategy( *filePlacementStrategy )
+    .checkFileIntegrity( checkFileIntegrity )
+    .threadsPerMedium( threadsPerMedium );
+
+  if ( defaults.payloadStore )
+  {
+    copier->payloadStore( mediaSetManagerDirectoryV / Arinc665::Utils::MediaSetManager::PayloadStoreDirectory );
+  }
+
+  const auto destinationPaths{ ( *copier )() };
+
+  std::string response{ std::format( "Imported Media Set {}\n", mediaSet->partNumber() ) };
+
+  // the copied files have been checked while copying - register the decompiled media set without reading it again
+  mediaSetManagerV->registerMediaSet( destinationPaths, std::move( mediaSet ), std::move( checkValues ), false );
+
+  mediaSetManagerV->saveConfiguration();
+  updateWatcher();
+
+  return response;
+}
+
+std::string MediaSetManagerService::removeMediaSet( const Arguments &arguments )
+{
+  if ( 1U != arguments.size() )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Invalid remove media set arguments" } );
+  }
+
+  const auto &mediaSetPartNumber{ arguments.front() };
+
+  if ( !mediaSetManagerV->hasMediaSet( mediaSetPartNumber ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception() << Helper::AdditionalInfo{ "Media Set does not exist" } );
+  }
+
+  auto mediaSetPaths{ mediaSetManagerV->deregisterMediaSet( mediaSetPartNumber ) };
+  mediaSetManagerV->saveConfiguration();
+  // stop watching before the files are removed
+  updateWatcher();
+
+  const auto remover{ Arinc665::Utils::FilesystemMediaSetRemover::create() };
+  assert( remover );
+
+  mediaSetPaths.first = mediaSetManagerDirectoryV / mediaSetPaths.first;
+  remover
+    ->mediaSetPaths( mediaSetPaths )
+    .payloadStore( mediaSetManagerDirectoryV / Arinc665::Utils::MediaSetManager::PayloadStoreDirectory );
+  ( *remover )();
+
+  return std::format( "Removed Media Set {}\n", mediaSetPartNumber );
+}
+
+std::string MediaSetManagerService::reload()
+{
+  // keep the current state, if loading fails
+  auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
+    mediaSetManagerDirectoryV,
+    checkMediaSetManagerIntegrityV,
+    loadProgressHandlerV,
+    {},
+    {},
+    !checkMediaSetManagerIntegrityV ) };
+
+  // the own modifications have been saved by each request - the stale state must not overwrite the configuration
+  // file, which has just been loaded
+  mediaSetManagerV->discardConfiguration();
+  {
+    // concurrent queries keep the previous instance until they are finished
+    const std::lock_guard lock{ mediaSetManagerMutexV };
+    mediaSetManagerV.swap( mediaSetManager );
+  }
+  updateWatcher();
+
+  return "Reloaded Media Set Manager\n";
+}
+
+void MediaSetManagerService::updateWatcher()
+{
+  if ( watcherV )
+  {
+    watcherV->watch( *mediaSetManagerV );
+  }
+}
+
+}
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665Commands::MediaSetManager::MediaSetManagerService.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERSERVICE_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERSERVICE_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+
+#include <arinc_665/utils/Utils.hpp>
+#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665/utils/MediaSetManagerWatcher.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @brief Media Set Manager Service.
+ *
+ * Keeps a loaded Media Set Manager and executes queries and mutations on it.
+ * The %Media Set Manager %Commands execute their operations as requests of this service.
+ * The service is either created locally for a single request, or is kept resident by the @ref ServeCommand and
+ * accessed over its socket (see MediaSetManagerClient_execute()).
+ * So the full media set manager is only loaded once for all requests.
+ *
+ * Queries are executed on a snapshot of the media set manager.
+ * So they may be executed concurrently with each other and with a mutation (see isMutation()).
+ * Mutations, applyChange(), and watch() must be executed one after another.
+ **/
+class ARINC_665_COMMANDS_EXPORT MediaSetManagerService
+{
+  public:
+    //! Request Arguments
+    using Arguments = std::vector< std::string >;
+
+    //! Lists the Loads (see listLoadsArguments() - all loads, if no arguments are given)
+    static constexpr std::string_view ListLoadsRequest{ "ListLoads" };
+    //! Lists all Batches (no arguments)
+    static constexpr std::string_view ListBatchesRequest{ "ListBatches" };
+    //! Lists all Media Sets (no arguments)
+    static constexpr std::string_view ListMediaSetsRequest{ "ListMediaSets" };
+    //! Imports a Media Set (see importMediaSetArguments())
+    static constexpr std::string_view ImportMediaSetRequest{ "ImportMediaSet" };
+    //! Removes a Media Set (argument: Media Set Part Number)
+    static constexpr std::string_view RemoveMediaSetRequest{ "RemoveMediaSet" };
+    //! Reloads the Media Set Manager after it has been modified by other means (no arguments)
+    static constexpr std::string_view ReloadRequest{ "Reload" };
+
+    /**
+     * @brief Returns if the Request modifies the Media Set Manager.
+     *
+     * @param[in] request
+     *   Request Name.
+     *
+     * @return If @p request is a mutation (import, remove, or reload).
+     **/
+    [[nodiscard]] static bool isMutation( std::string_view request ) noexcept;
+
+    /**
+     * @brief Encodes the Arguments of the List Loads Request.
+     *
+     * @param[in] query
+     *   Loads Query.
+     *
+     * @return Request Arguments.
+     **/
+    [[nodiscard]] static Arguments listLoadsArguments( const Arinc665::Utils::MediaSetManager::LoadsQuery &query );
+
+    /**
+     * @brief Encodes the Arguments of the Import Media Set Request.
+     *
+     * @param[in] mediaSourceDirectories
+     *   Media Source Directories (absolute paths).
+     * @param[in] checkFileIntegrity
+     *   Check File Integrity (media set manager default, if not set).
+     * @param[in] filePlacementStrategy
+     *   File Placement Strategy.
+     * @param[in] threadsPerMedium
+     *   Number of Files copied concurrently per Medium.
+     *
+     * @return Request Arguments.
+     **/
+    [[nodiscard]] static Arguments importMediaSetArguments(
+      const std::vector< std::filesystem::path > &mediaSourceDirectories,
+      std::optional< bool > checkFileIntegrity,
+      Arinc665::Utils::FilePlacementStrategy filePlacementStrategy,
+      std::size_t threadsPerMedium );
+
+    /**
+     * @brief Loads the Media Set Manager.
+     *
+     * @param[in] mediaSetManagerDirectory
+     *   Media Set Manager Directory.
+     * @param[in] checkMediaSetManagerIntegrity
+     *   Check Media Set Manager integrity during loading.
+     *   If not set, the media sets are decompiled lazily (see Arinc665::Utils::MediaSetManager::load()).
+     *   So the load header files and batch files are only read by requests accessing them.
+     * @param[in] loadProgressHandler
+     *   Load Progress Handler.
+     *
+     * @throw Arinc665::Arinc665Exception
+     *   When the media set manager cannot be loaded.
+     **/
+    MediaSetManagerService(
+      std::filesystem::path mediaSetManagerDirectory,
+      bool checkMediaSetManagerIntegrity,
+      Arinc665::Utils::MediaSetManager::LoadProgressHandler loadProgressHandler = {} );
+
+    /**
+     * @brief Returns the Media Set Manager Directory.
+     *
+     * @return Media Set Manager Directory.
+     **/
+    [[nodiscard]] const std::filesystem::path& mediaSetManagerDirectory() const noexcept;
+
+    /**
+     * @brief Executes the given Request.
+     *
+     * @param[in] request
+     *   Request Name.
+     * @param[in] arguments
+     *   Request Arguments.
+     *
+     * @return Response Text.
+     *
+     * @throw Arinc665::Arinc665Exception
+     *   When the request is unknown, its arguments are invalid, or it fails.
+     **/
+    [[nodiscard]] std::string operator()( std::string_view request, const Arguments &arguments );
+
+    /**
+     * @brief Watches the Media Set Manager for Modifications by other Tools.
+     *
+     * The media sets modified on disk are decompiled again in the background (see
+     * Arinc665::Utils::MediaSetManagerWatcher).
+     * The changes are provided to @p changeHandler within the watcher thread.
+     * The handler must forward them to the thread executing the mutations, which applies them by applyChange().
+     *
+     * @param[in] changeHandler
+     *   Change Handler.
+     *   If empty, watching is stopped.
+     *
+     * @throw Arinc665::Arinc665Exception
+     *   When watching is not supported or fails.
+     **/
+    void watch( Arinc665::Utils::MediaSetManagerWatcher::ChangeHandler changeHandler );
+
+    /**
+     * @brief Applies a Change detected by the Watcher.
+     *
+     * @param[in] change
+     *   Detected Change.
+     *
+     * @return If the Media Set Manager has been modified.
+     *
+     * @throw Arinc665::Arinc665Exception
+     *   When the change cannot be applied.
+     **/
+    bool applyChange( const Arinc665::Utils::MediaSetManagerWatcher::Change &change );
+
+  private:
+    /**
+     * @brief Returns the current Media Set Manager.
+     *
+     * The returned instance is kept, even if it is replaced by a concurrent reload.
+     *
+     * @return Current Media Set Manager.
+     **/
+    [[nodiscard]] Arinc665::Utils::MediaSetManagerPtr mediaSetManager() const;
+
+    /**
+     * @brief Lists the Loads matching the Query.
+     *
+     * @param[in] arguments
+     *   Request Arguments (see listLoadsArguments()).
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string listLoads( const Arguments &arguments ) const;
+
+    /**
+     * @brief Lists all Batches.
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string listBatches() const;
+
+    /**
+     * @brief Lists all Media Sets.
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string listMediaSets() const;
+
+    /**
+     * @brief Imports a Media Set.
+     *
+     * @param[in] arguments
+     *   Request Arguments (see importMediaSetArguments()).
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string importMediaSet( const Arguments &arguments );
+
+    /**
+     * @brief Removes a Media Set.
+     *
+     * @param[in] arguments
+     *   Request Arguments (Media Set Part Number).
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string removeMediaSet( const Arguments &arguments );
+
+    /**
+     * @brief Reloads the Media Set Manager.
+     *
+     * The previous instance is released without saving its configuration, which would overwrite the configuration
+     * just reloaded.
+     *
+     * @return Response Text.
+     **/
+    [[nodiscard]] std::string reload();
+
+    //! Updates the watched media sets after the Media Set Manager has been modified by a request.
+    void updateWatcher();
+
+    //! Media Set Manager Directory
+    std::filesystem::path mediaSetManagerDirectoryV;
+    //! Check Media Set Manager Integrity
+    bool checkMediaSetManagerIntegrityV;
+    //! Load Progress Handler
+    Arinc665::Utils::MediaSetManager::LoadProgressHandler loadProgressHandlerV;
+    //! Guards the Replacement of mediaSetManagerV (only replaced by mutations - which read it without lock)
+    mutable std::mutex mediaSetManagerMutexV;
+    //! Media Set Manager
+    Arinc665::Utils::MediaSetManagerPtr mediaSetManagerV;
+    //! Media Set Manager Watcher (empty if not watched)
+    Arinc665::Utils::MediaSetManagerWatcherPtr watcherV;
+};
+
+}
+
+#endif
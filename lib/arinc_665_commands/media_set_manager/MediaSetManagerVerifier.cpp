@@ -0,0 +1,1061 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Module Arinc665Commands::MediaSetManager MediaSetManagerVerifier.
+ **/
+
+#include "MediaSetManagerVerifier.hpp"
+
+#include "MediaSetManagerProtocol.hpp"
+
+#include <arinc_665/utils/BatchDigest.hpp>
+#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665/utils/MediaSetManagerConfiguration.hpp>
+
+#include <arinc_665/files/FileInfoTable.hpp>
+#include <arinc_665/files/FileListFile.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <helper/Exception.hpp>
+#include <helper/SafeCast.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <boost/config.hpp>
+#include <boost/exception/all.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined( BOOST_HAS_UNISTD_H )
+#include <cerrno>
+#include <csignal>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace Arinc665Commands::MediaSetManager {
+
+bool MediaSetManagerVerifierReport::valid() const noexcept
+{
+  return fileFailures.empty()
+    && shardFailures.empty()
+    && std::ranges::none_of( media, []( const Medium &medium ) { return !medium.error.empty(); } );
+}
+
+std::string_view MediaSetManagerVerifier_status( const MediaSetManagerVerifierStatus status ) noexcept
+{
+  switch ( status )
+  {
+    case MediaSetManagerVerifierStatus::Valid:
+      return "Valid";
+
+    case MediaSetManagerVerifierStatus::CrcInvalid:
+      return "CRC invalid";
+
+    case MediaSetManagerVerifierStatus::CheckValueInvalid:
+      return "Check Value invalid";
+
+    case MediaSetManagerVerifierStatus::ReadError:
+      return "Read error";
+
+    default:
+      return "Invalid";
+  }
+}
+
+#if defined( BOOST_HAS_UNISTD_H )
+
+namespace {
+
+//! Request Keyword to verify a Shard (Arguments: Shard, Medium Directory, Medium Number, First File, Files)
+constexpr std::string_view VerifyRequest{ "VERIFY" };
+//! Response Keyword of a verified Shard (Arguments: Shard, and Path, Status, Message of each File)
+constexpr std::string_view VerifyResponse{ "RESULT" };
+
+//! Files of a Medium in the Order of the List of Files
+using MediumFiles = std::vector< const Arinc665::Files::FileInfoTable::Entry * >;
+
+//! Shard of Files of a Medium
+struct Shard
+{
+  //! Medium of the Report
+  MediaSetManagerVerifierReport::Medium * medium;
+  //! Index of the first File within the Medium
+  std::size_t firstFile;
+  //! Number of Files
+  std::size_t files;
+  //! Number of Workers, which terminated while verifying this Shard
+  std::size_t failures{ 0U };
+};
+
+//! Worker Process as seen by the Coordinator
+struct Worker
+{
+  //! Process ID
+  pid_t pid;
+  //! Write End of the Request Pipe
+  int requestFd;
+  //! Read End of the Result Pipe
+  int resultFd;
+  //! Received, but not yet decoded Data
+  std::string buffer{};
+  //! Assigned Shard
+  std::optional< std::size_t > shard{};
+  //! Time, until the assigned Shard must be verified
+  std::chrono::steady_clock::time_point deadline{};
+};
+
+/**
+ * @brief Reads a File completely.
+ *
+ * @param[in] filePath
+ *   File Path.
+ *
+ * @return File content.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the file cannot be read.
+ **/
+Helper::RawData readFile( const std::filesystem::path &filePath )
+{
+  if ( !std::filesystem::is_regular_file( filePath ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "File not found" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  const auto fileSize{ std::filesystem::file_size( filePath ) };
+  Helper::RawData rawFile( fileSize );
+
+  std::ifstream file{ filePath, std::ifstream::binary | std::ifstream::in };
+  file.read( reinterpret_cast< char * >( std::data( rawFile ) ), static_cast< std::streamsize >( fileSize ) );
+
+  if ( !file || ( file.gcount() != static_cast< std::streamsize >( fileSize ) ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Error reading file" }
+      << boost::errinfo_file_name{ filePath.string() } );
+  }
+
+  return rawFile;
+}
+
+/**
+ * @brief Returns the Message of the current Exception.
+ *
+ * Must be called within a catch block.
+ *
+ * @return Exception message.
+ **/
+std::string exceptionMessage()
+{
+  try
+  {
+    throw;
+  }
+  catch ( const boost::exception &e )
+  {
+    if ( const auto * const info{ boost::get_error_info< Helper::AdditionalInfo >( e ) } )
+    {
+      return *info;
+    }
+
+    return boost::diagnostic_information( e, false );
+  }
+  catch ( const std::exception &e )
+  {
+    return e.what();
+  }
+  catch ( ... )
+  {
+    return "Unknown error";
+  }
+}
+
+/**
+ * @brief Returns the Files of a Medium.
+ *
+ * The list of files of each medium lists the files of all media of the media set.
+ *
+ * @param[in] filesInfo
+ *   Decoded List of Files.
+ * @param[in] mediumNumber
+ *   Medium Number.
+ *
+ * @return Files located on the medium.
+ **/
+MediumFiles mediumFiles(
+  const Arinc665::Files::FileInfoTable &filesInfo,
+  const Arinc665::MediumNumber &mediumNumber )
+{
+  MediumFiles files{};
+
+  for ( const auto &entry : filesInfo.entries() )
+  {
+    if ( entry.memberSequenceNumber == mediumNumber )
+    {
+      files.push_back( &entry );
+    }
+  }
+
+  return files;
+}
+
+/**
+ * @brief Returns the Path of a File within the Medium.
+ *
+ * @param[in] entry
+ *   File Information.
+ *
+ * @return Relative file path.
+ **/
+std::filesystem::path filePath( const Arinc665::Files::FileInfoTable::Entry &entry )
+{
+  std::string pathName{ entry.pathName };
+  std::ranges::replace( pathName, '\\', '/' );
+
+  return ( std::filesystem::path{ pathName } / entry.filename ).relative_path();
+}
+
+/**
+ * @brief Parses a numerical Argument.
+ *
+ * @param[in] argument
+ *   Argument.
+ *
+ * @return Numerical value.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the argument is not a number.
+ **/
+std::size_t parseNumber( const std::string_view argument )
+{
+  std::size_t value{ 0U };
+
+  if ( const auto [ end, error ]{ std::from_chars( argument.data(), argument.data() + argument.size(), value ) };
+       ( std::errc{} != error ) || ( argument.data() + argument.size() != end ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Malformed number" } );
+  }
+
+  return value;
+}
+
+/**
+ * @brief Writes all Data to the File Descriptor.
+ *
+ * @param[in] fd
+ *   File Descriptor.
+ * @param[in] data
+ *   Data to write.
+ *
+ * @throw std::system_error
+ *   When writing fails (e.g. the reader terminated).
+ **/
+void writeAll( const int fd, std::string_view data )
+{
+  while ( !data.empty() )
+  {
+    const auto written{ ::write( fd, data.data(), data.size() ) };
+
+    if ( written < 0 )
+    {
+      if ( EINTR == errno )
+      {
+        continue;
+      }
+
+      throw std::system_error{ errno, std::generic_category(), "write" };
+    }
+
+    data.remove_prefix( static_cast< std::size_t >( written ) );
+  }
+}
+
+/**
+ * @brief Decodes the next Frame from the received Data.
+ *
+ * @param[in,out] buffer
+ *   Received, but not yet decoded data. The decoded frame is removed.
+ *
+ * @return Keyword and payload of the frame, or an empty optional if the frame has not been received completely.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the frame header is malformed.
+ **/
+std::optional< std::pair< std::string, std::string > > decodeFrame( std::string &buffer )
+{
+  const auto newline{ buffer.find( '\n' ) };
+
+  if ( std::string::npos == newline )
+  {
+    return {};
+  }
+
+  auto [ keyword, payloadSize ]{ Protocol_decodeHeader( std::string_view{ buffer }.substr( 0U, newline ) ) };
+
+  if ( buffer.size() - newline - 1U < payloadSize )
+  {
+    return {};
+  }
+
+  std::pair< std::string, std::string > frame{ std::move( keyword ), buffer.substr( newline + 1U, payloadSize ) };
+  buffer.erase( 0U, newline + 1U + payloadSize );
+  return frame;
+}
+
+/**
+ * @brief Reads the next Frame from the File Descriptor.
+ *
+ * Blocks until the frame is read completely.
+ *
+ * @param[in] fd
+ *   File Descriptor.
+ * @param[in,out] buffer
+ *   Received, but not yet decoded data.
+ *
+ * @return Keyword and payload of the frame, or an empty optional if the writer closed the pipe between two frames.
+ *
+ * @throw std::system_error
+ *   When reading fails.
+ * @throw Arinc665::Arinc665Exception
+ *   When the frame is malformed or truncated.
+ **/
+std::optional< std::pair< std::string, std::string > > readFrame( const int fd, std::string &buffer )
+{
+  for ( ;; )
+  {
+    if ( auto frame{ decodeFrame( buffer ) } )
+    {
+      return frame;
+    }
+
+    std::array< char, 64U * 1024U > chunk{};
+    const auto received{ ::read( fd, chunk.data(), chunk.size() ) };
+
+    if ( received < 0 )
+    {
+      if ( EINTR == errno )
+      {
+        continue;
+      }
+
+      throw std::system_error{ errno, std::generic_category(), "read" };
+    }
+
+    if ( 0 == received )
+    {
+      if ( buffer.empty() )
+      {
+        return {};
+      }
+
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Truncated frame" } );
+    }
+
+    buffer.append( chunk.data(), static_cast< std::size_t >( received ) );
+  }
+}
+
+/**
+ * @brief Receives the available Data from the non-blocking File Descriptor.
+ *
+ * Does not block - frames are decoded by decodeFrame(), once they have been received completely.
+ *
+ * @param[in] fd
+ *   Non-blocking File Descriptor.
+ * @param[in,out] buffer
+ *   Received, but not yet decoded data. The available data is appended.
+ *
+ * @return If the writer keeps the pipe open.
+ *
+ * @throw std::system_error
+ *   When reading fails.
+ **/
+bool receive( const int fd, std::string &buffer )
+{
+  for ( ;; )
+  {
+    std::array< char, 64U * 1024U > chunk{};
+    const auto received{ ::read( fd, chunk.data(), chunk.size() ) };
+
+    if ( received < 0 )
+    {
+      if ( EINTR == errno )
+      {
+        continue;
+      }
+
+      if ( ( EAGAIN == errno ) || ( EWOULDBLOCK == errno ) )
+      {
+        return true;
+      }
+
+      throw std::system_error{ errno, std::generic_category(), "read" };
+    }
+
+    if ( 0 == received )
+    {
+      return false;
+    }
+
+    buffer.append( chunk.data(), static_cast< std::size_t >( received ) );
+  }
+}
+
+/**
+ * @brief Verifies a Shard within the Worker.
+ *
+ * @param[in,out] filesInfos
+ *   Decoded Lists of Files by Medium Directory (decoded on first use).
+ * @param[in] arguments
+ *   Request Arguments.
+ *
+ * @return Response Payload.
+ **/
+std::string verifyShard(
+  std::map< std::filesystem::path, Arinc665::Files::FileInfoTable > &filesInfos,
+  const std::vector< std::string > &arguments )
+{
+  if ( arguments.size() != 5U )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Invalid verify request" } );
+  }
+
+  const std::filesystem::path mediumDirectory{ arguments[ 1 ] };
+  const Arinc665::MediumNumber mediumNumber{ Helper::safeCast< uint8_t >( parseNumber( arguments[ 2 ] ) ) };
+  const auto firstFile{ parseNumber( arguments[ 3 ] ) };
+  const auto fileCount{ parseNumber( arguments[ 4 ] ) };
+
+  auto filesInfo{ filesInfos.find( mediumDirectory ) };
+
+  if ( filesInfos.end() == filesInfo )
+  {
+    filesInfo = filesInfos.emplace(
+      mediumDirectory,
+      Arinc665::Files::FileListFile::decodeFilesInfoTable(
+        readFile( mediumDirectory / Arinc665::ListOfFilesName ) ) ).first;
+  }
+
+  const auto files{ mediumFiles( filesInfo->second, mediumNumber ) };
+
+  if ( ( firstFile > files.size() ) || ( fileCount > files.size() - firstFile ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Shard exceeds list of files" }
+      << boost::errinfo_file_name{ mediumDirectory.string() } );
+  }
+
+  const auto shardFiles{ std::span{ files }.subspan( firstFile, fileCount ) };
+
+  std::vector< std::string > results{ arguments[ 0 ] };
+  std::vector< std::optional< Helper::RawData > > contents( shardFiles.size() );
+  std::vector< std::string > readErrors( shardFiles.size() );
+
+  std::vector< Arinc665::Utils::DigestRequest > requests{};
+  requests.reserve( shardFiles.size() );
+
+  for ( std::size_t index{ 0U }; index < shardFiles.size(); ++index )
+  {
+    try
+    {
+      contents[ index ] = readFile( mediumDirectory / filePath( *shardFiles[ index ] ) );
+      requests.push_back( Arinc665::Utils::DigestRequest{
+        .data = *contents[ index ],
+        .checkValueType = shardFiles[ index ]->checkValue.type() } );
+    }
+    catch ( ... )
+    {
+      readErrors[ index ] = exceptionMessage();
+    }
+  }
+
+  // the worker processes provide the parallelism - a single lane per worker
+  const auto digests{ Arinc665::Utils::BatchDigest_calculate( requests, 1U ) };
+  auto digest{ digests.begin() };
+
+  for ( std::size_t index{ 0U }; index < shardFiles.size(); ++index )
+  {
+    const auto &entry{ *shardFiles[ index ] };
+    auto status{ MediaSetManagerVerifierStatus::Valid };
+    std::string message{};
+
+    if ( !contents[ index ] )
+    {
+      status = MediaSetManagerVerifierStatus::ReadError;
+      message = std::move( readErrors[ index ] );
+    }
+    else
+    {
+      if ( digest->crc != entry.crc )
+      {
+        status = MediaSetManagerVerifierStatus::CrcInvalid;
+        message = std::format( "CRC {:04X} expected {:04X}", digest->crc, entry.crc );
+      }
+      else if ( ( Arinc645::CheckValueType::NotUsed != entry.checkValue.type() )
+        && ( digest->checkValue != entry.checkValue ) )
+      {
+        status = MediaSetManagerVerifierStatus::CheckValueInvalid;
+        message = std::format(
+          "Check Value {} expected {}",
+          digest->checkValue.toString(),
+          entry.checkValue.toString() );
+      }
+
+      ++digest;
+    }
+
+    results.emplace_back( filePath( entry ).generic_string() );
+    results.emplace_back( std::to_string( static_cast< unsigned int >( status ) ) );
+    results.emplace_back( std::move( message ) );
+  }
+
+  return Protocol_encodeArguments( results );
+}
+
+/**
+ * @brief Worker Process Main Loop.
+ *
+ * Verifies the requested shards until the coordinator closes the request pipe.
+ *
+ * @param[in] requestFd
+ *   Read End of the Request Pipe.
+ * @param[in] resultFd
+ *   Write End of the Result Pipe.
+ *
+ * @return Process exit status.
+ **/
+int worker( const int requestFd, const int resultFd )
+{
+  std::map< std::filesystem::path, Arinc665::Files::FileInfoTable > filesInfos{};
+  std::string buffer{};
+
+  try
+  {
+    while ( const auto request{ readFrame( requestFd, buffer ) } )
+    {
+      if ( request->first != VerifyRequest )
+      {
+        return EXIT_FAILURE;
+      }
+
+      writeAll(
+        resultFd,
+        Protocol_encodeFrame(
+          VerifyResponse,
+          verifyShard( filesInfos, Protocol_decodeArguments( request->second ) ) ) );
+    }
+
+    return EXIT_SUCCESS;
+  }
+  catch ( ... )
+  {
+    // the coordinator detects the closed pipe and assigns the shard again
+    spdlog::error( "Verification worker failed: {}", exceptionMessage() );
+    return EXIT_FAILURE;
+  }
+}
+
+/**
+ * @brief Stops a Worker Process and returns its Termination Reason.
+ *
+ * @param[in] worker
+ *   Worker.
+ * @param[in] kill
+ *   If set, the worker is killed before it is awaited.
+ *
+ * @return Termination reason.
+ **/
+std::string stopWorker( const Worker &worker, const bool kill )
+{
+  ::close( worker.requestFd );
+  ::close( worker.resultFd );
+
+  if ( kill )
+  {
+    ::kill( worker.pid, SIGKILL );
+  }
+
+  int status{ 0 };
+
+  while ( ::waitpid( worker.pid, &status, 0 ) < 0 )
+  {
+    if ( EINTR != errno )
+    {
+      return "Worker not awaitable";
+    }
+  }
+
+  if ( WIFSIGNALED( status ) )
+  {
+    return std::format( "Worker terminated by signal {}", WTERMSIG( status ) );
+  }
+
+  return std::format( "Worker exited with status {}", WEXITSTATUS( status ) );
+}
+
+/**
+ * @brief Starts a Worker Process.
+ *
+ * @param[in] workers
+ *   Running Workers (their pipes are closed within the new worker).
+ *
+ * @return New Worker.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the pipes or the process cannot be created.
+ **/
+Worker startWorker( const std::vector< Worker > &workers )
+{
+  std::array< int, 2U > requestPipe{};
+  std::array< int, 2U > resultPipe{};
+
+  if ( 0 != ::pipe( requestPipe.data() ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Cannot create worker pipe" }
+      << boost::errinfo_errno{ errno } );
+  }
+
+  if ( 0 != ::pipe( resultPipe.data() ) )
+  {
+    const auto error{ errno };
+    ::close( requestPipe[ 0 ] );
+    ::close( requestPipe[ 1 ] );
+
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Cannot create worker pipe" }
+      << boost::errinfo_errno{ error } );
+  }
+
+  const auto pid{ ::fork() };
+
+  if ( 0 == pid )
+  {
+    // otherwise the coordinator does not detect the termination of the other workers
+    for ( const auto &other : workers )
+    {
+      ::close( other.requestFd );
+      ::close( other.resultFd );
+    }
+
+    ::close( requestPipe[ 1 ] );
+    ::close( resultPipe[ 0 ] );
+
+    // do not run the destructors and exit handlers of the coordinator
+    ::_exit( worker( requestPipe[ 0 ], resultPipe[ 1 ] ) );
+  }
+
+  const auto error{ errno };
+  ::close( requestPipe[ 0 ] );
+  ::close( resultPipe[ 1 ] );
+
+  if ( pid < 0 )
+  {
+    ::close( requestPipe[ 1 ] );
+    ::close( resultPipe[ 0 ] );
+
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Cannot create worker process" }
+      << boost::errinfo_errno{ error } );
+  }
+
+  // the coordinator must not block on a partially written result (see receive())
+  if ( const auto flags{ ::fcntl( resultPipe[ 0 ], F_GETFL ) };
+    ( flags < 0 ) || ( ::fcntl( resultPipe[ 0 ], F_SETFL, flags | O_NONBLOCK ) < 0 ) )
+  {
+    const auto fcntlError{ errno };
+    stopWorker( Worker{ .pid = pid, .requestFd = requestPipe[ 1 ], .resultFd = resultPipe[ 0 ] }, true );
+
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Cannot configure worker pipe" }
+      << boost::errinfo_errno{ fcntlError } );
+  }
+
+  return Worker{ .pid = pid, .requestFd = requestPipe[ 1 ], .resultFd = resultPipe[ 0 ] };
+}
+
+/**
+ * @brief Distributes the Shards to the Workers and aggregates their Results.
+ *
+ * @param[in,out] report
+ *   Verification Report.
+ * @param[in,out] shards
+ *   Shards to verify.
+ * @param[in] workerCount
+ *   Maximum number of worker processes.
+ * @param[in] retries
+ *   Number of times a shard is assigned again.
+ * @param[in] shardTimeout
+ *   Time a worker may take for a shard, before it is killed (0: unlimited).
+ **/
+void coordinate(
+  MediaSetManagerVerifierReport &report,
+  std::vector< Shard > &shards,
+  const std::size_t workerCount,
+  const std::size_t retries,
+  const std::chrono::milliseconds shardTimeout )
+{
+  std::deque< std::size_t > pendingShards( shards.size() );
+  std::iota( pendingShards.begin(), pendingShards.end(), 0U );
+
+  std::vector< Worker > workers{};
+
+  // a terminated worker is detected by the failed write to its request pipe
+  struct sigaction ignore{};
+  struct sigaction previous{};
+  ignore.sa_handler = SIG_IGN;
+  ::sigaction( SIGPIPE, &ignore, &previous );
+
+  const auto busy{ []( const Worker &worker ) { return worker.shard.has_value(); } };
+
+  const auto workerFailed{ [ & ]( const std::size_t workerIndex, const bool kill, const std::string &cause = {} )
+  {
+    const auto worker{ workers[ workerIndex ] };
+    workers.erase( workers.begin() + static_cast< std::ptrdiff_t >( workerIndex ) );
+
+    const auto terminationReason{ stopWorker( worker, kill ) };
+    const auto &reason{ cause.empty() ? terminationReason : cause };
+    ++report.workerFailures;
+
+    if ( !worker.shard )
+    {
+      return;
+    }
+
+    auto &shard{ shards[ *worker.shard ] };
+    spdlog::warn(
+      "{} while verifying {} medium {} files {}-{}",
+      reason,
+      shard.medium->mediaSetPartNumber,
+      static_cast< std::string >( shard.medium->mediumNumber ),
+      shard.firstFile,
+      shard.firstFile + shard.files - 1U );
+
+    if ( ++shard.failures > retries )
+    {
+      report.shardFailures.emplace_back( MediaSetManagerVerifierReport::ShardFailure{
+        .mediaSetPartNumber = shard.medium->mediaSetPartNumber,
+        .mediumNumber = shard.medium->mediumNumber,
+        .firstFile = shard.firstFile,
+        .files = shard.files,
+        .reason = reason } );
+      return;
+    }
+
+    pendingShards.push_front( *worker.shard );
+  } };
+
+  const auto resultReceived{ [ & ]( Worker &worker, const std::string &payload )
+  {
+    const auto arguments{ Protocol_decodeArguments( payload ) };
+    auto &shard{ shards[ *worker.shard ] };
+
+    if ( ( arguments.size() != 1U + 3U * shard.files ) || ( parseNumber( arguments[ 0 ] ) != *worker.shard ) )
+    {
+      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+        << Helper::AdditionalInfo{ "Invalid verification result" } );
+    }
+
+    for ( std::size_t file{ 0U }; file < shard.files; ++file )
+    {
+      const auto &path{ arguments[ 1U + 3U * file ] };
+      const auto status{ static_cast< MediaSetManagerVerifierStatus >( parseNumber( arguments[ 2U + 3U * file ] ) ) };
+
+      if ( MediaSetManagerVerifierStatus::Valid == status )
+      {
+        ++shard.medium->validFiles;
+        continue;
+      }
+
+      report.fileFailures.emplace_back( MediaSetManagerVerifierReport::FileFailure{
+        .mediaSetPartNumber = shard.medium->mediaSetPartNumber,
+        .mediumNumber = shard.medium->mediumNumber,
+        .path = path,
+        .status = status,
+        .message = arguments[ 3U + 3U * file ] } );
+    }
+
+    worker.shard.reset();
+  } };
+
+  try
+  {
+    while ( !pendingShards.empty() || std::ranges::any_of( workers, busy ) )
+    {
+      // replace terminated workers, as long as shards are pending
+      while ( ( workers.size() < workerCount )
+        && ( static_cast< std::size_t >( std::ranges::count_if( workers, std::not_fn( busy ) ) )
+          < pendingShards.size() ) )
+      {
+        workers.push_back( startWorker( workers ) );
+      }
+
+      // assign pending shards to idle workers
+      for ( std::size_t workerIndex{ 0U }; ( workerIndex < workers.size() ) && !pendingShards.empty(); )
+      {
+        auto &worker{ workers[ workerIndex ] };
+
+        if ( worker.shard )
+        {
+          ++workerIndex;
+          continue;
+        }
+
+        worker.shard = pendingShards.front();
+        worker.deadline = std::chrono::steady_clock::now() + shardTimeout;
+        pendingShards.pop_front();
+
+        const auto &shard{ shards[ *worker.shard ] };
+        const std::vector< std::string > arguments{
+          std::to_string( *worker.shard ),
+          shard.medium->directory.string(),
+          std::to_string( static_cast< unsigned int >( static_cast< uint8_t >( shard.medium->mediumNumber ) ) ),
+          std::to_string( shard.firstFile ),
+          std::to_string( shard.files ) };
+
+        try
+        {
+          writeAll( worker.requestFd, Protocol_encodeFrame( VerifyRequest, Protocol_encodeArguments( arguments ) ) );
+          ++workerIndex;
+        }
+        catch ( const std::system_error & )
+        {
+          workerFailed( workerIndex, true );
+        }
+      }
+
+      // all workers failed on assignment - start new ones
+      if ( std::ranges::none_of( workers, busy ) )
+      {
+        continue;
+      }
+
+      std::vector< pollfd > pollFds{};
+      for ( const auto &worker : workers )
+      {
+        pollFds.push_back( pollfd{ .fd = worker.resultFd, .events = POLLIN, .revents = 0 } );
+      }
+
+      // wake up at the earliest deadline of the busy workers
+      int timeout{ -1 };
+      if ( shardTimeout.count() > 0 )
+      {
+        const auto now{ std::chrono::steady_clock::now() };
+        auto earliestDeadline{ std::chrono::steady_clock::time_point::max() };
+
+        for ( const auto &worker : workers | std::views::filter( busy ) )
+        {
+          earliestDeadline = std::min( earliestDeadline, worker.deadline );
+        }
+
+        timeout = static_cast< int >( std::clamp(
+          std::chrono::ceil< std::chrono::milliseconds >( earliestDeadline - now ).count(),
+          std::chrono::milliseconds::rep{ 0 },
+          std::chrono::milliseconds::rep{ std::numeric_limits< int >::max() } ) );
+      }
+
+      if ( ::poll( pollFds.data(), pollFds.size(), timeout ) < 0 )
+      {
+        if ( EINTR == errno )
+        {
+          continue;
+        }
+
+        BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+          << Helper::AdditionalInfo{ "Waiting for workers failed" }
+          << boost::errinfo_errno{ errno } );
+      }
+
+      const auto now{ std::chrono::steady_clock::now() };
+
+      // backwards - failed workers are removed
+      for ( auto workerIndex{ workers.size() }; workerIndex-- > 0U; )
+      {
+        auto &worker{ workers[ workerIndex ] };
+
+        if ( 0 != pollFds[ workerIndex ].revents )
+        {
+          try
+          {
+            // only complete frames are decoded - a partially written result is completed by the next wake up
+            const auto open{ receive( worker.resultFd, worker.buffer ) };
+
+            while ( const auto frame{ decodeFrame( worker.buffer ) } )
+            {
+              if ( ( frame->first != VerifyResponse ) || !worker.shard )
+              {
+                BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+                  << Helper::AdditionalInfo{ "Unexpected frame" } );
+              }
+
+              resultReceived( worker, frame->second );
+            }
+
+            if ( !open )
+            {
+              workerFailed( workerIndex, true );
+              continue;
+            }
+          }
+          catch ( ... )
+          {
+            spdlog::warn( "Verification worker failed: {}", exceptionMessage() );
+            workerFailed( workerIndex, true );
+            continue;
+          }
+        }
+
+        // the worker hangs (e.g. on a stalled file system) - kill it and assign the shard again
+        if ( worker.shard && ( shardTimeout.count() > 0 ) && ( now >= worker.deadline ) )
+        {
+          workerFailed(
+            workerIndex,
+            true,
+            std::format( "Shard not verified within {} ms", shardTimeout.count() ) );
+        }
+      }
+    }
+  }
+  catch ( ... )
+  {
+    for ( const auto &worker : workers )
+    {
+      stopWorker( worker, true );
+    }
+
+    ::sigaction( SIGPIPE, &previous, nullptr );
+    throw;
+  }
+
+  // idle workers exit, when their request pipe is closed
+  for ( const auto &worker : workers )
+  {
+    stopWorker( worker, false );
+  }
+
+  ::sigaction( SIGPIPE, &previous, nullptr );
+}
+
+}
+
+MediaSetManagerVerifierReport MediaSetManagerVerifier_verify(
+  const std::filesystem::path &mediaSetManagerDirectory,
+  std::size_t workers,
+  const std::size_t shardSize,
+  const std::size_t retries,
+  const std::chrono::milliseconds shardTimeout )
+{
+  const auto configurationFile{ mediaSetManagerDirectory / Arinc665::Utils::MediaSetManager::ConfigurationFilename };
+
+  if ( !std::filesystem::is_regular_file( configurationFile ) )
+  {
+    BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+      << Helper::AdditionalInfo{ "Media Set Configuration file does not exists" }
+      << boost::errinfo_file_name{ configurationFile.string() } );
+  }
+
+  boost::property_tree::ptree configurationProperties{};
+  boost::property_tree::json_parser::read_json( configurationFile.string(), configurationProperties );
+  const Arinc665::Utils::MediaSetManagerConfiguration configuration{ configurationProperties };
+
+  if ( 0U == workers )
+  {
+    workers = std::max( std::thread::hardware_concurrency(), 1U );
+  }
+
+  MediaSetManagerVerifierReport report{};
+  std::vector< Shard > shards{};
+
+  for ( const auto &[ mediaSetPath, mediaPaths ] : configuration.mediaSets )
+  {
+    for ( const auto &[ mediumNumber, mediumPath ] : mediaPaths )
+    {
+      auto &medium{ report.media.emplace_back( MediaSetManagerVerifierReport::Medium{
+        .mediaSetPartNumber = {},
+        .mediumNumber = mediumNumber,
+        .directory = ( mediaSetManagerDirectory / mediaSetPath / mediumPath ).lexically_normal(),
+        .files = 0U,
+        .validFiles = 0U,
+        .error = {} } ) };
+
+      try
+      {
+        const auto rawFileListFile{ readFile( medium.directory / Arinc665::ListOfFilesName ) };
+
+        medium.mediaSetPartNumber = Arinc665::Files::FileListFile{ rawFileListFile }.mediaSetPn();
+        medium.files = mediumFiles(
+          Arinc665::Files::FileListFile::decodeFilesInfoTable( rawFileListFile ),
+          mediumNumber ).size();
+      }
+      catch ( ... )
+      {
+        medium.mediaSetPartNumber = mediaSetPath.string();
+        medium.error = exceptionMessage();
+        continue;
+      }
+
+      for ( std::size_t firstFile{ 0U }; firstFile < medium.files; firstFile += std::max( shardSize, 1UZ ) )
+      {
+        shards.push_back( Shard{
+          .medium = &medium,
+          .firstFile = firstFile,
+          .files = std::min( std::max( shardSize, 1UZ ), medium.files - firstFile ) } );
+      }
+    }
+  }
+
+  coordinate( report, shards, workers, retries, shardTimeout );
+
+  return report;
+}
+
+#else
+
+MediaSetManagerVerifierReport MediaSetManagerVerifier_verify(
+  [[maybe_unused]] const std::filesystem::path &mediaSetManagerDirectory,
+  [[maybe_unused]] const std::size_t workers,
+  [[maybe_unused]] const std::size_t shardSize,
+  [[maybe_unused]] const std::size_t retries,
+  [[maybe_unused]] const std::chrono::milliseconds shardTimeout )
+{
+  BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception()
+    << Helper::AdditionalInfo{ "Worker processes are not supported on this platform" } );
+}
+
+#endif
+
+}
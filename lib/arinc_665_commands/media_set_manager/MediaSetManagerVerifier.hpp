@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Module Arinc665Commands::MediaSetManager MediaSetManagerVerifier.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERVERIFIER_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_MEDIASETMANAGERVERIFIER_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+
+#include <arinc_665/MediumNumber.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <string>
+#include <string_view>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @name Media Set Manager Verifier
+ *
+ * Verifies the files of all media sets registered with a media set manager by a coordinator and a set of worker
+ * processes.
+ *
+ * The files of each medium, as listed by its list of files (`FILES.LUM`), are split into shards of consecutive files.
+ * The coordinator distributes the shards over pipes to the worker processes, which read the files, calculate their
+ * CRC and check value, and compare them against the list of files.
+ * The results are aggregated into a single report.
+ *
+ * A worker only works on one shard at a time.
+ * When a worker terminates unexpectedly or does not finish its shard within the shard timeout, the worker is killed,
+ * its shard is assigned again and the worker is replaced.
+ * So a file, which crashes or stalls a worker, only affects its own shard.
+ * The coordinator never blocks on a single worker - results are received non-blocking and decoded, once they are
+ * complete.
+ * @{
+ **/
+
+//! Verification Status of a File
+enum class MediaSetManagerVerifierStatus
+{
+  Valid,             //!< CRC and Check Value match the list of files
+  CrcInvalid,        //!< CRC does not match
+  CheckValueInvalid, //!< Check Value does not match
+  ReadError          //!< File cannot be read
+};
+
+//! Verification Report
+struct ARINC_665_COMMANDS_EXPORT MediaSetManagerVerifierReport
+{
+  //! Verified Medium
+  struct Medium
+  {
+    //! Media Set Part Number
+    std::string mediaSetPartNumber;
+    //! Medium Number
+    Arinc665::MediumNumber mediumNumber;
+    //! Medium Directory
+    std::filesystem::path directory;
+    //! Number of Files listed for the Medium
+    std::size_t files{ 0U };
+    //! Number of valid Files
+    std::size_t validFiles{ 0U };
+    //! Error Message, when the list of files cannot be decoded (the medium is not verified)
+    std::string error;
+  };
+
+  //! File, which failed the Verification
+  struct FileFailure
+  {
+    //! Media Set Part Number
+    std::string mediaSetPartNumber;
+    //! Medium Number
+    Arinc665::MediumNumber mediumNumber;
+    //! Path of the File within the Medium
+    std::filesystem::path path;
+    //! Verification Status
+    MediaSetManagerVerifierStatus status{ MediaSetManagerVerifierStatus::Valid };
+    //! Details (read error, or calculated and expected CRC or check value)
+    std::string message;
+  };
+
+  //! Shard, which could not be verified (all its workers terminated unexpectedly)
+  struct ShardFailure
+  {
+    //! Media Set Part Number
+    std::string mediaSetPartNumber;
+    //! Medium Number
+    Arinc665::MediumNumber mediumNumber;
+    //! Index of the first File within the Medium
+    std::size_t firstFile{ 0U };
+    //! Number of Files
+    std::size_t files{ 0U };
+    //! Termination Reason of the last Worker (or the timeout)
+    std::string reason;
+  };
+
+  //! Verified Media
+  std::list< Medium > media;
+  //! Failed Files
+  std::list< FileFailure > fileFailures;
+  //! Failed Shards
+  std::list< ShardFailure > shardFailures;
+  //! Number of Workers, which terminated unexpectedly or have been killed on timeout
+  std::size_t workerFailures{ 0U };
+
+  /**
+   * @brief Returns if all Files have been verified successfully.
+   *
+   * @return If no medium, file or shard failed.
+   **/
+  [[nodiscard]] bool valid() const noexcept;
+};
+
+/**
+ * @brief Returns the String Representation of the Verification Status.
+ *
+ * @param[in] status
+ *   Verification Status.
+ *
+ * @return String representation.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT std::string_view MediaSetManagerVerifier_status(
+  MediaSetManagerVerifierStatus status ) noexcept;
+
+/**
+ * @brief Verifies the Files of all Media Sets of the Media Set Manager.
+ *
+ * The media set manager is not loaded - only its configuration file and the list of files of each medium are read.
+ *
+ * The worker processes are forked by the calling process.
+ * So this function must be called before other threads are created.
+ *
+ * @param[in] mediaSetManagerDirectory
+ *   Media Set Manager Directory.
+ * @param[in] workers
+ *   Number of worker processes. 0 selects the number of hardware threads.
+ * @param[in] shardSize
+ *   Maximum number of files of a shard.
+ * @param[in] retries
+ *   Number of times a shard is assigned again, after its worker terminated unexpectedly or timed out.
+ * @param[in] shardTimeout
+ *   Time a worker may take to verify a shard, before it is killed. 0 disables the timeout.
+ *
+ * @return Verification Report.
+ *
+ * @throw Arinc665::Arinc665Exception
+ *   When the configuration cannot be loaded, worker processes cannot be created, or worker processes are not
+ *   supported on this platform.
+ **/
+[[nodiscard]] ARINC_665_COMMANDS_EXPORT MediaSetManagerVerifierReport MediaSetManagerVerifier_verify(
+  const std::filesystem::path &mediaSetManagerDirectory,
+  std::size_t workers = 0U,
+  std::size_t shardSize = 64U,
+  std::size_t retries = 1U,
+  std::chrono::milliseconds shardTimeout = std::chrono::minutes{ 10 } );
+
+/** @} **/
+
+}
+
+#endif
@@ -12,12 +12,8 @@
 
 #include "RemoveMediaSetCommand.hpp"
 
-#include <arinc_665/utils/MediaSetManager.hpp>
-#include <arinc_665/utils/FilesystemMediaSetRemover.hpp>
-
-#include <arinc_665/Arinc665Exception.hpp>
-
-#include <helper/Exception.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
 
 #include <spdlog/spdlog.h>
 
@@ -67,28 +63,12 @@ void RemoveMediaSetCommand::execute( const Commands::Parameters &parameters )
       variablesMap );
     boost::program_options::notify( variablesMap );
 
-    // Media Set Manager
-    const auto mediaSetManager{ Arinc665::Utils::MediaSetManager::load(
+    std::cout << MediaSetManagerClient_execute(
       mediaSetManagerDirectoryV,
       checkMediaSetManagerIntegrityV,
-      std::bind_front( &RemoveMediaSetCommand::loadProgress, this ) ) };
-
-    auto mediaSet{ mediaSetManager->mediaSet( mediaSetPartNumberV ) };
-
-    if ( !mediaSet )
-    {
-      BOOST_THROW_EXCEPTION( Arinc665::Arinc665Exception() << Helper::AdditionalInfo{ "Media Set does not exist" } );
-    }
-
-    auto mediaSetPaths{ mediaSetManager->deregisterMediaSet( mediaSetPartNumberV ) };
-    mediaSetManager->saveConfiguration();
-
-    const auto remover{ Arinc665::Utils::FilesystemMediaSetRemover::create() };
-    assert( remover );
-
-    mediaSetPaths.first = mediaSetManagerDirectoryV / mediaSetPaths.first;
-    remover->mediaSetPaths( mediaSetPaths );
-    ( *remover )();
+      std::bind_front( &RemoveMediaSetCommand::loadProgress, this ),
+      MediaSetManagerService::RemoveMediaSetRequest,
+      { mediaSetPartNumberV } );
   }
   catch ( const boost::program_options::error & )
   {
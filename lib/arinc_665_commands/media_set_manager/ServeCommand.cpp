@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665Commands::MediaSetManager::ServeCommand.
+ **/
+
+#include "ServeCommand.hpp"
+
+#include <arinc_665_commands/media_set_manager/MediaSetManagerServer.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerService.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <iostream>
+#include <format>
+
+namespace Arinc665Commands::MediaSetManager {
+
+ServeCommand::ServeCommand() :
+  optionsDescriptionV{ "Serve ARINC 665 Media Set Manager Options" }
+{
+  optionsDescriptionV.add_options()
+  (
+    "media-set-manager-dir,d",
+    boost::program_options::value( &mediaSetManagerDirectoryV )
+      ->required()
+      ->value_name( "Directory" ),
+    "ARINC 665 Media Set Manager directory."
+  )
+  (
+    "check-media-set-manager-integrity,i",
+    boost::program_options::value( &checkMediaSetManagerIntegrityV )
+      ->default_value( true ),
+    "Check Media Set Manager integrity during initialisation."
+  )
+  (
+    "watch,w",
+    boost::program_options::value( &watchV )->default_value( true ),
+    "Watch the Media Set Manager directory and update modified media sets without reloading."
+  );
+}
+
+void ServeCommand::execute( const Commands::Parameters &parameters )
+{
+  try
+  {
+    std::cout << "Serve ARINC 665 Media Set Manager\n";
+
+    boost::program_options::variables_map variablesMap;
+    boost::program_options::store(
+      boost::program_options::command_line_parser( parameters ).options( optionsDescriptionV ).run(),
+      variablesMap );
+    boost::program_options::notify( variablesMap );
+
+    MediaSetManagerService service{
+      mediaSetManagerDirectoryV,
+      checkMediaSetManagerIntegrityV,
+      std::bind_front( &ServeCommand::loadProgress, this ) };
+
+    std::cout << "Serving - terminate with SIGINT or SIGTERM\n";
+
+    MediaSetManagerServer_serve( service, watchV );
+  }
+  catch ( const boost::program_options::error & )
+  {
+    // parsing errors are handled by command handler
+    throw;
+  }
+  catch ( const boost::exception &e )
+  {
+    std::cerr
+      << std::format( "Operation failed: {}\n", boost::diagnostic_information( e ) );
+  }
+  catch ( const std::exception &e )
+  {
+    std::cerr << std::format( "Operation failed: {}\n", e.what() );
+  }
+  catch ( ... )
+  {
+    std::cerr << "Operation failed: UNKNOWN EXCEPTION\n";
+  }
+}
+
+void ServeCommand::help()
+{
+  std::cout
+    << "Keep the Media Set Manager loaded and serve the requests of the other commands on a local socket.\n\n"
+    << optionsDescriptionV;
+}
+
+void ServeCommand::loadProgress(
+  std::pair< std::size_t, std::size_t > mediaSet,
+  std::string_view partNumber,
+  std::pair< Arinc665::MediumNumber, Arinc665::MediumNumber > medium )
+{
+  std::cout << std::format(
+    "Loading: {}/{} {} {}:{}\n",
+    mediaSet.first,
+    mediaSet.second,
+    partNumber,
+    static_cast< std::string >( medium.first ),
+    static_cast< std::string >( medium.second ) );
+}
+
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665Commands::MediaSetManager::ServeCommand.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_SERVECOMMAND_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_SERVECOMMAND_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+
+#include <arinc_665/Arinc665.hpp>
+
+#include <commands/Commands.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <filesystem>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @brief Serve Media Set Manager %Command.
+ *
+ * Loads the Media Set Manager once and serves its queries and mutations on a local socket until terminated.
+ * The other %Media Set Manager %Commands send their requests to this service, when it is running for their media set
+ * manager directory.
+ **/
+class ARINC_665_COMMANDS_EXPORT ServeCommand
+{
+  public:
+    /**
+     * @brief Constructs the Serve Command.
+     **/
+    ServeCommand();
+
+    /**
+     * @brief Executes the Operation.
+     *
+     * @param[in] parameters
+     *   Parameters supplied by User.
+     **/
+    void execute( const Commands::Parameters &parameters );
+
+    //! Prints help screen.
+    void help();
+
+  private:
+    /**
+     * @brief Load progress indicator.
+     *
+     * @param[in] mediaSet
+     *   Media Set information
+     * @param[in] partNumber
+     *   Media Set Part Number
+     * @param[in] medium
+     *   Medium information
+     **/
+    void loadProgress(
+      std::pair< std::size_t, std::size_t > mediaSet,
+      std::string_view partNumber,
+      std::pair< Arinc665::MediumNumber, Arinc665::MediumNumber > medium );
+
+    //! Program Options Description
+    boost::program_options::options_description optionsDescriptionV;
+    //! Media Set Manager Directory
+    std::filesystem::path mediaSetManagerDirectoryV;
+    //! Check Media Set Manager Integrity
+    bool checkMediaSetManagerIntegrityV{ true };
+    //! Watch the Media Set Manager for Modifications by other Tools
+    bool watchV{ true };
+};
+
+}
+
+#endif
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665Commands::MediaSetManager::VerifyCommand.
+ **/
+
+#include "VerifyCommand.hpp"
+
+#include <arinc_665_commands/media_set_manager/MediaSetManagerVerifier.hpp>
+
+#include <boost/exception/all.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <format>
+
+namespace Arinc665Commands::MediaSetManager {
+
+VerifyCommand::VerifyCommand() :
+  optionsDescriptionV{ "Verify ARINC 665 Media Set Manager Options" }
+{
+  optionsDescriptionV.add_options()
+  (
+    "media-set-manager-dir,d",
+    boost::program_options::value( &mediaSetManagerDirectoryV )
+      ->required()
+      ->value_name( "Directory" ),
+    "ARINC 665 Media Set Manager directory."
+  )
+  (
+    "workers,w",
+    boost::program_options::value( &workersV )->default_value( 0U ),
+    "Number of worker processes (0: number of hardware threads)."
+  )
+  (
+    "shard-size",
+    boost::program_options::value( &shardSizeV )->default_value( 64U ),
+    "Maximum number of files assigned to a worker at once."
+  )
+  (
+    "retries",
+    boost::program_options::value( &retriesV )->default_value( 1U ),
+    "Number of times the files of a terminated worker are assigned again."
+  )
+  (
+    "shard-timeout",
+    boost::program_options::value( &shardTimeoutV )->default_value( 600U ),
+    "Seconds a worker may take for its files, before it is terminated (0: unlimited)."
+  );
+}
+
+void VerifyCommand::execute( const Commands::Parameters &parameters )
+{
+  try
+  {
+    std::cout << "Verify ARINC 665 Media Set Manager\n";
+
+    boost::program_options::variables_map variablesMap;
+    boost::program_options::store(
+      boost::program_options::command_line_parser( parameters ).options( optionsDescriptionV ).run(),
+      variablesMap );
+    boost::program_options::notify( variablesMap );
+
+    const auto report{ MediaSetManagerVerifier_verify(
+      mediaSetManagerDirectoryV,
+      workersV,
+      shardSizeV,
+      retriesV,
+      std::chrono::seconds{ shardTimeoutV } ) };
+
+    for ( const auto &medium : report.media )
+    {
+      if ( !medium.error.empty() )
+      {
+        std::cout << std::format(
+          "{} {}: not verified: {}\n",
+          medium.mediaSetPartNumber,
+          static_cast< std::string >( medium.mediumNumber ),
+          medium.error );
+        continue;
+      }
+
+      std::cout << std::format(
+        "{} {}: {}/{} files valid\n",
+        medium.mediaSetPartNumber,
+        static_cast< std::string >( medium.mediumNumber ),
+        medium.validFiles,
+        medium.files );
+    }
+
+    for ( const auto &failure : report.fileFailures )
+    {
+      std::cout << std::format(
+        "{} {} '{}': {}{}{}\n",
+        failure.mediaSetPartNumber,
+        static_cast< std::string >( failure.mediumNumber ),
+        failure.path.generic_string(),
+        MediaSetManagerVerifier_status( failure.status ),
+        failure.message.empty() ? "" : " - ",
+        failure.message );
+    }
+
+    for ( const auto &failure : report.shardFailures )
+    {
+      std::cout << std::format(
+        "{} {} files {}-{}: not verified: {}\n",
+        failure.mediaSetPartNumber,
+        static_cast< std::string >( failure.mediumNumber ),
+        failure.firstFile,
+        failure.firstFile + failure.files - 1U,
+        failure.reason );
+    }
+
+    if ( 0U != report.workerFailures )
+    {
+      std::cout << std::format( "{} worker(s) terminated unexpectedly\n", report.workerFailures );
+    }
+
+    std::cout << ( report.valid() ? "Verification passed\n" : "Verification failed\n" );
+  }
+  catch ( const boost::program_options::error & )
+  {
+    // parsing errors are handled by command handler
+    throw;
+  }
+  catch ( const boost::exception &e )
+  {
+    std::cerr
+      << std::format( "Operation failed: {}\n", boost::diagnostic_information( e ) );
+  }
+  catch ( const std::exception &e )
+  {
+    std::cerr << std::format( "Operation failed: {}\n", e.what() );
+  }
+  catch ( ... )
+  {
+    std::cerr << "Operation failed: UNKNOWN EXCEPTION\n";
+  }
+}
+
+void VerifyCommand::help()
+{
+  std::cout
+    << "Verify the files of all Media Sets registered with the Media Set Manager by worker processes.\n\n"
+    << optionsDescriptionV;
+}
+
+}
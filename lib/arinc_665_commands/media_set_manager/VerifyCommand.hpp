@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665Commands::MediaSetManager::VerifyCommand.
+ **/
+
+#ifndef ARINC_665_COMMANDS_MEDIA_SET_MANAGER_VERIFYCOMMAND_HPP
+#define ARINC_665_COMMANDS_MEDIA_SET_MANAGER_VERIFYCOMMAND_HPP
+
+#include <arinc_665_commands/media_set_manager/MediaSetManager.hpp>
+
+#include <commands/Commands.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <cstddef>
+#include <filesystem>
+
+namespace Arinc665Commands::MediaSetManager {
+
+/**
+ * @brief Verify Media Set Manager %Command.
+ *
+ * Verifies the files of all registered Media Sets by worker processes and prints the aggregated report.
+ *
+ * @sa MediaSetManagerVerifier_verify()
+ **/
+class ARINC_665_COMMANDS_EXPORT VerifyCommand
+{
+  public:
+    /**
+     * @brief Constructs the Verify Command.
+     **/
+    VerifyCommand();
+
+    /**
+     * @brief Executes the Operation.
+     *
+     * @param[in] parameters
+     *   Parameters supplied by User.
+     **/
+    void execute( const Commands::Parameters &parameters );
+
+    //! Prints help screen.
+    void help();
+
+  private:
+    //! Program Options Description
+    boost::program_options::options_description optionsDescriptionV;
+    //! Media Set Manager Directory
+    std::filesystem::path mediaSetManagerDirectoryV;
+    //! Number of Worker Processes
+    std::size_t workersV{ 0U };
+    //! Maximum Number of Files of a Shard
+    std::size_t shardSizeV{ 64U };
+    //! Number of Retries of a Shard
+    std::size_t retriesV{ 1U };
+    //! Shard Timeout in Seconds (0: unlimited)
+    std::size_t shardTimeoutV{ 600U };
+};
+
+}
+
+#endif
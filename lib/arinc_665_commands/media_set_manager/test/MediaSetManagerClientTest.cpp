@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Module Arinc665Commands::MediaSetManager MediaSetManagerClient.
+ **/
+
+#include <arinc_665_commands/media_set_manager/MediaSetManagerClient.hpp>
+#include <arinc_665_commands/media_set_manager/MediaSetManagerProtocol.hpp>
+
+#include <arinc_665/utils/MediaSetManager.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <format>
+#include <future>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace Arinc665Commands::MediaSetManager {
+
+namespace {
+
+//! Response of an empty Media Set Manager to the List Media Sets Request
+constexpr std::string_view NoMediaSetsResponse{ "*** No media sets within media set manger ***\n" };
+
+/**
+ * @brief Creates an empty Media Set Manager.
+ *
+ * @param[in] directory
+ *   Media Set Manager Directory.
+ **/
+void createMediaSetManager( const std::filesystem::path &directory )
+{
+  Arinc665::Utils::MediaSetManager::loadOrCreate( directory )->saveConfiguration();
+}
+
+#if defined( BOOST_ASIO_HAS_LOCAL_SOCKETS )
+
+/**
+ * @brief Answers a single Request with the given Response Frame.
+ *
+ * Replaces the media set manager service.
+ * The connection is closed after the response has been written.
+ *
+ * @param[in,out] acceptor
+ *   Acceptor bound to the service socket.
+ * @param[in] response
+ *   Response Frame (might be malformed).
+ *
+ * @return Received Request Name and Arguments.
+ **/
+std::future< std::tuple< std::string, MediaSetManagerService::Arguments > > respond(
+  boost::asio::local::stream_protocol::acceptor &acceptor,
+  std::string response )
+{
+  return std::async( std::launch::async, [ &acceptor, response{ std::move( response ) } ]
+  {
+    auto socket{ acceptor.accept() };
+
+    boost::asio::streambuf buffer{};
+    const auto headerSize{ boost::asio::read_until( socket, buffer, '\n' ) };
+
+    std::string header( headerSize - 1U, '\0' );
+    std::istream stream{ &buffer };
+    stream.read( header.data(), static_cast< std::streamsize >( header.size() ) );
+    stream.ignore( 1 );
+
+    const auto [ request, payloadSize ]{ Protocol_decodeHeader( header ) };
+
+    if ( buffer.size() < payloadSize )
+    {
+      boost::asio::read( socket, buffer, boost::asio::transfer_exactly( payloadSize - buffer.size() ) );
+    }
+
+    std::string payload( payloadSize, '\0' );
+    stream.read( payload.data(), static_cast< std::streamsize >( payload.size() ) );
+
+    boost::asio::write( socket, boost::asio::buffer( response ) );
+
+    return std::make_tuple( request, Protocol_decodeArguments( payload ) );
+  } );
+}
+
+#endif
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665CommandsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerClientTest )
+
+//! Without a running service, the request is executed locally
+BOOST_AUTO_TEST_CASE( localFallback )
+{
+  const Arinc665::Test::TemporaryDirectory directory{};
+  createMediaSetManager( directory.path() );
+
+  BOOST_CHECK( !MediaSetManagerClient_request( directory.path(), MediaSetManagerService::ListMediaSetsRequest ) );
+  BOOST_CHECK_EQUAL(
+    MediaSetManagerClient_execute( directory.path(), false, {}, MediaSetManagerService::ListMediaSetsRequest ),
+    NoMediaSetsResponse );
+
+  // failures of the local execution are reported
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_execute( directory.path(), false, {}, "Unknown" ),
+    Arinc665::Arinc665Exception );
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_execute(
+      directory.path(),
+      false,
+      {},
+      MediaSetManagerService::RemoveMediaSetRequest,
+      { "UNKNOWN" } ),
+    Arinc665::Arinc665Exception );
+
+#if defined( BOOST_ASIO_HAS_LOCAL_SOCKETS )
+  // stale socket of a terminated service
+  {
+    boost::asio::io_context ioContext{};
+    boost::asio::local::stream_protocol::acceptor acceptor{
+      ioContext,
+      boost::asio::local::stream_protocol::endpoint{ Protocol_socketPath( directory.path() ).string() } };
+  }
+  BOOST_REQUIRE( std::filesystem::is_socket( Protocol_socketPath( directory.path() ) ) );
+
+  BOOST_CHECK( !MediaSetManagerClient_request( directory.path(), MediaSetManagerService::ListMediaSetsRequest ) );
+  BOOST_CHECK_EQUAL(
+    MediaSetManagerClient_execute( directory.path(), false, {}, MediaSetManagerService::ListMediaSetsRequest ),
+    NoMediaSetsResponse );
+#endif
+}
+
+#if defined( BOOST_ASIO_HAS_LOCAL_SOCKETS )
+
+//! A running service executes the request
+BOOST_AUTO_TEST_CASE( service )
+{
+  const Arinc665::Test::TemporaryDirectory directory{};
+  createMediaSetManager( directory.path() );
+
+  boost::asio::io_context ioContext{};
+  boost::asio::local::stream_protocol::acceptor acceptor{
+    ioContext,
+    boost::asio::local::stream_protocol::endpoint{ Protocol_socketPath( directory.path() ).string() } };
+
+  // response of the service instead of the local media set manager
+  auto received{ respond( acceptor, Protocol_encodeFrame( Protocol_ResponseOk, "SERVED" ) ) };
+  BOOST_CHECK_EQUAL(
+    MediaSetManagerClient_execute(
+      directory.path(),
+      false,
+      {},
+      MediaSetManagerService::RemoveMediaSetRequest,
+      { "PN" } ),
+    "SERVED" );
+
+  const auto [ request, arguments ]{ received.get() };
+  BOOST_CHECK_EQUAL( request, MediaSetManagerService::RemoveMediaSetRequest );
+  BOOST_CHECK( arguments == MediaSetManagerService::Arguments{ "PN" } );
+
+  // failure reported by the service - not executed locally again
+  received = respond( acceptor, Protocol_encodeFrame( Protocol_ResponseError, "FAILED" ) );
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_execute(
+      directory.path(),
+      false,
+      {},
+      MediaSetManagerService::ListMediaSetsRequest ),
+    Arinc665::Arinc665Exception );
+  std::ignore = received.get();
+}
+
+//! Oversized and truncated response frames are rejected
+BOOST_AUTO_TEST_CASE( malformedResponse )
+{
+  const Arinc665::Test::TemporaryDirectory directory{};
+
+  boost::asio::io_context ioContext{};
+  boost::asio::local::stream_protocol::acceptor acceptor{
+    ioContext,
+    boost::asio::local::stream_protocol::endpoint{ Protocol_socketPath( directory.path() ).string() } };
+
+  auto received{ respond( acceptor, std::format( "{} {}\n", Protocol_ResponseOk, Protocol_MaxPayloadSize + 1U ) ) };
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_request( directory.path(), MediaSetManagerService::ListMediaSetsRequest ),
+    Arinc665::Arinc665Exception );
+  std::ignore = received.get();
+
+  // connection closed within the payload
+  received = respond( acceptor, std::format( "{} 10\nSERVED", Protocol_ResponseOk ) );
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_request( directory.path(), MediaSetManagerService::ListMediaSetsRequest ),
+    boost::system::system_error );
+  std::ignore = received.get();
+
+  // connection closed within the header
+  received = respond( acceptor, std::string{ Protocol_ResponseOk } );
+  BOOST_CHECK_THROW(
+    std::ignore = MediaSetManagerClient_request( directory.path(), MediaSetManagerService::ListMediaSetsRequest ),
+    boost::system::system_error );
+  std::ignore = received.get();
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
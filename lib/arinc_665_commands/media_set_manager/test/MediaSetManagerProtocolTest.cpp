@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Module Arinc665Commands::MediaSetManager MediaSetManagerProtocol.
+ **/
+
+#include <arinc_665_commands/media_set_manager/MediaSetManagerProtocol.hpp>
+
+#include <arinc_665/Arinc665Exception.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace Arinc665Commands::MediaSetManager {
+
+namespace {
+
+/**
+ * @brief Splits an encoded Frame into its decoded Header and its Payload.
+ *
+ * @param[in] frame
+ *   Encoded Frame.
+ *
+ * @return Keyword, Payload Size, and Payload.
+ **/
+std::tuple< std::string, std::size_t, std::string > splitFrame( const std::string_view frame )
+{
+  const auto headerEnd{ frame.find( '\n' ) };
+  BOOST_REQUIRE( std::string_view::npos != headerEnd );
+
+  const auto [ keyword, payloadSize ]{ Protocol_decodeHeader( frame.substr( 0U, headerEnd ) ) };
+
+  return { keyword, payloadSize, std::string{ frame.substr( headerEnd + 1U ) } };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665CommandsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerProtocolTest )
+
+//! Request frames are decoded to the encoded request and arguments
+BOOST_AUTO_TEST_CASE( roundTrip )
+{
+  const std::vector< std::string > arguments{ "PN", "", "THW ID\nwith newline", "" };
+
+  const auto [ keyword, payloadSize, payload ]{
+    splitFrame( Protocol_encodeFrame( "ListLoads", Protocol_encodeArguments( arguments ) ) ) };
+  BOOST_CHECK_EQUAL( keyword, "ListLoads" );
+  BOOST_CHECK_EQUAL( payloadSize, payload.size() );
+  BOOST_CHECK( Protocol_decodeArguments( payload ) == arguments );
+
+  // no arguments
+  const auto [ emptyKeyword, emptyPayloadSize, emptyPayload ]{
+    splitFrame( Protocol_encodeFrame( "ListBatches", Protocol_encodeArguments( {} ) ) ) };
+  BOOST_CHECK_EQUAL( emptyKeyword, "ListBatches" );
+  BOOST_CHECK_EQUAL( emptyPayloadSize, 0U );
+  BOOST_CHECK( Protocol_decodeArguments( emptyPayload ).empty() );
+
+  // response text is kept as is
+  const std::string response{ "Line 1\nLine 2\n" };
+  const auto [ responseKeyword, responsePayloadSize, responsePayload ]{
+    splitFrame( Protocol_encodeFrame( Protocol_ResponseOk, response ) ) };
+  BOOST_CHECK_EQUAL( responseKeyword, Protocol_ResponseOk );
+  BOOST_CHECK_EQUAL( responsePayloadSize, response.size() );
+  BOOST_CHECK_EQUAL( responsePayload, response );
+}
+
+//! Frames exceeding the maximum payload size are rejected
+BOOST_AUTO_TEST_CASE( oversized )
+{
+  BOOST_CHECK_EQUAL(
+    Protocol_decodeHeader( "OK " + std::to_string( Protocol_MaxPayloadSize ) ).second,
+    Protocol_MaxPayloadSize );
+  BOOST_CHECK_THROW(
+    std::ignore = Protocol_decodeHeader( "OK " + std::to_string( Protocol_MaxPayloadSize + 1U ) ),
+    Arinc665::Arinc665Exception );
+  // exceeds std::size_t
+  BOOST_CHECK_THROW(
+    std::ignore = Protocol_decodeHeader( "OK 1000000000000000000000000" ),
+    Arinc665::Arinc665Exception );
+}
+
+//! Malformed headers and truncated payloads are rejected
+BOOST_AUTO_TEST_CASE( malformed )
+{
+  for ( const auto header : { "", "OK", "OK ", " 5", "OK 5x", "OK -1", "OK 0x10" } )
+  {
+    BOOST_TEST_CONTEXT( "Header '" << header << "'" )
+    {
+      BOOST_CHECK_THROW( std::ignore = Protocol_decodeHeader( header ), Arinc665::Arinc665Exception );
+    }
+  }
+
+  // payload truncated within the last argument
+  const auto payload{ Protocol_encodeArguments( std::vector< std::string >{ "ARGUMENT1", "ARGUMENT2" } ) };
+  BOOST_CHECK_EQUAL( Protocol_decodeArguments( payload ).size(), 2U );
+  BOOST_CHECK_THROW(
+    std::ignore = Protocol_decodeArguments( std::string_view{ payload }.substr( 0U, payload.size() - 1U ) ),
+    Arinc665::Arinc665Exception );
+  BOOST_CHECK_THROW( std::ignore = Protocol_decodeArguments( "ARGUMENT" ), Arinc665::Arinc665Exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Module Arinc665Commands::MediaSetManager MediaSetManagerVerifier.
+ **/
+
+#include <arinc_665_commands/media_set_manager/MediaSetManagerVerifier.hpp>
+
+#include <arinc_665/utils/MediaSetManager.hpp>
+#include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
+
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <arinc_665/test/TemporaryDirectory.hpp>
+
+#include <arinc_645/Arinc645Crc.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+
+namespace Arinc665Commands::MediaSetManager {
+
+namespace {
+
+/**
+ * @brief Creates a Media Set Manager with a single Media Set.
+ *
+ * The files are listed with their CRC and a SHA-256 check value.
+ *
+ * @param[in] directory
+ *   Base Directory (the media set manager is created within `manager`).
+ * @param[in] files
+ *   Files of the Media Set (Filename -> Content).
+ *
+ * @return Medium Directory.
+ **/
+std::filesystem::path createMediaSetManager(
+  const std::filesystem::path &directory,
+  const std::map< std::string, std::string > &files )
+{
+  const auto sourceDirectory{ directory / "source" };
+  const auto managerDirectory{ directory / "manager" };
+  std::filesystem::create_directories( sourceDirectory );
+
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  mediaSet->filesCheckValueType( Arinc645::CheckValueType::Sha256 );
+
+  Arinc665::Utils::FilePathMapping filePathMapping{};
+  for ( const auto &[ filename, content ] : files )
+  {
+    std::ofstream{ sourceDirectory / filename, std::ios::binary } << content;
+    filePathMapping.try_emplace(
+      mediaSet->addRegularFile( filename, Arinc665::MediumNumber{ 1U } ),
+      std::filesystem::path{ filename } );
+  }
+
+  auto mediaSetManager{ Arinc665::Utils::MediaSetManager::loadOrCreate( managerDirectory ) };
+
+  auto compiler{ Arinc665::Utils::FilesystemMediaSetCompiler::create() };
+  compiler->mediaSet( mediaSet )
+    .arinc665Version( Arinc665::SupportedArinc665Version::Supplement345 )
+    .createBatchFiles( Arinc665::Utils::FileCreationPolicy::None )
+    .createLoadHeaderFiles( Arinc665::Utils::FileCreationPolicy::None )
+    .sourceBasePath( sourceDirectory )
+    .filePathMapping( std::move( filePathMapping ) )
+    .outputBasePath( managerDirectory )
+    .mediaSetName( "MEDIASET" );
+
+  const auto mediaSetPaths{ ( *compiler )() };
+  mediaSetManager->registerMediaSet( mediaSetPaths, mediaSet, compiler->checkValues() );
+  mediaSetManager->saveConfiguration();
+
+  return managerDirectory / mediaSetPaths.first / mediaSetPaths.second.at( Arinc665::MediumNumber{ 1U } );
+}
+
+/**
+ * @brief Replaces the File Content, but keeps its CRC.
+ *
+ * Two bytes are appended to the modified content, so that the CRC matches the original one.
+ *
+ * @param[in] filePath
+ *   File Path.
+ **/
+void modifyKeepingCrc( const std::filesystem::path &filePath )
+{
+  std::ifstream file{ filePath, std::ios::binary };
+  std::string content{ std::istreambuf_iterator< char >{ file }, {} };
+  file.close();
+
+  Arinc645::Arinc645Crc16 originalCrc{};
+  originalCrc.process_bytes( content.data(), content.size() );
+
+  content[ 0 ] = static_cast< char >( content[ 0 ] ^ 0x01 );
+  content.append( 2U, '\0' );
+
+  for ( unsigned int suffix{ 0U }; suffix <= UINT16_MAX; ++suffix )
+  {
+    content[ content.size() - 2U ] = static_cast< char >( suffix >> 8U );
+    content[ content.size() - 1U ] = static_cast< char >( suffix );
+
+    Arinc645::Arinc645Crc16 crc{};
+    crc.process_bytes( content.data(), content.size() );
+
+    if ( crc.checksum() == originalCrc.checksum() )
+    {
+      std::ofstream{ filePath, std::ios::binary | std::ios::trunc } << content;
+      return;
+    }
+  }
+
+  BOOST_FAIL( "No CRC preserving modification found" );
+}
+
+/**
+ * @brief Returns the Failure of the given File.
+ *
+ * @param[in] report
+ *   Verification Report.
+ * @param[in] filename
+ *   Filename.
+ *
+ * @return File failure, or nullptr if the file did not fail.
+ **/
+const MediaSetManagerVerifierReport::FileFailure * fileFailure(
+  const MediaSetManagerVerifierReport &report,
+  const std::string &filename )
+{
+  const auto failure{ std::ranges::find( report.fileFailures, filename, []( const auto &fileFailure ) {
+    return fileFailure.path.filename().string();
+  } ) };
+
+  return ( report.fileFailures.end() == failure ) ? nullptr : &*failure;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665CommandsTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerTest )
+BOOST_AUTO_TEST_SUITE( MediaSetManagerVerifierTest )
+
+//! Results of several shards and workers are aggregated per medium and file
+BOOST_AUTO_TEST_CASE( aggregation )
+{
+  const Arinc665::Test::TemporaryDirectory directory{};
+  const auto mediumDirectory{ createMediaSetManager(
+    directory.path(),
+    { { "DATA1.BIN", "DATA1" }, { "DATA2.BIN", "DATA2" }, { "DATA3.BIN", "DATA3" }, { "DATA4.BIN", "DATA4" } } ) };
+
+  const auto validReport{ MediaSetManagerVerifier_verify( directory.path() / "manager", 2U, 2U ) };
+  BOOST_CHECK( validReport.valid() );
+  BOOST_REQUIRE_EQUAL( validReport.media.size(), 1U );
+  BOOST_CHECK_EQUAL( validReport.media.front().mediaSetPartNumber, "MEDIASET" );
+  BOOST_CHECK( validReport.media.front().files >= 4U );
+  BOOST_CHECK_EQUAL( validReport.media.front().validFiles, validReport.media.front().files );
+
+  std::ofstream{ mediumDirectory / "DATA2.BIN", std::ios::binary | std::ios::trunc } << "MODIFIED";
+  modifyKeepingCrc( mediumDirectory / "DATA3.BIN" );
+  std::filesystem::remove( mediumDirectory / "DATA4.BIN" );
+
+  const auto report{ MediaSetManagerVerifier_verify( directory.path() / "manager", 2U, 2U ) };
+  BOOST_CHECK( !report.valid() );
+  BOOST_CHECK( report.shardFailures.empty() );
+  BOOST_CHECK_EQUAL( report.workerFailures, 0U );
+  BOOST_REQUIRE_EQUAL( report.media.size(), 1U );
+  BOOST_CHECK_EQUAL( report.media.front().validFiles, report.media.front().files - 3U );
+  BOOST_REQUIRE_EQUAL( report.fileFailures.size(), 3U );
+
+  const auto * const crcInvalid{ fileFailure( report, "DATA2.BIN" ) };
+  BOOST_REQUIRE( nullptr != crcInvalid );
+  BOOST_CHECK( MediaSetManagerVerifierStatus::CrcInvalid == crcInvalid->status );
+  BOOST_CHECK( crcInvalid->message.contains( "expected" ) );
+
+  const auto * const checkValueInvalid{ fileFailure( report, "DATA3.BIN" ) };
+  BOOST_REQUIRE( nullptr != checkValueInvalid );
+  BOOST_CHECK( MediaSetManagerVerifierStatus::CheckValueInvalid == checkValueInvalid->status );
+  BOOST_CHECK( checkValueInvalid->message.contains( "expected" ) );
+  BOOST_CHECK_EQUAL( checkValueInvalid->mediaSetPartNumber, "MEDIASET" );
+
+  const auto * const readError{ fileFailure( report, "DATA4.BIN" ) };
+  BOOST_REQUIRE( nullptr != readError );
+  BOOST_CHECK( MediaSetManagerVerifierStatus::ReadError == readError->status );
+  BOOST_CHECK( !readError->message.empty() );
+
+  BOOST_CHECK( nullptr == fileFailure( report, "DATA1.BIN" ) );
+}
+
+//! A shard, which is not verified within the timeout, is assigned again and finally reported as failed
+BOOST_AUTO_TEST_CASE( timeoutRetry )
+{
+  const Arinc665::Test::TemporaryDirectory directory{};
+
+  // takes considerably longer to read and digest than the timeout
+  static_cast< void >( createMediaSetManager(
+    directory.path(),
+    { { "LARGE.BIN", std::string( 16U * 1024U * 1024U, 'L' ) }, { "SMALL.BIN", "SMALL" } } ) );
+
+  constexpr std::size_t retries{ 2U };
+
+  // a single shard, containing all files
+  const auto report{ MediaSetManagerVerifier_verify(
+    directory.path() / "manager",
+    1U,
+    64U,
+    retries,
+    std::chrono::milliseconds{ 1 } ) };
+
+  BOOST_CHECK( !report.valid() );
+  BOOST_CHECK_EQUAL( report.workerFailures, retries + 1U );
+  BOOST_CHECK( report.fileFailures.empty() );
+  BOOST_REQUIRE_EQUAL( report.media.size(), 1U );
+  BOOST_CHECK_EQUAL( report.media.front().validFiles, 0U );
+
+  BOOST_REQUIRE_EQUAL( report.shardFailures.size(), 1U );
+  const auto &shardFailure{ report.shardFailures.front() };
+  BOOST_CHECK_EQUAL( shardFailure.mediaSetPartNumber, "MEDIASET" );
+  BOOST_CHECK_EQUAL( shardFailure.firstFile, 0U );
+  BOOST_CHECK_EQUAL( shardFailure.files, report.media.front().files );
+  BOOST_CHECK( shardFailure.reason.contains( "1 ms" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -30,6 +30,8 @@ class MediaPathsWidget;
 
 class FilePathMappingModel;
 
+class ByteProgressDialog;
+
 class FileCreationPolicyModel;
 class SupportedArinc665VersionModel;
 
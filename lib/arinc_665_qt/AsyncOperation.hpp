@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration/ Definition of Function Arinc665Qt::AsyncOperation_start.
+ **/
+
+#ifndef ARINC_665_QT_ASYNCOPERATION_HPP
+#define ARINC_665_QT_ASYNCOPERATION_HPP
+
+#include <arinc_665_qt/Arinc665Qt.hpp>
+
+#include <QObject>
+#include <QThread>
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Arinc665Qt {
+
+/**
+ * @brief Executes a long-running Operation within a Worker Thread.
+ *
+ * @p operation is executed within a newly created worker thread.
+ * When the operation has finished, @p finished is called within the thread of @p context (normally the GUI thread).
+ * @p finished is called with a result getter, which returns the result of the operation or rethrows the exception
+ * thrown by the operation.
+ * So the result is handled by the same `try`-`catch` blocks as a synchronous call.
+ *
+ * If @p context is destroyed before the operation finishes, @p finished is not called.
+ * The worker thread deletes itself after the operation has finished.
+ *
+ * Progress handlers used by the operation are called within the worker thread and must forward their information
+ * thread-safe (e.g. by queued signals or ByteProgressDialog::progressHandler()).
+ *
+ * @tparam Operation
+ *   Callable with signature `Result()`.
+ * @tparam Finished
+ *   Callable with signature `void( ResultGetter &&result )`, where `result()` returns `Result`.
+ *
+ * @param[in] context
+ *   Context Object, in which thread @p finished is called.
+ * @param[in] operation
+ *   Operation executed within the worker thread.
+ * @param[in] finished
+ *   Handler called with the result.
+ **/
+template< typename Operation, typename Finished >
+void AsyncOperation_start( QObject * context, Operation operation, Finished finished )
+{
+  using Result = std::invoke_result_t< Operation >;
+
+  struct State
+  {
+    //! Result of Operation (unused for void operations)
+    std::optional< std::conditional_t< std::is_void_v< Result >, bool, Result > > result;
+    //! Exception thrown by Operation
+    std::exception_ptr exception;
+  };
+
+  auto state{ std::make_shared< State >() };
+
+  auto * const thread{ QThread::create( [ state, operation = std::move( operation ) ]() mutable {
+    try
+    {
+      if constexpr ( std::is_void_v< Result > )
+      {
+        operation();
+        state->result.emplace( true );
+      }
+      else
+      {
+        state->result.emplace( operation() );
+      }
+    }
+    catch ( ... )
+    {
+      state->exception = std::current_exception();
+    }
+  } ) };
+
+  QObject::connect(
+    thread,
+    &QThread::finished,
+    context,
+    [ state, finished = std::move( finished ) ]() mutable {
+      finished( [ &state ]() -> Result {
+        if ( state->exception )
+        {
+          std::rethrow_exception( state->exception );
+        }
+
+        if constexpr ( !std::is_void_v< Result > )
+        {
+          return std::move( *state->result );
+        }
+      } );
+    } );
+  QObject::connect( thread, &QThread::finished, thread, &QThread::deleteLater );
+
+  thread->start();
+}
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Class Arinc665Qt::ByteProgressDialog.
+ **/
+
+#include "ByteProgressDialog.hpp"
+
+#include <QCoreApplication>
+#include <QLocale>
+#include <QThread>
+
+#include <algorithm>
+
+namespace Arinc665Qt {
+
+ByteProgressDialog::ByteProgressDialog( const QString &labelText, QWidget * const parent ) :
+  QProgressDialog{ labelText, tr( "Cancel" ), 0, 1000, parent },
+  labelTextV{ labelText }
+{
+  setWindowModality( Qt::WindowModal );
+  setMinimumDuration( 500 );
+  setAutoClose( false );
+  setAutoReset( false );
+
+  connect( this, &QProgressDialog::canceled, this, [ this ] { stopSourceV.request_stop(); } );
+}
+
+ByteProgressDialog::~ByteProgressDialog() = default;
+
+Arinc665::Utils::ByteProgressHandler ByteProgressDialog::progressHandler()
+{
+  return [ this ]( const Arinc665::Utils::ByteProgress &progress ) {
+    if ( QThread::currentThread() == thread() )
+    {
+      update( progress );
+      QCoreApplication::processEvents();
+      return;
+    }
+
+    QMetaObject::invokeMethod( this, [ this, progress ] { update( progress ); }, Qt::QueuedConnection );
+  };
+}
+
+std::stop_token ByteProgressDialog::stopToken() const noexcept
+{
+  return stopSourceV.get_token();
+}
+
+void ByteProgressDialog::update( const Arinc665::Utils::ByteProgress &progress )
+{
+  const QLocale locale{};
+
+  if ( 0U != progress.totalBytes )
+  {
+    setValue( static_cast< int >( std::min< std::uint64_t >(
+      1000U,
+      progress.processedBytes * 1000U / progress.totalBytes ) ) );
+  }
+
+  auto text{ QString{ "%1\n%2\n%3 of %4 (%5/s)" }
+    .arg( labelTextV )
+    .arg( QString::fromStdString( progress.currentFile.generic_string() ) )
+    .arg( locale.formattedDataSize( static_cast< qint64 >( progress.processedBytes ) ) )
+    .arg( locale.formattedDataSize( static_cast< qint64 >( progress.totalBytes ) ) )
+    .arg( locale.formattedDataSize( static_cast< qint64 >( progress.throughput ) ) ) };
+
+  if ( progress.remainingTime )
+  {
+    text += tr( " - %1 s remaining" ).arg( progress.remainingTime->count() );
+  }
+
+  setLabelText( text );
+}
+
+}
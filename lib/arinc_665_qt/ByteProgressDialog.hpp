@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Declaration of Class Arinc665Qt::ByteProgressDialog.
+ **/
+
+#ifndef ARINC_665_QT_BYTEPROGRESSDIALOG_HPP
+#define ARINC_665_QT_BYTEPROGRESSDIALOG_HPP
+
+#include <arinc_665_qt/Arinc665Qt.hpp>
+
+#include <arinc_665/utils/Utils.hpp>
+
+#include <QProgressDialog>
+
+#include <stop_token>
+
+namespace Arinc665Qt {
+
+/**
+ * @brief Byte Progress Dialog.
+ *
+ * Modal progress dialog for long-running compiler and decompiler operations.
+ * The handler returned by @ref progressHandler() can be called from any thread.
+ * When called from a worker thread (see AsyncOperation_start()), the update is queued into the GUI thread.
+ * When called within the GUI thread, the dialog is updated directly and pending events are processed.
+ * Pressing _Cancel_ requests a stop on the token returned by @ref stopToken().
+ **/
+class ARINC_665_QT_EXPORT ByteProgressDialog final : public QProgressDialog
+{
+    Q_OBJECT
+
+  public:
+    /**
+     * @brief Initialises the Byte Progress Dialog.
+     *
+     * @param[in] labelText
+     *   Label Text.
+     * @param[in] parent
+     *   Parent Widget.
+     **/
+    explicit ByteProgressDialog( const QString &labelText, QWidget * parent = nullptr );
+
+    //! Destructor
+    ~ByteProgressDialog() override;
+
+    /**
+     * @brief Returns the Byte Progress Handler updating this dialog.
+     *
+     * The handler is thread-safe.
+     * The dialog must outlive the operation using the handler.
+     *
+     * @return Byte Progress Handler.
+     **/
+    [[nodiscard]] Arinc665::Utils::ByteProgressHandler progressHandler();
+
+    /**
+     * @brief Returns the Stop Token signalled on cancellation.
+     *
+     * @return Stop Token.
+     **/
+    [[nodiscard]] std::stop_token stopToken() const noexcept;
+
+  private:
+    /**
+     * @brief Updates the dialog.
+     *
+     * @param[in] progress
+     *   Current Byte Progress.
+     **/
+    void update( const Arinc665::Utils::ByteProgress &progress );
+
+    //! Label Text
+    QString labelTextV;
+    //! Stop Source
+    std::stop_source stopSourceV;
+};
+
+}
+
+#endif
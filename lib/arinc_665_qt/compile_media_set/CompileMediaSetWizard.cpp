@@ -15,6 +15,9 @@
 
 #include "ui_CompileMediaSetWizard.h"
 
+#include <arinc_665_qt/AsyncOperation.hpp>
+#include <arinc_665_qt/ByteProgressDialog.hpp>
+
 #include <arinc_665/utils/Arinc665Xml.hpp>
 #include <arinc_665/utils/FilesystemMediaSetCompiler.hpp>
 #include <arinc_665/utils/MediaSetDefaults.hpp>
@@ -132,47 +135,70 @@ void CompileMediaSetWizard::outputDirectory( std::filesystem::path directory )
 
 void CompileMediaSetWizard::compileMediaSet()
 {
-  try
-  {
-    // load ARINC 665 XML file
-    auto [ mediaSet, fileMapping ] =
-      Arinc665::Utils::Arinc665Xml_load( xmlFileV );
-
-    compilerV
-      ->mediaSet( std::move( mediaSet ) )
-      .filePathMapping( std::move( fileMapping ) )
-      .outputBasePath( outputDirectoryV );
-    assert( compilerV );
-    auto mediaSetPaths{ ( *compilerV )() };
-
-    QMessageBox::information(
-      nullptr,
-      tr( "Media Set Compilation successful" ),
-      QString{ "Media Set created within <tt>%1</tt>" }
-        .arg( QString::fromStdString( mediaSetPaths.first.string() ) ) );
-  }
-  catch ( const boost::exception &e )
-  {
-    const auto info{ boost::diagnostic_information( e ) };
-
-    QMessageBox::critical(
-      nullptr,
-      tr( "Error during compilation" ),
-      QString{ tr( "Error:<br/><tt>%1</tt>") }
-        .arg( QString::fromStdString( info ) ) );
-    return;
-  }
-  catch ( const std::exception &e )
-  {
-    const auto info{ boost::diagnostic_information( e ) };
-
-    QMessageBox::critical(
-      nullptr,
-      tr( "Error during compilation" ),
-      QString{ tr( "Error:<br/><tt>%1</tt>") }
-        .arg( QString::fromStdString( info ) ) );
-    return;
-  }
+  auto * const progressDialog{ new ByteProgressDialog{ tr( "Compiling Media Set" ), parentWidget() } };
+  progressDialog->open();
+
+  compilerV
+    ->outputBasePath( outputDirectoryV )
+    .progressHandler( progressDialog->progressHandler() )
+    .stopToken( progressDialog->stopToken() );
+
+  // load ARINC 665 XML file and compile media set within worker thread - the compiler is kept alive by the operation,
+  // even if the wizard is destroyed meanwhile
+  AsyncOperation_start(
+    this,
+    [ compiler = compilerV, xmlFile = xmlFileV ] {
+      auto [ mediaSet, fileMapping ]{ Arinc665::Utils::Arinc665Xml_load( xmlFile ) };
+
+      compiler
+        ->mediaSet( std::move( mediaSet ) )
+        .filePathMapping( std::move( fileMapping ) );
+      return ( *compiler )();
+    },
+    [ this, progressDialog ]( auto &&result ) {
+      progressDialog->deleteLater();
+
+      try
+      {
+        auto mediaSetPaths{ result() };
+
+        QMessageBox::information(
+          nullptr,
+          tr( "Media Set Compilation successful" ),
+          QString{ "Media Set created within <tt>%1</tt>" }
+            .arg( QString::fromStdString( mediaSetPaths.first.string() ) ) );
+      }
+      catch ( const Arinc665::OperationCancelled & )
+      {
+        QMessageBox::information(
+          nullptr,
+          tr( "Media Set Compilation cancelled" ),
+          tr( "Media Set Compilation has been cancelled." ) );
+        return;
+      }
+      catch ( const boost::exception &e )
+      {
+        const auto info{ boost::diagnostic_information( e ) };
+
+        QMessageBox::critical(
+          nullptr,
+          tr( "Error during compilation" ),
+          QString{ tr( "Error:<br/><tt>%1</tt>") }
+            .arg( QString::fromStdString( info ) ) );
+        return;
+      }
+      catch ( const std::exception &e )
+      {
+        const auto info{ boost::diagnostic_information( e ) };
+
+        QMessageBox::critical(
+          nullptr,
+          tr( "Error during compilation" ),
+          QString{ tr( "Error:<br/><tt>%1</tt>") }
+            .arg( QString::fromStdString( info ) ) );
+        return;
+      }
+    } );
 }
 
 }
@@ -113,14 +113,17 @@ class ARINC_665_QT_EXPORT CompileMediaSetWizard final : public QWizard
 
     /**
      * @brief Start Media Set Compilation.
+     *
+     * The XML file is loaded and the media set is compiled within a worker thread.
+     * Progress and cancellation are handled by a ByteProgressDialog.
      **/
     void compileMediaSet();
 
   private:
     //! UI (designer)
     std::unique_ptr< Ui::CompileMediaSetWizard > ui;
-    //! ARINC 665 Media Set Compiler
-    Arinc665::Utils::FilesystemMediaSetCompilerPtr compilerV;
+    //! ARINC 665 Media Set Compiler (shared with the compilation worker thread)
+    std::shared_ptr< Arinc665::Utils::FilesystemMediaSetCompiler > compilerV;
     //! XML File
     std::filesystem::path xmlFileV;
     //! Output Base Path
@@ -55,7 +55,7 @@ QVariant BatchInfoModel::data( const QModelIndex &index, const int role ) const
       switch ( static_cast< Columns>( index.column() ) )
       {
         case Columns::TargetHardwareIdPosition:
-          return HelperQt::toQString( batchTargetInfo.first );
+          return HelperQt::toQString( batchTargetInfo.first.str() );
 
         default:
           return {};
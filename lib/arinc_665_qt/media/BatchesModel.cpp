@@ -14,9 +14,13 @@
 #include "BatchesModel.hpp"
 
 #include <arinc_665/media/Batch.hpp>
+#include <arinc_665/media/MediaSet.hpp>
 
 #include <helper_qt/String.hpp>
 
+#include <algorithm>
+#include <string>
+
 namespace Arinc665Qt::Media {
 
 BatchesModel::BatchesModel( QObject * const parent ) :
@@ -33,7 +37,7 @@ int BatchesModel::rowCount( const QModelIndex &parent ) const
     return 0;
   }
 
-  return static_cast< int >( numberOfBatches() );
+  return static_cast< int >( fetchedRowsV );
 }
 
 int BatchesModel::columnCount( const QModelIndex &parent ) const
@@ -48,10 +52,10 @@ int BatchesModel::columnCount( const QModelIndex &parent ) const
 
 QVariant BatchesModel::data( const QModelIndex &index, const int role ) const
 {
-  auto batchPtr{ constBatch( batch( index ) ) };
-
   // index not valid
-  if ( !batchPtr )
+  if ( !index.isValid()
+    || ( static_cast< std::size_t >( index.row() ) >= fetchedRowsV )
+    || ( index.column() >= static_cast< int >( Columns::ColumnsCount ) ) )
   {
     return {};
   }
@@ -59,20 +63,8 @@ QVariant BatchesModel::data( const QModelIndex &index, const int role ) const
   switch ( role )
   {
     case Qt::ItemDataRole::DisplayRole:
-      switch ( static_cast< Columns>( index.column() ) )
-      {
-        case Columns::Name:
-          return HelperQt::toQString( batchPtr->name() );
-
-        case Columns::PartNumber:
-          return HelperQt::toQString( batchPtr->partNumber() );
-
-        case Columns::Comment:
-          return HelperQt::toQString( batchPtr->comment() );
-
-        default:
-          return {};
-      }
+      return cachedRow( static_cast< std::size_t >( index.row() ) ).display[
+        static_cast< std::size_t >( index.column() ) ];
 
     case Qt::ItemDataRole::ToolTipRole:
     case Qt::ItemDataRole::TextAlignmentRole:
@@ -113,11 +105,55 @@ QVariant BatchesModel::headerData(
   }
 }
 
+bool BatchesModel::canFetchMore( const QModelIndex &parent ) const
+{
+  if ( parent.isValid() )
+  {
+    return false;
+  }
+
+  return fetchedRowsV < visibleRowsV.size();
+}
+
+void BatchesModel::fetchMore( const QModelIndex &parent )
+{
+  if ( !canFetchMore( parent ) )
+  {
+    return;
+  }
+
+  const auto fetchedRows{ std::min( visibleRowsV.size(), fetchedRowsV + FetchSize ) };
+
+  beginInsertRows( {}, static_cast< int >( fetchedRowsV ), static_cast< int >( fetchedRows - 1U ) );
+  fetchedRowsV = fetchedRows;
+  endInsertRows();
+}
+
+void BatchesModel::sort( const int column, const Qt::SortOrder order )
+{
+  beginResetModel();
+  sortColumnV = ( ( column >= 0 ) && ( column < static_cast< int >( Columns::ColumnsCount ) ) ) ? column : -1;
+  sortOrderV = order;
+  updateVisibleRows();
+  endResetModel();
+}
+
+const QString& BatchesModel::filter() const
+{
+  return filterV;
+}
+
+void BatchesModel::filter( QString filter )
+{
+  beginResetModel();
+  filterV = std::move( filter );
+  updateVisibleRows();
+  endResetModel();
+}
+
 size_t BatchesModel::numberOfBatches() const
 {
-  return std::visit(
-    []( auto &batches ) { return batches.size(); },
-    batchesV );
+  return rowsV.size();
 }
 
 const Arinc665::Media::BatchesVariant& BatchesModel::batches() const
@@ -129,6 +165,19 @@ void BatchesModel::batches( Arinc665::Media::BatchesVariant batches )
 {
   beginResetModel();
   batchesV = std::move( batches );
+
+  rowsV.clear();
+  std::visit(
+    [ this ]( const auto &batches ) {
+      rowsV.reserve( batches.size() );
+      for ( const auto &batch : batches )
+      {
+        rowsV.emplace_back( Row{ .batch = batch } );
+      }
+    },
+    batchesV );
+
+  updateVisibleRows();
   endResetModel();
 }
 
@@ -145,17 +194,12 @@ Arinc665::Media::BatchVariant BatchesModel::batch(
 
 Arinc665::Media::BatchVariant BatchesModel::batch( std::size_t index ) const
 {
-  if ( index >= numberOfBatches() )
+  if ( index >= fetchedRowsV )
   {
     return {};
   }
 
-  return std::visit(
-    [ index ]( auto &batches ) {
-      auto batch{ std::next( batches.begin(), index ) };
-      return Arinc665::Media::BatchVariant{ *batch };
-    },
-    batchesV );
+  return rowsV[ visibleRowsV[ index ] ].batch;
 }
 
 Arinc665::Media::ConstBatchPtr BatchesModel::constBatch(
@@ -168,4 +212,78 @@ Arinc665::Media::ConstBatchPtr BatchesModel::constBatch(
     batch );
 }
 
+const BatchesModel::Row& BatchesModel::cachedRow( const std::size_t index ) const
+{
+  auto &row{ rowsV[ visibleRowsV[ index ] ] };
+  cacheRow( row );
+  return row;
+}
+
+void BatchesModel::cacheRow( Row &row ) const
+{
+  if ( row.cached )
+  {
+    return;
+  }
+
+  const auto batchPtr{ constBatch( row.batch ) };
+
+  row.display[ static_cast< std::size_t >( Columns::Name ) ] = HelperQt::toQString( batchPtr->name() );
+  row.display[ static_cast< std::size_t >( Columns::PartNumber ) ] = HelperQt::toQString( batchPtr->partNumber() );
+  row.display[ static_cast< std::size_t >( Columns::Comment ) ] = HelperQt::toQString( batchPtr->comment() );
+
+  std::string filterKey{ batchPtr->partNumber() };
+  for ( const auto &[ targetHardwareIdPosition, loads ] : batchPtr->targets() )
+  {
+    filterKey.append( "\n" ).append( targetHardwareIdPosition );
+  }
+  if ( const auto mediaSet{ batchPtr->mediaSet() }; mediaSet )
+  {
+    filterKey.append( "\n" ).append( mediaSet->partNumber() );
+  }
+  row.filterKey = QString::fromStdString( filterKey );
+
+  row.cached = true;
+}
+
+void BatchesModel::updateVisibleRows()
+{
+  visibleRowsV.clear();
+  visibleRowsV.reserve( rowsV.size() );
+
+  for ( std::size_t index{ 0U }; index < rowsV.size(); ++index )
+  {
+    if ( !filterV.isEmpty() )
+    {
+      cacheRow( rowsV[ index ] );
+      if ( !rowsV[ index ].filterKey.contains( filterV, Qt::CaseInsensitive ) )
+      {
+        continue;
+      }
+    }
+
+    visibleRowsV.push_back( index );
+  }
+
+  if ( sortColumnV >= 0 )
+  {
+    const auto column{ static_cast< std::size_t >( sortColumnV ) };
+
+    for ( const auto index : visibleRowsV )
+    {
+      cacheRow( rowsV[ index ] );
+    }
+
+    std::ranges::stable_sort(
+      visibleRowsV,
+      [ this, column ]( const std::size_t lhs, const std::size_t rhs ) {
+        const auto result{
+          QString::localeAwareCompare( rowsV[ lhs ].display[ column ], rowsV[ rhs ].display[ column ] ) };
+        return ( Qt::AscendingOrder == sortOrderV ) ? ( result < 0 ) : ( result > 0 );
+      } );
+  }
+
+  fetchedRowsV = std::min( visibleRowsV.size(), FetchSize );
+}
+
 }
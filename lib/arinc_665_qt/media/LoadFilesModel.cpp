@@ -64,7 +64,7 @@ QVariant LoadFilesModel::data( const QModelIndex &index, const int role ) const
           return HelperQt::toQString( std::get< 0 >( *loadFileInfo )->name() );
 
         case Columns::PartNumber:
-          return HelperQt::toQString( std::get< 1 >( *loadFileInfo ) );
+          return HelperQt::toQString( std::get< 1 >( *loadFileInfo ).str() );
 
         default:
           return {};
@@ -13,9 +13,11 @@
 #include "LoadsModel.hpp"
 
 #include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/MediaSet.hpp>
 
 #include <helper_qt/String.hpp>
 
+#include <algorithm>
 #include <format>
 
 namespace Arinc665Qt::Media {
@@ -34,7 +36,7 @@ int LoadsModel::rowCount( const QModelIndex &parent ) const
     return 0;
   }
 
-  return static_cast< int >( numberOfLoads() );
+  return static_cast< int >( fetchedRowsV );
 }
 
 int LoadsModel::columnCount( const QModelIndex &parent ) const
@@ -49,42 +51,27 @@ int LoadsModel::columnCount( const QModelIndex &parent ) const
 
 QVariant LoadsModel::data( const QModelIndex &index, const int role ) const
 {
-  auto loadPtr{ constLoad( load( index ) ) };
-
   // out of range access
-  if ( !loadPtr )
+  if ( !index.isValid()
+    || ( static_cast< std::size_t >( index.row() ) >= fetchedRowsV )
+    || ( index.column() >= static_cast< int >( Columns::ColumnsCount ) ) )
   {
     return {};
   }
 
+  const auto &row{ cachedRow( static_cast< std::size_t >( index.row() ) ) };
+
   switch ( role )
   {
     case Qt::ItemDataRole::DisplayRole:
-      switch ( static_cast< Columns >( index.column() ) )
-      {
-        case Columns::Name:
-          return HelperQt::toQString( loadPtr->name() );
-
-        case Columns::PartNumber:
-          return HelperQt::toQString( loadPtr->partNumber() );
-
-        case Columns::LoadType:
-          if ( auto loadType{ loadPtr->loadType() }; loadType )
-          {
-            return QString::fromStdString( std::format( "0x{:04x}: {:}", loadType->second, loadType->first ) );
-          }
-          return {};
-
-        default:
-          return {};
-      }
+      return row.display[ static_cast< std::size_t >( index.column() ) ];
 
     case Qt::ItemDataRole::ToolTipRole:
-      if ( const auto &loadType{ loadPtr->loadType() }; loadType )
+      if ( row.toolTip.isEmpty() )
       {
-        return QString::fromStdString( loadType->first );
+        return {};
       }
-      return {};
+      return row.toolTip;
 
     case Qt::ItemDataRole::TextAlignmentRole:
     default:
@@ -121,11 +108,55 @@ QVariant LoadsModel::headerData( const int section, const ::Qt::Orientation orie
   }
 }
 
+bool LoadsModel::canFetchMore( const QModelIndex &parent ) const
+{
+  if ( parent.isValid() )
+  {
+    return false;
+  }
+
+  return fetchedRowsV < visibleRowsV.size();
+}
+
+void LoadsModel::fetchMore( const QModelIndex &parent )
+{
+  if ( !canFetchMore( parent ) )
+  {
+    return;
+  }
+
+  const auto fetchedRows{ std::min( visibleRowsV.size(), fetchedRowsV + FetchSize ) };
+
+  beginInsertRows( {}, static_cast< int >( fetchedRowsV ), static_cast< int >( fetchedRows - 1U ) );
+  fetchedRowsV = fetchedRows;
+  endInsertRows();
+}
+
+void LoadsModel::sort( const int column, const Qt::SortOrder order )
+{
+  beginResetModel();
+  sortColumnV = ( ( column >= 0 ) && ( column < static_cast< int >( Columns::ColumnsCount ) ) ) ? column : -1;
+  sortOrderV = order;
+  updateVisibleRows();
+  endResetModel();
+}
+
+const QString& LoadsModel::filter() const
+{
+  return filterV;
+}
+
+void LoadsModel::filter( QString filter )
+{
+  beginResetModel();
+  filterV = std::move( filter );
+  updateVisibleRows();
+  endResetModel();
+}
+
 size_t LoadsModel::numberOfLoads() const
 {
-  return std::visit(
-    []( auto &loads ) { return loads.size(); },
-    loadsV );
+  return rowsV.size();
 }
 
 const Arinc665::Media::LoadsVariant& LoadsModel::loads() const
@@ -137,6 +168,19 @@ void LoadsModel::loads( Arinc665::Media::LoadsVariant loads )
 {
   beginResetModel();
   loadsV = std::move( loads );
+
+  rowsV.clear();
+  std::visit(
+    [ this ]( const auto &loads ) {
+      rowsV.reserve( loads.size() );
+      for ( const auto &load : loads )
+      {
+        rowsV.emplace_back( Row{ .load = load } );
+      }
+    },
+    loadsV );
+
+  updateVisibleRows();
   endResetModel();
 }
 
@@ -164,17 +208,12 @@ Arinc665::Media::LoadVariant LoadsModel::load( const QModelIndex &index ) const
 
 Arinc665::Media::LoadVariant LoadsModel::load( const std::size_t index ) const
 {
-  if ( index >= numberOfLoads() )
+  if ( index >= fetchedRowsV )
   {
     return {};
   }
 
-  return std::visit(
-    [ index ]( auto &loads ) {
-      auto load{ std::next( loads.begin(), index ) };
-      return Arinc665::Media::LoadVariant{ *load };
-    },
-    loadsV );
+  return rowsV[ visibleRowsV[ index ] ].load;
 }
 
 Arinc665::Media::ConstLoadPtr LoadsModel::constLoad( const Arinc665::Media::LoadVariant &load ) const
@@ -186,4 +225,84 @@ Arinc665::Media::ConstLoadPtr LoadsModel::constLoad( const Arinc665::Media::Load
     load );
 }
 
+const LoadsModel::Row& LoadsModel::cachedRow( const std::size_t index ) const
+{
+  auto &row{ rowsV[ visibleRowsV[ index ] ] };
+  cacheRow( row );
+  return row;
+}
+
+void LoadsModel::cacheRow( Row &row ) const
+{
+  if ( row.cached )
+  {
+    return;
+  }
+
+  const auto loadPtr{ constLoad( row.load ) };
+
+  row.display[ static_cast< std::size_t >( Columns::Name ) ] = HelperQt::toQString( loadPtr->name() );
+  row.display[ static_cast< std::size_t >( Columns::PartNumber ) ] = HelperQt::toQString( loadPtr->partNumber() );
+
+  if ( const auto &loadType{ loadPtr->loadType() }; loadType )
+  {
+    row.display[ static_cast< std::size_t >( Columns::LoadType ) ] =
+      QString::fromStdString( std::format( "0x{:04x}: {:}", loadType->second, loadType->first ) );
+    row.toolTip = QString::fromStdString( loadType->first );
+  }
+
+  std::string filterKey{ loadPtr->partNumber() };
+  for ( const auto &[ targetHardwareId, positions ] : loadPtr->targetHardwareIdPositions() )
+  {
+    filterKey.append( "\n" ).append( targetHardwareId );
+  }
+  if ( const auto mediaSet{ loadPtr->mediaSet() }; mediaSet )
+  {
+    filterKey.append( "\n" ).append( mediaSet->partNumber() );
+  }
+  row.filterKey = QString::fromStdString( filterKey );
+
+  row.cached = true;
+}
+
+void LoadsModel::updateVisibleRows()
+{
+  visibleRowsV.clear();
+  visibleRowsV.reserve( rowsV.size() );
+
+  for ( std::size_t index{ 0U }; index < rowsV.size(); ++index )
+  {
+    if ( !filterV.isEmpty() )
+    {
+      cacheRow( rowsV[ index ] );
+      if ( !rowsV[ index ].filterKey.contains( filterV, Qt::CaseInsensitive ) )
+      {
+        continue;
+      }
+    }
+
+    visibleRowsV.push_back( index );
+  }
+
+  if ( sortColumnV >= 0 )
+  {
+    const auto column{ static_cast< std::size_t >( sortColumnV ) };
+
+    for ( const auto index : visibleRowsV )
+    {
+      cacheRow( rowsV[ index ] );
+    }
+
+    std::ranges::stable_sort(
+      visibleRowsV,
+      [ this, column ]( const std::size_t lhs, const std::size_t rhs ) {
+        const auto result{
+          QString::localeAwareCompare( rowsV[ lhs ].display[ column ], rowsV[ rhs ].display[ column ] ) };
+        return ( Qt::AscendingOrder == sortOrderV ) ? ( result < 0 ) : ( result > 0 );
+      } );
+  }
+
+  fetchedRowsV = std::min( visibleRowsV.size(), FetchSize );
+}
+
 }
@@ -18,12 +18,24 @@
 #include <arinc_665/media/Media.hpp>
 
 #include <QAbstractTableModel>
+#include <QString>
+
+#include <array>
+#include <cstddef>
+#include <vector>
 
 namespace Arinc665Qt::Media {
 
 /**
  * @brief Qt Table Model of List of Loads.
  *
+ * The loads are held within a random-access snapshot, so each row is accessed in O(1).
+ * Display strings are cached on first access.
+ * Rows are populated lazily in chunks of @ref FetchSize rows via canFetchMore() and fetchMore().
+ *
+ * The model provides a built-in sort (sort()) and filter (filter()) index.
+ * The filter matches the load part number, the target hardware IDs and the media set part number.
+ *
  * @sa @ref Arinc665::Media::Load
  **/
 class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
@@ -44,6 +56,9 @@ class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
       ColumnsCount
     };
 
+    //! Number of Rows populated by a single fetchMore() call
+    static constexpr std::size_t FetchSize{ 256U };
+
     /**
      * @brief Initialises the loads model.
      *
@@ -104,6 +119,62 @@ class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
      **/
     [[nodiscard]] QVariant headerData( int section, Qt::Orientation orientation, int role ) const override;
 
+    /**
+     * @brief Returns if more rows can be populated.
+     *
+     * @param[in] parent
+     *   Index-parent - assumed to be the root element (invalid).
+     *
+     * @return If not all rows are populated.
+     **/
+    [[nodiscard]] bool canFetchMore( const QModelIndex &parent ) const override;
+
+    /**
+     * @brief Populates the next @ref FetchSize rows.
+     *
+     * @param[in] parent
+     *   Index-parent - assumed to be the root element (invalid).
+     **/
+    void fetchMore( const QModelIndex &parent ) override;
+
+    /**
+     * @brief Sorts the loads by the given column.
+     *
+     * @param[in] column
+     *   Sort column.
+     *   If out of range, the original order is restored.
+     * @param[in] order
+     *   Sort order.
+     **/
+    void sort( int column, Qt::SortOrder order = Qt::AscendingOrder ) override;
+
+    /**
+     * @name Filter
+     *
+     * Only loads, where the part number, a target hardware ID or the media set part number contains the filter string
+     * (case-insensitive) are provided.
+     * An empty filter string disables the filter.
+     *
+     * @{
+     **/
+
+    /**
+     * @brief Returns the filter string.
+     *
+     * @return Filter String.
+     **/
+    [[nodiscard]] const QString& filter() const;
+
+    /**
+     * @brief Updates the filter string.
+     *
+     * @param[in] filter
+     *   Filter String.
+     **/
+    void filter( QString filter );
+
+    /** @} **/
+
     /**
      * @name Loads
      * @{
@@ -112,6 +183,8 @@ class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
     /**
      * @brief Returns the Number of Loads
      *
+     * The filter is not considered.
+     *
      * @return Number of Loads
      **/
     [[nodiscard]] size_t numberOfLoads() const;
@@ -160,11 +233,11 @@ class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
      * @brief Return Load for a given Index.
      *
      * @param[in] index
-     *   Load Index
+     *   Load Index (Row considering filter and sort order)
      *
      * @return Load for a given Index
      * @retval {}
-     *   If @p index is invalid
+     *   If @p index is invalid or not yet fetched (beyond rowCount())
      **/
     [[nodiscard]] Arinc665::Media::LoadVariant load( std::size_t index ) const;
 
@@ -183,8 +256,61 @@ class ARINC_665_QT_EXPORT LoadsModel final : public QAbstractTableModel
     /** @} **/
 
   private:
+    //! Row of the Random-Access Snapshot
+    struct Row
+    {
+      //! Load
+      Arinc665::Media::LoadVariant load;
+      //! Cached Display Strings (Indexed by Columns)
+      std::array< QString, static_cast< std::size_t >( Columns::ColumnsCount ) > display{};
+      //! Cached Tool Tip
+      QString toolTip{};
+      //! Cached Filter Key (Part Number, Target Hardware IDs, and Media Set Part Number)
+      QString filterKey{};
+      //! If the strings are cached
+      bool cached{ false };
+    };
+
+    /**
+     * @brief Returns the row for the given index with cached strings.
+     *
+     * @param[in] index
+     *   Load Index (Row considering filter and sort order)
+     *
+     * @return Row with cached strings.
+     **/
+    [[nodiscard]] const Row& cachedRow( std::size_t index ) const;
+
+    /**
+     * @brief Caches the strings of the given row.
+     *
+     * @param[in,out] row
+     *   Row to update.
+     **/
+    void cacheRow( Row &row ) const;
+
+    /**
+     * @brief Rebuilds the visible rows considering filter and sort order.
+     *
+     * Only the first @ref FetchSize rows are populated.
+     * Must be called between beginResetModel() and endResetModel().
+     **/
+    void updateVisibleRows();
+
     //! Loads List
     Arinc665::Media::LoadsVariant loadsV;
+    //! Random-Access Snapshot of the Loads
+    mutable std::vector< Row > rowsV;
+    //! Visible Rows (Indices into rowsV considering filter and sort order)
+    std::vector< std::size_t > visibleRowsV;
+    //! Number of populated Rows
+    std::size_t fetchedRowsV{ 0U };
+    //! Filter String
+    QString filterV;
+    //! Sort Column (-1: original order)
+    int sortColumnV{ -1 };
+    //! Sort Order
+    Qt::SortOrder sortOrderV{ Qt::AscendingOrder };
 };
 
 }
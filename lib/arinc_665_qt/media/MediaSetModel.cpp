@@ -22,7 +22,9 @@
 
 #include <QIcon>
 
-#include <iterator>
+#include <cassert>
+#include <tuple>
+#include <utility>
 
 namespace Arinc665Qt::Media {
 
@@ -60,7 +62,8 @@ QModelIndex MediaSetModel::index( const int row, const int column, const QModelI
     case Arinc665::Media::Type::MediaSet:
     case Arinc665::Media::Type::Directory:
     {
-      auto containerParent{ std::dynamic_pointer_cast< const Arinc665::Media::ContainerEntity >( parentBase ) };
+      const auto containerParent{
+        std::dynamic_pointer_cast< const Arinc665::Media::ContainerEntity >( parentBase ) };
 
       if ( !containerParent )
       {
@@ -69,16 +72,17 @@ QModelIndex MediaSetModel::index( const int row, const int column, const QModelI
         return {};
       }
 
-      if ( auto directories{ containerParent->subdirectories() }; std::cmp_less( row, directories.size() ) )
+      const auto &containerChildren{ children( containerParent ) };
+
+      if ( ( row < 0 ) || std::cmp_greater_equal( row, containerChildren.size() ) )
       {
-        auto dirIt{ std::next( directories.begin(), row ) };
-        return createIndex( row, column, (void*)dirIt->get() );
+        return {};
       }
 
-      auto files{ containerParent->files() };
-      auto fileIt{
-        std::next( files.begin(), row - static_cast< ptrdiff_t >( containerParent->numberOfSubdirectories() ) ) };
-      return createIndex( row, column, (void*)fileIt->get() );
+      return createIndex(
+        row,
+        column,
+        (void*)containerChildren[ static_cast< std::size_t >( row ) ].get() );
     }
 
     case Arinc665::Media::Type::File:
@@ -118,65 +122,26 @@ QModelIndex MediaSetModel::parent( const QModelIndex &index ) const
       return {};
 
     case Arinc665::Media::Type::Directory:
+    case Arinc665::Media::Type::File:
     {
-      auto dir{ std::dynamic_pointer_cast< const Arinc665::Media::ContainerEntity >( base ) };
-
-      assert( dir );
+      const auto parentContainer{ base->parent() };
 
-      if ( Arinc665::Media::Type::MediaSet == dir->parent()->type() )
+      if ( !parentContainer || ( base == rootV ) )
       {
-        auto parent{ std::dynamic_pointer_cast< const Arinc665::Media::MediaSet >( dir->parent() ) };
-
-        assert( parent );
-
-        // Media-Set is root element
-        return createIndex( 0, 0, (void*)parent.get() );
+        // Root element has no parent
+        return {};
       }
 
-      auto grandParent( dir->parent()->parent() );
-
-      auto subDirs( grandParent->subdirectories() );
+      const auto parentRow{ row( parentContainer ) };
 
-      // find index of parent in grandparent list
-      auto pos( std::ranges::find( subDirs, dir->parent() ) );
-
-      return createIndex(
-        static_cast< int >( std::distance( subDirs.begin(), pos ) ),
-        0,
-        (void*)dir->parent().get() );
-    }
-
-    case Arinc665::Media::Type::File:
-    {
-      auto file{ std::dynamic_pointer_cast< const Arinc665::Media::File >( base) };
-
-      if ( !file )
+      if ( !parentRow )
       {
         // Should not happen
-        SPDLOG_ERROR( "Could not cast to File" );
+        SPDLOG_ERROR( "Parent not found within Grandparent" );
         return {};
       }
 
-      if ( Arinc665::Media::Type::MediaSet == file->parent()->type() )
-      {
-        auto parent( std::dynamic_pointer_cast< const Arinc665::Media::MediaSet >( file->parent() ) );
-        assert( parent );
-
-        // the media set
-        return createIndex( 0, 0, (void*)parent.get() );
-      }
-
-      auto grandParent{ file->parent()->parent() };
-
-      auto subDirs{ grandParent->subdirectories() };
-
-      // find index of parent in grandparent list
-      auto pos{ std::ranges::find( subDirs, file->parent() ) };
-
-      return createIndex(
-        static_cast< int >( std::distance( subDirs.begin(), pos ) ),
-        0,
-        (void*)file->parent().get() );
+      return createIndex( *parentRow, 0, (void*)static_cast< const Arinc665::Media::Base * >( parentContainer.get() ) );
     }
 
     default:
@@ -267,7 +232,7 @@ int MediaSetModel::rowCount( const QModelIndex &parent ) const
       }
 
       // Medium and Directories have subdirectories and files
-      return static_cast< int >( container->numberOfSubdirectories() + container->numberOfFiles() );
+      return static_cast< int >( children( container ).size() );
     }
 
     case Arinc665::Media::Type::File:
@@ -362,57 +327,20 @@ Arinc665::Media::ConstBasePtr MediaSetModel::element( const QModelIndex &index )
 
 QModelIndex MediaSetModel::indexForElement( const Arinc665::Media::ConstBasePtr &element ) const
 {
-  if ( rootV == element )
+  if ( !element )
   {
-    return index( 0, 0 );
-  }
-
-  const auto parent{ element->parent() };
-
-  if ( element->type() == Arinc665::Media::Type::Directory )
-  {
-    const auto directory{ std::dynamic_pointer_cast< const Arinc665::Media::Directory >( element ) };
-    if ( !directory )
-    {
-      // should not happen
-      return {};
-    }
-
-    auto subDirectories{ parent->subdirectories() };
-    const auto pos( std::ranges::find( subDirectories, directory  ) );
-
-    if ( pos == subDirectories.end() )
-    {
-      // should not happen
-      return {};
-    }
-
-    return index(
-      static_cast< int >( std::distance( subDirectories.begin(), pos ) ),
-      0,
-      indexForElement( parent ) );
-  }
-
-  const auto file{ std::dynamic_pointer_cast< const Arinc665::Media::File >( element ) };
-  if ( !file )
-  {
-    // should not happen
     return {};
   }
 
-  auto files{ parent->files() };
-  const auto pos( std::ranges::find( files, file ) );
+  const auto elementRow{ row( element ) };
 
-  if ( pos == files.end() )
+  if ( !elementRow )
   {
     // should not happen
     return {};
   }
 
-  return index(
-    static_cast< int >( parent->numberOfSubdirectories() + std::distance( files.begin(), pos ) ),
-    0,
-    indexForElement( parent ) );
+  return createIndex( *elementRow, 0, (void*)element.get() );
 }
 
 void MediaSetModel::root( Arinc665::Media::ConstBasePtr root )
@@ -423,6 +351,7 @@ void MediaSetModel::root( Arinc665::Media::ConstBasePtr root )
   }
 
   beginResetModel();
+  clearCache();
   rootV = std::move( root );
   endResetModel();
 }
@@ -432,6 +361,79 @@ const Arinc665::Media::ConstBasePtr& MediaSetModel::root() const
   return rootV;
 }
 
+void MediaSetModel::refresh()
+{
+  beginResetModel();
+  clearCache();
+  endResetModel();
+}
+
+const MediaSetModel::Children& MediaSetModel::children(
+  const Arinc665::Media::ConstContainerEntityPtr &container ) const
+{
+  assert( container );
+
+  const auto [ childrenIt, inserted ]{ childrenV.try_emplace( container.get() ) };
+  auto &containerChildren{ childrenIt->second };
+
+  if ( !inserted )
+  {
+    return containerChildren;
+  }
+
+  const auto subdirectories{ container->subdirectories() };
+  const auto files{ container->files() };
+
+  containerChildren.reserve( subdirectories.size() + files.size() );
+  containerChildren.insert( containerChildren.end(), subdirectories.begin(), subdirectories.end() );
+  containerChildren.insert( containerChildren.end(), files.begin(), files.end() );
+
+  for ( int childRow{ 0 }; const auto &child : containerChildren )
+  {
+    rowsV.insert_or_assign( child.get(), childRow++ );
+  }
+
+  return containerChildren;
+}
+
+std::optional< int > MediaSetModel::row( const Arinc665::Media::ConstBasePtr &element ) const
+{
+  assert( element );
+
+  if ( element == rootV )
+  {
+    return 0;
+  }
+
+  if ( const auto rowIt{ rowsV.find( element.get() ) }; rowIt != rowsV.end() )
+  {
+    return rowIt->second;
+  }
+
+  const auto parent{ element->parent() };
+
+  if ( !parent )
+  {
+    return {};
+  }
+
+  // populate cache of parent
+  std::ignore = children( parent );
+
+  if ( const auto rowIt{ rowsV.find( element.get() ) }; rowIt != rowsV.end() )
+  {
+    return rowIt->second;
+  }
+
+  return {};
+}
+
+void MediaSetModel::clearCache()
+{
+  childrenV.clear();
+  rowsV.clear();
+}
+
 QVariant MediaSetModel::dataDecorationRole( const int column, const Arinc665::Media::ConstBasePtr &base ) const
 {
   assert( base );
@@ -19,6 +19,10 @@
 
 #include <QAbstractItemModel>
 
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 namespace Arinc665Qt::Media {
 
 /**
@@ -27,6 +31,11 @@ namespace Arinc665Qt::Media {
  * This is a hierarchical model giving access to a %Media Set, their %Media, Directories and Files.
  *
  * The Model-Index holds the Pointer to the @ref Arinc665::Media::Base object.
+ *
+ * The children of each container (subdirectories followed by files) and the row of each element within its parent
+ * are cached on first access, so index() and parent() are O(1).
+ * The caches are discarded on model reset.
+ * When the structure of the media set is modified, refresh() must be called.
  **/
 class ARINC_665_QT_EXPORT MediaSetModel final : public QAbstractItemModel
 {
@@ -182,9 +191,47 @@ class ARINC_665_QT_EXPORT MediaSetModel final : public QAbstractItemModel
      **/
     [[nodiscard]] const Arinc665::Media::ConstBasePtr& root() const;
 
+    /**
+     * @brief Rebuilds the model.
+     *
+     * Must be called, when the structure of the associated %Media Set has been modified.
+     * Discards the cached children and resets the model.
+     **/
+    void refresh();
+
     /** @} **/
 
   private:
+    //! Children of a Container (Subdirectories followed by Files)
+    using Children = std::vector< Arinc665::Media::ConstBasePtr >;
+
+    /**
+     * @brief Returns the children of the given container.
+     *
+     * On first access, the children are cached and the row of each child is recorded.
+     *
+     * @param[in] container
+     *   Container (Media Set or Directory).
+     *
+     * @return Children of @p container.
+     **/
+    [[nodiscard]] const Children& children( const Arinc665::Media::ConstContainerEntityPtr &container ) const;
+
+    /**
+     * @brief Returns the row of the given element within its parent.
+     *
+     * @param[in] element
+     *   Media Set Element.
+     *
+     * @return Row of @p element.
+     * @retval {}
+     *   If @p element is not part of its parent.
+     **/
+    [[nodiscard]] std::optional< int > row( const Arinc665::Media::ConstBasePtr &element ) const;
+
+    //! Discards the cached children and rows.
+    void clearCache();
+
     /**
      * @brief Returns the _Decoration_ data for the given element.
      *
@@ -211,6 +258,10 @@ class ARINC_665_QT_EXPORT MediaSetModel final : public QAbstractItemModel
 
     //! Root Element
     Arinc665::Media::ConstBasePtr rootV;
+    //! Cached Children of each Container
+    mutable std::unordered_map< const Arinc665::Media::Base *, Children > childrenV;
+    //! Cached Row of each Element within its Parent
+    mutable std::unordered_map< const Arinc665::Media::Base *, int > rowsV;
 };
 
 }
@@ -13,9 +13,13 @@
 #include "MediaSetsModel.hpp"
 
 #include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/Load.hpp>
 
 #include <helper_qt/String.hpp>
 
+#include <algorithm>
+#include <string>
+
 namespace Arinc665Qt::Media {
 
 MediaSetsModel::MediaSetsModel( QObject *const parent ) :
@@ -32,7 +36,7 @@ int MediaSetsModel::rowCount( const QModelIndex &parent ) const
     return 0;
   }
 
-  return static_cast< int >( numberOfMediaSets() );
+  return static_cast< int >( fetchedRowsV );
 }
 
 int MediaSetsModel::columnCount( const QModelIndex &parent ) const
@@ -47,9 +51,9 @@ int MediaSetsModel::columnCount( const QModelIndex &parent ) const
 
 QVariant MediaSetsModel::data( const QModelIndex &index, const int role ) const
 {
-  const auto mediaSetPtr{ constMediaSet( mediaSet( index ) ) };
-
-  if ( !mediaSetPtr )
+  if ( !index.isValid()
+    || ( static_cast< std::size_t >( index.row() ) >= fetchedRowsV )
+    || ( index.column() >= std::to_underlying( Columns::ColumnsCount ) ) )
   {
     return {};
   }
@@ -57,14 +61,8 @@ QVariant MediaSetsModel::data( const QModelIndex &index, const int role ) const
   switch ( role )
   {
     case Qt::ItemDataRole::DisplayRole:
-      switch ( static_cast< Columns >( index.column() ) )
-      {
-        case Columns::PartNumber:
-          return HelperQt::toQString( mediaSetPtr->partNumber() );
-
-        default:
-          return {};
-      }
+      return cachedRow( static_cast< std::size_t >( index.row() ) ).display[
+        static_cast< std::size_t >( index.column() ) ];
 
     case Qt::ItemDataRole::ToolTipRole:
     case Qt::ItemDataRole::TextAlignmentRole:
@@ -95,9 +93,55 @@ QVariant MediaSetsModel::headerData( const int section, const ::Qt::Orientation
   }
 }
 
+bool MediaSetsModel::canFetchMore( const QModelIndex &parent ) const
+{
+  if ( parent.isValid() )
+  {
+    return false;
+  }
+
+  return fetchedRowsV < visibleRowsV.size();
+}
+
+void MediaSetsModel::fetchMore( const QModelIndex &parent )
+{
+  if ( !canFetchMore( parent ) )
+  {
+    return;
+  }
+
+  const auto fetchedRows{ std::min( visibleRowsV.size(), fetchedRowsV + FetchSize ) };
+
+  beginInsertRows( {}, static_cast< int >( fetchedRowsV ), static_cast< int >( fetchedRows - 1U ) );
+  fetchedRowsV = fetchedRows;
+  endInsertRows();
+}
+
+void MediaSetsModel::sort( const int column, const Qt::SortOrder order )
+{
+  beginResetModel();
+  sortColumnV = ( ( column >= 0 ) && ( column < std::to_underlying( Columns::ColumnsCount ) ) ) ? column : -1;
+  sortOrderV = order;
+  updateVisibleRows();
+  endResetModel();
+}
+
+const QString& MediaSetsModel::filter() const
+{
+  return filterV;
+}
+
+void MediaSetsModel::filter( QString filter )
+{
+  beginResetModel();
+  filterV = std::move( filter );
+  updateVisibleRows();
+  endResetModel();
+}
+
 size_t MediaSetsModel::numberOfMediaSets() const
 {
-  return std::visit( []( auto &mediaSets ) { return mediaSets.size(); }, mediaSetsV );
+  return rowsV.size();
 }
 
 const Arinc665::Media::MediaSetsVariant& MediaSetsModel::mediaSets() const
@@ -109,9 +153,53 @@ void MediaSetsModel::mediaSets( Arinc665::Media::MediaSetsVariant mediaSets )
 {
   beginResetModel();
   mediaSetsV = std::move( mediaSets );
+
+  rowsV.clear();
+  std::visit(
+    [ this ]( const auto &mediaSets ) {
+      rowsV.reserve( mediaSets.size() );
+      for ( const auto &mediaSet : mediaSets )
+      {
+        rowsV.emplace_back( Row{ .mediaSet = mediaSet } );
+      }
+    },
+    mediaSetsV );
+
+  updateVisibleRows();
   endResetModel();
 }
 
+void MediaSetsModel::appendMediaSet( Arinc665::Media::ConstMediaSetPtr mediaSet )
+{
+  if ( std::holds_alternative< Arinc665::Media::MediaSets >( mediaSetsV ) )
+  {
+    const auto &mediaSets{ std::get< Arinc665::Media::MediaSets >( mediaSetsV ) };
+    mediaSetsV = Arinc665::Media::ConstMediaSets{ mediaSets.begin(), mediaSets.end() };
+  }
+
+  std::get< Arinc665::Media::ConstMediaSets >( mediaSetsV ).push_back( mediaSet );
+  rowsV.emplace_back( Row{ .mediaSet = std::move( mediaSet ) } );
+
+  // filtered or sorted - rebuild visible rows
+  if ( !filterV.isEmpty() || ( sortColumnV >= 0 ) )
+  {
+    beginResetModel();
+    updateVisibleRows();
+    endResetModel();
+    return;
+  }
+
+  visibleRowsV.push_back( rowsV.size() - 1U );
+
+  // insert row only, when all previous rows are populated - otherwise it is populated by fetchMore()
+  if ( fetchedRowsV + 1U == visibleRowsV.size() )
+  {
+    beginInsertRows( {}, static_cast< int >( fetchedRowsV ), static_cast< int >( fetchedRowsV ) );
+    ++fetchedRowsV;
+    endInsertRows();
+  }
+}
+
 Arinc665::Media::MediaSetVariant MediaSetsModel::mediaSet( const QModelIndex &index ) const
 {
   if ( !index.isValid() )
@@ -125,17 +213,12 @@ Arinc665::Media::MediaSetVariant MediaSetsModel::mediaSet( const QModelIndex &in
 
 Arinc665::Media::MediaSetVariant MediaSetsModel::mediaSet( const std::size_t index ) const
 {
-  if ( index >= numberOfMediaSets() )
+  if ( index >= fetchedRowsV )
   {
     return {};
   }
 
-  return std::visit(
-    [ index ]( auto &mediaSets ) {
-      auto mediaSet{ std::next( mediaSets.begin(), index ) };
-      return Arinc665::Media::MediaSetVariant{ *mediaSet };
-    },
-    mediaSetsV );
+  return rowsV[ visibleRowsV[ index ] ].mediaSet;
 }
 
 Arinc665::Media::ConstMediaSetPtr MediaSetsModel::constMediaSet(
@@ -148,4 +231,75 @@ Arinc665::Media::ConstMediaSetPtr MediaSetsModel::constMediaSet(
     mediaSet );
 }
 
+const MediaSetsModel::Row& MediaSetsModel::cachedRow( const std::size_t index ) const
+{
+  auto &row{ rowsV[ visibleRowsV[ index ] ] };
+  cacheRow( row );
+  return row;
+}
+
+void MediaSetsModel::cacheRow( Row &row ) const
+{
+  if ( row.cached )
+  {
+    return;
+  }
+
+  const auto mediaSetPtr{ constMediaSet( row.mediaSet ) };
+
+  row.display[ static_cast< std::size_t >( Columns::PartNumber ) ] = HelperQt::toQString( mediaSetPtr->partNumber() );
+
+  std::string filterKey{ mediaSetPtr->partNumber() };
+  for ( const auto &load : mediaSetPtr->recursiveLoads() )
+  {
+    for ( const auto &[ targetHardwareId, positions ] : load->targetHardwareIdPositions() )
+    {
+      filterKey.append( "\n" ).append( targetHardwareId );
+    }
+  }
+  row.filterKey = QString::fromStdString( filterKey );
+
+  row.cached = true;
+}
+
+void MediaSetsModel::updateVisibleRows()
+{
+  visibleRowsV.clear();
+  visibleRowsV.reserve( rowsV.size() );
+
+  for ( std::size_t index{ 0U }; index < rowsV.size(); ++index )
+  {
+    if ( !filterV.isEmpty() )
+    {
+      cacheRow( rowsV[ index ] );
+      if ( !rowsV[ index ].filterKey.contains( filterV, Qt::CaseInsensitive ) )
+      {
+        continue;
+      }
+    }
+
+    visibleRowsV.push_back( index );
+  }
+
+  if ( sortColumnV >= 0 )
+  {
+    const auto column{ static_cast< std::size_t >( sortColumnV ) };
+
+    for ( const auto index : visibleRowsV )
+    {
+      cacheRow( rowsV[ index ] );
+    }
+
+    std::ranges::stable_sort(
+      visibleRowsV,
+      [ this, column ]( const std::size_t lhs, const std::size_t rhs ) {
+        const auto result{
+          QString::localeAwareCompare( rowsV[ lhs ].display[ column ], rowsV[ rhs ].display[ column ] ) };
+        return ( Qt::AscendingOrder == sortOrderV ) ? ( result < 0 ) : ( result > 0 );
+      } );
+  }
+
+  fetchedRowsV = std::min( visibleRowsV.size(), FetchSize );
+}
+
 }
@@ -18,8 +18,12 @@
 #include <arinc_665/media/Media.hpp>
 
 #include <QAbstractTableModel>
+#include <QString>
 
+#include <array>
+#include <cstddef>
 #include <variant>
+#include <vector>
 
 namespace Arinc665Qt::Media {
 
@@ -27,6 +31,11 @@ namespace Arinc665Qt::Media {
  * @brief Qt Table Model representing a list of %Media Sets.
  *
  * For media sets the type Arinc665::Media::MediaSetsVariant is used to allow const and non-const media sets to be used.
+ *
+ * The media sets are held within a random-access snapshot, so each row is accessed in O(1).
+ * Display strings are cached on first access.
+ * Rows are populated lazily in chunks of @ref FetchSize rows via canFetchMore() and fetchMore().
+ * The model provides a built-in sort (sort()) and filter (filter()) index.
  **/
 class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
 {
@@ -42,6 +51,9 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
       ColumnsCount
     };
 
+    //! Number of Rows populated by a single fetchMore() call
+    static constexpr std::size_t FetchSize{ 256U };
+
     /**
      * @brief Initialises the Media Sets Model.
      *
@@ -103,6 +115,62 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
      **/
     [[nodiscard]] QVariant headerData( int section, Qt::Orientation orientation, int role ) const override;
 
+    /**
+     * @brief Returns if more rows can be populated.
+     *
+     * @param[in] parent
+     *   Index-parent - assumed to be the root element (invalid).
+     *
+     * @return If not all rows are populated.
+     **/
+    [[nodiscard]] bool canFetchMore( const QModelIndex &parent ) const override;
+
+    /**
+     * @brief Populates the next @ref FetchSize rows.
+     *
+     * @param[in] parent
+     *   Index-parent - assumed to be the root element (invalid).
+     **/
+    void fetchMore( const QModelIndex &parent ) override;
+
+    /**
+     * @brief Sorts the media sets by the given column.
+     *
+     * @param[in] column
+     *   Sort column.
+     *   If out of range, the original order is restored.
+     * @param[in] order
+     *   Sort order.
+     **/
+    void sort( int column, Qt::SortOrder order = Qt::AscendingOrder ) override;
+
+    /**
+     * @name Filter
+     *
+     * Only media sets, where the part number or a target hardware ID of a contained load contains the filter string
+     * (case-insensitive) are provided.
+     * An empty filter string disables the filter.
+     *
+     * @{
+     **/
+
+    /**
+     * @brief Returns the filter string.
+     *
+     * @return Filter String.
+     **/
+    [[nodiscard]] const QString& filter() const;
+
+    /**
+     * @brief Updates the filter string.
+     *
+     * @param[in] filter
+     *   Filter String.
+     **/
+    void filter( QString filter );
+
+    /** @} **/
+
     /**
      * @name Media Sets.
      * @{
@@ -111,6 +179,8 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
     /**
      * @brief Returns the Number of Media Sets
      *
+     * The filter is not considered.
+     *
      * @return Number of Media Sets
      **/
     [[nodiscard]] size_t numberOfMediaSets() const;
@@ -130,6 +200,17 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
      **/
     void mediaSets( Arinc665::Media::MediaSetsVariant mediaSets );
 
+    /**
+     * @brief Appends the given Media Set to the data model.
+     *
+     * Used to present media sets incrementally, while they are loaded.
+     * If the model contains a non-const media set list, it is converted to a const media set list.
+     *
+     * @param[in] mediaSet
+     *   Media Set to append.
+     **/
+    void appendMediaSet( Arinc665::Media::ConstMediaSetPtr mediaSet );
+
     /**
      * @brief Returns the Media Set for the given index.
      *
@@ -144,11 +225,11 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
      * @brief Return Media Set for a given Index.
      *
      * @param[in] index
-     *   Media Set Index
+     *   Media Set Index (Row considering filter and sort order)
      *
      * @return Media Set for a given Index
      * @retval {}
-     *   If index is invalid
+     *   If @p index is invalid or not yet fetched (beyond rowCount())
      **/
     [[nodiscard]] Arinc665::Media::MediaSetVariant mediaSet( std::size_t index ) const;
 
@@ -169,8 +250,59 @@ class ARINC_665_QT_EXPORT MediaSetsModel final : public QAbstractTableModel
     /** @} **/
 
   private:
+    //! Row of the Random-Access Snapshot
+    struct Row
+    {
+      //! Media Set
+      Arinc665::Media::MediaSetVariant mediaSet;
+      //! Cached Display Strings (Indexed by Columns)
+      std::array< QString, static_cast< std::size_t >( Columns::ColumnsCount ) > display{};
+      //! Cached Filter Key (Part Number and Target Hardware IDs of contained Loads)
+      QString filterKey{};
+      //! If the strings are cached
+      bool cached{ false };
+    };
+
+    /**
+     * @brief Returns the row for the given index with cached strings.
+     *
+     * @param[in] index
+     *   Media Set Index (Row considering filter and sort order)
+     *
+     * @return Row with cached strings.
+     **/
+    [[nodiscard]] const Row& cachedRow( std::size_t index ) const;
+
+    /**
+     * @brief Caches the strings of the given row.
+     *
+     * @param[in,out] row
+     *   Row to update.
+     **/
+    void cacheRow( Row &row ) const;
+
+    /**
+     * @brief Rebuilds the visible rows considering filter and sort order.
+     *
+     * Only the first @ref FetchSize rows are populated.
+     * Must be called between beginResetModel() and endResetModel().
+     **/
+    void updateVisibleRows();
+
     //! Media Sets
     Arinc665::Media::MediaSetsVariant mediaSetsV;
+    //! Random-Access Snapshot of the Media Sets
+    mutable std::vector< Row > rowsV;
+    //! Visible Rows (Indices into rowsV considering filter and sort order)
+    std::vector< std::size_t > visibleRowsV;
+    //! Number of populated Rows
+    std::size_t fetchedRowsV{ 0U };
+    //! Filter String
+    QString filterV;
+    //! Sort Column (-1: original order)
+    int sortColumnV{ -1 };
+    //! Sort Order
+    Qt::SortOrder sortOrderV{ Qt::AscendingOrder };
 };
 
 }
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665Qt::Media::BatchesModel.
+ **/
+
+#include <arinc_665_qt/media/BatchesModel.hpp>
+
+#include <arinc_665/media/Batch.hpp>
+#include <arinc_665/media/MediaSet.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <format>
+#include <string>
+
+namespace Arinc665Qt::Media {
+
+namespace {
+
+//! Number of Batches (more than two fetches)
+constexpr std::size_t NumberOfBatches{ 2U * BatchesModel::FetchSize + 10U };
+
+/**
+ * @brief Creates a Media Set with @ref NumberOfBatches Batches.
+ *
+ * The part numbers are assigned in reverse order of the batches.
+ * Batches with an even index contain the target hardware ID position @p THW_EVEN_1.
+ *
+ * @param[in] mediaSet
+ *   Media Set, which contains the batches.
+ *
+ * @return Batches in the order of creation.
+ **/
+Arinc665::Media::Batches createBatches( const Arinc665::Media::MediaSetPtr &mediaSet )
+{
+  Arinc665::Media::Batches batches{};
+
+  for ( std::size_t index{ 0U }; index < NumberOfBatches; ++index )
+  {
+    auto batch{ mediaSet->addBatch( std::format( "BATCH{:04}.LUB", index ) ) };
+    batch->partNumber( std::format( "PN{:04}", NumberOfBatches - 1U - index ) );
+    if ( 0U == index % 2U )
+    {
+      batch->target( "THW_EVEN_1", Arinc665::Media::ConstLoads{} );
+    }
+    batches.push_back( batch );
+  }
+
+  return batches;
+}
+
+/**
+ * @brief Returns the Part Number of the Batch at the given row.
+ *
+ * @param[in] model
+ *   Batches Model.
+ * @param[in] row
+ *   Row.
+ *
+ * @return Part Number of the batch.
+ **/
+std::string partNumber( const BatchesModel &model, const std::size_t row )
+{
+  return std::string{ model.constBatch( model.batch( row ) )->partNumber() };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665QtTest )
+BOOST_AUTO_TEST_SUITE( MediaTest )
+BOOST_AUTO_TEST_SUITE( BatchesModelTest )
+
+//! Rows are populated incrementally
+BOOST_AUTO_TEST_CASE( fetch )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  const auto batches{ createBatches( mediaSet ) };
+
+  BatchesModel model{};
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  model.batches( batches );
+  BOOST_CHECK_EQUAL( model.numberOfBatches(), NumberOfBatches );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( BatchesModel::FetchSize ) );
+
+  BOOST_CHECK( model.constBatch( model.batch( BatchesModel::FetchSize - 1U ) ) );
+  // not yet fetched
+  BOOST_CHECK( !model.constBatch( model.batch( BatchesModel::FetchSize ) ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( 2U * BatchesModel::FetchSize ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfBatches ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no more rows
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfBatches ) );
+  BOOST_CHECK( !model.constBatch( model.batch( NumberOfBatches ) ) );
+
+  // original order
+  for ( std::size_t row{ 0U }; const auto &batch : batches )
+  {
+    BOOST_CHECK( model.constBatch( model.batch( row ) ) == batch );
+    ++row;
+  }
+
+  // child rows
+  BOOST_CHECK_EQUAL( model.rowCount( model.index( 0, 0 ) ), 0 );
+  BOOST_CHECK( !model.canFetchMore( model.index( 0, 0 ) ) );
+}
+
+//! Filter and sort order select and arrange the rows
+BOOST_AUTO_TEST_CASE( filterSort )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  const auto batches{ createBatches( mediaSet ) };
+
+  BatchesModel model{};
+  model.batches( batches );
+
+  // part number (case-insensitive)
+  model.filter( "pn000" );
+  BOOST_CHECK( model.filter() == QString{ "pn000" } );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+  for ( std::size_t row{ 0U }; row < 10U; ++row )
+  {
+    BOOST_CHECK( partNumber( model, row ).starts_with( "PN000" ) );
+  }
+  BOOST_CHECK( !model.constBatch( model.batch( std::size_t{ 10U } ) ) );
+
+  // target hardware ID position
+  model.filter( "THW_EVEN_1" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( BatchesModel::FetchSize ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfBatches / 2U ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // media set part number
+  model.filter( "MEDIASET" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( BatchesModel::FetchSize ) );
+  BOOST_CHECK( model.canFetchMore( {} ) );
+
+  model.filter( "UNKNOWN" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no filter - sorted by part number
+  model.filter( {} );
+  model.sort( static_cast< int >( BatchesModel::Columns::PartNumber ) );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), static_cast< int >( BatchesModel::FetchSize ) );
+  for ( std::size_t row{ 0U }; row < BatchesModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", row ) );
+  }
+
+  model.sort( static_cast< int >( BatchesModel::Columns::PartNumber ), Qt::DescendingOrder );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), std::format( "PN{:04}", NumberOfBatches - 1U ) );
+
+  // filtered and sorted
+  model.filter( "pn000" );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), "PN0009" );
+  BOOST_CHECK_EQUAL( partNumber( model, 9U ), "PN0000" );
+
+  // original order
+  model.filter( {} );
+  model.sort( -1 );
+  for ( std::size_t row{ 0U }; row < BatchesModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", NumberOfBatches - 1U - row ) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
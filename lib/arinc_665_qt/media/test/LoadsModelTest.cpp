@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665Qt::Media::LoadsModel.
+ **/
+
+#include <arinc_665_qt/media/LoadsModel.hpp>
+
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/MediaSet.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <format>
+#include <string>
+
+namespace Arinc665Qt::Media {
+
+namespace {
+
+//! Number of Loads (more than two fetches)
+constexpr std::size_t NumberOfLoads{ 2U * LoadsModel::FetchSize + 10U };
+
+/**
+ * @brief Creates a Media Set with @ref NumberOfLoads Loads.
+ *
+ * The part numbers are assigned in reverse order of the loads.
+ * Loads with an even index are assigned to the target hardware ID @p THW_EVEN.
+ *
+ * @param[in] mediaSet
+ *   Media Set, which contains the loads.
+ *
+ * @return Loads in the order of creation.
+ **/
+Arinc665::Media::Loads createLoads( const Arinc665::Media::MediaSetPtr &mediaSet )
+{
+  Arinc665::Media::Loads loads{};
+
+  for ( std::size_t index{ 0U }; index < NumberOfLoads; ++index )
+  {
+    auto load{ mediaSet->addLoad( std::format( "LOAD{:04}.LUH", index ) ) };
+    load->partNumber( std::format( "PN{:04}", NumberOfLoads - 1U - index ) );
+    if ( 0U == index % 2U )
+    {
+      load->targetHardwareId( "THW_EVEN" );
+    }
+    loads.push_back( load );
+  }
+
+  return loads;
+}
+
+/**
+ * @brief Returns the Part Number of the Load at the given row.
+ *
+ * @param[in] model
+ *   Loads Model.
+ * @param[in] row
+ *   Row.
+ *
+ * @return Part Number of the load.
+ **/
+std::string partNumber( const LoadsModel &model, const std::size_t row )
+{
+  return std::string{ model.constLoad( model.load( row ) )->partNumber() };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665QtTest )
+BOOST_AUTO_TEST_SUITE( MediaTest )
+BOOST_AUTO_TEST_SUITE( LoadsModelTest )
+
+//! Rows are populated incrementally
+BOOST_AUTO_TEST_CASE( fetch )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  const auto loads{ createLoads( mediaSet ) };
+
+  LoadsModel model{};
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  model.loads( loads );
+  BOOST_CHECK_EQUAL( model.numberOfLoads(), NumberOfLoads );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( LoadsModel::FetchSize ) );
+
+  BOOST_CHECK( model.constLoad( model.load( LoadsModel::FetchSize - 1U ) ) );
+  // not yet fetched
+  BOOST_CHECK( !model.constLoad( model.load( LoadsModel::FetchSize ) ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( 2U * LoadsModel::FetchSize ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfLoads ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no more rows
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfLoads ) );
+  BOOST_CHECK( !model.constLoad( model.load( NumberOfLoads ) ) );
+
+  // original order
+  for ( std::size_t row{ 0U }; const auto &load : loads )
+  {
+    BOOST_CHECK( model.constLoad( model.load( row ) ) == load );
+    ++row;
+  }
+
+  // child rows
+  BOOST_CHECK_EQUAL( model.rowCount( model.index( 0, 0 ) ), 0 );
+  BOOST_CHECK( !model.canFetchMore( model.index( 0, 0 ) ) );
+}
+
+//! Filter and sort order select and arrange the rows
+BOOST_AUTO_TEST_CASE( filterSort )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  const auto loads{ createLoads( mediaSet ) };
+
+  LoadsModel model{};
+  model.loads( loads );
+
+  // part number (case-insensitive)
+  model.filter( "pn000" );
+  BOOST_CHECK( model.filter() == QString{ "pn000" } );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+  for ( std::size_t row{ 0U }; row < 10U; ++row )
+  {
+    BOOST_CHECK( partNumber( model, row ).starts_with( "PN000" ) );
+  }
+  BOOST_CHECK( !model.constLoad( model.load( std::size_t{ 10U } ) ) );
+
+  // target hardware ID
+  model.filter( "THW_EVEN" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( LoadsModel::FetchSize ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfLoads / 2U ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // media set part number
+  model.filter( "MEDIASET" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( LoadsModel::FetchSize ) );
+  BOOST_CHECK( model.canFetchMore( {} ) );
+
+  model.filter( "UNKNOWN" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no filter - sorted by part number
+  model.filter( {} );
+  model.sort( static_cast< int >( LoadsModel::Columns::PartNumber ) );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), static_cast< int >( LoadsModel::FetchSize ) );
+  for ( std::size_t row{ 0U }; row < LoadsModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", row ) );
+  }
+
+  model.sort( static_cast< int >( LoadsModel::Columns::PartNumber ), Qt::DescendingOrder );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), std::format( "PN{:04}", NumberOfLoads - 1U ) );
+
+  // filtered and sorted
+  model.filter( "pn000" );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), "PN0009" );
+  BOOST_CHECK_EQUAL( partNumber( model, 9U ), "PN0000" );
+
+  // original order
+  model.filter( {} );
+  model.sort( -1 );
+  for ( std::size_t row{ 0U }; row < LoadsModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", NumberOfLoads - 1U - row ) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
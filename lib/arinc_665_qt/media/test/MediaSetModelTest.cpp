@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665Qt::Media::MediaSetModel.
+ **/
+
+#include <arinc_665_qt/media/MediaSetModel.hpp>
+
+#include <arinc_665/media/Directory.hpp>
+#include <arinc_665/media/MediaSet.hpp>
+#include <arinc_665/media/RegularFile.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace Arinc665Qt::Media {
+
+namespace {
+
+/**
+ * @brief Returns the expected Children of the Container (Subdirectories followed by Files).
+ *
+ * @param[in] container
+ *   Container (Media Set or Directory).
+ *
+ * @return Children of @p container.
+ **/
+std::vector< Arinc665::Media::ConstBasePtr > children( const Arinc665::Media::ConstContainerEntityPtr &container )
+{
+  std::vector< Arinc665::Media::ConstBasePtr > containerChildren{};
+
+  for ( const auto &subdirectory : container->subdirectories() )
+  {
+    containerChildren.emplace_back( subdirectory );
+  }
+
+  for ( const auto &file : container->files() )
+  {
+    containerChildren.emplace_back( file );
+  }
+
+  return containerChildren;
+}
+
+/**
+ * @brief Checks the Model Indices of the Children of the Container recursively.
+ *
+ * @param[in] model
+ *   Media Set Model.
+ * @param[in] parentIndex
+ *   Model Index of @p container.
+ * @param[in] container
+ *   Container (Media Set or Directory).
+ **/
+void checkChildren(
+  const MediaSetModel &model,
+  const QModelIndex &parentIndex,
+  const Arinc665::Media::ConstContainerEntityPtr &container )
+{
+  const auto containerChildren{ children( container ) };
+  BOOST_REQUIRE_EQUAL( model.rowCount( parentIndex ), static_cast< int >( containerChildren.size() ) );
+  BOOST_CHECK_EQUAL( model.hasChildren( parentIndex ), !containerChildren.empty() );
+
+  for ( int row{ 0 }; const auto &child : containerChildren )
+  {
+    const auto index{ model.index( row, 0, parentIndex ) };
+    BOOST_REQUIRE( index.isValid() );
+    BOOST_CHECK_EQUAL( index.row(), row );
+    BOOST_CHECK( model.element( index ) == child );
+    BOOST_CHECK( model.parent( index ) == parentIndex );
+    BOOST_CHECK( model.indexForElement( child ) == index );
+
+    if ( const auto directory{ std::dynamic_pointer_cast< const Arinc665::Media::Directory >( child ) }; directory )
+    {
+      checkChildren( model, index, directory );
+    }
+    else
+    {
+      BOOST_CHECK_EQUAL( model.rowCount( index ), 0 );
+      BOOST_CHECK( !model.index( 0, 0, index ).isValid() );
+    }
+
+    ++row;
+  }
+
+  // beyond the children
+  BOOST_CHECK( !model.index( static_cast< int >( containerChildren.size() ), 0, parentIndex ).isValid() );
+  BOOST_CHECK( !model.index( -1, 0, parentIndex ).isValid() );
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665QtTest )
+BOOST_AUTO_TEST_SUITE( MediaTest )
+BOOST_AUTO_TEST_SUITE( MediaSetModelTest )
+
+//! Model indices and parents correspond to the media set structure
+BOOST_AUTO_TEST_CASE( indexParent )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  mediaSet->partNumber( "MEDIASET" );
+  std::ignore = mediaSet->addRegularFile( "FILE1" );
+  std::ignore = mediaSet->addRegularFile( "FILE2" );
+  auto directory1{ mediaSet->addSubdirectory( "DIR1" ) };
+  std::ignore = directory1->addRegularFile( "FILE3" );
+  std::ignore = directory1->addSubdirectory( "DIR3" );
+  std::ignore = mediaSet->addSubdirectory( "DIR2" );
+
+  MediaSetModel model{};
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.index( 0, 0 ).isValid() );
+
+  model.root( mediaSet );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 1 );
+
+  const auto rootIndex{ model.index( 0, 0 ) };
+  BOOST_REQUIRE( rootIndex.isValid() );
+  BOOST_CHECK( model.element( rootIndex ) == Arinc665::Media::ConstBasePtr{ mediaSet } );
+  BOOST_CHECK( !model.parent( rootIndex ).isValid() );
+  BOOST_CHECK( model.indexForElement( mediaSet ) == rootIndex );
+
+  checkChildren( model, rootIndex, mediaSet );
+
+  // indices of elements, which have not been visited before
+  MediaSetModel otherModel{};
+  otherModel.root( mediaSet );
+  const auto file3{ directory1->files().front() };
+  const auto file3Index{ otherModel.indexForElement( file3 ) };
+  BOOST_REQUIRE( file3Index.isValid() );
+  BOOST_CHECK( otherModel.element( file3Index ) == file3 );
+  BOOST_CHECK( otherModel.element( otherModel.parent( file3Index ) ) == Arinc665::Media::ConstBasePtr{ directory1 } );
+}
+
+//! The cached children are discarded on refresh and when the root is replaced
+BOOST_AUTO_TEST_CASE( reset )
+{
+  auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  std::ignore = mediaSet->addRegularFile( "FILE1" );
+
+  MediaSetModel model{};
+  model.root( mediaSet );
+
+  auto rootIndex{ model.index( 0, 0 ) };
+  checkChildren( model, rootIndex, mediaSet );
+
+  // modified structure
+  std::ignore = mediaSet->addSubdirectory( "DIR1" );
+  std::ignore = mediaSet->addRegularFile( "FILE2" );
+  model.refresh();
+
+  rootIndex = model.index( 0, 0 );
+  checkChildren( model, rootIndex, mediaSet );
+
+  // replaced root
+  auto otherMediaSet{ Arinc665::Media::MediaSet::create() };
+  auto directory{ otherMediaSet->addSubdirectory( "OTHER" ) };
+  std::ignore = directory->addRegularFile( "FILE" );
+  model.root( otherMediaSet );
+
+  rootIndex = model.index( 0, 0 );
+  BOOST_CHECK( model.element( rootIndex ) == Arinc665::Media::ConstBasePtr{ otherMediaSet } );
+  checkChildren( model, rootIndex, otherMediaSet );
+
+  // removed root
+  model.root( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.index( 0, 0 ).isValid() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
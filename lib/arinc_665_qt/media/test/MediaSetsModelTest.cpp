@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * @file
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * @author Thomas Vogt, thomas@thomas-vogt.de
+ *
+ * @brief Definition of Unit Tests for Class Arinc665Qt::Media::MediaSetsModel.
+ **/
+
+#include <arinc_665_qt/media/MediaSetsModel.hpp>
+
+#include <arinc_665/media/Load.hpp>
+#include <arinc_665/media/MediaSet.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <format>
+#include <string>
+
+namespace Arinc665Qt::Media {
+
+namespace {
+
+//! Number of Media Sets (more than two fetches)
+constexpr std::size_t NumberOfMediaSets{ 2U * MediaSetsModel::FetchSize + 10U };
+
+/**
+ * @brief Creates @ref NumberOfMediaSets Media Sets.
+ *
+ * The part numbers are assigned in reverse order of the media sets.
+ * Media sets with an even index contain a load for the target hardware ID @p THW_EVEN.
+ *
+ * @return Media Sets in the order of creation.
+ **/
+Arinc665::Media::MediaSets createMediaSets()
+{
+  Arinc665::Media::MediaSets mediaSets{};
+
+  for ( std::size_t index{ 0U }; index < NumberOfMediaSets; ++index )
+  {
+    auto mediaSet{ Arinc665::Media::MediaSet::create() };
+    mediaSet->partNumber( std::format( "PN{:04}", NumberOfMediaSets - 1U - index ) );
+    if ( 0U == index % 2U )
+    {
+      mediaSet->addLoad( "LOAD.LUH" )->targetHardwareId( "THW_EVEN" );
+    }
+    mediaSets.push_back( mediaSet );
+  }
+
+  return mediaSets;
+}
+
+/**
+ * @brief Returns the Part Number of the Media Set at the given row.
+ *
+ * @param[in] model
+ *   Media Sets Model.
+ * @param[in] row
+ *   Row.
+ *
+ * @return Part Number of the media set.
+ **/
+std::string partNumber( const MediaSetsModel &model, const std::size_t row )
+{
+  return std::string{ model.constMediaSet( model.mediaSet( row ) )->partNumber() };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( Arinc665QtTest )
+BOOST_AUTO_TEST_SUITE( MediaTest )
+BOOST_AUTO_TEST_SUITE( MediaSetsModelTest )
+
+//! Rows are populated incrementally
+BOOST_AUTO_TEST_CASE( fetch )
+{
+  const auto mediaSets{ createMediaSets() };
+
+  MediaSetsModel model{};
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  model.mediaSets( mediaSets );
+  BOOST_CHECK_EQUAL( model.numberOfMediaSets(), NumberOfMediaSets );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( MediaSetsModel::FetchSize ) );
+
+  BOOST_CHECK( model.constMediaSet( model.mediaSet( MediaSetsModel::FetchSize - 1U ) ) );
+  // not yet fetched
+  BOOST_CHECK( !model.constMediaSet( model.mediaSet( MediaSetsModel::FetchSize ) ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( 2U * MediaSetsModel::FetchSize ) );
+
+  BOOST_REQUIRE( model.canFetchMore( {} ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfMediaSets ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no more rows
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfMediaSets ) );
+  BOOST_CHECK( !model.constMediaSet( model.mediaSet( NumberOfMediaSets ) ) );
+
+  // original order
+  for ( std::size_t row{ 0U }; const auto &mediaSet : mediaSets )
+  {
+    BOOST_CHECK( model.constMediaSet( model.mediaSet( row ) ) == mediaSet );
+    ++row;
+  }
+
+  // child rows
+  BOOST_CHECK_EQUAL( model.rowCount( model.index( 0, 0 ) ), 0 );
+  BOOST_CHECK( !model.canFetchMore( model.index( 0, 0 ) ) );
+}
+
+//! Appended media sets are inserted only, when all previous rows are populated
+BOOST_AUTO_TEST_CASE( append )
+{
+  const auto mediaSets{ createMediaSets() };
+
+  MediaSetsModel model{};
+
+  // fully populated - inserted directly
+  for ( std::size_t row{ 0U }; const auto &mediaSet : mediaSets )
+  {
+    model.appendMediaSet( mediaSet );
+    ++row;
+
+    BOOST_CHECK_EQUAL( model.numberOfMediaSets(), row );
+    BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( row ) );
+    BOOST_CHECK( !model.canFetchMore( {} ) );
+  }
+
+  BOOST_CHECK( model.constMediaSet( model.mediaSet( NumberOfMediaSets - 1U ) ) == mediaSets.back() );
+
+  // partially populated - populated by fetchMore()
+  model.mediaSets( mediaSets );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), static_cast< int >( MediaSetsModel::FetchSize ) );
+
+  const auto mediaSet{ Arinc665::Media::MediaSet::create() };
+  model.appendMediaSet( mediaSet );
+  BOOST_CHECK_EQUAL( model.numberOfMediaSets(), NumberOfMediaSets + 1U );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( MediaSetsModel::FetchSize ) );
+  BOOST_CHECK( model.canFetchMore( {} ) );
+
+  model.fetchMore( {} );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfMediaSets + 1U ) );
+  BOOST_CHECK( model.constMediaSet( model.mediaSet( NumberOfMediaSets ) ) == mediaSet );
+
+  // filtered - rebuilt
+  model.filter( "pn000" );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  const auto filteredMediaSet{ Arinc665::Media::MediaSet::create() };
+  filteredMediaSet->partNumber( "PN000X" );
+  model.appendMediaSet( filteredMediaSet );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 11 );
+  model.appendMediaSet( Arinc665::Media::MediaSet::create() );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 11 );
+}
+
+//! Filter and sort order select and arrange the rows
+BOOST_AUTO_TEST_CASE( filterSort )
+{
+  const auto mediaSets{ createMediaSets() };
+
+  MediaSetsModel model{};
+  model.mediaSets( mediaSets );
+
+  // part number (case-insensitive)
+  model.filter( "pn000" );
+  BOOST_CHECK( model.filter() == QString{ "pn000" } );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+  for ( std::size_t row{ 0U }; row < 10U; ++row )
+  {
+    BOOST_CHECK( partNumber( model, row ).starts_with( "PN000" ) );
+  }
+  BOOST_CHECK( !model.constMediaSet( model.mediaSet( std::size_t{ 10U } ) ) );
+
+  // target hardware ID of the loads
+  model.filter( "THW_EVEN" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( MediaSetsModel::FetchSize ) );
+  model.fetchMore( {} );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), static_cast< int >( NumberOfMediaSets / 2U ) );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  model.filter( "UNKNOWN" );
+  BOOST_CHECK_EQUAL( model.rowCount( {} ), 0 );
+  BOOST_CHECK( !model.canFetchMore( {} ) );
+
+  // no filter - sorted by part number
+  model.filter( {} );
+  model.sort( static_cast< int >( MediaSetsModel::Columns::PartNumber ) );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), static_cast< int >( MediaSetsModel::FetchSize ) );
+  for ( std::size_t row{ 0U }; row < MediaSetsModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", row ) );
+  }
+
+  model.sort( static_cast< int >( MediaSetsModel::Columns::PartNumber ), Qt::DescendingOrder );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), std::format( "PN{:04}", NumberOfMediaSets - 1U ) );
+
+  // filtered and sorted
+  model.filter( "pn000" );
+  BOOST_REQUIRE_EQUAL( model.rowCount( {} ), 10 );
+  BOOST_CHECK_EQUAL( partNumber( model, 0U ), "PN0009" );
+  BOOST_CHECK_EQUAL( partNumber( model, 9U ), "PN0000" );
+
+  // original order
+  model.filter( {} );
+  model.sort( -1 );
+  for ( std::size_t row{ 0U }; row < MediaSetsModel::FetchSize; ++row )
+  {
+    BOOST_CHECK_EQUAL( partNumber( model, row ), std::format( "PN{:04}", NumberOfMediaSets - 1U - row ) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+}
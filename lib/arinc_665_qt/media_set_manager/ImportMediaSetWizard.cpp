@@ -116,6 +116,11 @@ void ImportMediaSetWizard::importMediaSet()
       .outputBasePath( mediaSetManagerV->directory() )
       .mediaSetName( mediaInformation->partNumber );
 
+    if ( mediaSetManagerV->mediaSetDefaults().payloadStore )
+    {
+      copierV->payloadStore( mediaSetManagerV->directory() / Arinc665::Utils::MediaSetManager::PayloadStoreDirectory );
+    }
+
     const auto copyResult{ ( * copierV )() };
 
     mediaSetManagerV->registerMediaSet( copyResult, checkFileIntegrityV );
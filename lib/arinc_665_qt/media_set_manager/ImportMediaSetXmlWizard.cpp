@@ -143,14 +143,19 @@ void ImportMediaSetXmlWizard::importMediaSetXml()
       Arinc665::Utils::Arinc665Xml_load( xmlFileV );
 
     compilerV
-      ->mediaSet( std::move( mediaSet ) )
+      ->mediaSet( mediaSet )
       .filePathMapping( std::move( fileMapping ) )
       .outputBasePath( mediaSetManagerV->directory() );
     assert( compilerV );
 
     auto mediaSetPaths{ ( *compilerV )() };
 
-    mediaSetManagerV->registerMediaSet( mediaSetPaths, checkFileIntegrityV );
+    // register compiled media set without re-reading it
+    mediaSetManagerV->registerMediaSet(
+      mediaSetPaths,
+      std::move( mediaSet ),
+      compilerV->checkValues(),
+      checkFileIntegrityV );
     mediaSetManagerV->saveConfiguration();
   }
   catch ( const boost::exception &e )
@@ -17,8 +17,6 @@
 
 #include <arinc_665/Arinc665Exception.hpp>
 
-#include <QMessageBox>
-
 #include <boost/exception/all.hpp>
 
 namespace Arinc665Qt::MediaSetManager {
@@ -29,6 +27,7 @@ LoadMediaSetManagerAction::LoadMediaSetManagerAction( QObject * const parent ) :
   qRegisterMetaType< size_t >( "size_t" );
   qRegisterMetaType< std::string >( "std::string" );
   qRegisterMetaType< Arinc665::Utils::MediaSetManagerPtr >( "Arinc665::Utils::MediaSetManagerPtr" );
+  qRegisterMetaType< Arinc665::Media::ConstMediaSetPtr >( "Arinc665::Media::ConstMediaSetPtr" );
 
   moveToThread( threadV );
 
@@ -52,6 +51,11 @@ void LoadMediaSetManagerAction::checkMediaSetIntegrity( const bool checkMediaSet
   checkMediaSetIntegrityV = checkMediaSetIntegrity;
 }
 
+void LoadMediaSetManagerAction::stopToken( std::stop_token stopToken )
+{
+  stopTokenV = std::move( stopToken );
+}
+
 void LoadMediaSetManagerAction::start()
 {
   try
@@ -59,41 +63,23 @@ void LoadMediaSetManagerAction::start()
     auto mediaSetManager{ Arinc665::Utils::MediaSetManager::loadOrCreate(
       mediaSetDirectoryV,
       checkMediaSetIntegrityV,
-      std::bind_front( &LoadMediaSetManagerAction::loadProgress, this ) ) };
+      std::bind_front( &LoadMediaSetManagerAction::loadProgress, this ),
+      [ this ]( const Arinc665::Media::ConstMediaSetPtr &mediaSet ) { emit mediaSetLoaded( mediaSet ); },
+      stopTokenV ) };
 
     emit mediaSetManagerLoaded( mediaSetManager );
   }
+  catch ( const Arinc665::OperationCancelled & )
+  {
+    emit cancelled();
+  }
   catch ( const Arinc665::Arinc665Exception &e )
   {
-    const auto info{ boost::diagnostic_information( e ) };
-
-    QMessageBox::critical(
-      nullptr,
-      tr( "Cannot open Media Set Manager" ),
-      QString{ tr(
-         "<b>Media Set Directory:</b><br/><i>%1</i><br/>"
-         "<b>Error:</b><br/><tt>%2</tt>" ) }
-        .arg(
-          QString::fromStdString( mediaSetDirectoryV.string() ),
-          QString::fromStdString( info ) ) );
-
-    emit failed();
+    emit failed( QString::fromStdString( boost::diagnostic_information( e ) ) );
   }
   catch ( const std::exception &e )
   {
-    const auto info{ boost::diagnostic_information( e ) };
-
-    QMessageBox::critical(
-      nullptr,
-      tr( "Cannot open Media Set Manager" ),
-      QString{ tr(
-       "<b>Media Set Directory:</b><br/><i>%1</i><br/>"
-       "<b>Error:</b><br/><tt>%2</tt>" ) }
-        .arg(
-          QString::fromStdString( mediaSetDirectoryV.string() ),
-          QString::fromStdString( info ) ) );
-
-    emit failed();
+    emit failed( QString::fromStdString( boost::diagnostic_information( e ) ) );
   }
 }
 
@@ -17,8 +17,11 @@
 
 #include <arinc_665/utils/Utils.hpp>
 
+#include <arinc_665/media/Media.hpp>
+
 #include <filesystem>
 #include <memory>
+#include <stop_token>
 
 #include <QObject>
 #include <QThread>
@@ -30,6 +33,8 @@ namespace Arinc665Qt::MediaSetManager {
  *
  * Loads the Media Set Manger in a separate task.
  * For communication with a GUI, signals are provided.
+ * The signals are emitted within the worker thread, so connected slots of GUI objects are called queued.
+ * Each media set is published by @ref mediaSetLoaded() as soon as it is loaded.
  **/
 class ARINC_665_QT_EXPORT LoadMediaSetManagerAction final : public QObject
 {
@@ -63,6 +68,16 @@ class ARINC_665_QT_EXPORT LoadMediaSetManagerAction final : public QObject
      **/
     void checkMediaSetIntegrity( bool checkMediaSetIntegrity );
 
+    /**
+     * @brief Sets the Stop Token used for Cancellation.
+     *
+     * Must be set before start() is invoked.
+     *
+     * @param[in] stopToken
+     *   Stop Token.
+     **/
+    void stopToken( std::stop_token stopToken );
+
   signals:
     /**
      * @brief Signal emitted when new progress information is available.
@@ -76,6 +91,14 @@ class ARINC_665_QT_EXPORT LoadMediaSetManagerAction final : public QObject
      **/
     void mediaSetManagerLoadProgress( size_t currentMediaSet, size_t numberOfMediaSets, const std::string &partNumber );
 
+    /**
+     * @brief Signal emitted when a Media Set has been loaded.
+     *
+     * @param[in] mediaSet
+     *   Loaded Media Set.
+     **/
+    void mediaSetLoaded( const Arinc665::Media::ConstMediaSetPtr &mediaSet );
+
     /**
      * @brief Signal emitted when the Media Set Manager is loaded successfully.
      *
@@ -86,8 +109,16 @@ class ARINC_665_QT_EXPORT LoadMediaSetManagerAction final : public QObject
 
     /**
      * @brief Signal emitted when the Media Set Manager could not be loaded.
+     *
+     * @param[in] errorInformation
+     *   Error Information.
+     **/
+    void failed( const QString &errorInformation );
+
+    /**
+     * @brief Signal emitted when loading of the Media Set Manager has been cancelled.
      **/
-    void failed();
+    void cancelled();
 
   public slots:
     /**
@@ -117,6 +148,8 @@ class ARINC_665_QT_EXPORT LoadMediaSetManagerAction final : public QObject
     std::filesystem::path mediaSetDirectoryV;
     //! Check Media Set Integrity parameter.
     bool checkMediaSetIntegrityV{ true };
+    //! Stop Token
+    std::stop_token stopTokenV;
 };
 
 }
@@ -37,6 +37,10 @@
 
 #include <helper/Version.hpp>
 
+#include <spdlog/spdlog.h>
+
+#include <boost/exception/all.hpp>
+
 #include <QIcon>
 #include <QDesktopServices>
 #include <QUrl>
@@ -135,8 +139,30 @@ MediaSetManagerWindow::~MediaSetManagerWindow() = default;
 void MediaSetManagerWindow::mediaSetManger(
   Arinc665::Utils::MediaSetManagerPtr mediaSetManager )
 {
+  mediaSetManagerWatcherV.reset();
   mediaSetManagerV = std::move( mediaSetManager );
 
+  if ( mediaSetManagerV )
+  {
+    try
+    {
+      // changes are detected within the watcher thread and applied within the GUI thread
+      mediaSetManagerWatcherV = Arinc665::Utils::MediaSetManagerWatcher::create(
+        *mediaSetManagerV,
+        [ this ]( Arinc665::Utils::MediaSetManagerWatcher::Change change )
+        {
+          QMetaObject::invokeMethod(
+            this,
+            [ this, change{ std::move( change ) } ]() { applyChange( change ); },
+            Qt::QueuedConnection );
+        } );
+    }
+    catch ( const boost::exception &e )
+    {
+      spdlog::warn( "Media Set Manager not watched: {}", boost::diagnostic_information( e ) );
+    }
+  }
+
   reloadMediaSetModel();
 }
 
@@ -153,7 +179,7 @@ void MediaSetManagerWindow::reloadMediaSetModel()
   {
     // convert media sets to const media sets
     std::ranges::transform(
-      mediaSetManagerV->mediaSets(),
+      *mediaSetManagerV->mediaSetsSnapshot(),
       std::back_inserter( mediaSets ),
       []( const auto &mediaSet )
       {
@@ -164,6 +190,21 @@ void MediaSetManagerWindow::reloadMediaSetModel()
   mediaSetsModelV->mediaSets( std::move( mediaSets ) );
 
   uiV->mediaSets->selectRow( 0 );
+
+  if ( mediaSetManagerWatcherV && mediaSetManagerV )
+  {
+    mediaSetManagerWatcherV->watch( *mediaSetManagerV );
+  }
+}
+
+void MediaSetManagerWindow::mediaSetLoaded( const Arinc665::Media::ConstMediaSetPtr &mediaSet )
+{
+  if ( !mediaSetsModelV )
+  {
+    return;
+  }
+
+  mediaSetsModelV->appendMediaSet( mediaSet );
 }
 
 void MediaSetManagerWindow::viewMediaSet()
@@ -300,4 +341,31 @@ void MediaSetManagerWindow::saveSettings()
   mediaSetManagerV->saveConfiguration();
 }
 
+void MediaSetManagerWindow::applyChange( const Arinc665::Utils::MediaSetManagerWatcher::Change &change )
+{
+  if ( !mediaSetManagerV )
+  {
+    return;
+  }
+
+  try
+  {
+    if ( Arinc665::Utils::MediaSetManagerWatcher::apply( *mediaSetManagerV, change ) )
+    {
+      reloadMediaSetModel();
+
+      uiV->statusbar->showMessage(
+        tr( "Media Set %1 changed on disk" ).arg( QString::fromStdString( change.mediaSetPaths.first.string() ) ),
+        5000 );
+    }
+  }
+  catch ( const boost::exception &e )
+  {
+    spdlog::warn(
+      "Applying change of Media Set '{}' failed: {}",
+      change.mediaSetPaths.first.string(),
+      boost::diagnostic_information( e ) );
+  }
+}
+
 }
@@ -19,6 +19,9 @@
 #include <arinc_665_qt/media/Media.hpp>
 
 #include <arinc_665/utils/Utils.hpp>
+#include <arinc_665/utils/MediaSetManagerWatcher.hpp>
+
+#include <arinc_665/media/Media.hpp>
 
 #include <helper_qt/HelperQt.hpp>
 
@@ -41,6 +44,9 @@ class MediaSetManagerWindow;
  * - Importing Media Sets,
  * - Import Media Set XML Configuration, and
  * - Removing Media Sets.
+ *
+ * The Media Set Manager is watched for modifications by other tools.
+ * Modified media sets are updated without reloading the Media Set Manager.
  **/
 class ARINC_665_QT_EXPORT MediaSetManagerWindow final : public QMainWindow
 {
@@ -63,14 +69,28 @@ class ARINC_665_QT_EXPORT MediaSetManagerWindow final : public QMainWindow
      * @brief Assigns Media Set Manager.
      *
      * Reloads the Media Sets from the Media Set manager and updates the Media Sets Model.
+     * Starts watching the Media Set Manager.
      **/
     void mediaSetManger( Arinc665::Utils::MediaSetManagerPtr mediaSetManager );
 
     /**
      * @brief Reloads the Media Sets from the Media Set manager and updates the Media Sets Model.
+     *
+     * Also updates the watched media sets, as the Media Set Manager might have been modified.
      **/
     void reloadMediaSetModel();
 
+    /**
+     * @brief Appends a loaded Media Set to the Media Sets Model.
+     *
+     * Used during loading of the Media Set Manager to present the media sets incrementally.
+     * The media sets are replaced by the media sets of the Media Set Manager, when it is assigned.
+     *
+     * @param[in] mediaSet
+     *   Loaded Media Set.
+     **/
+    void mediaSetLoaded( const Arinc665::Media::ConstMediaSetPtr &mediaSet );
+
   private slots:
     /**
      * @brief Slot handling View Media Set Clicked.
@@ -108,6 +128,16 @@ class ARINC_665_QT_EXPORT MediaSetManagerWindow final : public QMainWindow
     void saveSettings();
 
   private:
+    /**
+     * @brief Applies a Change detected by the Media Set Manager Watcher.
+     *
+     * Called within the GUI thread.
+     *
+     * @param[in] change
+     *   Detected Change.
+     **/
+    void applyChange( const Arinc665::Utils::MediaSetManagerWatcher::Change &change );
+
     //! UI (designer)
     std::unique_ptr< Ui::MediaSetManagerWindow > uiV;
 
@@ -122,6 +152,8 @@ class ARINC_665_QT_EXPORT MediaSetManagerWindow final : public QMainWindow
     Arinc665::Utils::MediaSetManagerPtr mediaSetManagerV;
     //! Media Set Model
     std::unique_ptr< Media::MediaSetsModel > mediaSetsModelV;
+    //! Media Set Manager Watcher
+    Arinc665::Utils::MediaSetManagerWatcherPtr mediaSetManagerWatcherV;
 };
 
 }
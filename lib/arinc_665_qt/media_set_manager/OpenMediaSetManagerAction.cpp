@@ -58,6 +58,11 @@ OpenMediaSetManagerAction::OpenMediaSetManagerAction(
     &LoadMediaSetManagerAction::mediaSetManagerLoadProgress,
     this,
     &OpenMediaSetManagerAction::mediaSetManagerLoadProgress );
+  connect(
+    loadMediaSetManagerActionV.get(),
+    &LoadMediaSetManagerAction::mediaSetLoaded,
+    this,
+    &OpenMediaSetManagerAction::mediaSetLoaded );
   connect(
     loadMediaSetManagerActionV.get(),
     &LoadMediaSetManagerAction::mediaSetManagerLoaded,
@@ -67,7 +72,12 @@ OpenMediaSetManagerAction::OpenMediaSetManagerAction(
     loadMediaSetManagerActionV.get(),
     &LoadMediaSetManagerAction::failed,
     this,
-    &OpenMediaSetManagerAction::failed );
+    &OpenMediaSetManagerAction::loadFailed );
+  connect(
+    loadMediaSetManagerActionV.get(),
+    &LoadMediaSetManagerAction::cancelled,
+    this,
+    &OpenMediaSetManagerAction::loadCancelled );
 }
 
 OpenMediaSetManagerAction::~OpenMediaSetManagerAction() = default;
@@ -85,6 +95,8 @@ void OpenMediaSetManagerAction::directorySelected()
 
   loadMediaSetManagerActionV->mediaSetDirectory( directory.path().toStdString() );
   loadMediaSetManagerActionV->checkMediaSetIntegrity( settings.value( "CheckIntegrityOnStartup", true ).toBool() );
+  stopSourceV = std::stop_source{};
+  loadMediaSetManagerActionV->stopToken( stopSourceV.get_token() );
 
   settings.setValue( "LastMediaSetManagerDirectory", directory.path() );
 
@@ -114,6 +126,19 @@ void OpenMediaSetManagerAction::directorySelected()
     progressDialogV,
     &QProgressDialog::deleteLater );
 
+  connect(
+    loadMediaSetManagerActionV.get(),
+    &LoadMediaSetManagerAction::cancelled,
+    progressDialogV,
+    &QProgressDialog::deleteLater );
+
+  // request stop - the loader finishes the current file and emits cancelled()
+  connect(
+    progressDialogV,
+    &QProgressDialog::canceled,
+    this,
+    [ this ] { stopSourceV.request_stop(); } );
+
   progressDialogV->show();
 
   // call start asynchronous
@@ -140,4 +165,26 @@ void OpenMediaSetManagerAction::mediaSetManagerLoadProgress(
   }
 }
 
+void OpenMediaSetManagerAction::loadFailed( const QString &errorInformation )
+{
+  progressDialogV = nullptr;
+
+  QMessageBox::critical(
+    nullptr,
+    tr( "Cannot open Media Set Manager" ),
+    QString{ tr(
+      "<b>Media Set Directory:</b><br/><i>%1</i><br/>"
+      "<b>Error:</b><br/><tt>%2</tt>" ) }
+      .arg( selectMediaSetDirectoryDialogV->directory().path(), errorInformation ) );
+
+  emit failed();
+}
+
+void OpenMediaSetManagerAction::loadCancelled()
+{
+  progressDialogV = nullptr;
+
+  emit rejected();
+}
+
 }
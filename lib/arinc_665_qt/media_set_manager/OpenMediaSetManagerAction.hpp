@@ -19,11 +19,14 @@
 
 #include <arinc_665/utils/Utils.hpp>
 
+#include <arinc_665/media/Media.hpp>
+
 #include <QFileDialog>
 #include <QProgressDialog>
 #include <QWidget>
 
 #include <memory>
+#include <stop_token>
 
 namespace Arinc665Qt::MediaSetManager {
 
@@ -32,6 +35,8 @@ namespace Arinc665Qt::MediaSetManager {
  *
  * Asks the User for selecting the Media Set Manager Directory and tries to open it.
  * During loading of the Media Set Manager a progress dialog is shown.
+ * Loading is performed within a worker thread and can be cancelled using the progress dialog.
+ * Loaded media sets are published by @ref mediaSetLoaded() before the whole Media Set Manager is loaded.
  **/
 class ARINC_665_QT_EXPORT OpenMediaSetManagerAction : public QObject
 {
@@ -58,6 +63,14 @@ class ARINC_665_QT_EXPORT OpenMediaSetManagerAction : public QObject
     void open();
 
   signals:
+    /**
+     * @brief Signal emitted, when a Media Set has been loaded.
+     *
+     * @param[in] mediaSet
+     *   Loaded Media Set.
+     **/
+    void mediaSetLoaded( const Arinc665::Media::ConstMediaSetPtr &mediaSet );
+
     /**
      * @brief Signal emitted, when the Media Set Manager is loaded successfully.
      *
@@ -98,6 +111,23 @@ class ARINC_665_QT_EXPORT OpenMediaSetManagerAction : public QObject
       size_t numberOfMediaSets,
       const std::string &partNumber );
 
+    /**
+     * @brief Slot called, when the Media Set Manager could not be loaded.
+     *
+     * Shows the error and emits @ref failed().
+     *
+     * @param[in] errorInformation
+     *   Error Information.
+     **/
+    void loadFailed( const QString &errorInformation );
+
+    /**
+     * @brief Slot called, when loading has been cancelled.
+     *
+     * Emits @ref rejected().
+     **/
+    void loadCancelled();
+
   private:
     //! Select Media Set Manager Directory Dialog
     std::unique_ptr< QFileDialog > selectMediaSetDirectoryDialogV;
@@ -105,6 +135,8 @@ class ARINC_665_QT_EXPORT OpenMediaSetManagerAction : public QObject
     QProgressDialog * progressDialogV{ nullptr };
     //! Load Media Set Action
     std::unique_ptr< LoadMediaSetManagerAction > loadMediaSetManagerActionV;
+    //! Stop Source for Cancellation of Loading
+    std::stop_source stopSourceV;
 };
 
 }
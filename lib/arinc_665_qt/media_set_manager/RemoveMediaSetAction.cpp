@@ -67,7 +67,9 @@ void RemoveMediaSetAction::start(
     auto remover{ Arinc665::Utils::FilesystemMediaSetRemover::create() };
     assert( remover );
 
-    remover->mediaSetPaths( mediaSetPaths );
+    remover
+      ->mediaSetPaths( mediaSetPaths )
+      .payloadStore( mediaSetManager->directory() / Arinc665::Utils::MediaSetManager::PayloadStoreDirectory );
     ( *remover )();
   }
   catch ( const Arinc665::Arinc665Exception &e )
@@ -18,6 +18,8 @@
 
 #include <arinc_665_qt/media/MediaSetModel.hpp>
 
+#include <arinc_665_qt/AsyncOperation.hpp>
+#include <arinc_665_qt/ByteProgressDialog.hpp>
 #include <arinc_665_qt/FilePathMappingModel.hpp>
 
 #include <arinc_665/utils/Arinc665Xml.hpp>
@@ -157,65 +159,80 @@ void MediaSetViewerWindow::checkFileIntegrity( bool checkFileIntegrity )
 
 void MediaSetViewerWindow::startMediaSetDecompilation()
 {
-  try
-  {
-    auto decompiler{ Arinc665::Utils::FilesystemMediaSetDecompiler::create() };
-
-    decompiler
-      ->checkFileIntegrity( checkFileIntegrityV )
-      .mediaPaths( mediaPathsV );
-
-    auto [ mediaSet, checkValues ]{ ( *decompiler )() };
-
-    Arinc665::Utils::FilePathMapping fileMapping{};
-
-    // iterate over all files to add file-mapping
-    for ( const auto &file : mediaSet->recursiveFiles() )
-    {
-      std::filesystem::path filePath(
-        mediaPathsV.at( file->effectiveMediumNumber() )
-        / file->path().relative_path() );
-
-      fileMapping.try_emplace( file, std::move( filePath ) );
-    }
-
-    auto partNumber{ mediaSet->partNumber() };
-
-    // remove all files from watching
-    fileSystemWatcherV->removePaths( fileSystemWatcherV->files() );
-
-    mediaSetModelV->root( std::move( mediaSet ) );
-    filePathMappingModelV->filePathMapping( std::move( fileMapping ) );
-
-    selectSaveMediaSetXmlDialogV->selectFile(
-      HelperQt::toQString( partNumber ) + ".xml" );
-
-    setWindowTitle( HelperQt::toQString( partNumber ) );
+  auto decompiler{ Arinc665::Utils::FilesystemMediaSetDecompiler::create() };
+  auto * const progressDialog{ new ByteProgressDialog{ tr( "Decompiling Media Set" ), this } };
+  progressDialog->open();
 
-    ui->actionSaveMediaSetXml->setEnabled( true );
-  }
-  catch ( const boost::exception &e )
-  {
-    const auto info{ boost::diagnostic_information( e ) };
+  decompiler
+    ->checkFileIntegrity( checkFileIntegrityV )
+    .mediaPaths( mediaPathsV )
+    .byteProgressHandler( progressDialog->progressHandler() )
+    .stopToken( progressDialog->stopToken() );
 
-    QMessageBox::critical(
-      nullptr,
-      tr( "Error during decompilation" ),
-      QString::fromStdString( info ) );
-    return;
-  }
-  catch ( const std::exception &e )
-  {
-    const auto info{ boost::diagnostic_information( e ) };
-
-    QMessageBox::critical(
-      nullptr,
-      tr( "Error during decompilation" ),
-      QString::fromStdString( info ) );
-    return;
-  }
-
-  decompileMediaSetWizardV->restart();
+  AsyncOperation_start(
+    this,
+    [ decompiler = std::move( decompiler ) ] { return ( *decompiler )(); },
+    [ this, progressDialog ]( auto &&result ) {
+      progressDialog->deleteLater();
+
+      try
+      {
+        auto [ mediaSet, checkValues ]{ result() };
+
+        Arinc665::Utils::FilePathMapping fileMapping{};
+
+        // iterate over all files to add file-mapping
+        for ( const auto &file : mediaSet->recursiveFiles() )
+        {
+          std::filesystem::path filePath(
+            mediaPathsV.at( file->effectiveMediumNumber() )
+            / file->path().relative_path() );
+
+          fileMapping.try_emplace( file, std::move( filePath ) );
+        }
+
+        auto partNumber{ mediaSet->partNumber() };
+
+        // remove all files from watching
+        fileSystemWatcherV->removePaths( fileSystemWatcherV->files() );
+
+        mediaSetModelV->root( std::move( mediaSet ) );
+        filePathMappingModelV->filePathMapping( std::move( fileMapping ) );
+
+        selectSaveMediaSetXmlDialogV->selectFile(
+          HelperQt::toQString( partNumber ) + ".xml" );
+
+        setWindowTitle( HelperQt::toQString( partNumber ) );
+
+        ui->actionSaveMediaSetXml->setEnabled( true );
+      }
+      catch ( const Arinc665::OperationCancelled & )
+      {
+        return;
+      }
+      catch ( const boost::exception &e )
+      {
+        const auto info{ boost::diagnostic_information( e ) };
+
+        QMessageBox::critical(
+          nullptr,
+          tr( "Error during decompilation" ),
+          QString::fromStdString( info ) );
+        return;
+      }
+      catch ( const std::exception &e )
+      {
+        const auto info{ boost::diagnostic_information( e ) };
+
+        QMessageBox::critical(
+          nullptr,
+          tr( "Error during decompilation" ),
+          QString::fromStdString( info ) );
+        return;
+      }
+
+      decompileMediaSetWizardV->restart();
+    } );
 }
 
 void MediaSetViewerWindow::loadXmlFile( const QString &file )
@@ -78,6 +78,9 @@ class ARINC_665_QT_EXPORT MediaSetViewerWindow final : public QMainWindow
 
     /**
      * @brief Slot for Media Set Decompilation.
+     *
+     * The media set is decompiled within a worker thread.
+     * The models are updated within the GUI thread, when the decompilation has finished.
      **/
     void startMediaSetDecompilation();
 